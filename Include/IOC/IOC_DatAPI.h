@@ -20,6 +20,79 @@ extern "C" {
  *      THEN: IOC_DatUsageArgs_T in IOC_ConnArgs_T::UsageArgs.pDat
  */
 
+/**
+ * @brief Called when the last reference of a IOC_DatBuf_T is released,
+ *    which means both DatSender and every CbRecvDat_F who got it are done with pData.
+ */
+typedef void (*IOC_CbReleaseDatBuf_F)(void *pData, ULONG_T DataSize, void *pCbPrivData);
+
+/**
+ * @brief Wrap DatSender's own memory into a reference-counted IOC_DatBuf_T, whose reference count is 1.
+ *    DatSender sets it to IOC_DatDesc_T::Payload.pDatBuf with pData pointing into it, then IOC_sendDAT
+ *    delivers pData to the DatReceiver without copying, and DatSender calls IOC_releaseDatBuf after sending.
+ *
+ * @param pData: the memory to wrap, which MUST be valid until CbRelease_F is called
+ * @param DataSize: size of pData (bytes)
+ * @param CbRelease_F: OPTIONAL, called once when the last reference is released, to recycle pData
+ * @param pCbPrivData: private data of CbRelease_F
+ * @param ppDatBuf: the new IOC_DatBuf_T
+ *
+ * @return IOC_RESULT_SUCCESS: pData is wrapped
+ * @return IOC_RESULT_INVALID_PARAM: NULL pData, zero DataSize or NULL ppDatBuf
+ * @return IOC_RESULT_POSIX_ENOMEM: no memory for the IOC_DatBuf_T
+ *
+ * RefUT: UT_DataTypicalZeroCopy
+ */
+IOC_Result_T IOC_wrapDatBuf(void *pData, ULONG_T DataSize, IOC_CbReleaseDatBuf_F CbRelease_F, void *pCbPrivData,
+                            IOC_DatBuf_pT *ppDatBuf);
+
+/**
+ * @brief Add a reference, such as in CbRecvDat_F to keep Payload.pData after CbRecvDat_F returns.
+ */
+IOC_Result_T IOC_holdDatBuf(IOC_DatBuf_pT pDatBuf);
+
+/**
+ * @brief Drop a reference, and call CbRelease_F then free the IOC_DatBuf_T if it's the last one.
+ */
+IOC_Result_T IOC_releaseDatBuf(IOC_DatBuf_pT pDatBuf);
+
+/**
+ * @brief DataSender calls this API to loan a writable buffer from the link's slab pool,
+ *        fills it in place, then calls IOC_commitDAT to send it without IOC copying it.
+ *        Loaned buffers are recycled into the pool after the receiver side is done,
+ *        so steady loaning costs no malloc.
+ *
+ * @param LinkID: the DataSender's link ID
+ * @param DataSize: size of the buffer to loan (bytes)
+ * @param pDatDesc: Payload.pData/PtrDataSize/PtrDataLen/pDatBuf are set to the loaned buffer,
+ *     DataSender may shrink PtrDataSize/PtrDataLen before IOC_commitDAT if it fills less.
+ *
+ * @return IOC_RESULT_SUCCESS: a buffer is loaned
+ * @return IOC_RESULT_INVALID_PARAM: NULL pDatDesc
+ * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
+ * @return IOC_RESULT_INCOMPATIBLE_USAGE: LinkID is not a DataSender
+ * @return IOC_RESULT_ZERO_DATA: zero DataSize
+ * @return IOC_RESULT_DATA_TOO_LARGE: DataSize exceeds maximum allowed size
+ * @return IOC_RESULT_POSIX_ENOMEM: no memory for a new slab
+ *
+ * RefUT: UT_DataTypicalAllocCommit
+ */
+IOC_Result_T IOC_allocDAT(IOC_LinkID_T LinkID, ULONG_T DataSize, IOC_DatDesc_pT pDatDesc);
+
+/**
+ * @brief DataSender calls this API to send a buffer loaned by IOC_allocDAT.
+ *        FIFO delivers the loaned pData to CbRecvDat_F as is, TCP sends it with its header in one syscall.
+ *        IF success, the loan ends and Payload.pData/pDatBuf are cleared.
+ *        ELSE DataSender still owns the loan, to commit again or IOC_releaseDatBuf(Payload.pDatBuf).
+ *
+ * @param pOption: same as IOC_sendDAT
+ *
+ * @return same as IOC_sendDAT, and IOC_RESULT_INVALID_PARAM if Payload.pDatBuf is NULL
+ *
+ * RefUT: UT_DataTypicalAllocCommit
+ */
+IOC_Result_T IOC_commitDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Options_pT pOption);
+
 /**
  * @brief Send data chunk on the specified link
  *        DataSender calls this API to send data chunk to DataReceiver asynchronously
@@ -28,23 +101,48 @@ extern "C" {
  * @param LinkID: the link ID between DataSender and DataReceiver
  *     RefMore: README_ArchDesign::Object::Link
  * @param pDatDesc: the data description. IOC will COPY-IN data payload for reliability
+ *     IF Payload.pDatBuf is set, IOC holds it instead of copying pData, RefMore: IOC_wrapDatBuf
  *     RefMore: README_ArchDesign::Concept::MSG::DAT
  * @param pOption: the options for this sendDAT
  *     Supported options: IOC_OPTID_TIMEOUT, IOC_OPTID_BLOCKING_MODE
+ *       IOC_OPTID_DAT_COMPLETION: complete this send by Payload.DatCompletion.CbDatCompleted_F,
+ *         or by queuing it for IOC_pollDatCompletions if NULL, once DatReceiver consumed the data.
  *     Note: RELIABILITY_MODE is always NODROP (immutable for stream consistency)
  *
  * @return IOC_RESULT_SUCCESS: data chunk queued for transmission successfully
- * @return IOC_RESULT_INVALID_PARAM: invalid parameters (NULL pDatDesc)
+ * @return IOC_RESULT_INVALID_PARAM: invalid parameters (NULL pDatDesc, pData out of Payload.pDatBuf)
  * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
  * @return IOC_RESULT_DATA_TOO_LARGE: data chunk exceeds maximum allowed size
- * @return IOC_RESULT_BUFFER_FULL: IOC buffer is full (when immediate NONBLOCK mode)
+ * @return IOC_RESULT_BUFFER_FULL: DatReceiver's credits are used up (when immediate NONBLOCK mode)
+ *     RefMore: IOC_SrvTypes.h::IOC_DatUsageArgs_T::Credit
  * @return IOC_RESULT_TIMEOUT: data transmission timeout (when NONBLOCK mode with timeout)
  * @return IOC_RESULT_LINK_BROKEN: communication link is broken during transmission
+ * @return IOC_RESULT_POSIX_ENOMEM: no memory to queue the data chunk to DatReceiver's callback, nothing was sent
  *
  * RefUT: UT_ConetDatSendXXX
  */
 IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Options_pT pOption);
 
+/**
+ * @brief Send ONE data chunk made of DatVecNum segments on the specified link, in segment order,
+ *        so DataSender sends a header and a body in separate buffers without concatenating them,
+ *        and DataReceiver gets them as one chunk, same as IOC_sendDAT of the concatenated buffer.
+ *
+ * @param LinkID: same as IOC_sendDAT
+ * @param pDatVecs: pData and DataLen of each segment, IOC will COPY-IN them, a zero DataLen segment is skipped
+ * @param DatVecNum: number of pDatVecs, up to IOC_DATVEC_MAX_NUM
+ * @param pOption: same as IOC_sendDAT
+ *
+ * @return IOC_RESULT_INVALID_PARAM: NULL pDatVecs, zero or too many DatVecNum, NULL pData of a segment
+ * @return IOC_RESULT_ZERO_DATA: all segments are zero DataLen
+ * @return IOC_RESULT_DATA_TOO_LARGE: the sum of DataLen exceeds maximum allowed size
+ * @return others: same as IOC_sendDAT
+ *
+ * RefUT: UT_DataTypicalSendVec
+ */
+IOC_Result_T IOC_sendDATv(IOC_LinkID_T LinkID, const IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                          IOC_Options_pT pOption);
+
 /**
  * @brief Receive data chunk on the specified link (polling mode)
  *        DataReceiver calls this API to actively wait for data chunks when using polling mode
@@ -60,30 +158,143 @@ IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
  * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
  * @return IOC_RESULT_TIMEOUT: receive timeout (when timeout configured)
  * @return IOC_RESULT_LINK_BROKEN: communication link is broken
+ * @return IOC_RESULT_BUSY: an IOC_peekDATv of this link is not ended by IOC_consumeDAT yet
  *
  * RefUT: UT_ConetDatRecvPollingXXX
  */
 IOC_Result_T IOC_recvDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Options_pT pOption);
 
+/**
+ * @brief Receive many data chunks on the specified link (polling mode) with their boundaries kept,
+ *        one whole chunk into each pDatVecs[i], so DataReceiver does NOT need to re-frame the byte stream.
+ *        It only waits for the first chunk, then takes the chunks already received until pDatVecs are used up,
+ *        or the next chunk is larger than its pDatVecs[i].DataSize, which is kept for next receiving.
+ *        A chunk partially received by IOC_recvDAT counts as its remaining bytes.
+ *
+ * @param LinkID: the link ID to receive data from
+ * @param pDatVecs: pData and DataSize are prepared by DataReceiver, DataLen is set to each chunk's length
+ * @param DatVecNum: number of pDatVecs
+ * @param pRecvDatNum: number of chunks received into pDatVecs[0, *pRecvDatNum)
+ * @param pOption: same as IOC_recvDAT
+ *
+ * @return IOC_RESULT_SUCCESS: at least one chunk is received
+ * @return IOC_RESULT_BUFFER_TOO_SMALL: the first chunk is larger than pDatVecs[0].DataSize,
+ *     whose length is set to pDatVecs[0].DataLen, and it's kept for next receiving
+ * @return IOC_RESULT_INVALID_PARAM: NULL pDatVecs or pRecvDatNum, or zero DatVecNum
+ * @return IOC_RESULT_INCOMPATIBLE_USAGE: LinkID is not a DatReceiver
+ * @return IOC_RESULT_NOT_SUPPORT: LinkID receives data by CbRecvDat_F, not polling
+ * @return others: same as IOC_recvDAT
+ *
+ * RefUT: UT_DataTypicalRecvVec
+ */
+IOC_Result_T IOC_recvDATv(IOC_LinkID_T LinkID, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pRecvDatNum,
+                          IOC_Options_pT pOption);
+
+/**
+ * @brief Same as IOC_recvDATv, but point each pDatVecs[i].pData at a chunk in IOC's polling buffer without copying,
+ *        then DataReceiver MUST call IOC_consumeDAT in the same thread after it's done with them.
+ *        Until then the peek is pending, and any IOC_recvDAT/IOC_recvDATv/IOC_peekDATv of the same link,
+ *        even from the peeking thread, returns IOC_RESULT_BUSY instead of waiting.
+ *        IOC_closeLink drops a pending peek, then its pDatVecs[i].pData MUST NOT be accessed anymore.
+ *
+ * @param pDatVecs: pData and DataLen are set to each chunk, which is READ ONLY until IOC_consumeDAT
+ * @param pPeekDatNum: number of chunks peeked into pDatVecs[0, *pPeekDatNum)
+ *
+ * @return same as IOC_recvDATv, except IOC_RESULT_BUFFER_TOO_SMALL
+ *
+ * RefUT: UT_DataTypicalRecvVec
+ */
+IOC_Result_T IOC_peekDATv(IOC_LinkID_T LinkID, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pPeekDatNum,
+                          IOC_Options_pT pOption);
+
+/**
+ * @brief End the last IOC_peekDATv by consuming its first ConsumeDatNum chunks,
+ *        the other peeked chunks are kept for next receiving, so 0 means consume nothing.
+ *
+ * @return IOC_RESULT_SUCCESS: the chunks are consumed and their space is reused
+ * @return IOC_RESULT_INVALID_PARAM: no IOC_peekDATv to end, it's peeked by another thread,
+ *                                   or ConsumeDatNum > *pPeekDatNum, which keeps peeking
+ * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
+ *
+ * RefUT: UT_DataTypicalRecvVec
+ */
+IOC_Result_T IOC_consumeDAT(IOC_LinkID_T LinkID, ULONG_T ConsumeDatNum);
+
 /**
  * @brief Force transmission of buffered data on the specified link
  *        DataSender calls this API to ensure immediate delivery of buffered data chunks
  *        This is the ONLY explicit control operation needed for data streaming
+ *      It's a drain barrier: it returns once every data chunk sent before it is delivered to DatReceiver,
+ *        i.e. returned from its CbRecvDat_F or stored in its polling buffer for IOC_recvDAT,
+ *        so DatSender MAY pipeline many async IOC_sendDAT and synchronize once by IOC_flushDAT.
+ *      Called from a CbRecvDat_F, it doesn't wait, so circular send chains never deadlock.
  *
  * @param LinkID: the link ID to flush buffered data
  * @param pOption: the options for this flushDAT
- *     Supported options: IOC_OPTID_TIMEOUT
+ *     Supported options: IOC_OPTID_TIMEOUT, wait infinitely by default
  *
- * @return IOC_RESULT_SUCCESS: buffered data flushed successfully
+ * @return IOC_RESULT_SUCCESS: data sent before it is delivered
  * @return IOC_RESULT_INVALID_PARAM: invalid parameters
  * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
- * @return IOC_RESULT_TIMEOUT: flush timeout
+ * @return IOC_RESULT_TIMEOUT: flush timeout, data sent before it is not delivered yet
  * @return IOC_RESULT_LINK_BROKEN: communication link is broken
  *
- * RefUT: UT_ConetDatFlushXXX
+ * RefUT: UT_ConetDatFlushXXX, UT_DataTypicalFlush
  */
 IOC_Result_T IOC_flushDAT(IOC_LinkID_T LinkID, IOC_Options_pT pOption);
 
+/**
+ * @brief DataSender calls this API to get completions of its sends with IOC_OPTID_DAT_COMPLETION
+ *        and a NULL Payload.DatCompletion.CbDatCompleted_F, in their completion order, many at once.
+ *
+ * @param LinkID: the DataSender's link ID
+ * @param pCompletions: array of MaxNum completions to fill
+ * @param MaxNum: max number of completions to get
+ * @param pCompletionNum: number of completions got
+ * @param pOption: the options for this pollDatCompletions
+ *     Supported options: IOC_OPTID_TIMEOUT to wait for the first completion, wait infinitely by default
+ *
+ * @return IOC_RESULT_SUCCESS: at least one completion is got
+ * @return IOC_RESULT_INVALID_PARAM: NULL pCompletions or pCompletionNum, or zero MaxNum
+ * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
+ * @return IOC_RESULT_INCOMPATIBLE_USAGE: LinkID is not a DataSender
+ * @return IOC_RESULT_NO_DATA: no completion yet (when immediate NONBLOCK mode)
+ * @return IOC_RESULT_TIMEOUT: no completion within the timeout
+ * @return IOC_RESULT_POSIX_ENOMEM: no memory for the link's completion queue
+ *
+ * RefUT: UT_DataTypicalSendCompletion
+ */
+IOC_Result_T IOC_pollDatCompletions(IOC_LinkID_T LinkID, IOC_DatCompletion_pT pCompletions, ULONG_T MaxNum,
+                                    ULONG_T *pCompletionNum, IOC_Options_pT pOption);
+
+typedef struct {
+    ULONG_T Capacity;  // Credit.MaxDatNum, DatSenders wait for credits beyond this, except those from a CbRecvDat_F
+
+    ULONG_T QueuedDatNum;      // data chunks waiting for CbRecvDat_F now
+    ULONG_T HighWatermark;     // max QueuedDatNum since the link is established
+    ULONG_T DispatchedDatNum;  // data chunks delivered to CbRecvDat_F by the dispatcher
+    ULONG_T BlockedDatNum;     // sends which waited for credits
+    ULONG_T OverflowDatNum;    // sends from a CbRecvDat_F queued beyond Capacity, to never deadlock a send chain
+
+    ULONG_T DispatchedBatchNum;  // batches delivered, DispatchedDatNum / DispatchedBatchNum is the mean batch size
+    ULONG_T TargetBatchDatNum;   // batch size waited for now, adapted to the callback cost if Batch.MaxDelayUS > 0
+} IOC_DatDispatchStats_T, *IOC_DatDispatchStats_pT;
+
+/**
+ * @brief DataReceiver calls this API to query counters of the queue which delivers data to its CbRecvDat_F.
+ *
+ * @param LinkID: the DataReceiver's link ID
+ * @param pDispatchStats: the counters of this link's dispatch queue
+ *
+ * @return IOC_RESULT_SUCCESS: counters are copied to pDispatchStats
+ * @return IOC_RESULT_INVALID_PARAM: invalid parameters (NULL pDispatchStats)
+ * @return IOC_RESULT_NOT_EXIST_LINK: LinkID does not exist or already closed
+ * @return IOC_RESULT_NOT_SUPPORT: the link's protocol dispatches data without a queue, such as TCP
+ *
+ * RefUT: UT_DataPerformanceUS1
+ */
+IOC_Result_T IOC_getDatDispatchStats(IOC_LinkID_T LinkID, IOC_DatDispatchStats_pT pDispatchStats);
+
 // TODO: IOC_cancelDAT(IOC_LinkID_T LinkID, ...)
 
 #ifdef __cplusplus
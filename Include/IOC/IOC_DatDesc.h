@@ -7,6 +7,13 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Reference-counted payload buffer, so DatSender can hand over big data chunks (e.g. camera frames)
+ *    to IOC_sendDAT without IOC copying them.
+ *    RefMore: IOC_wrapDatBuf, IOC_holdDatBuf, IOC_releaseDatBuf in IOC_DatAPI.h
+ */
+typedef struct IOC_DatBufStru IOC_DatBuf_T, *IOC_DatBuf_pT;
+
 /**
  * @brief Data payload structure for stream data chunks
  *     IF EmbDataSize > 0, then EmbData[] is used to store the data.
@@ -25,10 +32,31 @@ typedef struct {
     ULONG_T PtrDataLen;  // asDatSender: length of data in pData (bytes) to send
                          // asDatReceiver: length of data received in pData (bytes)
 
+    IOC_DatBuf_pT pDatBuf;  // OPTIONAL, NULL means IOC copies pData when it needs to keep it.
+    // asDatSender: pData points into pDatBuf, IOC holds pDatBuf instead of copying pData.
+    // asDatReceiver: IOC_holdDatBuf in CbRecvDat_F to keep pData after CbRecvDat_F returns,
+    //  NULL if pData is only valid inside CbRecvDat_F, such as smaller data TCP received in place.
+
     ULONG_T EmdDataLen;   // Actual length of data in EmbData (bytes)
     ULONG_T EmdData[16];  // Embedded data array for small chunks (64 bytes on 64-bit systems)
 } IOC_DatPayload_T, *IOC_DatPayload_pT;
 
+/**
+ * @brief One data segment in a vector of them, like struct iovec,
+ *    so DataSender sends ONE chunk of many segments by IOC_sendDATv without concatenating them,
+ *    and DataReceiver gets many chunks by one IOC_recvDATv/IOC_peekDATv with their boundaries kept.
+ */
+typedef struct {
+    void *pData;  // IOC_sendDATv: prepared by DataSender as one segment of the chunk
+                  // IOC_recvDATv: prepared by DataReceiver to copy a chunk into
+                  // IOC_peekDATv: set by IOC to point at a chunk in IOC's buffer, READ ONLY
+
+    ULONG_T DataSize;  // IOC_recvDATv: size of pData (bytes), others: unused
+    ULONG_T DataLen;   // length of the segment or chunk in pData (bytes)
+} IOC_DatVec_T, *IOC_DatVec_pT;
+
+#define IOC_DATVEC_MAX_NUM 64  // max segments of one IOC_sendDATv
+
 /**
  * @brief Data description structure for stream-based data transfer
  *        Contains all information about a data chunk including metadata and payload
@@ -8,6 +8,32 @@ extern "C" {
 #endif
 
 typedef IOC_Result_T (*IOC_CbProcEvt_F)(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv);
+
+typedef enum {
+    IOC_SUBEVT_FLAG_NONE = 0,
+    /**
+     * @brief ConlesMode only: CbProcEvt_F is called by a bounded worker pool shared by all AutoLinks,
+     *    instead of the AutoLink's EvtProcThread, so a slow EvtConsumer won't delay other EvtConsumers.
+     *  CbProcEvt_F of one EvtConsumer is still called one by one in posting order,
+     *    while CbProcEvt_F of different EvtConsumers may be called in parallel.
+     *  SYNC_MODE postEVT to the same AutoLink is FORBIDDEN inside such CbProcEvt_F.
+     */
+    IOC_SUBEVT_FLAG_WORKER_POOL = 1 << 0,
+} IOC_SubEvtFlags_T;
+
+/**
+ * @brief ConlesMode only: what EvtProcThread does when an EvtConsumer's mailbox is full.
+ *    RefMore: IOC_SubEvtArgs_T::MailboxCapacity
+ */
+typedef enum {
+    IOC_EVT_OVERFLOW_BLOCK = 0,         // nothing is lost, the AutoLink's postEVTs of its EvtIDs are pushed back as if
+                                        //   the EvtDescQueue is full until it has space, other EvtConsumers keep going
+    IOC_EVT_OVERFLOW_DROP_OLDEST,       // drop the oldest queued event, then queue the new one
+    IOC_EVT_OVERFLOW_DROP_NEWEST,       // drop the new event
+    IOC_EVT_OVERFLOW_COALESCE_BY_EVTID, // merge queued events of the same EvtID into the first one with the newest
+                                        //   value, and BLOCK if no EvtID is mergeable
+} IOC_EvtOverflowPolicy_T;
+
 typedef struct {
     /**
      * @brief CbProcEvt_F + pCbPrivData is used to IDENTIFY one EvtConsumer.
@@ -19,6 +45,17 @@ typedef struct {
     ULONG_T EvtNum;        // number of EvtIDs, IOC_calcArrayElmtCnt(SubEvtIDs)
     IOC_EvtID_T *pEvtIDs;  // EvtIDs to subscribe
 
+    IOC_SubEvtFlags_T Flags;  // IOC_SUBEVT_FLAG_*, default IOC_SUBEVT_FLAG_NONE
+
+    /**
+     * @brief ConlesMode only: this EvtConsumer's own bounded mailbox, so a slow or lossy EvtConsumer
+     *    won't stall others, a full one of IOC_EVT_OVERFLOW_BLOCK only pushes back postEVTs of its EvtIDs.
+     *  They only take effect with IOC_SUBEVT_FLAG_WORKER_POOL, and are ignored without it.
+     *    RefMore: IOC_getEvtMailboxStats
+     */
+    ULONG_T MailboxCapacity;                 // 0 means default, rounded up to power of two
+    IOC_EvtOverflowPolicy_T OverflowPolicy;  // default IOC_EVT_OVERFLOW_BLOCK
+
     // TODO: AutoLinkID
 } IOC_SubEvtArgs_T, *IOC_SubEvtArgs_pT;
 
@@ -30,6 +67,18 @@ typedef struct {
     };
 } IOC_UnsubEvtArgs_T, *IOC_UnsubEvtArgs_pT;
 
+typedef struct {
+    ULONG_T Capacity;  // rounded up to power of two
+    IOC_EvtOverflowPolicy_T OverflowPolicy;
+
+    ULONG_T QueuedEvtNum;     // events in the mailbox now
+    ULONG_T HighWatermark;    // max QueuedEvtNum since subEVT
+    ULONG_T DroppedEvtNum;    // dropped by IOC_EVT_OVERFLOW_DROP_OLDEST/DROP_NEWEST
+    ULONG_T CoalescedEvtNum;  // merged into another event by IOC_EVT_OVERFLOW_COALESCE_BY_EVTID
+    ULONG_T BlockedEvtNum;    // events kept in backlog by IOC_EVT_OVERFLOW_BLOCK since the mailbox was full
+    ULONG_T BackloggedEvtNum; // events in backlog now, moved into the mailbox in order once it has space
+} IOC_EvtMailboxStats_T, *IOC_EvtMailboxStats_pT;
+
 /**
  * @brief EvtProducer call this API to post an event to the LinkID,
  *  IOC will deliver this event to the corresponding EvtConsumer,
@@ -39,10 +88,13 @@ typedef struct {
  *     RefMore: README_ArchDesign::Object::Link
  * @param pEvtDesc: the event description. IOC will COPY-OUT this event description if return
  * SUCCESS. RefMore: README_ArchDesign::Concept::MSG::EVT
+ *     pEvtDesc->Priority selects the lane of IOC's queue in ConlesMode, RefMore: IOC_EvtPriority_T
+ *       a Priority out of IOC_EvtPriority_T is treated and delivered as IOC_EVT_PRIORITY_NORMAL.
  * @param pOption: the options for this postEVT.
- *     Supported options: IOC_OPTID_TIMEOUT, IOC_OPTID_SYNC_MODE.
+ *     Supported options: IOC_OPTID_TIMEOUT, IOC_OPTID_SYNC_MODE, IOC_OPTID_CONFLATE.
  *
  * @return IOC_RESULT_SUCCESS: postEVT successfully.
+ * @return IOC_RESULT_INVALID_PARAM: pEvtDesc is NULL.
  * @return IOC_RESULT_NO_EVENT_CONSUMER: no EvtConsumer for this event.
  *      RefUT: UT_ConlesEventMisuse.Case01_verifyNoEvtConsumer_byNotSubEvtButPostEvtDirectly
  * @return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC: too many event description in IOC's queue.
@@ -61,6 +113,38 @@ IOC_Result_T IOC_postEVT(
 
 #define IOC_postEVT_inConlesMode(pEvtDesc, pOption) IOC_postEVT(IOC_CONLES_MODE_AUTO_LINK_ID, pEvtDesc, pOption)
 
+/**
+ * @brief EvtProducer call this API to post a burst of events to the LinkID at once,
+ *  which is same as call IOC_postEVT for each event in order, but much cheaper for many small events.
+ *
+ * @param LinkID: the link ID between EvtProducer and EvtConsumer.
+ * @param pEvtDescs: the event description array, IOC will COPY-OUT all of them if return SUCCESS.
+ *     Each event's SeqID and TimeStamp are set by IOC, SeqIDs of one burst are continuous.
+ * @param EvtDescNum: number of events in pEvtDescs.
+ *     In ConlesMode, the burst is split by lane of each Priority, events of one lane are still in posted order.
+ * @param pOption: same as IOC_postEVT.
+ *
+ * @return IOC_RESULT_SUCCESS: all events are posted.
+ * @return IOC_RESULT_INVALID_PARAM: pEvtDescs is NULL or EvtDescNum is 0.
+ * @return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC: no space for a lane's events in IOC's queue,
+ *      or events of a lane are more than DepthEvtDescQueue of IOC_getCapability.
+ * @return IOC_RESULT_XXX: same as IOC_postEVT.
+ *
+ * @note In ConlesMode's ASyncMode, events of each lane are queued by one reservation, all or nothing,
+ *       from the highest lane, so on TOO_MANY_QUEUING_EVTDESC or TIMEOUT higher lanes may be already queued.
+ *       In ConlesMode's SyncMode, all events are callbacked in order in the caller's thread.
+ *       In ConetMode, events are posted one by one in order, and it stops at the first failure.
+ * @note This API is thread-safe.
+ */
+IOC_Result_T IOC_postEVTs(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
+    /*ARG_IN_OPTIONAL*/ IOC_Options_pT pOption);
+
+#define IOC_postEVTs_inConlesMode(pEvtDescs, EvtDescNum, pOption) \
+    IOC_postEVTs(IOC_CONLES_MODE_AUTO_LINK_ID, pEvtDescs, EvtDescNum, pOption)
+
 IOC_Result_T IOC_broadcastEVT(
     /*ARG_IN*/ IOC_SrvID_T SrvID,
     /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
@@ -126,6 +210,28 @@ IOC_Result_T IOC_unsubEVT(
 
 #define IOC_unsubEVT_inConlesMode(pUnsubEvtArgs) IOC_unsubEVT(IOC_CONLES_MODE_AUTO_LINK_ID, pUnsubEvtArgs)
 
+/**
+ * @brief EvtConsumer call this API to query counters of its own mailbox.
+ *
+ * @param LinkID: the AutoLinkID in ConlesMode which the EvtConsumer subscribed on.
+ * @param pSuberArgs: CbProcEvt_F + pCbPrivData to identify the EvtConsumer, same as IOC_unsubEVT.
+ * @param pMailboxStats: the counters of the EvtConsumer's mailbox.
+ *
+ * @return IOC_RESULT_SUCCESS: counters are copied to pMailboxStats.
+ * @return IOC_RESULT_INVALID_PARAM: pSuberArgs or pMailboxStats is NULL.
+ * @return IOC_RESULT_NO_EVENT_CONSUMER: no such EvtConsumer on the LinkID.
+ * @return IOC_RESULT_NOT_SUPPORT: the EvtConsumer has no mailbox, or LinkID is not in ConlesMode.
+ *
+ * @note Counters are updated without lock, so they're a snapshot and may be changed at once.
+ */
+IOC_Result_T IOC_getEvtMailboxStats(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pSuberArgs,
+    /*ARG_OUT*/ IOC_EvtMailboxStats_pT pMailboxStats);
+
+#define IOC_getEvtMailboxStats_inConlesMode(pSuberArgs, pMailboxStats) \
+    IOC_getEvtMailboxStats(IOC_CONLES_MODE_AUTO_LINK_ID, pSuberArgs, pMailboxStats)
+
 /**
  * @brief force IOC to process the event immediately.
  *  when return from this API, all pending events will be processed.
@@ -8,6 +8,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Priority of an event, which selects the lane of EvtDescQueue in ConlesMode,
+ *    EvtProcThread drains higher lanes first, while lower lanes are still served after being skipped a while,
+ *    so an URGENT event such as shutdown or fault never waits behind lots of NORMAL events such as telemetry.
+ *  Events of different priorities are NOT in posted order, events of the same priority are.
+ *  A Priority out of this enum is treated as IOC_EVT_PRIORITY_NORMAL by postEVT.
+ */
+typedef enum {
+    IOC_EVT_PRIORITY_NORMAL = 0,  // default
+    IOC_EVT_PRIORITY_HIGH = 1,
+    IOC_EVT_PRIORITY_URGENT = 2,
+} IOC_EvtPriority_T;
+
 typedef struct {
     // MsgCommon
     IOC_MsgDesc_T MsgDesc;
@@ -15,6 +28,7 @@ typedef struct {
     // EvtSpecific
     IOC_EvtID_T EvtID;
     ULONG_T EvtValue;
+    IOC_EvtPriority_T Priority;
 
     // TOOD(@W): +More..., such as EvtPayload
 } IOC_EvtDesc_T, *IOC_EvtDesc_pT;
@@ -22,6 +36,7 @@ typedef struct {
 static inline ULONG_T IOC_EvtDesc_getSeqID(IOC_EvtDesc_pT pEvtDesc) { return pEvtDesc->MsgDesc.SeqID; }
 static inline IOC_EvtID_T IOC_EvtDesc_getEvtID(IOC_EvtDesc_pT pEvtDesc) { return pEvtDesc->EvtID; }
 static inline ULONG_T IOC_EvtDesc_getEvtValue(IOC_EvtDesc_pT pEvtDesc) { return pEvtDesc->EvtValue; }
+static inline IOC_EvtPriority_T IOC_EvtDesc_getPriority(IOC_EvtDesc_pT pEvtDesc) { return pEvtDesc->Priority; }
 
 static inline const char *IOC_EvtDesc_getEvtClassStr(IOC_EvtDesc_pT pEvtDesc) {
     IOC_EvtID_T EvtID = IOC_EvtDesc_getEvtID(pEvtDesc);
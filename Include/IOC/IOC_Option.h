@@ -11,6 +11,11 @@ typedef enum {
     IOC_OPTID_TIMEOUT = 1 << 0,    // set this IDs and Payload.TimeoutUS>=0, to set timeout for
                                    // execCMD,waitCMD,sendDAT,recvDAT,...
     IOC_OPTID_SYNC_MODE = 1 << 1,  // set this IDs and Payload.RZVD=0, to set SYNC mode for postEVT.
+    IOC_OPTID_CONFLATE = 1 << 2,   // set this IDs for ASYNC postEVT, no Payload, to replace the value of the pending
+                                   //   EvtDesc of the same EvtID which is also posted with this IDs, instead of
+                                   //   queuing a new one, so only the latest value of each EvtID is delivered.
+    IOC_OPTID_DAT_COMPLETION = 1 << 3,  // set this IDs and Payload.DatCompletion for sendDAT, to get its completion
+                                        //   once DatReceiver consumed the data, RefMore: IOC_DatCompletion_T
                                    // TODO(@W): +More...
 } IOC_OptionsID_T;
 
@@ -23,12 +28,38 @@ typedef enum {
 #define IOC_TIMEOUT_MAX 86400000000  // 24-Hours 24*60*60*1000ms*1000us
 #endif                               // CONFIG_BUILD_WITH_UNIT_TESTING
 
+/**
+ * @brief Completion of ONE data chunk sent with IOC_OPTID_DAT_COMPLETION, after DatReceiver consumed it,
+ *    so DatSender MAY keep many sends in flight and recycle each one's buffer once it's completed.
+ *    Only a send which returned IOC_RESULT_SUCCESS is completed, exactly once.
+ */
+typedef struct {
+    ULONG_T Tag;          // Payload.DatCompletion.Tag of its send, such as the index of DatSender's buffer
+    IOC_Result_T Result;  // returned by the receiver's CbRecvDat_F, IOC_RESULT_SUCCESS if stored for IOC_recvDAT,
+                          //   or IOC_RESULT_LINK_BROKEN if dropped by closeLink
+    ULONG_T DataSize;
+} IOC_DatCompletion_T, *IOC_DatCompletion_pT;
+
+/**
+ * @brief Called once per send with IOC_OPTID_DAT_COMPLETION, from the thread which got the receiver's result,
+ *    such as the DatReceiver's dispatcher(FIFO) or DatSender's receiver thread(TCP), so it MUST NOT block.
+ */
+typedef void (*IOC_CbDatCompleted_F)(IOC_LinkID_T LinkID, const IOC_DatCompletion_pT pCompletion, void *pCbPrivData);
+
 typedef struct {
     IOC_OptionsID_T IDs;
 
     union {
         uint64_t RZVD[8];  // reserve for MAX payload size.
         ULONG_T TimeoutUS;
+
+        // TimeoutUS is first to be the same Payload.TimeoutUS, when IDs also has IOC_OPTID_TIMEOUT
+        struct {
+            ULONG_T TimeoutUS;
+            ULONG_T Tag;                            // copied to IOC_DatCompletion_T::Tag
+            IOC_CbDatCompleted_F CbDatCompleted_F;  // NULL to queue it for IOC_pollDatCompletions of the link
+            void *pCbPrivData;
+        } DatCompletion;
     } Payload;
 
 } IOC_Options_T, *IOC_Options_pT;
@@ -50,6 +81,13 @@ static inline IOC_BoolResult_T IOC_Option_isSyncMode(IOC_Options_pT pOption) {
                                            : IOC_RESULT_YES;
 }
 
+static inline IOC_BoolResult_T IOC_Option_isConflateMode(IOC_Options_pT pOption) {
+    if (pOption && (pOption->IDs & IOC_OPTID_CONFLATE)) {
+        return IOC_RESULT_YES;
+    }
+    return IOC_RESULT_NO;
+}
+
 static inline IOC_BoolResult_T IOC_Option_isNonBlockMode(IOC_Options_pT pOption) {
     IOC_BoolResult_T IsNonBlockMode = IOC_RESULT_NO;  // Default is BlockMode
     if (pOption) {
@@ -82,6 +120,18 @@ static inline IOC_BoolResult_T IOC_Option_isNonBlockMode(IOC_Options_pT pOption)
 #define IOC_Option_defineASyncMayBlock(OptVarName) IOC_Options_T OptVarName = {};
 #define IOC_Option_defineASyncMode IOC_Option_defineASyncMayBlock
 
+#define IOC_Option_defineASyncConflate(OptVarName) \
+    IOC_Options_T OptVarName = {};                 \
+    OptVarName.IDs = IOC_OPTID_CONFLATE;
+
+// DAT_COMPLETION: ArgCbDatCompleted_F MAY be NULL, to queue completions for IOC_pollDatCompletions,
+//  set OptVarName.Payload.DatCompletion.Tag before each sendDAT to tell its completion.
+#define IOC_Option_defineDatCompletion(OptVarName, ArgCbDatCompleted_F, ArgCbPrivData) \
+    IOC_Options_T OptVarName = {};                                                   \
+    OptVarName.IDs = IOC_OPTID_DAT_COMPLETION;                                       \
+    OptVarName.Payload.DatCompletion.CbDatCompleted_F = ArgCbDatCompleted_F;         \
+    OptVarName.Payload.DatCompletion.pCbPrivData = ArgCbPrivData;
+
 // NONBLOCK: ArgTimeoutUS MUST == 0, means NonBlock mode
 #define IOC_Option_defineSyncNonBlock(OptVarName)                                \
     IOC_Options_T OptVarName = {};                                               \
@@ -68,6 +68,22 @@ typedef IOC_Result_T (*IOC_CbExecCmd_F)(IOC_LinkID_T LinkID, IOC_CmdDesc_pT pCmd
  */
 typedef IOC_Result_T (*IOC_CbRecvDat_F)(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDataDesc, void *pCbPriv);
 
+/**
+ * @brief Data batch reception callback function type
+ *        This callback is invoked with a batch of data chunks in send order, each chunk keeps its own boundary.
+ *        The batch is ONLY valid inside the callback, hold pDataDescs[i].Payload.pDatBuf to keep zero-copy data.
+ *
+ * @param LinkID: the link ID where the data was received
+ * @param pDataDescs: array of DatDescNum data descriptions
+ * @param DatDescNum: number of data chunks in this batch, always > 0
+ * @param pCbPriv: callback private context data
+ *
+ * @return IOC_RESULT_SUCCESS: data processed successfully
+ * @return Other IOC_Result_T values: data processing failed with specific error
+ */
+typedef IOC_Result_T (*IOC_CbRecvDatBatch_F)(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDataDescs, ULONG_T DatDescNum,
+                                             void *pCbPriv);
+
 /**
  * @brief Service-level callback for new auto-accepted client links
  *        Invoked when IOC_SRVFLAG_AUTO_ACCEPT is enabled and a new client is accepted.
@@ -75,6 +91,20 @@ typedef IOC_Result_T (*IOC_CbRecvDat_F)(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDat
  */
 typedef void (*IOC_CbOnAutoAccepted_F)(IOC_SrvID_T SrvID, IOC_LinkID_T NewLinkID, void *pSrvPriv);
 
+/**
+ * @brief How a link's sender coalesces small messages into fewer writes, by protocols over a stream(TCP),
+ *        used in IOC_EvtUsageArgs_T by EvtProducer and IOC_DatUsageArgs_T by DatSender, ignored by others.
+ *        By default each message is written at once, in one write of its header and payload.
+ *  IF: MaxDelayUS > 0,
+ *  THEN: ASYNC posted events or sent data wait at most MaxDelayUS to be written together with later ones,
+ *        or less once they reach MaxBytes, or once IOC_flushDAT, a SYNC posted event or any other message
+ *        is written, which takes them along ahead of it, so messages are never reordered.
+ */
+typedef struct {
+    ULONG_T MaxDelayUS;  // 0 means write each message at once
+    ULONG_T MaxBytes;    // 0 means 16KB, a larger message is written at once
+} IOC_CoalesceArgs_T, *IOC_CoalesceArgs_pT;
+
 /**
  * @brief Event usage arguments for IOC framework
  *        Contains all event-related parameters and configurations
@@ -89,6 +119,9 @@ typedef struct {
     ULONG_T EvtNum;        // Number of EvtIDs to subscribe/produce
     IOC_EvtID_T *pEvtIDs;  // Array of EvtIDs to subscribe/produce
 
+    // Coalescing of ASYNC posted events into fewer writes by EvtProducer, see IOC_CoalesceArgs_T
+    IOC_CoalesceArgs_T Coalesce;
+
     // TODO:Reserved;
 } IOC_EvtUsageArgs_T, *IOC_EvtUsageArgs_pT;
 
@@ -119,6 +152,46 @@ typedef struct {
     IOC_CbRecvDat_F CbRecvDat_F;  // Callback function for receiving data
     void *pCbPrivData;            // Receiver callback private context data
 
+    // Receiver polling buffer of IOC_recvDAT, 0 means default 64KB.
+    //  It's rounded up to a power of two page size multiple, and each data chunk takes 8 bytes more in it.
+    ULONG_T PollingBufSize;
+
+    // Receiver callback of data batches, used instead of CbRecvDat_F if set.
+    //  Protocols which don't batch(such as TCP) call it with one data chunk each time.
+    IOC_CbRecvDatBatch_F CbRecvDatBatch_F;
+
+    // Limits of each batch delivered to the receiver callback, 0 means default.
+    //  The batch grows up to MaxDatNum chunks or MaxDatBytes bytes from the data queued meanwhile,
+    //  and waits at most MaxDelayUS after its first chunk is sent for more, 0 means never wait.
+    //  While waiting, the expected batch size is adapted to the observed callback cost per chunk,
+    //  so a batch's delivery takes about half of MaxDelayUS.
+    //  CbRecvDat_F gets each chunk of a batch by its own call, so each send keeps its boundary,
+    //  unless IsJoinData opts in to get each batch's data joined up to 16KB in one IOC_DatDesc_T,
+    //  except zero-copy data(Payload.pDatBuf) and larger data which are delivered alone.
+    //  Without MaxDelayUS, it joins only data queued while its previous callback ran.
+    struct {
+        ULONG_T MaxDatNum;    // 0 means 64, at most 256
+        ULONG_T MaxDatBytes;  // 0 means 64KB, a larger chunk is delivered alone
+        ULONG_T MaxDelayUS;   // 0 means deliver what's queued without waiting
+        bool IsJoinData;      // false means CbRecvDat_F per chunk, true joins chunks as DAT is a stream
+    } Batch;
+
+    // Credits granted to the DatSender, which may have at most MaxDatNum chunks or MaxDatBytes bytes in flight,
+    //  i.e. sent but not consumed yet by the receiver callback or IOC_recvDAT, 0 means default.
+    //  Beyond them, IOC_sendDAT waits for credits returned as the receiver consumes data, within its timeout,
+    //  or returns IOC_RESULT_BUFFER_FULL if NonBlock, so data is never dropped nor buffered unboundedly.
+    //  A chunk larger than MaxDatBytes is sent alone once all others are consumed.
+    //  For IOC_recvDAT, they're also bounded to fit in PollingBufSize,
+    //    and a FIFO IOC_sendDAT without IOC_OPTID_TIMEOUT returns IOC_RESULT_BUFFER_FULL instead of waiting.
+    struct {
+        ULONG_T MaxDatNum;    // 0 means 256
+        ULONG_T MaxDatBytes;  // 0 means 1MB
+    } Credit;
+
+    // Coalescing of sent data into fewer writes by DatSender, see IOC_CoalesceArgs_T,
+    //  where IOC_flushDAT writes data waiting to be coalesced at once.
+    IOC_CoalesceArgs_T Coalesce;
+
     // TODO: Reserved;
 
 } IOC_DatUsageArgs_T, *IOC_DatUsageArgs_pT;
@@ -336,6 +409,15 @@ typedef struct {
     // THEN: OnAutoAccepted_F will be called with the new LinkID
     IOC_CbOnAutoAccepted_F OnAutoAccepted_F;
     void *pSrvPriv;
+
+    /**
+     * @brief How many listeners of a TCP service accept clients on the same port, 0 or 1 means one.
+     *  IF: ListenerNum > 1, listening sockets share the port by SO_REUSEPORT, among which the kernel spreads clients,
+     *  THEN: each listener is served by its own reactor shard, so are links it accepted,
+     *    which accepts a storm of connecting clients and serves many links on multiple CPU cores.
+     *  At most 16 listeners, otherwise IOC_onlineService returns IOC_RESULT_INVALID_PARAM. Ignored by other protocols.
+     */
+    ULONG_T ListenerNum;
 } IOC_SrvArgs_T, *IOC_SrvArgs_pT;
 
 static inline void IOC_Helper_initSrvArgs(IOC_SrvArgs_pT pSrvArgs) {
@@ -125,6 +125,10 @@ typedef IOC_SrvID_T *IOC_SrvID_pT;
 
 #define IOC_INVALID_SRV_ID IOC_ID_INVALID  // Used for default variable value assignment, e.g. IOC_SrvID_T
 
+// The N-th ConlesMode AutoLinkID, valid if N < AutoLinkNum of IOC_ConlesModeEventCapability_T,
+//  otherwise ConlesMode APIs return IOC_RESULT_INVALID_AUTO_LINK_ID. RefAPI: IOC_getCapability
+#define IOC_CONLES_MODE_AUTO_LINK_ID_N(N) ((IOC_LinkID_T)IOC_CONLES_MODE_AUTO_LINK_ID_0 + (N))
+
 /**
  * @brief AutoLinkID is a unique ID to identify an automatic link in IOC.
  *    CONLES_MODE is used in ConlesMode, CONET_MODE is used in ConetMode.
@@ -135,7 +139,18 @@ enum IOC_AutoLinkID_enum {
     IOC_CONLES_MODE_AUTO_LINK_ID_0 = 0U,
     IOC_CONLES_MODE_AUTO_LINK_ID = IOC_CONLES_MODE_AUTO_LINK_ID_0,  // Default
 
-    // TODO: +More AutoLinkID_1/_2/...MAX
+    // Each AutoLinkID has its own EvtDescQueue, EvtSuberList and EvtProcThread,
+    //  so a slow EvtConsumer on one AutoLinkID never stalls EvtConsumers on others.
+    //  How many are valid is decided when IOC is built and reported as AutoLinkNum by IOC_getCapability,
+    //  _1~_7 are named for convenience, use IOC_CONLES_MODE_AUTO_LINK_ID_N for more.
+    IOC_CONLES_MODE_AUTO_LINK_ID_1 = 1U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_2 = 2U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_3 = 3U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_4 = 4U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_5 = 5U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_6 = 6U,
+    IOC_CONLES_MODE_AUTO_LINK_ID_7 = 7U,
+
     IOC_CONLES_MODE_AUTO_LINK_ID_MAX = 1024U
 };
 
@@ -301,7 +316,8 @@ typedef enum {
 
 typedef struct {
     uint16_t MaxEvtConsumer;     // How many EvtConsumer can be subEVT in ConlesMode.
-    uint16_t DepthEvtDescQueue;  // How many EvtDesc can be queued in IOC's EvtDescQueue.
+    uint16_t DepthEvtDescQueue;  // How many EvtDesc can be queued in IOC's EvtDescQueue of each AutoLinkID.
+    uint16_t AutoLinkNum;        // How many AutoLinkIDs are valid, from IOC_CONLES_MODE_AUTO_LINK_ID_0.
 } IOC_ConlesModeEventCapability_T, *IOC_ConlesModeEventCapability_pT;
 
 typedef struct {
@@ -4,8 +4,452 @@
  * @details Provides data streaming capabilities with NODROP guarantee
  */
 
+#include <errno.h>
+#include <stdatomic.h>
+
 #include "_IOC.h"
 
+struct IOC_DatBufStru {
+    atomic_ulong RefCnt;
+    void *pData;
+    ULONG_T DataSize;
+    IOC_CbReleaseDatBuf_F CbRelease_F;
+    void *pCbPrivData;
+    bool IsInSlab;  // embedded in a _IOC_DatSlab_T, so CbRelease_F recycles it together with pData
+};
+
+IOC_Result_T IOC_wrapDatBuf(void *pData, ULONG_T DataSize, IOC_CbReleaseDatBuf_F CbRelease_F, void *pCbPrivData,
+                            IOC_DatBuf_pT *ppDatBuf) {
+    if (!pData || 0 == DataSize || !ppDatBuf) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    IOC_DatBuf_pT pDatBuf = (IOC_DatBuf_pT)calloc(1, sizeof(IOC_DatBuf_T));
+    if (!pDatBuf) {
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    atomic_init(&pDatBuf->RefCnt, 1);
+    pDatBuf->pData = pData;
+    pDatBuf->DataSize = DataSize;
+    pDatBuf->CbRelease_F = CbRelease_F;
+    pDatBuf->pCbPrivData = pCbPrivData;
+    pDatBuf->IsInSlab = false;  // only slabs of _IOC_DatSlabPool_T embed their DatBuf
+
+    *ppDatBuf = pDatBuf;
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T IOC_holdDatBuf(IOC_DatBuf_pT pDatBuf) {
+    if (!pDatBuf) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    atomic_fetch_add_explicit(&pDatBuf->RefCnt, 1, memory_order_relaxed);
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T IOC_releaseDatBuf(IOC_DatBuf_pT pDatBuf) {
+    if (!pDatBuf) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    // acq_rel: every holder's last access to pData happens before CbRelease_F
+    if (atomic_fetch_sub_explicit(&pDatBuf->RefCnt, 1, memory_order_acq_rel) == 1) {
+        bool IsInSlab = pDatBuf->IsInSlab;  // pDatBuf may be reused once CbRelease_F recycled its slab
+        if (pDatBuf->CbRelease_F) {
+            pDatBuf->CbRelease_F(pDatBuf->pData, pDatBuf->DataSize, pDatBuf->pCbPrivData);
+        }
+        if (!IsInSlab) {
+            free(pDatBuf);
+        }
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Per-link slab pool of IOC_allocDAT, and of protocols which receive data into their own memory (TCP).
+ *    Each slab is ONE allocation of {_IOC_DatSlab_T, pData}, so a loaned buffer costs no malloc once recycled.
+ *    Slabs are size-classed, and a released slab goes back to its class's FreeList, up to FreeMax of the class.
+ *    Data bigger than the biggest class gets a one-off slab, which is freed on release.
+ *    The link and each loaned slab hold a reference of the pool, so slabs may be released after the link is closed.
+ */
+typedef struct _IOC_DatSlabStru _IOC_DatSlab_T, *_IOC_DatSlab_pT;
+struct _IOC_DatSlabStru {
+    IOC_DatBuf_T DatBuf;  // DatBuf.pData points right after this header
+    _IOC_DatSlabPool_pT pPool;
+    _IOC_DatSlab_pT pNext;  // in FreeList
+    int ClassIdx;           // -1 means a one-off slab
+};
+
+#define _IOC_DAT_SLAB_HDR_SIZE ((sizeof(_IOC_DatSlab_T) + 63) & ~(size_t)63)  // keep pData cache-line aligned
+
+static const struct {
+    ULONG_T ChunkSize;
+    ULONG_T FreeMax;
+} _mIOC_DatSlabClasses[] = {
+    {256, 64}, {4 * 1024, 32}, {64 * 1024, 16}, {1024 * 1024, 4}, {4 * 1024 * 1024, 2},
+};
+#define _IOC_DAT_SLAB_CLASS_NUM (sizeof(_mIOC_DatSlabClasses) / sizeof(_mIOC_DatSlabClasses[0]))
+
+struct _IOC_DatSlabPoolStru {
+    pthread_mutex_t Mutex;
+    atomic_ulong RefCnt;  // 1 by the link until _IOC_putDatSlabPool, +1 by each loaned slab
+    bool IsClosed;        // the link is gone, so released slabs are freed instead of cached
+
+    struct {
+        _IOC_DatSlab_pT pFreeList;
+        ULONG_T FreeNum;
+    } Classes[_IOC_DAT_SLAB_CLASS_NUM];
+};
+
+static void __IOC_putDatSlabPool(_IOC_DatSlabPool_pT pPool) {
+    if (atomic_fetch_sub_explicit(&pPool->RefCnt, 1, memory_order_acq_rel) == 1) {
+        pthread_mutex_destroy(&pPool->Mutex);
+        free(pPool);
+    }
+}
+
+static void __IOC_recycleDatSlab(void *pData, ULONG_T DataSize, void *pCbPrivData) {
+    (void)pData;
+    (void)DataSize;
+    _IOC_DatSlab_pT pSlab = (_IOC_DatSlab_pT)pCbPrivData;
+    _IOC_DatSlabPool_pT pPool = pSlab->pPool;
+    bool IsCached = false;
+
+    int ClassIdx = pSlab->ClassIdx;
+    if (ClassIdx >= 0) {
+        pthread_mutex_lock(&pPool->Mutex);
+        if (!pPool->IsClosed && pPool->Classes[ClassIdx].FreeNum < _mIOC_DatSlabClasses[ClassIdx].FreeMax) {
+            pSlab->pNext = pPool->Classes[ClassIdx].pFreeList;
+            pPool->Classes[ClassIdx].pFreeList = pSlab;
+            pPool->Classes[ClassIdx].FreeNum++;
+            IsCached = true;
+        }
+        pthread_mutex_unlock(&pPool->Mutex);
+    }
+
+    if (!IsCached) {
+        free(pSlab);
+    }
+    __IOC_putDatSlabPool(pPool);
+}
+
+static _IOC_DatSlabPool_pT __IOC_getDatSlabPool(_IOC_LinkObject_pT pLinkObj) {
+    pthread_mutex_lock(&pLinkObj->DatState.SubStateMutex);
+    _IOC_DatSlabPool_pT pPool = pLinkObj->pDatSlabPool;
+    if (!pPool) {
+        pPool = (_IOC_DatSlabPool_pT)calloc(1, sizeof(_IOC_DatSlabPool_T));
+        if (pPool) {
+            pthread_mutex_init(&pPool->Mutex, NULL);
+            atomic_init(&pPool->RefCnt, 1);
+            pLinkObj->pDatSlabPool = pPool;
+        }
+    }
+    pthread_mutex_unlock(&pLinkObj->DatState.SubStateMutex);
+    return pPool;
+}
+
+IOC_Result_T _IOC_allocDatSlab(_IOC_LinkObject_pT pLinkObj, ULONG_T DataSize, IOC_DatBuf_pT *ppDatBuf,
+                               void **ppData) {
+    _IOC_DatSlabPool_pT pPool = __IOC_getDatSlabPool(pLinkObj);
+    if (!pPool) {
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    int ClassIdx = -1;
+    for (int i = 0; i < (int)_IOC_DAT_SLAB_CLASS_NUM; i++) {
+        if (DataSize <= _mIOC_DatSlabClasses[i].ChunkSize) {
+            ClassIdx = i;
+            break;
+        }
+    }
+
+    _IOC_DatSlab_pT pSlab = NULL;
+    if (ClassIdx >= 0) {
+        pthread_mutex_lock(&pPool->Mutex);
+        pSlab = pPool->Classes[ClassIdx].pFreeList;
+        if (pSlab) {
+            pPool->Classes[ClassIdx].pFreeList = pSlab->pNext;
+            pPool->Classes[ClassIdx].FreeNum--;
+        }
+        pthread_mutex_unlock(&pPool->Mutex);
+    }
+
+    if (!pSlab) {
+        ULONG_T ChunkSize = (ClassIdx >= 0) ? _mIOC_DatSlabClasses[ClassIdx].ChunkSize : DataSize;
+        pSlab = (_IOC_DatSlab_pT)malloc(_IOC_DAT_SLAB_HDR_SIZE + ChunkSize);
+        if (!pSlab) {
+            return IOC_RESULT_POSIX_ENOMEM;
+        }
+        pSlab->pPool = pPool;
+        pSlab->ClassIdx = ClassIdx;
+    }
+
+    atomic_fetch_add_explicit(&pPool->RefCnt, 1, memory_order_relaxed);
+
+    IOC_DatBuf_pT pDatBuf = &pSlab->DatBuf;
+    atomic_init(&pDatBuf->RefCnt, 1);
+    pDatBuf->pData = (char *)pSlab + _IOC_DAT_SLAB_HDR_SIZE;
+    pDatBuf->DataSize = DataSize;
+    pDatBuf->CbRelease_F = __IOC_recycleDatSlab;
+    pDatBuf->pCbPrivData = pSlab;
+    pDatBuf->IsInSlab = true;
+
+    *ppDatBuf = pDatBuf;
+    *ppData = pDatBuf->pData;
+    return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_putDatSlabPool(_IOC_LinkObject_pT pLinkObj) {
+    _IOC_DatSlabPool_pT pPool = pLinkObj->pDatSlabPool;
+    if (!pPool) {
+        return;
+    }
+    pLinkObj->pDatSlabPool = NULL;
+
+    pthread_mutex_lock(&pPool->Mutex);
+    pPool->IsClosed = true;
+    for (int i = 0; i < (int)_IOC_DAT_SLAB_CLASS_NUM; i++) {
+        while (pPool->Classes[i].pFreeList) {
+            _IOC_DatSlab_pT pSlab = pPool->Classes[i].pFreeList;
+            pPool->Classes[i].pFreeList = pSlab->pNext;
+            free(pSlab);
+        }
+        pPool->Classes[i].FreeNum = 0;
+    }
+    pthread_mutex_unlock(&pPool->Mutex);
+
+    __IOC_putDatSlabPool(pPool);
+}
+
+/**
+ * @brief Per-link queue of completions of sends with IOC_OPTID_DAT_COMPLETION but no CbDatCompleted_F,
+ *    filled by the thread which got the receiver's result, and drained by IOC_pollDatCompletions in bulk.
+ *    Each pending completer reserves its slot when sent, so completing never fails for no memory.
+ *    The link, each pending completer and each poller hold a reference, so completers may outlive the link.
+ */
+struct _IOC_DatCompletionQueueStru {
+    pthread_mutex_t Mutex;
+    pthread_cond_t NotEmptyCond;  // pollers wait for completions
+    atomic_ulong RefCnt;          // 1 by the link until _IOC_putDatCompletionQueue, +1 by each completer and poller
+
+    IOC_DatCompletion_T *pCompletions;  // ring of Capacity, grown by doubling
+    ULONG_T Capacity, HeadIdx, CompletionNum;
+    ULONG_T ReservedNum;  // slots of pending completers, CompletionNum + ReservedNum <= Capacity
+};
+
+static void __IOC_putDatCompletionQueue(_IOC_DatCompletionQueue_pT pQueue) {
+    if (atomic_fetch_sub_explicit(&pQueue->RefCnt, 1, memory_order_acq_rel) == 1) {
+        free(pQueue->pCompletions);
+        pthread_cond_destroy(&pQueue->NotEmptyCond);
+        pthread_mutex_destroy(&pQueue->Mutex);
+        free(pQueue);
+    }
+}
+
+// Get pLinkObj's completion queue with a reference, create it on the first call
+static _IOC_DatCompletionQueue_pT __IOC_getDatCompletionQueue(_IOC_LinkObject_pT pLinkObj) {
+    pthread_mutex_lock(&pLinkObj->DatState.SubStateMutex);
+    _IOC_DatCompletionQueue_pT pQueue = pLinkObj->pDatCompletionQueue;
+    if (!pQueue) {
+        pQueue = (_IOC_DatCompletionQueue_pT)calloc(1, sizeof(_IOC_DatCompletionQueue_T));
+        if (pQueue) {
+            pthread_mutex_init(&pQueue->Mutex, NULL);
+            pthread_cond_init(&pQueue->NotEmptyCond, NULL);
+            atomic_init(&pQueue->RefCnt, 1);
+            pLinkObj->pDatCompletionQueue = pQueue;
+        }
+    }
+    if (pQueue) {
+        atomic_fetch_add_explicit(&pQueue->RefCnt, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&pLinkObj->DatState.SubStateMutex);
+    return pQueue;
+}
+
+// Reserve one slot for a pending completer, growing the ring if it's full
+static IOC_Result_T __IOC_reserveDatCompletion(_IOC_DatCompletionQueue_pT pQueue) {
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+
+    pthread_mutex_lock(&pQueue->Mutex);
+    if (pQueue->CompletionNum + pQueue->ReservedNum == pQueue->Capacity) {
+        ULONG_T NewCapacity = pQueue->Capacity ? pQueue->Capacity * 2 : 64;
+        IOC_DatCompletion_T *pNewCompletions =
+            (IOC_DatCompletion_T *)malloc(NewCapacity * sizeof(IOC_DatCompletion_T));
+        if (pNewCompletions) {
+            for (ULONG_T i = 0; i < pQueue->CompletionNum; i++) {
+                pNewCompletions[i] = pQueue->pCompletions[(pQueue->HeadIdx + i) % pQueue->Capacity];
+            }
+            free(pQueue->pCompletions);
+            pQueue->pCompletions = pNewCompletions;
+            pQueue->Capacity = NewCapacity;
+            pQueue->HeadIdx = 0;
+        } else {
+            Result = IOC_RESULT_POSIX_ENOMEM;
+        }
+    }
+    if (IOC_RESULT_SUCCESS == Result) {
+        pQueue->ReservedNum++;
+    }
+    pthread_mutex_unlock(&pQueue->Mutex);
+    return Result;
+}
+
+IOC_Result_T _IOC_initDatCompleter(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption, ULONG_T DataSize,
+                                   _IOC_DatCompleter_pT pCompleter) {
+    memset(pCompleter, 0, sizeof(*pCompleter));
+    if (!pOption || !(pOption->IDs & IOC_OPTID_DAT_COMPLETION)) {
+        return IOC_RESULT_SUCCESS;
+    }
+
+    pCompleter->LinkID = pLinkObj->ID;
+    pCompleter->Completion.Tag = pOption->Payload.DatCompletion.Tag;
+    pCompleter->Completion.DataSize = DataSize;
+    if (pOption->Payload.DatCompletion.CbDatCompleted_F) {
+        pCompleter->CbDatCompleted_F = pOption->Payload.DatCompletion.CbDatCompleted_F;
+        pCompleter->pCbPrivData = pOption->Payload.DatCompletion.pCbPrivData;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    _IOC_DatCompletionQueue_pT pQueue = __IOC_getDatCompletionQueue(pLinkObj);
+    if (!pQueue) {
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+    IOC_Result_T Result = __IOC_reserveDatCompletion(pQueue);
+    if (Result != IOC_RESULT_SUCCESS) {
+        __IOC_putDatCompletionQueue(pQueue);
+        return Result;
+    }
+    pCompleter->pQueue = pQueue;
+    return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_completeDat(_IOC_DatCompleter_pT pCompleter, IOC_Result_T Result) {
+    pCompleter->Completion.Result = Result;
+
+    if (pCompleter->CbDatCompleted_F) {
+        pCompleter->CbDatCompleted_F(pCompleter->LinkID, &pCompleter->Completion, pCompleter->pCbPrivData);
+        pCompleter->CbDatCompleted_F = NULL;
+    } else if (pCompleter->pQueue) {
+        _IOC_DatCompletionQueue_pT pQueue = pCompleter->pQueue;
+        pthread_mutex_lock(&pQueue->Mutex);
+        pQueue->ReservedNum--;
+        pQueue->pCompletions[(pQueue->HeadIdx + pQueue->CompletionNum) % pQueue->Capacity] = pCompleter->Completion;
+        pQueue->CompletionNum++;
+        pthread_cond_broadcast(&pQueue->NotEmptyCond);
+        pthread_mutex_unlock(&pQueue->Mutex);
+
+        pCompleter->pQueue = NULL;
+        __IOC_putDatCompletionQueue(pQueue);
+    }
+}
+
+void _IOC_cancelDatCompleter(_IOC_DatCompleter_pT pCompleter) {
+    pCompleter->CbDatCompleted_F = NULL;
+    if (pCompleter->pQueue) {
+        _IOC_DatCompletionQueue_pT pQueue = pCompleter->pQueue;
+        pthread_mutex_lock(&pQueue->Mutex);
+        pQueue->ReservedNum--;
+        pthread_mutex_unlock(&pQueue->Mutex);
+
+        pCompleter->pQueue = NULL;
+        __IOC_putDatCompletionQueue(pQueue);
+    }
+}
+
+void _IOC_putDatCompletionQueue(_IOC_LinkObject_pT pLinkObj) {
+    _IOC_DatCompletionQueue_pT pQueue = pLinkObj->pDatCompletionQueue;
+    if (!pQueue) {
+        return;
+    }
+    pLinkObj->pDatCompletionQueue = NULL;
+    __IOC_putDatCompletionQueue(pQueue);
+}
+
+IOC_Result_T IOC_allocDAT(IOC_LinkID_T LinkID, ULONG_T DataSize, IOC_DatDesc_pT pDatDesc) {
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pSenderLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pSenderLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    if (!(pSenderLinkObj->Args.Usage & IOC_LinkUsageDatSender)) {
+        return IOC_RESULT_INCOMPATIBLE_USAGE;
+    }
+
+    if (!pDatDesc) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    if (DataSize == 0) {
+        return IOC_RESULT_ZERO_DATA;
+    }
+
+    if (DataSize > _IOC_MAX_DAT_SIZE) {
+        return IOC_RESULT_DATA_TOO_LARGE;
+    }
+
+    IOC_DatBuf_pT pDatBuf = NULL;
+    void *pData = NULL;
+    IOC_Result_T Result = _IOC_allocDatSlab(pSenderLinkObj, DataSize, &pDatBuf, &pData);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    pDatDesc->Payload.pDatBuf = pDatBuf;
+    pDatDesc->Payload.pData = pData;
+    pDatDesc->Payload.PtrDataSize = DataSize;
+    pDatDesc->Payload.PtrDataLen = DataSize;
+    pDatDesc->Payload.EmdDataLen = 0;
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T IOC_commitDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Options_pT pOption) {
+    if (pDatDesc && !pDatDesc->Payload.pDatBuf) {
+        return IOC_RESULT_INVALID_PARAM;  // not loaned by IOC_allocDAT
+    }
+
+    IOC_Result_T Result = IOC_sendDAT(LinkID, pDatDesc, pOption);
+    if (Result == IOC_RESULT_SUCCESS) {
+        // The receiver side holds its own reference now, so the loan ends here
+        IOC_releaseDatBuf(pDatDesc->Payload.pDatBuf);
+        pDatDesc->Payload.pDatBuf = NULL;
+        pDatDesc->Payload.pData = NULL;
+        pDatDesc->Payload.PtrDataSize = 0;
+        pDatDesc->Payload.PtrDataLen = 0;
+    }
+    return Result;
+}
+
+// 🎯 TDD IMPLEMENTATION: Track DAT sender state transitions, set to "busy sending" before operation
+static void __IOC_enterDatSenderBusy(_IOC_LinkObject_pT pSenderLinkObj) {
+    pthread_mutex_lock(&pSenderLinkObj->DatState.SubStateMutex);
+    pSenderLinkObj->DatState.IsSending = true;
+    pSenderLinkObj->DatState.CurrentSubState = IOC_LinkSubStateDatSenderBusySendDat;
+    pSenderLinkObj->DatState.LastOperationTime = time(NULL);
+    pthread_mutex_unlock(&pSenderLinkObj->DatState.SubStateMutex);
+
+    // 🔄 TDD GREEN: Update ConlesEvent SubState for IOC_getLinkState() compatibility
+    // Bridge the gap between Service-mode DAT state and ConlesMode state reporting
+    _IOC_updateConlesEventSubState(pSenderLinkObj->ID, IOC_LinkSubStateDatSenderBusySendDat);
+}
+
+// 🎯 TDD IMPLEMENTATION: Restore sender state to "ready" after operation completes
+static void __IOC_leaveDatSenderBusy(_IOC_LinkObject_pT pSenderLinkObj) {
+    pthread_mutex_lock(&pSenderLinkObj->DatState.SubStateMutex);
+    pSenderLinkObj->DatState.IsSending = false;
+    pSenderLinkObj->DatState.CurrentSubState = IOC_LinkSubStateDatSenderReady;
+    pSenderLinkObj->DatState.LastOperationTime = time(NULL);
+    pthread_mutex_unlock(&pSenderLinkObj->DatState.SubStateMutex);
+
+    // 🔄 TDD GREEN: Update ConlesEvent SubState back to Ready
+    _IOC_updateConlesEventSubState(pSenderLinkObj->ID, IOC_LinkSubStateDatSenderReady);
+}
+
 /**
  * @brief Send data chunk on the specified link
  * @param LinkID: the link ID to send data on
@@ -61,10 +505,9 @@ IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
 
     // Data size validation - check for maximum allowed data size
     // 🎯 TDD REQUIREMENT: Implement IOC_RESULT_DATA_TOO_LARGE validation
-    const size_t IOC_MAX_DATA_SIZE = 64 * 1024 * 1024;  // 64MB limit for single data chunk
     size_t totalDataSize = pDatDesc->Payload.PtrDataSize + pDatDesc->Payload.EmdDataLen;
 
-    if (totalDataSize > IOC_MAX_DATA_SIZE) {
+    if (totalDataSize > _IOC_MAX_DAT_SIZE) {
         return IOC_RESULT_DATA_TOO_LARGE;
     }
 
@@ -73,6 +516,17 @@ IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
         return IOC_RESULT_ZERO_DATA;
     }
 
+    // Zero-copy payload MUST be inside its IOC_DatBuf_T, which is what IOC holds while pData is in use
+    IOC_DatBuf_pT pDatBuf = pDatDesc->Payload.pDatBuf;
+    if (pDatBuf) {
+        const char *pBufBegin = (const char *)pDatBuf->pData;
+        const char *pDataBegin = (const char *)pDatDesc->Payload.pData;
+        if (pDataBegin < pBufBegin || pDatDesc->Payload.PtrDataSize > pDatBuf->DataSize ||
+            (ULONG_T)(pDataBegin - pBufBegin) > pDatBuf->DataSize - pDatDesc->Payload.PtrDataSize) {
+            return IOC_RESULT_INVALID_PARAM;
+        }
+    }
+
     // ════════════════════════════════════════════════════════════════════════════════════════
     // 🏁 PHASE 4: Options Validation (LOWEST PRECEDENCE)
     // Rationale: Validate configuration after confirming connection, role, and data are valid
@@ -82,17 +536,7 @@ IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
 
     _IOC_LogDebug("IOC_sendDAT: Sending %lu bytes on LinkID=%llu\n", pDatDesc->Payload.PtrDataSize, LinkID);
 
-    // 🎯 TDD IMPLEMENTATION: Track DAT sender state transitions for TDD GREEN
-    // Set sender to "busy sending" before operation, restore to "ready" after
-    pthread_mutex_lock(&pSenderLinkObj->DatState.SubStateMutex);
-    pSenderLinkObj->DatState.IsSending = true;
-    pSenderLinkObj->DatState.CurrentSubState = IOC_LinkSubStateDatSenderBusySendDat;
-    pSenderLinkObj->DatState.LastOperationTime = time(NULL);
-    pthread_mutex_unlock(&pSenderLinkObj->DatState.SubStateMutex);
-
-    // 🔄 TDD GREEN: Update ConlesEvent SubState for IOC_getLinkState() compatibility
-    // Bridge the gap between Service-mode DAT state and ConlesMode state reporting
-    _IOC_updateConlesEventSubState(LinkID, IOC_LinkSubStateDatSenderBusySendDat);
+    __IOC_enterDatSenderBusy(pSenderLinkObj);
 
     // 🔄 WHY ARCHITECTURE CHANGE: The original implementation used global variables
     // (_gTDD_PendingData) to store data, completely bypassing the protocol layer.
@@ -118,31 +562,90 @@ IOC_Result_T IOC_sendDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
 
     IOC_Result_T Result = pMethods->OpSendData_F(pSenderLinkObj, pDatDesc, pOption);
 
-    // 🎯 TDD IMPLEMENTATION: Restore sender state after operation completes
-    pthread_mutex_lock(&pSenderLinkObj->DatState.SubStateMutex);
-    pSenderLinkObj->DatState.IsSending = false;
-    pSenderLinkObj->DatState.CurrentSubState = IOC_LinkSubStateDatSenderReady;
-    pSenderLinkObj->DatState.LastOperationTime = time(NULL);
-    pthread_mutex_unlock(&pSenderLinkObj->DatState.SubStateMutex);
+    __IOC_leaveDatSenderBusy(pSenderLinkObj);
+    return Result;
+}
 
-    // 🔄 TDD GREEN: Update ConlesEvent SubState back to Ready
-    _IOC_updateConlesEventSubState(LinkID, IOC_LinkSubStateDatSenderReady);
+IOC_Result_T IOC_sendDATv(IOC_LinkID_T LinkID, const IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                          IOC_Options_pT pOption) {
+    // Same precedence as IOC_sendDAT: LinkID → Role → Data → Options
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pSenderLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pSenderLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    if (!(pSenderLinkObj->Args.Usage & IOC_LinkUsageDatSender)) {
+        return IOC_RESULT_INCOMPATIBLE_USAGE;
+    }
+
+    if (!pDatVecs || DatVecNum == 0 || DatVecNum > IOC_DATVEC_MAX_NUM) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
 
+    ULONG_T TotalDataLen = 0;
+    for (ULONG_T i = 0; i < DatVecNum; i++) {
+        if (pDatVecs[i].DataLen > 0 && !pDatVecs[i].pData) {
+            return IOC_RESULT_INVALID_PARAM;
+        }
+        if (pDatVecs[i].DataLen > _IOC_MAX_DAT_SIZE - TotalDataLen) {
+            return IOC_RESULT_DATA_TOO_LARGE;
+        }
+        TotalDataLen += pDatVecs[i].DataLen;
+    }
+
+    if (TotalDataLen == 0) {
+        return IOC_RESULT_ZERO_DATA;
+    }
+
+    _IOC_SrvProtoMethods_pT pMethods = pSenderLinkObj->pMethods;
+    if (pMethods && pMethods->OpSendDataV_F) {
+        __IOC_enterDatSenderBusy(pSenderLinkObj);
+        IOC_Result_T Result = pMethods->OpSendDataV_F(pSenderLinkObj, pDatVecs, DatVecNum, pOption);
+        __IOC_leaveDatSenderBusy(pSenderLinkObj);
+        return Result;
+    }
+
+    // Gather segments into a slab of the link's pool, then send it as one zero-copy chunk,
+    // so the protocol copies nothing more than IOC_sendDAT would, and steady sending costs no malloc.
+    IOC_DatDesc_T DatDesc;
+    IOC_initDatDesc(&DatDesc);
+    IOC_Result_T Result =
+        _IOC_allocDatSlab(pSenderLinkObj, TotalDataLen, &DatDesc.Payload.pDatBuf, &DatDesc.Payload.pData);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    char *pGatherPos = (char *)DatDesc.Payload.pData;
+    for (ULONG_T i = 0; i < DatVecNum; i++) {
+        if (pDatVecs[i].DataLen > 0) {
+            memcpy(pGatherPos, pDatVecs[i].pData, pDatVecs[i].DataLen);
+            pGatherPos += pDatVecs[i].DataLen;
+        }
+    }
+    DatDesc.Payload.PtrDataSize = TotalDataLen;
+    DatDesc.Payload.PtrDataLen = TotalDataLen;
+
+    Result = IOC_sendDAT(LinkID, &DatDesc, pOption);
+    IOC_releaseDatBuf(DatDesc.Payload.pDatBuf);  // The receiver side holds its own reference if needed
     return Result;
 }
 
 /**
- * @brief Flush pending data on the specified link
+ * @brief Flush pending data on the specified link, as a barrier of the data sent before it
  * @param LinkID: the link ID to flush data on
- * @param pOption: optional parameters (can be NULL)
- * @return IOC_RESULT_SUCCESS: data flushed successfully
+ * @param pOption: optional parameters (can be NULL), IOC_OPTID_TIMEOUT bounds the wait
+ * @return IOC_RESULT_SUCCESS: data sent before it is delivered to the DatReceiver
  */
 IOC_Result_T IOC_flushDAT(IOC_LinkID_T LinkID, IOC_Options_pT pOption) {
     if (LinkID == IOC_ID_INVALID) {
         return IOC_RESULT_NOT_EXIST_LINK;
     }
 
-    printf("IOC_flushDAT: Flushing data on LinkID=%llu\n", LinkID);
+    _IOC_LogDebug("IOC_flushDAT: Flushing data on LinkID=%llu\n", LinkID);
 
     // Get link object to determine protocol and flush appropriately
     _IOC_LinkObject_pT pLinkObj = _IOC_getLinkObjByLinkID(LinkID);
@@ -157,24 +660,17 @@ IOC_Result_T IOC_flushDAT(IOC_LinkID_T LinkID, IOC_Options_pT pOption) {
         return IOC_RESULT_INCOMPATIBLE_USAGE;
     }
 
-    // 🚀 MICRO-BATCHING SUPPORT: For ProtoFifo protocol, flush any accumulated batch data
-    // The time-window batching feature requires explicit flushing to deliver queued data
-    // when the application signals completion of a burst or end of data stream.
+    // 🚧 DRAIN BARRIER: Each protocol tracks the data sent on this link by sequence numbers,
+    // and waits until the DatReceiver got all of them before this flush, so DatSender MAY pipeline
+    // many async sends and synchronize once, instead of sending each synchronously.
+    // - FIFO: the receiver's dispatcher delivered them to CbRecvDat_F, or they're in its polling buffer
+    // - TCP: the peer's receiver acknowledged this flush after the data sent before it
     _IOC_SrvProtoMethods_pT pMethods = pLinkObj->pMethods;
-    if (pMethods && pMethods->pProtocol && strcmp(pMethods->pProtocol, IOC_SRV_PROTO_FIFO) == 0) {
-        // ProtoFifo protocol: flush any accumulated batch data
-        // This ensures that data queued during batching windows is delivered to receivers
-        extern IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption);
-        return __IOC_flushData_ofProtoFifo(pLinkObj, pOption);
+    if (pMethods && pMethods->OpFlushData_F) {
+        return pMethods->OpFlushData_F(pLinkObj, pOption);
     }
 
-    // 📋 PROTOCOL DIFFERENCES: Other protocols might implement different strategies:
-    // - TCP: Could buffer data and flush() would force socket send
-    // - UDP: Might batch packets and flush() would send the batch
-    // - File: Could buffer writes and flush() would fsync() to disk
-    //
-    // 💡 DESIGN PRINCIPLE: Keep flush() simple for immediate protocols, let buffering
-    // protocols override with their own flush implementation via OpFlushData_F (future).
+    // Protocols without OpFlushData_F deliver data before their sendDAT returns, nothing left to wait for
     return IOC_RESULT_SUCCESS;
 }
 
@@ -239,3 +735,171 @@ IOC_Result_T IOC_recvDAT(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, IOC_Optio
 
     return Result;
 }
+
+// Common checks of IOC_recvDATv and IOC_peekDATv, in the same precedence as IOC_sendDAT.
+static IOC_Result_T __IOC_getDatReceiverLinkObj(IOC_LinkID_T LinkID, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                               ULONG_T *pDatNum, _IOC_LinkObject_pT *ppLinkObj) {
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pReceiverLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pReceiverLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    if (!(pReceiverLinkObj->Args.Usage & IOC_LinkUsageDatReceiver)) {
+        return IOC_RESULT_INCOMPATIBLE_USAGE;
+    }
+
+    if (!pDatVecs || DatVecNum == 0 || !pDatNum) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    *pDatNum = 0;
+    *ppLinkObj = pReceiverLinkObj;
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T IOC_recvDATv(IOC_LinkID_T LinkID, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pRecvDatNum,
+                          IOC_Options_pT pOption) {
+    _IOC_LinkObject_pT pReceiverLinkObj = NULL;
+    IOC_Result_T Result = __IOC_getDatReceiverLinkObj(LinkID, pDatVecs, DatVecNum, pRecvDatNum, &pReceiverLinkObj);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    _IOC_SrvProtoMethods_pT pMethods = pReceiverLinkObj->pMethods;
+    if (!pMethods || !pMethods->OpRecvDataV_F) {
+        return IOC_RESULT_NOT_SUPPORT;
+    }
+
+    return pMethods->OpRecvDataV_F(pReceiverLinkObj, pDatVecs, DatVecNum, pRecvDatNum, pOption);
+}
+
+IOC_Result_T IOC_peekDATv(IOC_LinkID_T LinkID, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pPeekDatNum,
+                          IOC_Options_pT pOption) {
+    _IOC_LinkObject_pT pReceiverLinkObj = NULL;
+    IOC_Result_T Result = __IOC_getDatReceiverLinkObj(LinkID, pDatVecs, DatVecNum, pPeekDatNum, &pReceiverLinkObj);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    _IOC_SrvProtoMethods_pT pMethods = pReceiverLinkObj->pMethods;
+    if (!pMethods || !pMethods->OpPeekDataV_F || !pMethods->OpConsumeData_F) {
+        return IOC_RESULT_NOT_SUPPORT;
+    }
+
+    return pMethods->OpPeekDataV_F(pReceiverLinkObj, pDatVecs, DatVecNum, pPeekDatNum, pOption);
+}
+
+IOC_Result_T IOC_consumeDAT(IOC_LinkID_T LinkID, ULONG_T ConsumeDatNum) {
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pReceiverLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pReceiverLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_SrvProtoMethods_pT pMethods = pReceiverLinkObj->pMethods;
+    if (!pMethods || !pMethods->OpConsumeData_F) {
+        return IOC_RESULT_INVALID_PARAM;  // Never peeked
+    }
+
+    return pMethods->OpConsumeData_F(pReceiverLinkObj, ConsumeDatNum);
+}
+
+/**
+ * @brief Query counters of the queue which delivers data to the receiver link's CbRecvDat_F
+ * @param LinkID: the DatReceiver link ID
+ * @param pDispatchStats: pointer to the counters buffer
+ * @return IOC_RESULT_SUCCESS: counters copied successfully
+ */
+IOC_Result_T IOC_getDatDispatchStats(IOC_LinkID_T LinkID, IOC_DatDispatchStats_pT pDispatchStats) {
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pReceiverLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pReceiverLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    if (!pDispatchStats) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    _IOC_SrvProtoMethods_pT pMethods = pReceiverLinkObj->pMethods;
+    if (!pMethods || !pMethods->OpGetDatDispatchStats_F) {
+        return IOC_RESULT_NOT_SUPPORT;
+    }
+
+    return pMethods->OpGetDatDispatchStats_F(pReceiverLinkObj, pDispatchStats);
+}
+
+IOC_Result_T IOC_pollDatCompletions(IOC_LinkID_T LinkID, IOC_DatCompletion_pT pCompletions, ULONG_T MaxNum,
+                                    ULONG_T *pCompletionNum, IOC_Options_pT pOption) {
+    if (LinkID == IOC_ID_INVALID) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    _IOC_LinkObject_pT pSenderLinkObj = _IOC_getLinkObjByLinkID(LinkID);
+    if (!pSenderLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    if (!(pSenderLinkObj->Args.Usage & IOC_LinkUsageDatSender)) {
+        return IOC_RESULT_INCOMPATIBLE_USAGE;
+    }
+
+    if (!pCompletions || 0 == MaxNum || !pCompletionNum) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+    *pCompletionNum = 0;
+
+    // Created here too, so a poller MAY wait before the first send with completion
+    _IOC_DatCompletionQueue_pT pQueue = __IOC_getDatCompletionQueue(pSenderLinkObj);
+    if (!pQueue) {
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    ULONG_T TimeoutUS = IOC_Option_getTimeoutUS(pOption);
+    struct timespec AbsTimeout;
+    if (TimeoutUS != IOC_TIMEOUT_INFINITE) {
+        clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+        AbsTimeout.tv_sec += TimeoutUS / 1000000;
+        AbsTimeout.tv_nsec += (TimeoutUS % 1000000) * 1000;
+        if (AbsTimeout.tv_nsec >= 1000000000) {
+            AbsTimeout.tv_sec += 1;
+            AbsTimeout.tv_nsec -= 1000000000;
+        }
+    }
+
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    pthread_mutex_lock(&pQueue->Mutex);
+    while (0 == pQueue->CompletionNum) {
+        if (TimeoutUS == IOC_TIMEOUT_INFINITE) {
+            pthread_cond_wait(&pQueue->NotEmptyCond, &pQueue->Mutex);
+        } else if (TimeoutUS == IOC_TIMEOUT_NONBLOCK) {
+            Result = IOC_RESULT_NO_DATA;
+            break;
+        } else if (ETIMEDOUT == pthread_cond_timedwait(&pQueue->NotEmptyCond, &pQueue->Mutex, &AbsTimeout)) {
+            Result = (0 == pQueue->CompletionNum) ? IOC_RESULT_TIMEOUT : IOC_RESULT_SUCCESS;
+            break;
+        }
+    }
+
+    ULONG_T CompletionNum = (pQueue->CompletionNum < MaxNum) ? pQueue->CompletionNum : MaxNum;
+    for (ULONG_T i = 0; i < CompletionNum; i++) {
+        pCompletions[i] = pQueue->pCompletions[pQueue->HeadIdx];
+        pQueue->HeadIdx = (pQueue->HeadIdx + 1) % pQueue->Capacity;
+    }
+    pQueue->CompletionNum -= CompletionNum;
+    pthread_mutex_unlock(&pQueue->Mutex);
+
+    __IOC_putDatCompletionQueue(pQueue);
+    *pCompletionNum = CompletionNum;
+    return Result;
+}
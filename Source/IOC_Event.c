@@ -2,6 +2,8 @@
 
 #include "_IOC.h"
 
+static atomic_ulong _mEvtSeqID = 0;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 IOC_Result_T IOC_postEVT(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
@@ -10,13 +12,15 @@ IOC_Result_T IOC_postEVT(
     if (NULL == pEvtDesc) {
         return IOC_RESULT_INVALID_PARAM;
     }
+    //=>[Priority]: out of IOC_EvtPriority_T such as garbage of an uninitialized field is NORMAL
+    if (pEvtDesc->Priority > IOC_EVT_PRIORITY_URGENT) {
+        pEvtDesc->Priority = IOC_EVT_PRIORITY_NORMAL;
+    }
 
     //---------------------------------------------------------------------------
     //===>>>Set EvtDesc's metadata: SeqID, TimeStamp
-    //=>[SeqID]: define a static atomic variable to keep SeqID++
-    static atomic_ulong SeqID = 0;
-    atomic_fetch_add(&SeqID, 1);
-    pEvtDesc->MsgDesc.SeqID = SeqID;
+    //=>[SeqID]: a static atomic variable shared with IOC_postEVTs to keep SeqID++
+    pEvtDesc->MsgDesc.SeqID = atomic_fetch_add(&_mEvtSeqID, 1) + 1;
     //=>[TimeStamp]
     pEvtDesc->MsgDesc.TimeStamp = IOC_getCurrentTimeSpec();
 
@@ -28,11 +32,49 @@ IOC_Result_T IOC_postEVT(
     }
 }
 
+IOC_Result_T IOC_postEVTs(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
+    /*ARG_IN_OPTIONAL*/ IOC_Options_pT pOptions) {
+    if (NULL == pEvtDescs || 0 == EvtDescNum) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        if (pEvtDescs[i].Priority > IOC_EVT_PRIORITY_URGENT) {
+            pEvtDescs[i].Priority = IOC_EVT_PRIORITY_NORMAL;  // same as IOC_postEVT
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    //===>>>Set each EvtDesc's metadata: SeqID, TimeStamp, SeqIDs of one burst are continuous.
+    ULONG_T FirstSeqID = atomic_fetch_add(&_mEvtSeqID, EvtDescNum) + 1;
+    struct timespec TimeStamp = IOC_getCurrentTimeSpec();
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        pEvtDescs[i].MsgDesc.SeqID = FirstSeqID + i;
+        pEvtDescs[i].MsgDesc.TimeStamp = TimeStamp;
+    }
+
+    //---------------------------------------------------------------------------
+    if (IOC_RESULT_YES == _IOC_isAutoLink_inConlesMode(LinkID)) {
+        return _IOC_postEVTs_inConlesMode(LinkID, pEvtDescs, EvtDescNum, pOptions);
+    }
+
+    // ConetMode has no burst path yet, post one by one in order and stop at the first failure.
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        IOC_Result_T Result = _IOC_postEVT_inConetMode(LinkID, &pEvtDescs[i], pOptions);
+        if (IOC_RESULT_SUCCESS != Result) {
+            return Result;
+        }
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
 IOC_Result_T IOC_subEVT(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_SubEvtArgs_pT pSubEvtArgs) {
     if (IOC_RESULT_YES == _IOC_isAutoLink_inConlesMode(LinkID)) {
-        return _IOC_subEVT_inConlesMode(pSubEvtArgs);
+        return _IOC_subEVT_inConlesMode(LinkID, pSubEvtArgs);
     } else {
         return _IOC_subEVT_inConetMode(LinkID, pSubEvtArgs);
     }
@@ -42,12 +84,27 @@ IOC_Result_T IOC_unsubEVT(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pUnsubEvtArgs) {
     if (IOC_RESULT_YES == _IOC_isAutoLink_inConlesMode(LinkID)) {
-        return _IOC_unsubEVT_inConlesMode(pUnsubEvtArgs);
+        return _IOC_unsubEVT_inConlesMode(LinkID, pUnsubEvtArgs);
     } else {
         return _IOC_unsubEVT_inConetMode(LinkID, pUnsubEvtArgs);
     }
 }
 
+IOC_Result_T IOC_getEvtMailboxStats(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pSuberArgs,
+    /*ARG_OUT*/ IOC_EvtMailboxStats_pT pMailboxStats) {
+    if (NULL == pSuberArgs || NULL == pMailboxStats) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    if (IOC_RESULT_YES == _IOC_isAutoLink_inConlesMode(LinkID)) {
+        return _IOC_getEvtMailboxStats_inConlesMode(LinkID, pSuberArgs, pMailboxStats);
+    } else {
+        return IOC_RESULT_NOT_SUPPORT;  // ConetMode EvtConsumer has no mailbox yet
+    }
+}
+
 void IOC_forceProcEVT(void) {
     _IOC_forceProcEvt_inConlesMode();
     // TODO: forceProcEvt_inConetMode
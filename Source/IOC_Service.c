@@ -137,6 +137,7 @@ static IOC_Result_T __IOC_allocSrvObj(/*ARG_INCONST*/ IOC_SrvArgs_pT pSrvArgs,
             pSrvObj->Args.SrvURI.Port = pSrvArgs->SrvURI.Port;
             pSrvObj->Args.UsageCapabilites = pSrvArgs->UsageCapabilites;
             pSrvObj->Args.Flags = pSrvArgs->Flags;
+            pSrvObj->Args.ListenerNum = pSrvArgs->ListenerNum;
 
             // 🚨 WHY CRITICAL FIX: The original code was missing this UsageArgs copy, causing
             // DAT callback functions (CbRecvDat_F, pCbPrivData) to be lost when service objects
@@ -211,7 +212,7 @@ static _IOC_ServiceObject_pT __IOC_getSrvObjBySrvID(IOC_SrvID_T SrvID) {
 // TODO: __IOC_putSrvObj
 
 //=================================================================================================
-#define _MAX_IOC_LINK_OBJ_NUM 32  // Increased from 8 to 32 to support auto-accept daemon threads and concurrent tests
+#define _MAX_IOC_LINK_OBJ_NUM 1024  // Both ends of hundreds of TCP links in one process, such as UT_ServicePerformanceTCP
 static _IOC_LinkObject_pT _mIOC_LinkObjTbl[_MAX_IOC_LINK_OBJ_NUM] = {};
 static pthread_mutex_t _mIOC_LinkObjTblMutex = PTHREAD_MUTEX_INITIALIZER;
 static inline void ___IOC_lockLinkObjTbl(void) { pthread_mutex_lock(&_mIOC_LinkObjTblMutex); }
@@ -299,6 +300,9 @@ void __IOC_freeLinkObj(_IOC_LinkObject_pT pLinkObj) {
     _mIOC_LinkObjTbl[___IOC_convertLinkIDToLinkObjTblIdx(pLinkObj->ID)] = NULL;
     ___IOC_unlockLinkObjTbl();
 
+    _IOC_putDatSlabPool(pLinkObj);
+    _IOC_putDatCompletionQueue(pLinkObj);
+
     // 🎯 TDD IMPLEMENTATION: Cleanup state mutexes
     pthread_mutex_destroy(&pLinkObj->ConnState.StateMutex);
     pthread_mutex_destroy(&pLinkObj->DatState.SubStateMutex);
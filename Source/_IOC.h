@@ -32,6 +32,37 @@ extern "C" {
 // 🎯 TDD GREEN: ConlesEvent SubState bridge function for DAT operations
 void _IOC_updateConlesEventSubState(IOC_LinkID_T linkID, IOC_LinkSubState_T subState);
 
+#define _IOC_MAX_DAT_SIZE (64 * 1024 * 1024)  // 64MB limit for single data chunk
+
+// Loan a slab of DataSize bytes from pLinkObj's slab pool, IOC_releaseDatBuf(*ppDatBuf) recycles it into the pool.
+IOC_Result_T _IOC_allocDatSlab(_IOC_LinkObject_pT pLinkObj, ULONG_T DataSize, IOC_DatBuf_pT *ppDatBuf, void **ppData);
+// Drop pLinkObj's reference of its slab pool, which is freed after every loaned slab is released.
+void _IOC_putDatSlabPool(_IOC_LinkObject_pT pLinkObj);
+
+// Completer of ONE send with IOC_OPTID_DAT_COMPLETION, which the protocol keeps until the receiver's result is known.
+typedef struct _IOC_DatCompleterStru {
+    IOC_LinkID_T LinkID;             // DatSender's
+    IOC_DatCompletion_T Completion;  // Tag and DataSize set by _IOC_initDatCompleter, Result by _IOC_completeDat
+    IOC_CbDatCompleted_F CbDatCompleted_F;
+    void *pCbPrivData;
+    _IOC_DatCompletionQueue_pT pQueue;     // referenced and a slot reserved, if CbDatCompleted_F is NULL
+    struct _IOC_DatCompleterStru *pNext;  // free for the protocol to list its pending completers
+} _IOC_DatCompleter_T, *_IOC_DatCompleter_pT;
+
+// Init pCompleter from pOption's IOC_OPTID_DAT_COMPLETION, or zero it if not set.
+IOC_Result_T _IOC_initDatCompleter(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption, ULONG_T DataSize,
+                                   _IOC_DatCompleter_pT pCompleter);
+// Whether pCompleter has a completion to report, i.e. _IOC_completeDat or _IOC_cancelDatCompleter is due.
+static inline bool _IOC_isDatCompleterArmed(const _IOC_DatCompleter_T *pCompleter) {
+    return pCompleter->CbDatCompleted_F || pCompleter->pQueue;
+}
+// Report the receiver's Result by the callback or the link's completion queue, then disarm pCompleter.
+void _IOC_completeDat(_IOC_DatCompleter_pT pCompleter, IOC_Result_T Result);
+// Disarm pCompleter without reporting, for a send which failed, as its caller gets the error instead.
+void _IOC_cancelDatCompleter(_IOC_DatCompleter_pT pCompleter);
+// Drop pLinkObj's reference of its completion queue, which is freed after every pending completer is done.
+void _IOC_putDatCompletionQueue(_IOC_LinkObject_pT pLinkObj);
+
 // 🎯 TDD GREEN: Role negotiation helper for multi-role service support (US-3)
 // Computes complementary link role: Client=Executor → Service=Initiator on that link
 IOC_LinkUsage_T _IOC_negotiateLinkRole(IOC_LinkUsage_T ServiceCapabilities, IOC_LinkUsage_T ClientRequestedUsage);
@@ -16,14 +16,20 @@
 //======>>>>>>BEGIN OF DESIGN FOR ConlesEvent>>>>>>====================================================================
 /**
  * An [AutoLinkID] is a unique predefined LinkID used by a group of EvtProducers and EvtConsumers in ConlesMode.
- *     IOC_CONLES_MODE_AUTO_LINK_ID is support by default, and other values are reserved for future use.
+ *     IOC_CONLES_MODE_AUTO_LINK_ID(_0) is the default, and _1/_2/... are valid up to _CONLES_EVENT_MAX_AUTO_LINK,
+ *     others below IOC_CONLES_MODE_AUTO_LINK_ID_MAX are still AutoLinkIDs but INVALID_AUTO_LINK_ID.
  * Each AutoLinkID corresponds to a [ConlesEventLinkObject](a.k.a ClsEvtLinkObj) as an aggregation of all.
+ *     Each ClsEvtLinkObj's EvtProcThread is created when its first ClsEvtSuber comes,
+ *       so unused AutoLinkIDs cost no thread.
  *
- * Each ClsEvtLinkObj has a [EvtDescQueue] to save all EvtDesc,
+ * Each ClsEvtLinkObj has a [EvtDescQueue] for each IOC_EvtPriority_T as a lane to save all EvtDesc,
  *   which posted by EvtProducers use _IOC_postEVT_inConlesMode by default in async mode.
- *     And the EvtQueue is a FIFO queue, the size is limited by _CONLES_EVENT_MAX_QUEUING_EVTDESC.
- *          (TODO: adjust this static size when _IOC_initModule_inConlesMode)
+ *     And each lane is a FIFO queue, whose depth is _CONLES_EVENT_DEPTH_EVTDESC_QUEUE set at build time,
+ *       which defaults to _CONLES_EVENT_MAX_QUEUING_EVTDESC and is allocated when ClsEvtLinkObj is initialized.
+ *       EvtProcThread drains higher lanes first, and serves a lower lane after it's skipped a while.
  *     Then each EvtDesc in EvtDescQueue will be processed by a [EvtProcThread] for this AutoLinkID.
+ *       EvtProcThread sleeps on Cond until QueuedEvtNum != CallbacedEvtNum without polling timeout,
+ *         and who waits EvtProcThread's progress(forceProcEVT, Timeout/MayBlock postEVT) sleeps on ProcedCond.
  *   If EvtProducers use _IOC_postEVT_inConlesMode in sync mode,
  *      the EvtDesc will be processed immediately if EvtQueue is empty, or wait until the EvtQueue is empty.
  *
@@ -31,8 +37,7 @@
  *     with AutoLinkID and IOC_SubEvtArgs_T, and finally get an IOC_RESULT_SUCCESS.
  *     And he may call _IOC_unsubEVT_inConlesMode to unsubscribe the event any time.
  * Each ClsEvtSuber is saved in a [EvtSuberList] identified by AutoLinkID and only belongs to this AutoLinkID.
- *      And the EvtSuberList's size is limited by _CONLES_EVENT_MAX_SUBSCRIBER.
- *          (TODO: adjust this static size when _IOC_initModule_inConlesMode)
+ *      And the EvtSuberList's size is limited by _CONLES_EVENT_MAX_SUBSCRIBER set at build time.
  *
  * RefDiagram: _IOC_ConlesEvent.md
  */
@@ -40,15 +45,66 @@
 
 #include "_IOC_ConlesEvent.h"
 
+#include <errno.h>
 #include <stdatomic.h>
 #include <stdbool.h>
 #include <unistd.h>
 
 #include "_IOC_EvtDescQueue.h"
+#include "_IOC_SnapshotPtr.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //======>>>>>>BEGIN OF DEFINE FOR ConlesEvent>>>>>>====================================================================
+// Max number of ClsEvtSubers of each AutoLinkID,
+//  may be overridden at build time such as -D_CONLES_EVENT_MAX_SUBSCRIBER=256.
+#ifndef _CONLES_EVENT_MAX_SUBSCRIBER
 #define _CONLES_EVENT_MAX_SUBSCRIBER 128  // Increased from 16 to support high-concurrency scenarios
+#endif
+
+// How many AutoLinkIDs from IOC_CONLES_MODE_AUTO_LINK_ID_0 are valid,
+//  may be overridden at build time such as -D_CONLES_EVENT_MAX_AUTO_LINK=4,
+//  users get it by IOC_getCapability as AutoLinkNum, so it's never baked into their build.
+#ifndef _CONLES_EVENT_MAX_AUTO_LINK
+#define _CONLES_EVENT_MAX_AUTO_LINK 8
+#endif
+#if _CONLES_EVENT_MAX_AUTO_LINK < 1 || _CONLES_EVENT_MAX_AUTO_LINK > 1024  // IOC_CONLES_MODE_AUTO_LINK_ID_MAX
+#error "_CONLES_EVENT_MAX_AUTO_LINK MUST be in [1, 1024]"
+#endif
+
+// Depth of each ClsEvtLinkObj's EvtDescQueue, rounded up to power of two by EvtDescQueue,
+//  may be overridden at build time such as -D_CONLES_EVENT_DEPTH_EVTDESC_QUEUE=1024.
+#ifndef _CONLES_EVENT_DEPTH_EVTDESC_QUEUE
+#define _CONLES_EVENT_DEPTH_EVTDESC_QUEUE _CONLES_EVENT_MAX_QUEUING_EVTDESC
+#endif
+
+// Max number of EvtDescs dequeued by EvtProcThread at once, then callbacked one by one.
+#define _CONLES_EVENT_PROC_EVTDESC_BATCH 16
+
+// Each ClsEvtLinkObj has one EvtDescQueue as a lane for each IOC_EvtPriority_T.
+#define _CONLES_EVENT_PRIORITY_LANE_NUM (IOC_EVT_PRIORITY_URGENT + 1)
+
+// A non-empty lower lane is served once after it's skipped this times by higher lanes' batches,
+//  so it's never starved but only gets about 1/(N+1) of EvtProcThread when higher lanes are saturated.
+#ifndef _CONLES_EVENT_MAX_LANE_SKIPPED_NUM
+#define _CONLES_EVENT_MAX_LANE_SKIPPED_NUM 8
+#endif
+
+// Max number of worker threads shared by all AutoLinks to callback IOC_SUBEVT_FLAG_WORKER_POOL EvtSubers,
+//  the real number is the online CPU number, but at least 2 and at most this.
+#ifndef _CONLES_EVENT_MAX_DISPATCH_WORKER
+#define _CONLES_EVENT_MAX_DISPATCH_WORKER 8
+#endif
+
+// Default depth of each EvtSuber's mailbox if IOC_SubEvtArgs_T::MailboxCapacity is 0,
+//  and what to do if it's full is decided by IOC_SubEvtArgs_T::OverflowPolicy.
+#ifndef _CONLES_EVENT_DEPTH_SUBER_MAILBOX
+#define _CONLES_EVENT_DEPTH_SUBER_MAILBOX 64
+#endif
+
+// Max IOC_SubEvtArgs_T::MailboxCapacity, COALESCE_BY_EVTID scans the whole mailbox when it's full.
+#ifndef _CONLES_EVENT_MAX_DEPTH_SUBER_MAILBOX
+#define _CONLES_EVENT_MAX_DEPTH_SUBER_MAILBOX 1024
+#endif
 
 //---------------------------------------------------------------------------------------------------------------------
 typedef enum {
@@ -56,18 +112,116 @@ typedef enum {
     Subed = 1,
 } _ClsEvtSuberState_T;
 
+struct _ClsEvtLinkObjStru;
+
+// One EvtDesc of ClsEvtSuberMailbox's backlog, RefMore: IOC_EVT_OVERFLOW_BLOCK
+typedef struct _ClsEvtBackloggedEvtDescStru {
+    IOC_EvtDesc_T EvtDesc;
+    struct _ClsEvtBackloggedEvtDescStru *pNext;
+} _ClsEvtBackloggedEvtDesc_T, *_ClsEvtBackloggedEvtDesc_pT;
+
+/**
+ * @brief DataType of ClsEvtSuberMailbox, created for each EvtSuber who subEVT with IOC_SUBEVT_FLAG_WORKER_POOL,
+ *    whose MailboxCapacity/OverflowPolicy set it.
+ *    EvtProcThread enqueues matched EvtDescs into it instead of callback, and schedules it to ClsEvtWorkerPool
+ *      if not scheduled yet. Only one worker drains a scheduled mailbox at a time, so CbProcEvt of one EvtSuber
+ *      is called in order, while different EvtSubers' CbProcEvt are called in parallel by different workers.
+ *    RefCnt is held by: EvtSuber's slot until unsubEVT, each ClsEvtDispatchTbl referring it,
+ *      and ClsEvtWorkerPool while it's scheduled.
+ */
+typedef struct _ClsEvtSuberMailboxStru {
+    atomic_ulong RefCnt;
+    struct _ClsEvtLinkObjStru *pLinkObj;
+    IOC_CbProcEvt_F CbProcEvt_F;
+    void *pCbPrivData;
+
+    atomic_bool IsUnsubed;                       // set by unsubEVT, then queued EvtDescs are dropped
+    atomic_bool IsScheduled;                     // in ClsEvtWorkerPool's ReadyList or being drained by a worker
+    struct _ClsEvtSuberMailboxStru *pNextReady;  // protected by ClsEvtWorkerPool's Mutex
+
+    // EvtProcThread is the only producer, except the worker moving backlogged EvtDescs in while it's not.
+    _IOC_EvtDescQueue_T EvtDescQueue;
+    IOC_EvtOverflowPolicy_T OverflowPolicy;
+    IOC_EvtDesc_pT pCoalescingEvtDescs;  // Capacity+1 EvtDescs, only for IOC_EVT_OVERFLOW_COALESCE_BY_EVTID
+
+    /**
+     * @brief IOC_EVT_OVERFLOW_BLOCK: EvtDescs not enqueued while EvtDescQueue is full are appended here in order
+     *    by EvtProcThread, and moved into EvtDescQueue by worker after it frees space, both under BacklogMutex.
+     *  So EvtProcThread never waits for this EvtSuber, but postEVTs of its EvtIDs are pushed back meanwhile,
+     *    RefMore: __IOC_ClsEvt_isBackloggedForEvtDescs
+     */
+    pthread_mutex_t BacklogMutex;
+    _ClsEvtBackloggedEvtDesc_pT pBacklogHead, pBacklogTail;
+    atomic_ulong BackloggedEvtNum;
+
+    // written by EvtProcThread only, and read by IOC_getEvtMailboxStats
+    atomic_ulong HighWatermark;
+    atomic_ulong DroppedEvtNum;
+    atomic_ulong CoalescedEvtNum;
+    atomic_ulong BlockedEvtNum;
+} _ClsEvtSuberMailbox_T, *_ClsEvtSuberMailbox_pT;
+
 /**
  * @brief DataType of one ClsEvtSuber
  */
 typedef struct {
     _ClsEvtSuberState_T State;
     IOC_SubEvtArgs_T Args;
+    _ClsEvtSuberMailbox_pT pMailbox;  // NULL if CbProcEvt is called by EvtProcThread
 } _ClsEvtSuber_T, *_ClsEvtSuber_pT;
 
+/**
+ * @brief DataType of ClsEvtDispatchTbl, an immutable EvtID->ClsEvtSuberCbs index built from Subers.
+ *    Entries is a open addressing hash table with linear probing, each used entry has at least one SuberCb.
+ *    EvtIDs not in Entries only match AnySuberCbs, who subEVT with EvtNum==0.
+ *    SuberCbs of each entry keep the order of Subers' slots, same as the order before indexing.
+ *
+ *    Subers is the only source of truth, and each subEVT/unsubEVT builds a new ClsEvtDispatchTbl copy-on-write,
+ *      so dispatch looks up the current one and callbacks its SuberCbs without taking EvtSuberList's Mutex.
+ *    The new one is derived from the current one, where only entries of the changed EvtSuber's EvtIDs are re-derived,
+ *      or all entries if it subEVT with EvtNum==0, and others are copied as they are, without scanning Subers.
+ */
+typedef struct {
+    IOC_CbProcEvt_F CbProcEvt_F;
+    void *pCbPrivData;
+    _ClsEvtSuberMailbox_pT pMailbox;  // NULL if callback by EvtProcThread
+    ULONG_T SlotIdx;                  // of the EvtSuber in Subers, SuberCbs are in its order
+} _ClsEvtSuberCb_T, *_ClsEvtSuberCb_pT;
+
+typedef struct {
+    bool IsUsed;
+    IOC_EvtID_T EvtID;
+    ULONG_T SuberCbNum;
+    _ClsEvtSuberCb_pT pSuberCbs;
+} _ClsEvtDispatchEntry_T, *_ClsEvtDispatchEntry_pT;
+
+typedef struct {
+    _IOC_SnapshotHdr_T SnapshotHdr;  // MUST be first, published by EvtSuberList's DispatchTbl
+
+    ULONG_T EntryMask;  // EntryNum - 1, EntryNum is power of two
+    _ClsEvtDispatchEntry_pT pEntries;
+
+    ULONG_T AnySuberCbNum;
+    _ClsEvtSuberCb_pT pAnySuberCbs;
+
+    // each referred ClsEvtSuberMailbox holds one RefCnt by this table, released when this table is freed.
+    ULONG_T MailboxNum;
+    _ClsEvtSuberMailbox_pT *ppMailboxes;
+} _ClsEvtDispatchTbl_T, *_ClsEvtDispatchTbl_pT;
+
 typedef struct {
     pthread_mutex_t Mutex;  // Used to protect Subers
     atomic_ulong SuberNum;
+    ULONG_T SuberSlotEnd;  // 1 + the last Subed slot of Subers, 0 if none, no scan of Subers goes beyond it
     _ClsEvtSuber_T Subers[_CONLES_EVENT_MAX_SUBSCRIBER];
+
+    /**
+     * @brief DispatchTbl is a snapshot of _ClsEvtDispatchTbl_T, published under Mutex and read without it.
+     *  The old one is retired and freed after its readers leave, subEVT/unsubEVT never wait for them,
+     *    so CbProcEvt may subEVT/unsubEVT while it's called from the old one.
+     *  NULL means no EvtSuber.
+     */
+    _IOC_SnapshotPtr_T DispatchTbl;
 } _ClsEvtSuberList_T, *_ClsEvtSuberList_pT;
 
 #if 0
@@ -82,30 +236,52 @@ static IOC_BoolResult_T __IOC_ClsEvt_isEmptySuberList(_ClsEvtSuberList_pT pEvtSu
 /**
  * @brief DataType of ClsEvtLinkObj
  */
-typedef struct {
-    IOC_LinkID_T LinkID;  // AutoLinkID = IOC_CONLES_MODE_AUTO_LINK_ID/...
+typedef struct _ClsEvtLinkObjStru {
+    IOC_LinkID_T LinkID;  // AutoLinkID = IOC_CONLES_MODE_AUTO_LINK_ID_0/_1/...
 
     /**
      * @brief each postEVT to this LinkID will wakeup by
      */
-    pthread_mutex_t Mutex;  // Used to protect EvtLinkObj
+    pthread_mutex_t Mutex;  // Used to protect EvtLinkObj, taken by subEVT/unsubEVT and SyncMode postEVT, not AsyncMode
+
+    // AsyncMode MayBlock postEVTs wait for EvtDescQueue's space one by one under it,
+    //  RefMore: __IOC_postEVT_inConlesModeAsyncBlocked
+    pthread_mutex_t BlockedPostMutex;
+
+    pthread_cond_t Cond;        // Used to wakeup EvtProcThread when QueuedEvtNum != CallbacedEvtNum
+    pthread_mutex_t CondMutex;  // Used to protect Cond and ProcedCond
+
+    // EvtProcThread is waiting on Cond, producers only signal Cond when it's set.
+    atomic_bool IsEvtProcThreadWaiting;
 
-    pthread_cond_t Cond;        // Used to wakeup EvtProcThread
-    pthread_mutex_t CondMutex;  // Used to protect Cond
+    // Used to wakeup who is waiting CallbacedEvtNum to move, such as forceProcEVT or postEVT in Timeout/MayBlock mode.
+    pthread_cond_t ProcedCond;
+    atomic_ulong ProcedWaiterNum;  // EvtProcThread only broadcast ProcedCond when it's not zero.
 
     /**
      * @brief each LinkObj has a thread to procEvt=call each EvtSuber's CbProcEvt_F if EvtID matched.
+     *  IsThreadStarted is set under Mutex when first EvtSuber comes.
      */
     pthread_t ThreadID;
+    bool IsThreadStarted;
 
-    _IOC_EvtDescQueue_T EvtDescQueue;
+    // EvtDescQueues[IOC_EvtPriority_T], LaneSkippedNum is only used by EvtProcThread,
+    //  RefMore: __IOC_ClsEvt_dequeueEvtDescsByPriority
+    _IOC_EvtDescQueue_T EvtDescQueues[_CONLES_EVENT_PRIORITY_LANE_NUM];
+    ULONG_T LaneSkippedNum[_CONLES_EVENT_PRIORITY_LANE_NUM];
     _ClsEvtSuberList_T EvtSuberList;
 
     // atomic counter:
     //   1) how many EvtDesc enqueued EvtDescQueue
     //   2) how many EvtDesc is callbacked by EvtProcThread
-    //   WHEN QueuedEvtNum == CallbacedEvtNum, LinkObj has no EvtDesc queueing or callbacking.
+    //   3) how many EvtDesc is enqueued to ClsEvtSuberMailbox by EvtProcThread but not yet callbacked by worker
+    //   WHEN QueuedEvtNum == CallbacedEvtNum && DispatchingEvtNum == 0, LinkObj has no EvtDesc queueing or callbacking.
     atomic_ulong QueuedEvtNum, CallbacedEvtNum;
+    atomic_ulong DispatchingEvtNum;
+
+    // EvtDescs in ClsEvtSuberMailboxes' backlog now, and ever moved out of them by workers,
+    //  RefMore: IOC_EVT_OVERFLOW_BLOCK and __IOC_ClsEvt_getLinkObjProcedNum
+    atomic_ulong BackloggedEvtNum, UnbackloggedEvtNum;
 
     /**
      * RefState: README_ArchDesign.md
@@ -131,6 +307,12 @@ static void __IOC_ClsEvt_putLinkObj(_ClsEvtLinkObj_pT pLinkObj);
 
 static void __IOC_ClsEvt_wakeupLinkObjThread(_ClsEvtLinkObj_pT pLinkObj);
 static void __IOC_ClsEvt_waitLinkObjNewEvtDesc(_ClsEvtLinkObj_pT pLinkObj);
+static void __IOC_ClsEvt_notifyLinkObjNewEvtDescs(_ClsEvtLinkObj_pT pLinkObj, ULONG_T EvtDescNum);
+
+static void __IOC_ClsEvt_notifyLinkObjProcedEvtDescs(_ClsEvtLinkObj_pT pLinkObj, ULONG_T EvtDescNum);
+static ULONG_T __IOC_ClsEvt_getLinkObjProcedNum(_ClsEvtLinkObj_pT pLinkObj);
+static void __IOC_ClsEvt_waitLinkObjProcedEvtDesc(_ClsEvtLinkObj_pT pLinkObj, ULONG_T LastProcedNum,
+                                                  ULONG_T TimeoutUS);
 
 static void *__IOC_ClsEvt_callbackProcEvtThread(void *arg);
 #endif
@@ -162,9 +344,20 @@ static IOC_Result_T __IOC_ClsEvt_removeSuberFromLinkObj(_ClsEvtLinkObj_pT pEvtLi
                                                         IOC_UnsubEvtArgs_pT pUnsubEvtArgs);
 
 static void __IOC_ClsEvt_callbackProcEvtOverSuberList(_ClsEvtLinkObj_pT pEvtLinkObj,
-                                                      IOC_EvtDesc_pT pEvtDesc);
+                                                      IOC_EvtDesc_pT pEvtDesc, bool IsByEvtProcThread);
 #endif
 
+// ClsEvtWorkerPool of IOC_SUBEVT_FLAG_WORKER_POOL EvtSubers, shared by all ClsEvtLinkObjs.
+static IOC_Result_T __IOC_ClsEvt_startWorkerPoolOnce(void);
+static bool __IOC_ClsEvt_isSuberWithMailbox(IOC_SubEvtArgs_pT pSubEvtArgs);
+static _ClsEvtSuberMailbox_pT __IOC_ClsEvt_newSuberMailbox(_ClsEvtLinkObj_pT pLinkObj, IOC_SubEvtArgs_pT pSubEvtArgs);
+static void __IOC_ClsEvt_getSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox);
+static void __IOC_ClsEvt_putSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox);
+// EvtProcThread side: enqueue EvtDesc to pMailbox and schedule it, never wait even if pMailbox is full.
+static void __IOC_ClsEvt_postEvtDescToSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox, IOC_EvtDesc_pT pEvtDesc);
+// Return: true if caller is a worker who is calling CbProcEvt of pLinkObj's EvtSuber.
+static bool __IOC_ClsEvt_isInWorkerCbProcEvtOfLinkObj(_ClsEvtLinkObj_pT pLinkObj);
+
 // RefDoc: README_ArchDesign.md
 //     |-> State
 //       |-> EVT::Conles
@@ -220,7 +413,10 @@ static void __IOC_ClsEvt_transferLinkObjStateByBehavior(_ClsEvtLinkObj_pT pLinkO
 static void __IOC_ClsEvt_initSuberList(_ClsEvtSuberList_pT pEvtSuberList) {
     pthread_mutex_init(&pEvtSuberList->Mutex, NULL);
     pEvtSuberList->SuberNum = 0;
+    pEvtSuberList->SuberSlotEnd = 0;
     memset(pEvtSuberList->Subers, 0, sizeof(pEvtSuberList->Subers));
+
+    _IOC_SnapshotPtr_initOne(&pEvtSuberList->DispatchTbl);
 }
 static void __IOC_ClsEvt_deinitSuberList(_ClsEvtSuberList_pT pEvtSuberList) {
     // deinit all checkable members only
@@ -232,6 +428,366 @@ static void __IOC_ClsEvt_deinitSuberList(_ClsEvtSuberList_pT pEvtSuberList) {
     if (PosixResult != 0) {
         _IOC_LogAssert(PosixResult == 0);
     }
+
+    _IOC_SnapshotPtr_deinitOne(&pEvtSuberList->DispatchTbl);
+}
+
+static ULONG_T __IOC_ClsEvt_hashEvtID(IOC_EvtID_T EvtID) {
+    // Fibonacci hashing, EvtName is bitmask in high bits, so mix all bits into the low bits.
+    return (ULONG_T)((EvtID * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+static _ClsEvtDispatchEntry_pT __IOC_ClsEvt_findDispatchEntry(_ClsEvtDispatchTbl_pT pDispatchTbl, IOC_EvtID_T EvtID) {
+    ULONG_T Pos = __IOC_ClsEvt_hashEvtID(EvtID) & pDispatchTbl->EntryMask;
+
+    while (pDispatchTbl->pEntries[Pos].IsUsed) {
+        if (pDispatchTbl->pEntries[Pos].EvtID == EvtID) {
+            return &pDispatchTbl->pEntries[Pos];
+        }
+        Pos = (Pos + 1) & pDispatchTbl->EntryMask;
+    }
+
+    return NULL;
+}
+
+// Find EvtID's entry, or insert a new one at the first empty position if not found.
+static _ClsEvtDispatchEntry_pT __IOC_ClsEvt_findOrInsertDispatchEntry(_ClsEvtDispatchTbl_pT pDispatchTbl,
+                                                                      IOC_EvtID_T EvtID) {
+    ULONG_T Pos = __IOC_ClsEvt_hashEvtID(EvtID) & pDispatchTbl->EntryMask;
+
+    while (pDispatchTbl->pEntries[Pos].IsUsed) {
+        if (pDispatchTbl->pEntries[Pos].EvtID == EvtID) {
+            return &pDispatchTbl->pEntries[Pos];
+        }
+        Pos = (Pos + 1) & pDispatchTbl->EntryMask;
+    }
+
+    pDispatchTbl->pEntries[Pos].IsUsed = true;
+    pDispatchTbl->pEntries[Pos].EvtID = EvtID;
+    return &pDispatchTbl->pEntries[Pos];
+}
+
+// Return true if pSuber has subscribed EvtIDs[Idx] before Idx, to count each EvtSuber once per EvtID.
+static bool __IOC_ClsEvt_isDupSubEvtID(_ClsEvtSuber_pT pSuber, ULONG_T Idx) {
+    for (ULONG_T i = 0; i < Idx; i++) {
+        if (pSuber->Args.pEvtIDs[i] == pSuber->Args.pEvtIDs[Idx]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// FreeSnapshot_F of ClsEvtDispatchTbl, called when it's retired and no reader is using it.
+static void __IOC_ClsEvt_freeDispatchTbl(_IOC_SnapshotHdr_pT pSnapshot) {
+    _ClsEvtDispatchTbl_pT pDispatchTbl = (_ClsEvtDispatchTbl_pT)pSnapshot;
+
+    for (ULONG_T i = 0; i < pDispatchTbl->MailboxNum; i++) {
+        __IOC_ClsEvt_putSuberMailbox(pDispatchTbl->ppMailboxes[i]);
+    }
+    free(pDispatchTbl);
+}
+
+/**
+ * @brief Build a new ClsEvtDispatchTbl from current Subers, MUST be called with EvtSuberList's Mutex locked.
+ *  Entries, SuberCbs, Mailboxes and the table itself are in ONE allocation, freed by __IOC_ClsEvt_freeDispatchTbl.
+ * @return NULL if no EvtSuber or out of memory(*pResult==IOC_RESULT_POSIX_ENOMEM).
+ */
+static _ClsEvtDispatchTbl_pT __IOC_ClsEvt_buildDispatchTbl(_ClsEvtSuberList_pT pSuberList, IOC_Result_T *pResult) {
+    ULONG_T SubEvtIDNum = 0, AnySuberNum = 0, SuberNum = 0, MailboxNum = 0;
+
+    *pResult = IOC_RESULT_SUCCESS;
+
+    // 1) count how many entries and SuberCbs at most
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
+        _ClsEvtSuber_pT pSuber = &pSuberList->Subers[i];
+        if (pSuber->State == Subed) {
+            SuberNum++;
+            MailboxNum += (pSuber->pMailbox != NULL) ? 1 : 0;
+            if (pSuber->Args.EvtNum == 0) {
+                AnySuberNum++;
+            } else {
+                SubEvtIDNum += pSuber->Args.EvtNum;
+            }
+        }
+    }
+
+    if (SuberNum == 0) {
+        return NULL;
+    }
+
+    ULONG_T EntryNum = 1;
+    while (EntryNum < SubEvtIDNum * 2) {
+        EntryNum <<= 1;
+    }
+
+    // each EvtID's SuberCbs also include all AnySuberCbs, so SubEvtIDNum*(1+AnySuberNum) is the upper bound.
+    ULONG_T SuberCbNum = AnySuberNum + SubEvtIDNum * (1 + AnySuberNum);
+    size_t TblSize = sizeof(_ClsEvtDispatchTbl_T) + EntryNum * sizeof(_ClsEvtDispatchEntry_T) +
+                     SuberCbNum * sizeof(_ClsEvtSuberCb_T) + MailboxNum * sizeof(_ClsEvtSuberMailbox_pT);
+
+    _ClsEvtDispatchTbl_pT pDispatchTbl = (_ClsEvtDispatchTbl_pT)calloc(1, TblSize);
+    if (NULL == pDispatchTbl) {
+        _IOC_LogError("Failed to alloc ClsEvtDispatchTbl(Size=%zu)", TblSize);
+        *pResult = IOC_RESULT_POSIX_ENOMEM;
+        return NULL;
+    }
+
+    pDispatchTbl->SnapshotHdr.FreeSnapshot_F = __IOC_ClsEvt_freeDispatchTbl;
+    pDispatchTbl->EntryMask = EntryNum - 1;
+    pDispatchTbl->pEntries = (_ClsEvtDispatchEntry_pT)(pDispatchTbl + 1);
+    pDispatchTbl->pAnySuberCbs = (_ClsEvtSuberCb_pT)(pDispatchTbl->pEntries + EntryNum);
+    pDispatchTbl->ppMailboxes = (_ClsEvtSuberMailbox_pT *)(pDispatchTbl->pAnySuberCbs + SuberCbNum);
+    _ClsEvtSuberCb_pT pNextSuberCbs = pDispatchTbl->pAnySuberCbs + AnySuberNum;
+
+    // 2) insert each distinct EvtID and count its SuberCbs, including AnySubers
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
+        _ClsEvtSuber_pT pSuber = &pSuberList->Subers[i];
+        if (pSuber->State != Subed) {
+            continue;
+        }
+
+        for (ULONG_T j = 0; j < pSuber->Args.EvtNum; j++) {
+            if (!__IOC_ClsEvt_isDupSubEvtID(pSuber, j)) {
+                __IOC_ClsEvt_findOrInsertDispatchEntry(pDispatchTbl, pSuber->Args.pEvtIDs[j])->SuberCbNum++;
+            }
+        }
+    }
+
+    for (ULONG_T Pos = 0; Pos < EntryNum; Pos++) {
+        _ClsEvtDispatchEntry_pT pEntry = &pDispatchTbl->pEntries[Pos];
+        if (pEntry->IsUsed) {
+            pEntry->pSuberCbs = pNextSuberCbs;
+            pNextSuberCbs += pEntry->SuberCbNum + AnySuberNum;
+            pEntry->SuberCbNum = 0;  // recount when filling
+        }
+    }
+
+    // 3) fill SuberCbs in the order of Subers' slots
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
+        _ClsEvtSuber_pT pSuber = &pSuberList->Subers[i];
+        if (pSuber->State != Subed) {
+            continue;
+        }
+
+        _ClsEvtSuberCb_T SuberCb = {
+            .CbProcEvt_F = pSuber->Args.CbProcEvt_F,
+            .pCbPrivData = pSuber->Args.pCbPrivData,
+            .pMailbox = pSuber->pMailbox,
+            .SlotIdx = i,
+        };
+
+        if (pSuber->pMailbox != NULL) {
+            __IOC_ClsEvt_getSuberMailbox(pSuber->pMailbox);
+            pDispatchTbl->ppMailboxes[pDispatchTbl->MailboxNum++] = pSuber->pMailbox;
+        }
+
+        if (pSuber->Args.EvtNum == 0) {
+            pDispatchTbl->pAnySuberCbs[pDispatchTbl->AnySuberCbNum++] = SuberCb;
+
+            for (ULONG_T Pos = 0; Pos < EntryNum; Pos++) {
+                _ClsEvtDispatchEntry_pT pEntry = &pDispatchTbl->pEntries[Pos];
+                if (pEntry->IsUsed) {
+                    pEntry->pSuberCbs[pEntry->SuberCbNum++] = SuberCb;
+                }
+            }
+        } else {
+            for (ULONG_T j = 0; j < pSuber->Args.EvtNum; j++) {
+                if (!__IOC_ClsEvt_isDupSubEvtID(pSuber, j)) {
+                    _ClsEvtDispatchEntry_pT pEntry =
+                        __IOC_ClsEvt_findDispatchEntry(pDispatchTbl, pSuber->Args.pEvtIDs[j]);
+                    pEntry->pSuberCbs[pEntry->SuberCbNum++] = SuberCb;
+                }
+            }
+        }
+    }
+
+    return pDispatchTbl;
+}
+
+// Copy SrcNum SuberCbs into pDstSuberCbs with pOneSuberCb inserted by its SlotIdx if IsSub, or removed if not.
+// Return: number of SuberCbs copied
+static ULONG_T __IOC_ClsEvt_copySuberCbsWithOne(_ClsEvtSuberCb_pT pDstSuberCbs, const _ClsEvtSuberCb_T *pSrcSuberCbs,
+                                               ULONG_T SrcNum, const _ClsEvtSuberCb_T *pOneSuberCb, bool IsSub) {
+    ULONG_T DstNum = 0;
+    bool IsInserted = !IsSub;
+
+    for (ULONG_T i = 0; i < SrcNum; i++) {
+        if (!IsInserted && pSrcSuberCbs[i].SlotIdx > pOneSuberCb->SlotIdx) {
+            pDstSuberCbs[DstNum++] = *pOneSuberCb;
+            IsInserted = true;
+        }
+        if (!IsSub && pSrcSuberCbs[i].SlotIdx == pOneSuberCb->SlotIdx) {
+            continue;
+        }
+        pDstSuberCbs[DstNum++] = pSrcSuberCbs[i];
+    }
+    if (!IsInserted) {
+        pDstSuberCbs[DstNum++] = *pOneSuberCb;
+    }
+    return DstNum;
+}
+
+// Return true if pSuber subEVT EvtID by its EvtIDs.
+static bool __IOC_ClsEvt_isSubEvtIDOfSuber(_ClsEvtSuber_pT pSuber, IOC_EvtID_T EvtID) {
+    for (ULONG_T i = 0; i < pSuber->Args.EvtNum; i++) {
+        if (pSuber->Args.pEvtIDs[i] == EvtID) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Derive a new ClsEvtDispatchTbl from the current one after Subers[SlotIdx] is just Subed or UnSubed,
+ *    MUST be called with EvtSuberList's Mutex locked, and only then, as the current one misses that change.
+ *  Only entries of the EvtSuber's EvtIDs are re-derived, or all entries if its EvtNum==0, others are copied,
+ *    so a subEVT/unsubEVT no longer scans all Subers' EvtIDs. Since the table is immutable and in ONE allocation,
+ *    it still copies the whole table, but by memcpy of each entry's SuberCbs.
+ * @return same as __IOC_ClsEvt_buildDispatchTbl.
+ */
+static _ClsEvtDispatchTbl_pT __IOC_ClsEvt_updateDispatchTbl(_ClsEvtSuberList_pT pSuberList, ULONG_T SlotIdx,
+                                                            IOC_Result_T *pResult) {
+    _ClsEvtDispatchTbl_pT pOldTbl = (_ClsEvtDispatchTbl_pT)_IOC_SnapshotPtr_getForWriter(&pSuberList->DispatchTbl);
+    if (NULL == pOldTbl || 0 == pSuberList->SuberSlotEnd) {
+        return __IOC_ClsEvt_buildDispatchTbl(pSuberList, pResult);  // the first EvtSuber, or none left
+    }
+
+    *pResult = IOC_RESULT_SUCCESS;
+
+    _ClsEvtSuber_pT pSuber = &pSuberList->Subers[SlotIdx];
+    bool IsSub = (pSuber->State == Subed);
+    bool IsAnySuber = (pSuber->Args.EvtNum == 0);
+    _ClsEvtSuberCb_T SuberCb = {
+        .CbProcEvt_F = pSuber->Args.CbProcEvt_F,
+        .pCbPrivData = pSuber->Args.pCbPrivData,
+        .pMailbox = pSuber->pMailbox,
+        .SlotIdx = SlotIdx,
+    };
+
+    ULONG_T AnySuberNum = pOldTbl->AnySuberCbNum;
+    if (IsAnySuber) {
+        AnySuberNum = IsSub ? AnySuberNum + 1 : AnySuberNum - 1;
+    }
+    ULONG_T MailboxNum = pOldTbl->MailboxNum;
+    if (pSuber->pMailbox != NULL) {
+        MailboxNum = IsSub ? MailboxNum + 1 : MailboxNum - 1;
+    }
+
+    // 1) count entries kept and SuberCbs, an entry left with AnySubers only is dropped, same as no entry
+    ULONG_T OldEntryNum = pOldTbl->EntryMask + 1;
+    ULONG_T KeptEntryNum = 0, SuberCbNum = AnySuberNum;
+    for (ULONG_T Pos = 0; Pos < OldEntryNum; Pos++) {
+        _ClsEvtDispatchEntry_pT pOldEntry = &pOldTbl->pEntries[Pos];
+        if (!pOldEntry->IsUsed) {
+            continue;
+        }
+
+        ULONG_T EntrySuberCbNum = pOldEntry->SuberCbNum;
+        if (IsAnySuber || __IOC_ClsEvt_isSubEvtIDOfSuber(pSuber, pOldEntry->EvtID)) {
+            EntrySuberCbNum = IsSub ? EntrySuberCbNum + 1 : EntrySuberCbNum - 1;
+        }
+        if (EntrySuberCbNum > AnySuberNum) {
+            KeptEntryNum++;
+            SuberCbNum += EntrySuberCbNum;
+        }
+    }
+    for (ULONG_T j = 0; IsSub && j < pSuber->Args.EvtNum; j++) {
+        if (!__IOC_ClsEvt_isDupSubEvtID(pSuber, j) &&
+            NULL == __IOC_ClsEvt_findDispatchEntry(pOldTbl, pSuber->Args.pEvtIDs[j])) {
+            KeptEntryNum++;
+            SuberCbNum += AnySuberNum + 1;
+        }
+    }
+
+    ULONG_T EntryNum = 1;
+    while (EntryNum < KeptEntryNum * 2) {
+        EntryNum <<= 1;
+    }
+
+    size_t TblSize = sizeof(_ClsEvtDispatchTbl_T) + EntryNum * sizeof(_ClsEvtDispatchEntry_T) +
+                     SuberCbNum * sizeof(_ClsEvtSuberCb_T) + MailboxNum * sizeof(_ClsEvtSuberMailbox_pT);
+
+    _ClsEvtDispatchTbl_pT pDispatchTbl = (_ClsEvtDispatchTbl_pT)calloc(1, TblSize);
+    if (NULL == pDispatchTbl) {
+        _IOC_LogError("Failed to alloc ClsEvtDispatchTbl(Size=%zu)", TblSize);
+        *pResult = IOC_RESULT_POSIX_ENOMEM;
+        return NULL;
+    }
+
+    pDispatchTbl->SnapshotHdr.FreeSnapshot_F = __IOC_ClsEvt_freeDispatchTbl;
+    pDispatchTbl->EntryMask = EntryNum - 1;
+    pDispatchTbl->pEntries = (_ClsEvtDispatchEntry_pT)(pDispatchTbl + 1);
+    pDispatchTbl->pAnySuberCbs = (_ClsEvtSuberCb_pT)(pDispatchTbl->pEntries + EntryNum);
+    pDispatchTbl->ppMailboxes = (_ClsEvtSuberMailbox_pT *)(pDispatchTbl->pAnySuberCbs + SuberCbNum);
+
+    // 2) AnySuberCbs, then each kept entry's SuberCbs, re-derived if the EvtSuber matches it, or copied
+    if (IsAnySuber) {
+        pDispatchTbl->AnySuberCbNum = __IOC_ClsEvt_copySuberCbsWithOne(
+            pDispatchTbl->pAnySuberCbs, pOldTbl->pAnySuberCbs, pOldTbl->AnySuberCbNum, &SuberCb, IsSub);
+    } else {
+        memcpy(pDispatchTbl->pAnySuberCbs, pOldTbl->pAnySuberCbs, AnySuberNum * sizeof(_ClsEvtSuberCb_T));
+        pDispatchTbl->AnySuberCbNum = AnySuberNum;
+    }
+    _ClsEvtSuberCb_pT pNextSuberCbs = pDispatchTbl->pAnySuberCbs + AnySuberNum;
+
+    for (ULONG_T Pos = 0; Pos < OldEntryNum; Pos++) {
+        _ClsEvtDispatchEntry_pT pOldEntry = &pOldTbl->pEntries[Pos];
+        if (!pOldEntry->IsUsed) {
+            continue;
+        }
+
+        bool IsMatched = IsAnySuber || __IOC_ClsEvt_isSubEvtIDOfSuber(pSuber, pOldEntry->EvtID);
+        if (IsMatched && !IsSub && pOldEntry->SuberCbNum - 1 <= AnySuberNum) {
+            continue;  // its last EvtSuber by EvtID is gone
+        }
+
+        _ClsEvtDispatchEntry_pT pEntry = __IOC_ClsEvt_findOrInsertDispatchEntry(pDispatchTbl, pOldEntry->EvtID);
+        pEntry->pSuberCbs = pNextSuberCbs;
+        if (IsMatched) {
+            pEntry->SuberCbNum = __IOC_ClsEvt_copySuberCbsWithOne(pEntry->pSuberCbs, pOldEntry->pSuberCbs,
+                                                                  pOldEntry->SuberCbNum, &SuberCb, IsSub);
+        } else {
+            memcpy(pEntry->pSuberCbs, pOldEntry->pSuberCbs, pOldEntry->SuberCbNum * sizeof(_ClsEvtSuberCb_T));
+            pEntry->SuberCbNum = pOldEntry->SuberCbNum;
+        }
+        pNextSuberCbs += pEntry->SuberCbNum;
+    }
+
+    // new entries of EvtIDs only this EvtSuber subEVT, which also match AnySubers
+    for (ULONG_T j = 0; IsSub && j < pSuber->Args.EvtNum; j++) {
+        if (__IOC_ClsEvt_isDupSubEvtID(pSuber, j) ||
+            __IOC_ClsEvt_findDispatchEntry(pOldTbl, pSuber->Args.pEvtIDs[j]) != NULL) {
+            continue;
+        }
+
+        _ClsEvtDispatchEntry_pT pEntry =
+            __IOC_ClsEvt_findOrInsertDispatchEntry(pDispatchTbl, pSuber->Args.pEvtIDs[j]);
+        pEntry->pSuberCbs = pNextSuberCbs;
+        pEntry->SuberCbNum = __IOC_ClsEvt_copySuberCbsWithOne(pEntry->pSuberCbs, pOldTbl->pAnySuberCbs,
+                                                              pOldTbl->AnySuberCbNum, &SuberCb, true);
+        pNextSuberCbs += pEntry->SuberCbNum;
+    }
+
+    // 3) each referred mailbox holds one more RefCnt by this table
+    for (ULONG_T i = 0; i < pOldTbl->MailboxNum; i++) {
+        if (!IsSub && pOldTbl->ppMailboxes[i] == pSuber->pMailbox) {
+            continue;
+        }
+        __IOC_ClsEvt_getSuberMailbox(pOldTbl->ppMailboxes[i]);
+        pDispatchTbl->ppMailboxes[pDispatchTbl->MailboxNum++] = pOldTbl->ppMailboxes[i];
+    }
+    if (IsSub && pSuber->pMailbox != NULL) {
+        __IOC_ClsEvt_getSuberMailbox(pSuber->pMailbox);
+        pDispatchTbl->ppMailboxes[pDispatchTbl->MailboxNum++] = pSuber->pMailbox;
+    }
+
+    return pDispatchTbl;
+}
+
+// Replace current DispatchTbl by pNewDispatchTbl, MUST be called with EvtSuberList's Mutex locked.
+static void __IOC_ClsEvt_replaceDispatchTbl(_ClsEvtSuberList_pT pSuberList, _ClsEvtDispatchTbl_pT pNewDispatchTbl) {
+    _IOC_SnapshotPtr_publish(&pSuberList->DispatchTbl,
+                             (NULL == pNewDispatchTbl) ? NULL : &pNewDispatchTbl->SnapshotHdr);
 }
 
 // Return: IOC_RESULT_SUCCESS or IOC_RESULT_TOO_MANY_EVENT_CONSUMER or IOC_RESULT_CONFLICT_EVENT_CONSUMER
@@ -249,7 +805,7 @@ static IOC_Result_T __IOC_ClsEvt_insertSuberIntoLinkObj(_ClsEvtLinkObj_pT pEvtLi
     }
 
     // check conflict
-    for (ULONG_T i = 0; i < _CONLES_EVENT_MAX_SUBSCRIBER; i++) {
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
         _ClsEvtSuber_T *pSuber = &pSuberList->Subers[i];
 
         if (pSuber->State == Subed) {
@@ -267,7 +823,11 @@ static IOC_Result_T __IOC_ClsEvt_insertSuberIntoLinkObj(_ClsEvtLinkObj_pT pEvtLi
         _ClsEvtSuber_T *pSuber = &pSuberList->Subers[i];
 
         if (pSuber->State == UnSubed) {
+            ULONG_T OldSuberSlotEnd = pSuberList->SuberSlotEnd;
             pSuber->State = Subed;
+            if (i >= OldSuberSlotEnd) {
+                pSuberList->SuberSlotEnd = i + 1;
+            }
 
             // save direct args, and alloc new memory to save indirect EvtIDs
             pSuber->Args.CbProcEvt_F = pSubEvtArgs->CbProcEvt_F;
@@ -275,6 +835,33 @@ static IOC_Result_T __IOC_ClsEvt_insertSuberIntoLinkObj(_ClsEvtLinkObj_pT pEvtLi
             pSuber->Args.EvtNum = pSubEvtArgs->EvtNum;
             pSuber->Args.pEvtIDs = (IOC_EvtID_T *)malloc(pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
             memcpy(pSuber->Args.pEvtIDs, pSubEvtArgs->pEvtIDs, pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
+            pSuber->Args.Flags = pSubEvtArgs->Flags;
+
+            pSuber->pMailbox = NULL;
+            if (__IOC_ClsEvt_isSuberWithMailbox(pSubEvtArgs)) {
+                pSuber->pMailbox = __IOC_ClsEvt_newSuberMailbox(pEvtLinkObj, pSubEvtArgs);
+                if (NULL == pSuber->pMailbox) {
+                    free(pSuber->Args.pEvtIDs);
+                    pSuber->State = UnSubed;
+                    pSuberList->SuberSlotEnd = OldSuberSlotEnd;
+                    Result = IOC_RESULT_POSIX_ENOMEM;
+                    goto _returnResult;
+                }
+            }
+
+            _ClsEvtDispatchTbl_pT pNewDispatchTbl = __IOC_ClsEvt_updateDispatchTbl(pSuberList, i, &Result);
+            if (NULL == pNewDispatchTbl) {
+                // rollback this slot, nothing is published yet
+                if (pSuber->pMailbox != NULL) {
+                    __IOC_ClsEvt_putSuberMailbox(pSuber->pMailbox);
+                    pSuber->pMailbox = NULL;
+                }
+                free(pSuber->Args.pEvtIDs);
+                pSuber->State = UnSubed;
+                pSuberList->SuberSlotEnd = OldSuberSlotEnd;
+                goto _returnResult;
+            }
+            __IOC_ClsEvt_replaceDispatchTbl(pSuberList, pNewDispatchTbl);
 
             // increase SuberNum atomically
             atomic_fetch_add(&pSuberList->SuberNum, 1);
@@ -305,14 +892,35 @@ static IOC_Result_T __IOC_ClsEvt_removeSuberFromLinkObj(_ClsEvtLinkObj_pT pEvtLi
     }
 
     // forloop to find the first match slot
-    for (ULONG_T i = 0; i < _CONLES_EVENT_MAX_SUBSCRIBER; i++) {
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
         _ClsEvtSuber_T *pSuber = &pSuberList->Subers[i];
 
         if (pSuber->State == Subed) {
             // RefComments: IOC_SubEvtArgs_T how to identify a EvtConsumer
             if (pSuber->Args.CbProcEvt_F == pUnsubEvtArgs->CbProcEvt_F &&
                 pSuber->Args.pCbPrivData == pUnsubEvtArgs->pCbPrivData) {
+                ULONG_T OldSuberSlotEnd = pSuberList->SuberSlotEnd;
                 pSuber->State = UnSubed;
+                while (pSuberList->SuberSlotEnd > 0 &&
+                       pSuberList->Subers[pSuberList->SuberSlotEnd - 1].State != Subed) {
+                    pSuberList->SuberSlotEnd--;
+                }
+
+                // publish the table without this EvtSuber BEFORE freeing its EvtIDs
+                _ClsEvtDispatchTbl_pT pNewDispatchTbl = __IOC_ClsEvt_updateDispatchTbl(pSuberList, i, &Result);
+                if (NULL == pNewDispatchTbl && Result != IOC_RESULT_SUCCESS) {
+                    pSuber->State = Subed;
+                    pSuberList->SuberSlotEnd = OldSuberSlotEnd;
+                    goto _returnResult;
+                }
+                __IOC_ClsEvt_replaceDispatchTbl(pSuberList, pNewDispatchTbl);
+
+                // drop its EvtDescs still in mailbox, and release the slot's RefCnt
+                if (pSuber->pMailbox != NULL) {
+                    atomic_store(&pSuber->pMailbox->IsUnsubed, true);
+                    __IOC_ClsEvt_putSuberMailbox(pSuber->pMailbox);
+                    pSuber->pMailbox = NULL;
+                }
 
                 // free indirect EvtIDs
                 free(pSuber->Args.pEvtIDs);
@@ -324,236 +932,831 @@ static IOC_Result_T __IOC_ClsEvt_removeSuberFromLinkObj(_ClsEvtLinkObj_pT pEvtLi
         }
     }
 
-    Result = IOC_RESULT_SUCCESS;
+    Result = IOC_RESULT_SUCCESS;
+
+_returnResult:
+    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_leaveUnsubEvt);
+    pthread_mutex_unlock(&pSuberList->Mutex);
+    return Result;
+}
+
+static IOC_BoolResult_T __IOC_ClsEvt_isEmptySuberList(_ClsEvtSuberList_pT pEvtSuberList) {
+    // read SuberNum atomically
+    ULONG_T SuberNum = atomic_load(&pEvtSuberList->SuberNum);
+    IOC_BoolResult_T Result = (SuberNum == 0) ? IOC_RESULT_YES : IOC_RESULT_NO;
+    return Result;
+}
+
+// Matched SuberCbs of EvtID in pDispatchTbl, which are EvtSubers of EvtNum==0 if no one subEVT it by EvtID.
+static _ClsEvtSuberCb_pT __IOC_ClsEvt_getSuberCbsOfEvtID(_ClsEvtDispatchTbl_pT pDispatchTbl, IOC_EvtID_T EvtID,
+                                                        ULONG_T *pSuberCbNum) {
+    _ClsEvtDispatchEntry_pT pEntry = __IOC_ClsEvt_findDispatchEntry(pDispatchTbl, EvtID);
+    if (pEntry != NULL) {
+        *pSuberCbNum = pEntry->SuberCbNum;
+        return pEntry->pSuberCbs;
+    }
+
+    *pSuberCbNum = pDispatchTbl->AnySuberCbNum;
+    return pDispatchTbl->pAnySuberCbs;
+}
+
+/**
+ * @brief IOC_EVT_OVERFLOW_BLOCK's back-pressure: postEVT of pEvtDescs has to wait as if EvtDescQueue is full,
+ *    if any of them matches an EvtSuber whose mailbox is backlogged, while EvtProcThread keeps serving others.
+ *  It looks up only when LinkObj has backlogged EvtDescs, so it costs nothing otherwise.
+ *  CbProcEvt called by ClsEvtWorkerPool is never pushed back, because it may be the one to wait for.
+ */
+static bool __IOC_ClsEvt_isBackloggedForEvtDescs(_ClsEvtLinkObj_pT pEvtLinkObj, IOC_EvtDesc_pT pEvtDescs,
+                                                 ULONG_T EvtDescNum) {
+    if (atomic_load(&pEvtLinkObj->BackloggedEvtNum) == 0 || __IOC_ClsEvt_isInWorkerCbProcEvtOfLinkObj(pEvtLinkObj)) {
+        return false;
+    }
+
+    _ClsEvtSuberList_pT pSuberList = &pEvtLinkObj->EvtSuberList;
+    bool IsBacklogged = false;
+    ULONG_T Epoch = 0;
+
+    _ClsEvtDispatchTbl_pT pDispatchTbl =
+        (_ClsEvtDispatchTbl_pT)_IOC_SnapshotPtr_enterRead(&pSuberList->DispatchTbl, &Epoch);
+    for (ULONG_T i = 0; pDispatchTbl != NULL && i < EvtDescNum && !IsBacklogged; i++) {
+        ULONG_T SuberCbNum = 0;
+        _ClsEvtSuberCb_pT pSuberCbs = __IOC_ClsEvt_getSuberCbsOfEvtID(pDispatchTbl, pEvtDescs[i].EvtID, &SuberCbNum);
+
+        for (ULONG_T j = 0; j < SuberCbNum && !IsBacklogged; j++) {
+            IsBacklogged =
+                (pSuberCbs[j].pMailbox != NULL) && (atomic_load(&pSuberCbs[j].pMailbox->BackloggedEvtNum) > 0);
+        }
+    }
+    _IOC_SnapshotPtr_leaveRead(&pSuberList->DispatchTbl, Epoch);
+
+    return IsBacklogged;
+}
+
+/**
+ * @brief Callback each matched EvtSuber's CbProcEvt with pEvtDesc.
+ *  IsByEvtProcThread: IOC_SUBEVT_FLAG_WORKER_POOL EvtSubers get pEvtDesc by their mailbox,
+ *    otherwise(SyncMode postEVT with empty LinkObj) all EvtSubers are called in caller's thread,
+ *    which keeps order because no EvtDesc is left in any mailbox.
+ */
+static void __IOC_ClsEvt_callbackProcEvtOverSuberList(_ClsEvtLinkObj_pT pEvtLinkObj, IOC_EvtDesc_pT pEvtDesc,
+                                                      bool IsByEvtProcThread) {
+    _ClsEvtSuberList_pT pSuberList = &pEvtLinkObj->EvtSuberList;
+
+    // Lookup matched SuberCbs by EvtID in current ClsEvtDispatchTbl without EvtSuberList's Mutex,
+    //   and callback them directly from the table, which stays valid until leaving even if CbProcEvt
+    //   subEVT/unsubEVT and replaces it.
+    ULONG_T Epoch = 0;
+    ULONG_T MatchedSuberCbNum = 0;
+    _ClsEvtSuberCb_pT pMatchedSuberCbs = NULL;
+
+    _ClsEvtDispatchTbl_pT pDispatchTbl =
+        (_ClsEvtDispatchTbl_pT)_IOC_SnapshotPtr_enterRead(&pSuberList->DispatchTbl, &Epoch);
+    if (pDispatchTbl != NULL) {
+        pMatchedSuberCbs = __IOC_ClsEvt_getSuberCbsOfEvtID(pDispatchTbl, pEvtDesc->EvtID, &MatchedSuberCbNum);
+    }
+
+    // RESTORED: Transition link state to BusyCbProcEvt to enable deadlock detection
+    // for SYNC_MODE posts inside callbacks (TC-9).
+    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_enterCbProcEvt);
+
+    for (ULONG_T i = 0; i < MatchedSuberCbNum; i++) {
+        if (IsByEvtProcThread && pMatchedSuberCbs[i].pMailbox != NULL) {
+            __IOC_ClsEvt_postEvtDescToSuberMailbox(pMatchedSuberCbs[i].pMailbox, pEvtDesc);
+        } else {
+            pMatchedSuberCbs[i].CbProcEvt_F(pEvtDesc, pMatchedSuberCbs[i].pCbPrivData);
+        }
+    }
+
+    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_leaveCbProcEvt);
+
+    _IOC_SnapshotPtr_leaveRead(&pSuberList->DispatchTbl, Epoch);
+}
+
+//===> END IMPLEMENT FOR ClsEvtSuberList
+//---------------------------------------------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------------------------------------------------
+//===> BEGIN IMPLEMENT FOR ClsEvtLinkObj
+/**
+ * @brief _mClsEvtLinkObjs[i] is the ClsEvtLinkObj of AutoLinkID i, which is inited by __IOC_LibCRT_initClsEvtLinkObj.
+ */
+static _ClsEvtLinkObj_T _mClsEvtLinkObjs[_CONLES_EVENT_MAX_AUTO_LINK];
+
+// This is a helper function to get ClsEvtLinkObj by AutoLinkID
+// Because the ClsEvtLinkObj is a static array, so we access it directly without lock.
+__attribute__((no_sanitize_thread)) static _ClsEvtLinkObj_pT __IOC_ClsEvt_getLinkObjNotLocked(IOC_LinkID_T AutoLinkID) {
+    _ClsEvtLinkObj_pT pLinkObj = NULL;
+    ULONG_T TotalClsLinkObjNum = IOC_calcArrayElmtCnt(_mClsEvtLinkObjs);
+
+    for (ULONG_T i = 0; i < TotalClsLinkObjNum; i++) {
+        pLinkObj = &_mClsEvtLinkObjs[i];
+        if (pLinkObj->LinkID == AutoLinkID) {
+            return pLinkObj;
+        }
+    }
+
+    return NULL;
+}
+
+static _ClsEvtLinkObj_pT __IOC_ClsEvt_getLinkObjLocked(IOC_LinkID_T AutoLinkID) {
+    IOC_BoolResult_T IsAutoLink = _IOC_isAutoLink_inConlesMode(AutoLinkID);
+    if (IsAutoLink == IOC_RESULT_NO) {
+        return NULL;
+    }
+
+    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjNotLocked(AutoLinkID);
+    if (pLinkObj == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&pLinkObj->Mutex);
+    return pLinkObj;
+}
+
+static void __IOC_ClsEvt_putLinkObj(_ClsEvtLinkObj_pT pLinkObj) { pthread_mutex_unlock(&pLinkObj->Mutex); }
+
+static void *__IOC_ClsEvt_callbackProcEvtThread(void *arg);
+
+// Create LinkObj's EvtProcThread if not yet, MUST be called with LinkObj's Mutex locked.
+static IOC_Result_T __IOC_ClsEvt_startLinkObjThreadOnce(_ClsEvtLinkObj_pT pLinkObj) {
+    if (pLinkObj->IsThreadStarted) {
+        return IOC_RESULT_SUCCESS;
+    }
+
+    int PosixResult = pthread_create(&pLinkObj->ThreadID, NULL, __IOC_ClsEvt_callbackProcEvtThread, pLinkObj);
+    if (PosixResult != 0) {
+        _IOC_LogError("AutoLinkID(%" PRIu64 ") create EvtProcThread failed(%d)", pLinkObj->LinkID, PosixResult);
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    pLinkObj->IsThreadStarted = true;
+    return IOC_RESULT_SUCCESS;
+}
+
+// HAS = EvtDescQueue is not empty || one EvtDesc is callbacking by EvtProcThread, which is EvtProcThread's work.
+static IOC_BoolResult_T __IOC_ClsEvt_hasQueuedEvtDescInLinkObj(_ClsEvtLinkObj_pT pLinkObj) {
+    // read QueuedEvtNum and CallbacedEvtNum atomically
+    ULONG_T QueuedEvtNum = atomic_load(&pLinkObj->QueuedEvtNum);
+    ULONG_T CallbacedEvtNum = atomic_load(&pLinkObj->CallbacedEvtNum);
+    IOC_BoolResult_T Result = (QueuedEvtNum != CallbacedEvtNum) ? IOC_RESULT_YES : IOC_RESULT_NO;
+    return Result;
+}
+
+// HAS = queued EvtDesc as above || one EvtDesc is in ClsEvtSuberMailbox or callbacking by worker
+static IOC_BoolResult_T __IOC_ClsEvt_hasEvtDescInLinkObj(_ClsEvtLinkObj_pT pLinkObj) {
+    if (__IOC_ClsEvt_hasQueuedEvtDescInLinkObj(pLinkObj) == IOC_RESULT_YES) {
+        return IOC_RESULT_YES;
+    }
+    return (atomic_load(&pLinkObj->DispatchingEvtNum) != 0) ? IOC_RESULT_YES : IOC_RESULT_NO;
+}
+
+static void __IOC_ClsEvt_wakeupLinkObjThread(_ClsEvtLinkObj_pT pLinkObj) {
+    pthread_mutex_lock(&pLinkObj->CondMutex);
+    pthread_cond_signal(&pLinkObj->Cond);
+    pthread_mutex_unlock(&pLinkObj->CondMutex);
+}
+
+/**
+ * @brief EvtProcThread sleeps until QueuedEvtNum != CallbacedEvtNum, without any polling timeout.
+ *  IsEvtProcThreadWaiting is set BEFORE checking the predicate, and producers add QueuedEvtNum BEFORE
+ *    checking IsEvtProcThreadWaiting, both in seq_cst order, so either EvtProcThread sees the new QueuedEvtNum,
+ *    or the producer sees IsEvtProcThreadWaiting and signals Cond under CondMutex, no wakeup is lost.
+ */
+static void __IOC_ClsEvt_waitLinkObjNewEvtDesc(_ClsEvtLinkObj_pT pLinkObj) {
+    pthread_mutex_lock(&pLinkObj->CondMutex);
+    atomic_store(&pLinkObj->IsEvtProcThreadWaiting, true);
+
+    while (__IOC_ClsEvt_hasQueuedEvtDescInLinkObj(pLinkObj) == IOC_RESULT_NO) {
+        pthread_cond_wait(&pLinkObj->Cond, &pLinkObj->CondMutex);
+    }
+
+    atomic_store(&pLinkObj->IsEvtProcThreadWaiting, false);
+    pthread_mutex_unlock(&pLinkObj->CondMutex);
+}
+
+static void __IOC_ClsEvt_wakeupLinkObjProcedWaiters(_ClsEvtLinkObj_pT pLinkObj) {
+    if (atomic_load(&pLinkObj->ProcedWaiterNum) > 0) {
+        pthread_mutex_lock(&pLinkObj->CondMutex);
+        pthread_cond_broadcast(&pLinkObj->ProcedCond);
+        pthread_mutex_unlock(&pLinkObj->CondMutex);
+    }
+}
+
+// Producer side: count EvtDescNum newly enqueued EvtDescs, then wakeup EvtProcThread only if it's waiting.
+static void __IOC_ClsEvt_notifyLinkObjNewEvtDescs(_ClsEvtLinkObj_pT pLinkObj, ULONG_T EvtDescNum) {
+    atomic_fetch_add(&pLinkObj->QueuedEvtNum, EvtDescNum);
+
+    if (atomic_load(&pLinkObj->IsEvtProcThreadWaiting)) {
+        __IOC_ClsEvt_wakeupLinkObjThread(pLinkObj);
+    }
+
+    // EvtProcThread may have callbacked these EvtDescs before QueuedEvtNum is added,
+    //  then QueuedEvtNum == CallbacedEvtNum happens here, so ProcedCond waiters need to know too.
+    __IOC_ClsEvt_wakeupLinkObjProcedWaiters(pLinkObj);
+}
+
+// EvtProcThread side: count EvtDescNum callbacked EvtDescs, then wakeup all ProcedCond waiters if any.
+static void __IOC_ClsEvt_notifyLinkObjProcedEvtDescs(_ClsEvtLinkObj_pT pLinkObj, ULONG_T EvtDescNum) {
+    atomic_fetch_add(&pLinkObj->CallbacedEvtNum, EvtDescNum);
+    __IOC_ClsEvt_wakeupLinkObjProcedWaiters(pLinkObj);
+}
+
+// Progress of LinkObj waited by ProcedCond waiters: EvtDescs callbacked by EvtProcThread or moved out of backlogs,
+//  both free space for pushed back postEVTs.
+static ULONG_T __IOC_ClsEvt_getLinkObjProcedNum(_ClsEvtLinkObj_pT pLinkObj) {
+    return atomic_load(&pLinkObj->CallbacedEvtNum) + atomic_load(&pLinkObj->UnbackloggedEvtNum);
+}
+
+// Wait until LinkObj's ProcedNum moves from LastProcedNum or LinkObj has no EvtDesc,
+//  or TimeoutUS elapsed(ULONG_MAX means forever).
+static void __IOC_ClsEvt_waitLinkObjProcedEvtDesc(_ClsEvtLinkObj_pT pLinkObj, ULONG_T LastProcedNum,
+                                                  ULONG_T TimeoutUS) {
+    struct timespec TS_Deadline;
+    clock_gettime(CLOCK_REALTIME, &TS_Deadline);
+    if (TimeoutUS != ULONG_MAX) {
+        TS_Deadline.tv_sec += TimeoutUS / 1000000;
+        TS_Deadline.tv_nsec += (TimeoutUS % 1000000) * 1000;
+        TS_Deadline.tv_sec += TS_Deadline.tv_nsec / 1000000000;
+        TS_Deadline.tv_nsec %= 1000000000;
+    }
+
+    atomic_fetch_add(&pLinkObj->ProcedWaiterNum, 1);
+    pthread_mutex_lock(&pLinkObj->CondMutex);
+
+    while (__IOC_ClsEvt_getLinkObjProcedNum(pLinkObj) == LastProcedNum &&
+           __IOC_ClsEvt_hasEvtDescInLinkObj(pLinkObj) == IOC_RESULT_YES) {
+        if (TimeoutUS == ULONG_MAX) {
+            pthread_cond_wait(&pLinkObj->ProcedCond, &pLinkObj->CondMutex);
+        } else if (pthread_cond_timedwait(&pLinkObj->ProcedCond, &pLinkObj->CondMutex, &TS_Deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&pLinkObj->CondMutex);
+    atomic_fetch_sub(&pLinkObj->ProcedWaiterNum, 1);
+}
+
+/**
+ * @brief Dequeue up to MaxEvtDescNum EvtDescs from one lane of LinkObj:
+ *    the lowest lane skipped _CONLES_EVENT_MAX_LANE_SKIPPED_NUM times if any, otherwise the highest non-empty lane,
+ *    and each non-empty lane lower than the dequeued one is counted as skipped once.
+ */
+static ULONG_T __IOC_ClsEvt_dequeueEvtDescsByPriority(_ClsEvtLinkObj_pT pLinkObj, IOC_EvtDesc_pT pEvtDescs,
+                                                      ULONG_T MaxEvtDescNum) {
+    bool IsLaneEmpty[_CONLES_EVENT_PRIORITY_LANE_NUM];
+    ULONG_T PickedLane = _CONLES_EVENT_PRIORITY_LANE_NUM;
+
+    for (ULONG_T Lane = 0; Lane < _CONLES_EVENT_PRIORITY_LANE_NUM; Lane++) {
+        IsLaneEmpty[Lane] = (_IOC_EvtDescQueue_isEmpty(&pLinkObj->EvtDescQueues[Lane]) == IOC_RESULT_YES);
+        if (IsLaneEmpty[Lane]) {
+            pLinkObj->LaneSkippedNum[Lane] = 0;
+        } else if (PickedLane == _CONLES_EVENT_PRIORITY_LANE_NUM &&
+                   pLinkObj->LaneSkippedNum[Lane] >= _CONLES_EVENT_MAX_LANE_SKIPPED_NUM) {
+            PickedLane = Lane;
+        }
+    }
+
+    if (PickedLane == _CONLES_EVENT_PRIORITY_LANE_NUM) {
+        for (ULONG_T Lane = _CONLES_EVENT_PRIORITY_LANE_NUM; Lane-- > 0;) {
+            if (!IsLaneEmpty[Lane]) {
+                PickedLane = Lane;
+                break;
+            }
+        }
+    }
+
+    if (PickedLane == _CONLES_EVENT_PRIORITY_LANE_NUM) {
+        return 0;
+    }
+
+    for (ULONG_T Lane = 0; Lane < PickedLane; Lane++) {
+        if (!IsLaneEmpty[Lane]) {
+            pLinkObj->LaneSkippedNum[Lane]++;
+        }
+    }
+    pLinkObj->LaneSkippedNum[PickedLane] = 0;
+
+    return _IOC_EvtDescQueue_dequeueElementsFirst(&pLinkObj->EvtDescQueues[PickedLane], pEvtDescs, MaxEvtDescNum);
+}
+
+static void *__IOC_ClsEvt_callbackProcEvtThread(void *arg) {
+    _ClsEvtLinkObj_pT pLinkObj = (_ClsEvtLinkObj_pT)arg;
+
+    /**
+     * Steps:
+     *  1) __IOC_ClsEvt_waitLinkObjNewEvtDesc
+     *  2) __IOC_ClsEvt_dequeueEvtDescsByPriority up to _CONLES_EVENT_PROC_EVTDESC_BATCH
+     *    |-> if none dequeued, goto 1)
+     *  3) __IOC_ClsEvt_callbackProcEvtOverSuberList for each dequeued EvtDesc
+     */
+    do {
+        __IOC_ClsEvt_waitLinkObjNewEvtDesc(pLinkObj);
+
+        //-----------------------------------------------------------------------------------------------------------------
+        do {
+            IOC_EvtDesc_T EvtDescs[_CONLES_EVENT_PROC_EVTDESC_BATCH];
+            ULONG_T EvtDescNum =
+                __IOC_ClsEvt_dequeueEvtDescsByPriority(pLinkObj, EvtDescs, _CONLES_EVENT_PROC_EVTDESC_BATCH);
+            if (EvtDescNum == 0) {
+                break;
+            }
+
+            for (ULONG_T i = 0; i < EvtDescNum; i++) {
+                __IOC_ClsEvt_callbackProcEvtOverSuberList(pLinkObj, &EvtDescs[i], true);
+            }
+
+            __IOC_ClsEvt_notifyLinkObjProcedEvtDescs(pLinkObj, EvtDescNum);
+        } while (0x20240714);
+        //-----------------------------------------------------------------------------------------------------------------
+
+    } while (0x20240709);
+
+    pthread_exit(NULL);
+}
+
+// On libc's runtime init, this function will be called to init all ClsEvtLinkObj.
+__attribute__((constructor)) static void __IOC_LibCRT_initClsEvtLinkObj(void) {
+    ULONG_T TotalClsLinkObjNum = IOC_calcArrayElmtCnt(_mClsEvtLinkObjs);
+
+    for (ULONG_T i = 0; i < TotalClsLinkObjNum; i++) {
+        _ClsEvtLinkObj_pT pLinkObj = &_mClsEvtLinkObjs[i];
+
+        pLinkObj->LinkID = IOC_CONLES_MODE_AUTO_LINK_ID_0 + i;
+        pLinkObj->State.Main = IOC_LinkStateReady;
+        pLinkObj->State.Sub = IOC_LinkSubStateDefault;
+        pthread_mutex_init(&pLinkObj->State.Mutex, NULL);
+
+        for (ULONG_T Lane = 0; Lane < _CONLES_EVENT_PRIORITY_LANE_NUM; Lane++) {
+            IOC_Result_T Result = _IOC_EvtDescQueue_initOneWithCapacity(&pLinkObj->EvtDescQueues[Lane],
+                                                                        _CONLES_EVENT_DEPTH_EVTDESC_QUEUE);
+            _IOC_LogAssert(IOC_RESULT_SUCCESS == Result);
+            pLinkObj->LaneSkippedNum[Lane] = 0;
+        }
+        __IOC_ClsEvt_initSuberList(&pLinkObj->EvtSuberList);
+
+        pthread_mutex_init(&pLinkObj->Mutex, NULL);
+        pthread_mutex_init(&pLinkObj->BlockedPostMutex, NULL);
+        pthread_cond_init(&pLinkObj->Cond, NULL);
+        pthread_mutex_init(&pLinkObj->CondMutex, NULL);
+        pthread_cond_init(&pLinkObj->ProcedCond, NULL);
+        atomic_init(&pLinkObj->IsEvtProcThreadWaiting, false);
+        atomic_init(&pLinkObj->ProcedWaiterNum, 0);
+        atomic_init(&pLinkObj->DispatchingEvtNum, 0);
+        atomic_init(&pLinkObj->BackloggedEvtNum, 0);
+        atomic_init(&pLinkObj->UnbackloggedEvtNum, 0);
+
+        // EvtProcThread is created by __IOC_ClsEvt_startLinkObjThreadOnce when first EvtSuber comes.
+        pLinkObj->IsThreadStarted = false;
+    }
+}
+
+//===> END IMPLEMENT FOR ClsEvtLinkObj
+//---------------------------------------------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------------------------------------------------
+//===> BEGIN IMPLEMENT FOR ClsEvtWorkerPool
+/**
+ * @brief DataType of ClsEvtWorkerPool, started when first IOC_SUBEVT_FLAG_WORKER_POOL EvtSuber comes.
+ *    Each worker pops a scheduled ClsEvtSuberMailbox from ReadyList, drains up to _CONLES_EVENT_PROC_EVTDESC_BATCH
+ *      EvtDescs of it, then pushes it back to ReadyList's tail if it's still not empty, so mailboxes share workers
+ *      fairly, and a slow EvtSuber only occupies one worker.
+ */
+typedef struct {
+    pthread_mutex_t Mutex;     // Used to protect ReadyList and WorkerNum
+    pthread_cond_t ReadyCond;  // Used to wakeup idle workers when a mailbox is pushed to ReadyList
+    _ClsEvtSuberMailbox_pT pReadyHead, pReadyTail;
+
+    ULONG_T WorkerNum;
+    pthread_t WorkerIDs[_CONLES_EVENT_MAX_DISPATCH_WORKER];
+} _ClsEvtWorkerPool_T;
+
+static _ClsEvtWorkerPool_T _mClsEvtWorkerPool = {
+    .Mutex = PTHREAD_MUTEX_INITIALIZER,
+    .ReadyCond = PTHREAD_COND_INITIALIZER,
+};
+
+// LinkObj whose EvtSuber's CbProcEvt is being called by this worker thread, NULL if not in CbProcEvt.
+static _Thread_local _ClsEvtLinkObj_pT _mpWorkerCbProcEvtLinkObj = NULL;
+
+static bool __IOC_ClsEvt_isInWorkerCbProcEvtOfLinkObj(_ClsEvtLinkObj_pT pLinkObj) {
+    return _mpWorkerCbProcEvtLinkObj == pLinkObj;
+}
+
+static bool __IOC_ClsEvt_isSuberWithMailbox(IOC_SubEvtArgs_pT pSubEvtArgs) {
+    return (pSubEvtArgs->Flags & IOC_SUBEVT_FLAG_WORKER_POOL) != 0;
+}
+
+static _ClsEvtSuberMailbox_pT __IOC_ClsEvt_newSuberMailbox(_ClsEvtLinkObj_pT pLinkObj, IOC_SubEvtArgs_pT pSubEvtArgs) {
+    _ClsEvtSuberMailbox_pT pMailbox =
+        (_ClsEvtSuberMailbox_pT)_IOC_EvtDescQueue_callocEmbedder(sizeof(_ClsEvtSuberMailbox_T));
+    if (NULL == pMailbox) {
+        _IOC_LogError("Failed to alloc ClsEvtSuberMailbox");
+        return NULL;
+    }
+
+    ULONG_T Capacity = pSubEvtArgs->MailboxCapacity;
+    if (0 == Capacity) {
+        Capacity = _CONLES_EVENT_DEPTH_SUBER_MAILBOX;
+    }
+    IOC_Result_T Result = _IOC_EvtDescQueue_initOneWithCapacity(&pMailbox->EvtDescQueue, Capacity);
+    if (Result != IOC_RESULT_SUCCESS) {
+        free(pMailbox);
+        return NULL;
+    }
+
+    pMailbox->OverflowPolicy = pSubEvtArgs->OverflowPolicy;
+    if (IOC_EVT_OVERFLOW_COALESCE_BY_EVTID == pMailbox->OverflowPolicy) {
+        Capacity = _IOC_EvtDescQueue_getCapacity(&pMailbox->EvtDescQueue);
+        pMailbox->pCoalescingEvtDescs = (IOC_EvtDesc_pT)malloc((Capacity + 1) * sizeof(IOC_EvtDesc_T));
+        if (NULL == pMailbox->pCoalescingEvtDescs) {
+            _IOC_LogError("Failed to alloc CoalescingEvtDescs of ClsEvtSuberMailbox");
+            _IOC_EvtDescQueue_deinitOne(&pMailbox->EvtDescQueue);
+            free(pMailbox);
+            return NULL;
+        }
+    }
+
+    atomic_init(&pMailbox->RefCnt, 1);  // EvtSuber's slot
+    pMailbox->pLinkObj = pLinkObj;
+    pMailbox->CbProcEvt_F = pSubEvtArgs->CbProcEvt_F;
+    pMailbox->pCbPrivData = pSubEvtArgs->pCbPrivData;
+    atomic_init(&pMailbox->IsUnsubed, false);
+    atomic_init(&pMailbox->IsScheduled, false);
+    pMailbox->pNextReady = NULL;
 
-_returnResult:
-    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_leaveUnsubEvt);
-    pthread_mutex_unlock(&pSuberList->Mutex);
-    return Result;
+    pthread_mutex_init(&pMailbox->BacklogMutex, NULL);
+    pMailbox->pBacklogHead = pMailbox->pBacklogTail = NULL;
+    atomic_init(&pMailbox->BackloggedEvtNum, 0);
+
+    return pMailbox;
 }
 
-static IOC_BoolResult_T __IOC_ClsEvt_isEmptySuberList(_ClsEvtSuberList_pT pEvtSuberList) {
-    // read SuberNum atomically
-    ULONG_T SuberNum = atomic_load(&pEvtSuberList->SuberNum);
-    IOC_BoolResult_T Result = (SuberNum == 0) ? IOC_RESULT_YES : IOC_RESULT_NO;
-    return Result;
+static void __IOC_ClsEvt_getSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) { atomic_fetch_add(&pMailbox->RefCnt, 1); }
+
+static void __IOC_ClsEvt_putSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    if (atomic_fetch_sub(&pMailbox->RefCnt, 1) == 1) {
+        // not scheduled any more, so no EvtDesc is left in it, neither in its backlog
+        _IOC_EvtDescQueue_deinitOne(&pMailbox->EvtDescQueue);
+        pthread_mutex_destroy(&pMailbox->BacklogMutex);
+        free(pMailbox->pCoalescingEvtDescs);
+        free(pMailbox);
+    }
 }
 
-static void __IOC_ClsEvt_callbackProcEvtOverSuberList(_ClsEvtLinkObj_pT pEvtLinkObj, IOC_EvtDesc_pT pEvtDesc) {
-    _ClsEvtSuberList_pT pSuberList = &pEvtLinkObj->EvtSuberList;
+static void __IOC_ClsEvt_pushReadySuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    _ClsEvtWorkerPool_T *pPool = &_mClsEvtWorkerPool;
 
-    // BUG FIX: Copy subscriber info while holding lock, then release before callbacks
-    // This prevents deadlock when callbacks try to subscribe/unsubscribe
-    typedef struct {
-        IOC_CbProcEvt_F CbProcEvt_F;
-        void *pCbPrivData;
-        bool IsMatched;
-    } _ActiveCallback_T;
+    pthread_mutex_lock(&pPool->Mutex);
+    pMailbox->pNextReady = NULL;
+    if (NULL == pPool->pReadyTail) {
+        pPool->pReadyHead = pMailbox;
+    } else {
+        pPool->pReadyTail->pNextReady = pMailbox;
+    }
+    pPool->pReadyTail = pMailbox;
+    pthread_cond_signal(&pPool->ReadyCond);
+    pthread_mutex_unlock(&pPool->Mutex);
+}
 
-    _ActiveCallback_T ActiveCallbacks[_CONLES_EVENT_MAX_SUBSCRIBER] = {0};
-    ULONG_T ActiveCount = 0;
+static _ClsEvtSuberMailbox_pT __IOC_ClsEvt_popReadySuberMailbox(void) {
+    _ClsEvtWorkerPool_T *pPool = &_mClsEvtWorkerPool;
 
-    // Phase 1: Collect matching subscribers while holding lock
-    pthread_mutex_lock(&pSuberList->Mutex);
+    pthread_mutex_lock(&pPool->Mutex);
+    while (NULL == pPool->pReadyHead) {
+        pthread_cond_wait(&pPool->ReadyCond, &pPool->Mutex);
+    }
 
-    for (ULONG_T i = 0; i < _CONLES_EVENT_MAX_SUBSCRIBER; i++) {
-        _ClsEvtSuber_T *pSuber = &pSuberList->Subers[i];
+    _ClsEvtSuberMailbox_pT pMailbox = pPool->pReadyHead;
+    pPool->pReadyHead = pMailbox->pNextReady;
+    if (NULL == pPool->pReadyHead) {
+        pPool->pReadyTail = NULL;
+    }
+    pthread_mutex_unlock(&pPool->Mutex);
 
-        if (pSuber->State == Subed) {
-            bool IsMatched = false;
+    return pMailbox;
+}
 
-            // Check if this subscriber wants this event
-            if (pSuber->Args.EvtNum == 0) {
-                // EvtNum == 0 means subscribe to all events
-                IsMatched = true;
-            } else {
-                // Check specific event IDs
-                for (ULONG_T j = 0; j < pSuber->Args.EvtNum; j++) {
-                    if (pEvtDesc->EvtID == pSuber->Args.pEvtIDs[j]) {
-                        IsMatched = true;
-                        break;
-                    }
-                }
-            }
+// Schedule pMailbox to ReadyList if it's not scheduled yet, the pool holds one RefCnt while it's scheduled.
+static void __IOC_ClsEvt_scheduleSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    if (atomic_exchange(&pMailbox->IsScheduled, true)) {
+        return;
+    }
 
-            if (IsMatched) {
-                ActiveCallbacks[ActiveCount].CbProcEvt_F = pSuber->Args.CbProcEvt_F;
-                ActiveCallbacks[ActiveCount].pCbPrivData = pSuber->Args.pCbPrivData;
-                ActiveCallbacks[ActiveCount].IsMatched = true;
-                ActiveCount++;
-            }
-        }
+    __IOC_ClsEvt_getSuberMailbox(pMailbox);
+    __IOC_ClsEvt_pushReadySuberMailbox(pMailbox);
+}
+
+// Worker side: count EvtDescNum callbacked EvtDescs, then wakeup ProcedCond waiters if LinkObj has no EvtDesc.
+static void __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(_ClsEvtLinkObj_pT pLinkObj, ULONG_T EvtDescNum) {
+    if (atomic_fetch_sub(&pLinkObj->DispatchingEvtNum, EvtDescNum) == EvtDescNum) {
+        __IOC_ClsEvt_wakeupLinkObjProcedWaiters(pLinkObj);
     }
+}
 
-    pthread_mutex_unlock(&pSuberList->Mutex);
+/**
+ * @brief IOC_EVT_OVERFLOW_BLOCK: append pEvtDesc to pMailbox's backlog, who is full or already has a backlog,
+ *    instead of waiting for its worker, so other EvtSubers of the AutoLink still get EvtDescs meanwhile.
+ *  Backlog only grows by EvtDescs already queued in the AutoLink, because its posters are pushed back.
+ */
+static void __IOC_ClsEvt_backlogSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox, IOC_EvtDesc_pT pEvtDesc) {
+    _ClsEvtLinkObj_pT pLinkObj = pMailbox->pLinkObj;
+
+    pthread_mutex_lock(&pMailbox->BacklogMutex);
+    // worker may have freed space and moved all backlogged ones meanwhile, then enqueue keeps the order.
+    if (NULL == pMailbox->pBacklogHead &&
+        _IOC_EvtDescQueue_enqueueElementLast(&pMailbox->EvtDescQueue, pEvtDesc) == IOC_RESULT_SUCCESS) {
+        pthread_mutex_unlock(&pMailbox->BacklogMutex);
+        return;
+    }
 
-    // Phase 2: Invoke callbacks WITHOUT holding lock - prevents deadlock!
-    // RESTORED: Transition link state to BusyCbProcEvt to enable deadlock detection
-    // for SYNC_MODE posts inside callbacks (TC-9).
-    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_enterCbProcEvt);
+    _ClsEvtBackloggedEvtDesc_pT pBacklogged = (_ClsEvtBackloggedEvtDesc_pT)malloc(sizeof(_ClsEvtBackloggedEvtDesc_T));
+    if (NULL == pBacklogged) {
+        pthread_mutex_unlock(&pMailbox->BacklogMutex);
+        _IOC_LogError("Failed to alloc BackloggedEvtDesc of ClsEvtSuberMailbox, drop it");
+        atomic_fetch_add_explicit(&pMailbox->DroppedEvtNum, 1, memory_order_relaxed);
+        __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pLinkObj, 1);
+        return;
+    }
 
-    for (ULONG_T i = 0; i < ActiveCount; i++) {
-        // FIXED: Callback now invoked WITHOUT holding pSuberList->Mutex
-        // This allows callbacks to safely call IOC_subEVT/IOC_unsubEVT without deadlock
-        ActiveCallbacks[i].CbProcEvt_F(pEvtDesc, ActiveCallbacks[i].pCbPrivData);
+    pBacklogged->EvtDesc = *pEvtDesc;
+    pBacklogged->pNext = NULL;
+    if (NULL == pMailbox->pBacklogTail) {
+        pMailbox->pBacklogHead = pBacklogged;
+    } else {
+        pMailbox->pBacklogTail->pNext = pBacklogged;
     }
+    pMailbox->pBacklogTail = pBacklogged;
 
-    __IOC_ClsEvt_transferLinkObjStateByBehavior(pEvtLinkObj, Behavior_leaveCbProcEvt);
+    // LinkObj's count first, so posters see it no later than pMailbox's.
+    atomic_fetch_add(&pLinkObj->BackloggedEvtNum, 1);
+    atomic_fetch_add(&pMailbox->BackloggedEvtNum, 1);
+    atomic_fetch_add_explicit(&pMailbox->BlockedEvtNum, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&pMailbox->BacklogMutex);
 }
 
-//===> END IMPLEMENT FOR ClsEvtSuberList
-//---------------------------------------------------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------------------------------------------------
-//===> BEGIN IMPLEMENT FOR ClsEvtLinkObj
 /**
- * @brief Only LinkID==IOC_CONLES_MODE_AUTO_LINK_ID is supported now.
- *  TODO: support other LinkID in future of IOC_CONLES_MODE_AUTO_LINK_ID_1/2/3/...
- *
+ * @brief Worker side: move backlogged EvtDescs into pMailbox's freed space in order, or drop them if it's unsubed,
+ *    then wakeup pushed back posters of the AutoLink.
+ *  pMailbox's BackloggedEvtNum is decreased AFTER each one is enqueued, so once EvtProcThread sees it's zero,
+ *    it may enqueue directly behind them.
  */
-static _ClsEvtLinkObj_T _mClsEvtLinkObjs[] = {
-    {
-        .LinkID = IOC_CONLES_MODE_AUTO_LINK_ID,
-        .State =
-            {
-                .Main = IOC_LinkStateReady,
-                .Sub = IOC_LinkSubStateDefault,
-            },
-    },
-};
+static void __IOC_ClsEvt_unbacklogSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    if (atomic_load(&pMailbox->BackloggedEvtNum) == 0) {
+        return;
+    }
 
-// This is a helper function to get ClsEvtLinkObj by AutoLinkID
-// Because the ClsEvtLinkObj is a static array, so we access it directly without lock.
-__attribute__((no_sanitize_thread)) static _ClsEvtLinkObj_pT __IOC_ClsEvt_getLinkObjNotLocked(IOC_LinkID_T AutoLinkID) {
-    _ClsEvtLinkObj_pT pLinkObj = NULL;
-    ULONG_T TotalClsLinkObjNum = IOC_calcArrayElmtCnt(_mClsEvtLinkObjs);
+    _ClsEvtLinkObj_pT pLinkObj = pMailbox->pLinkObj;
+    ULONG_T MovedNum = 0, DroppedNum = 0;
 
-    for (ULONG_T i = 0; i < TotalClsLinkObjNum; i++) {
-        pLinkObj = &_mClsEvtLinkObjs[i];
-        if (pLinkObj->LinkID == AutoLinkID) {
-            return pLinkObj;
+    pthread_mutex_lock(&pMailbox->BacklogMutex);
+    while (pMailbox->pBacklogHead != NULL) {
+        _ClsEvtBackloggedEvtDesc_pT pBacklogged = pMailbox->pBacklogHead;
+        if (atomic_load(&pMailbox->IsUnsubed)) {
+            DroppedNum++;
+        } else if (_IOC_EvtDescQueue_enqueueElementLast(&pMailbox->EvtDescQueue, &pBacklogged->EvtDesc) !=
+                   IOC_RESULT_SUCCESS) {
+            break;
+        }
+
+        pMailbox->pBacklogHead = pBacklogged->pNext;
+        if (NULL == pMailbox->pBacklogHead) {
+            pMailbox->pBacklogTail = NULL;
         }
+        free(pBacklogged);
+        atomic_fetch_sub(&pMailbox->BackloggedEvtNum, 1);
+        MovedNum++;
     }
+    pthread_mutex_unlock(&pMailbox->BacklogMutex);
 
-    return NULL;
+    if (MovedNum > 0) {
+        atomic_fetch_sub(&pLinkObj->BackloggedEvtNum, MovedNum);
+        atomic_fetch_add(&pLinkObj->UnbackloggedEvtNum, MovedNum);
+        if (DroppedNum > 0) {
+            __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pLinkObj, DroppedNum);
+        }
+        __IOC_ClsEvt_wakeupLinkObjProcedWaiters(pLinkObj);
+    }
 }
 
-static _ClsEvtLinkObj_pT __IOC_ClsEvt_getLinkObjLocked(IOC_LinkID_T AutoLinkID) {
-    IOC_BoolResult_T IsAutoLink = _IOC_isAutoLink_inConlesMode(AutoLinkID);
-    if (IsAutoLink == IOC_RESULT_NO) {
-        return NULL;
+// IOC_EVT_OVERFLOW_DROP_OLDEST: dequeue the oldest EvtDesc as its worker does, until pEvtDesc is enqueued.
+static void __IOC_ClsEvt_dropOldestOfSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox, IOC_EvtDesc_pT pEvtDesc) {
+    IOC_EvtDesc_T DroppedEvtDesc;
+
+    while (_IOC_EvtDescQueue_enqueueElementLast(&pMailbox->EvtDescQueue, pEvtDesc) != IOC_RESULT_SUCCESS) {
+        // worker may dequeue it first, then just retry enqueue.
+        if (_IOC_EvtDescQueue_dequeueElementFirst(&pMailbox->EvtDescQueue, &DroppedEvtDesc) == IOC_RESULT_SUCCESS) {
+            atomic_fetch_add_explicit(&pMailbox->DroppedEvtNum, 1, memory_order_relaxed);
+            __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pMailbox->pLinkObj, 1);
+        }
     }
+}
 
-    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjNotLocked(AutoLinkID);
-    if (pLinkObj == NULL) {
-        return NULL;
+/**
+ * @brief IOC_EVT_OVERFLOW_COALESCE_BY_EVTID: take out all EvtDescs of the full pMailbox, merge each EvtDesc into
+ *    the first one of the same EvtID(so it keeps the first's position but has the newest value), then put back.
+ *  Worker may only dequeue meanwhile, and the taken out ones are always newer than what it dequeued,
+ *    so the order seen by CbProcEvt is kept.
+ *
+ * @return true if pEvtDesc is enqueued after merging, false if nothing is mergeable and pMailbox is unchanged.
+ */
+static bool __IOC_ClsEvt_coalesceSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox, IOC_EvtDesc_pT pEvtDesc) {
+    IOC_EvtDesc_pT pEvtDescs = pMailbox->pCoalescingEvtDescs;
+    ULONG_T Capacity = _IOC_EvtDescQueue_getCapacity(&pMailbox->EvtDescQueue);
+
+    ULONG_T TakenNum = _IOC_EvtDescQueue_dequeueElementsFirst(&pMailbox->EvtDescQueue, pEvtDescs, Capacity);
+    pEvtDescs[TakenNum] = *pEvtDesc;
+
+    ULONG_T KeptNum = 0;
+    for (ULONG_T i = 0; i <= TakenNum; i++) {
+        ULONG_T j = 0;
+        while (j < KeptNum && pEvtDescs[j].EvtID != pEvtDescs[i].EvtID) {
+            j++;
+        }
+
+        pEvtDescs[j] = pEvtDescs[i];
+        if (j == KeptNum) {
+            KeptNum++;
+        }
     }
 
-    pthread_mutex_lock(&pLinkObj->Mutex);
-    return pLinkObj;
-}
+    ULONG_T CoalescedNum = TakenNum + 1 - KeptNum;
+    if (0 == CoalescedNum) {
+        KeptNum = TakenNum;  // put back all taken out ones without pEvtDesc
+    }
 
-static void __IOC_ClsEvt_putLinkObj(_ClsEvtLinkObj_pT pLinkObj) { pthread_mutex_unlock(&pLinkObj->Mutex); }
+    // EvtProcThread is the only producer, so the space of taken out ones is still there.
+    if (KeptNum > 0) {
+        IOC_Result_T Result = _IOC_EvtDescQueue_enqueueElementsLast(&pMailbox->EvtDescQueue, pEvtDescs, KeptNum);
+        if (Result != IOC_RESULT_SUCCESS) {
+            _IOC_LogBug("Failed to put back %lu coalesced EvtDescs(%s)", KeptNum, IOC_getResultStr(Result));
+        }
+    }
 
-static void __IOC_ClsEvt_wakeupLinkObjThread(_ClsEvtLinkObj_pT pLinkObj) {
-    pthread_mutex_lock(&pLinkObj->CondMutex);
-    pthread_cond_signal(&pLinkObj->Cond);
-    pthread_mutex_unlock(&pLinkObj->CondMutex);
+    if (CoalescedNum > 0) {
+        atomic_fetch_add_explicit(&pMailbox->CoalescedEvtNum, CoalescedNum, memory_order_relaxed);
+        __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pMailbox->pLinkObj, CoalescedNum);
+    }
+    return CoalescedNum > 0;
 }
-static void __IOC_ClsEvt_waitLinkObjNewEvtDesc(_ClsEvtLinkObj_pT pLinkObj) {
-    // wait for signal or timeout 10ms
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
 
-    ts.tv_nsec += 10000000;  // 10ms
-    ts.tv_sec += ts.tv_nsec / 1000000000;
-    ts.tv_nsec %= 1000000000;
+static void __IOC_ClsEvt_postEvtDescToSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox, IOC_EvtDesc_pT pEvtDesc) {
+    // count BEFORE enqueue, so DispatchingEvtNum never drops to zero while pEvtDesc is not callbacked yet.
+    atomic_fetch_add(&pMailbox->pLinkObj->DispatchingEvtNum, 1);
+
+    if (atomic_load(&pMailbox->BackloggedEvtNum) > 0) {
+        __IOC_ClsEvt_backlogSuberMailbox(pMailbox, pEvtDesc);  // behind the backlogged ones
+    } else if (_IOC_EvtDescQueue_enqueueElementLast(&pMailbox->EvtDescQueue, pEvtDesc) != IOC_RESULT_SUCCESS) {
+        // mailbox is full, which means it's scheduled and its worker will free space.
+        switch (pMailbox->OverflowPolicy) {
+            case IOC_EVT_OVERFLOW_DROP_NEWEST: {
+                atomic_fetch_add_explicit(&pMailbox->DroppedEvtNum, 1, memory_order_relaxed);
+                __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pMailbox->pLinkObj, 1);
+            } break;
+            case IOC_EVT_OVERFLOW_DROP_OLDEST: {
+                __IOC_ClsEvt_dropOldestOfSuberMailbox(pMailbox, pEvtDesc);
+            } break;
+            case IOC_EVT_OVERFLOW_COALESCE_BY_EVTID: {
+                if (!__IOC_ClsEvt_coalesceSuberMailbox(pMailbox, pEvtDesc)) {
+                    __IOC_ClsEvt_backlogSuberMailbox(pMailbox, pEvtDesc);
+                }
+            } break;
+            default: {
+                __IOC_ClsEvt_backlogSuberMailbox(pMailbox, pEvtDesc);
+            } break;
+        }
+    }
 
-    pthread_mutex_lock(&pLinkObj->CondMutex);
-    pthread_cond_timedwait(&pLinkObj->Cond, &pLinkObj->CondMutex, &ts);
-    pthread_mutex_unlock(&pLinkObj->CondMutex);
+    ULONG_T QueuedNum = _IOC_EvtDescQueue_getQueuedNum(&pMailbox->EvtDescQueue);
+    if (QueuedNum > atomic_load_explicit(&pMailbox->HighWatermark, memory_order_relaxed)) {
+        atomic_store_explicit(&pMailbox->HighWatermark, QueuedNum, memory_order_relaxed);
+    }
+
+    __IOC_ClsEvt_scheduleSuberMailbox(pMailbox);
 }
 
-static void *__IOC_ClsEvt_callbackProcEvtThread(void *arg) {
-    _ClsEvtLinkObj_pT pLinkObj = (_ClsEvtLinkObj_pT)arg;
+static bool __IOC_ClsEvt_hasEvtDescInSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    return _IOC_EvtDescQueue_isEmpty(&pMailbox->EvtDescQueue) == IOC_RESULT_NO ||
+           atomic_load(&pMailbox->BackloggedEvtNum) > 0;
+}
 
-    /**
-     * Steps:
-     *  1) __IOC_ClsEvt_waitLinkObjNewEvtDesc
-     *  2) __IOC_EvtDescQueue_dequeueElementFirst
-     *    |-> if IOC_RESULT_EVTDESC_QUEUE_EMPTY, goto 1)
-     *  3) __IOC_ClsEvt_callbackProcEvtOverSuberList
-     */
-    do {
-        __IOC_ClsEvt_waitLinkObjNewEvtDesc(pLinkObj);
+// Drain one batch of pMailbox, then push it back to ReadyList or unschedule it.
+static void __IOC_ClsEvt_drainSuberMailbox(_ClsEvtSuberMailbox_pT pMailbox) {
+    IOC_EvtDesc_T EvtDescs[_CONLES_EVENT_PROC_EVTDESC_BATCH];
 
-        //-----------------------------------------------------------------------------------------------------------------
-        do {
-            IOC_EvtDesc_T EvtDesc = {};
-            IOC_Result_T Result = _IOC_EvtDescQueue_dequeueElementFirst(&pLinkObj->EvtDescQueue, &EvtDesc);
-            if (Result == IOC_RESULT_EVTDESC_QUEUE_EMPTY) {
-                break;
+    ULONG_T EvtDescNum =
+        _IOC_EvtDescQueue_dequeueElementsFirst(&pMailbox->EvtDescQueue, EvtDescs, _CONLES_EVENT_PROC_EVTDESC_BATCH);
+    __IOC_ClsEvt_unbacklogSuberMailbox(pMailbox);  // into the space just freed, before callbacking them
+
+    if (EvtDescNum > 0) {
+        _mpWorkerCbProcEvtLinkObj = pMailbox->pLinkObj;
+        for (ULONG_T i = 0; i < EvtDescNum; i++) {
+            // unsubEVT may happen in any CbProcEvt, then drop the rest EvtDescs.
+            if (!atomic_load(&pMailbox->IsUnsubed)) {
+                pMailbox->CbProcEvt_F(&EvtDescs[i], pMailbox->pCbPrivData);
             }
+        }
+        _mpWorkerCbProcEvtLinkObj = NULL;
 
-            __IOC_ClsEvt_callbackProcEvtOverSuberList(pLinkObj, &EvtDesc);
+        __IOC_ClsEvt_notifyLinkObjDispatchedEvtDescs(pMailbox->pLinkObj, EvtDescNum);
+    }
 
-            atomic_fetch_add(&pLinkObj->CallbacedEvtNum, 1);
-        } while (0x20240714);
-        //-----------------------------------------------------------------------------------------------------------------
+    if (__IOC_ClsEvt_hasEvtDescInSuberMailbox(pMailbox)) {
+        __IOC_ClsEvt_pushReadySuberMailbox(pMailbox);  // keep the pool's RefCnt
+        return;
+    }
 
-    } while (0x20240709);
+    // Unschedule, then recheck: EvtProcThread may enqueue after isEmpty but see IsScheduled still true.
+    atomic_store(&pMailbox->IsScheduled, false);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (__IOC_ClsEvt_hasEvtDescInSuberMailbox(pMailbox) &&
+        !atomic_exchange(&pMailbox->IsScheduled, true)) {
+        __IOC_ClsEvt_pushReadySuberMailbox(pMailbox);  // keep the pool's RefCnt
+        return;
+    }
 
-    pthread_exit(NULL);
+    __IOC_ClsEvt_putSuberMailbox(pMailbox);
 }
 
-// HAS = EvtDescQueue is not empty || one EvtDesc is callbacking by EvtProcThread
-static IOC_BoolResult_T __IOC_ClsEvt_hasEvtDescInLinkObj(_ClsEvtLinkObj_pT pLinkObj) {
-    // read QueuedEvtNum and CallbacedEvtNum atomically
-    ULONG_T QueuedEvtNum = atomic_load(&pLinkObj->QueuedEvtNum);
-    ULONG_T CallbacedEvtNum = atomic_load(&pLinkObj->CallbacedEvtNum);
-    IOC_BoolResult_T Result = (QueuedEvtNum != CallbacedEvtNum) ? IOC_RESULT_YES : IOC_RESULT_NO;
-    return Result;
-}
+static void *__IOC_ClsEvt_workerThread(void *arg) {
+    (void)arg;
 
-// On libc's runtime init, this function will be called to create all ClsEvtLinkObj's EvtProcThread.
-__attribute__((constructor)) static void __IOC_LibCRT_initClsEvtLinkObj(void) {
-    ULONG_T TotalClsLinkObjNum = IOC_calcArrayElmtCnt(_mClsEvtLinkObjs);
+    do {
+        __IOC_ClsEvt_drainSuberMailbox(__IOC_ClsEvt_popReadySuberMailbox());
+    } while (0x20260107);
 
-    for (ULONG_T i = 0; i < TotalClsLinkObjNum; i++) {
-        _ClsEvtLinkObj_pT pLinkObj = &_mClsEvtLinkObjs[i];
+    pthread_exit(NULL);
+}
 
-        _IOC_EvtDescQueue_initOne(&pLinkObj->EvtDescQueue);
-        __IOC_ClsEvt_initSuberList(&pLinkObj->EvtSuberList);
+static IOC_Result_T __IOC_ClsEvt_startWorkerPoolOnce(void) {
+    _ClsEvtWorkerPool_T *pPool = &_mClsEvtWorkerPool;
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
 
-        pthread_mutex_init(&pLinkObj->Mutex, NULL);
-        pthread_cond_init(&pLinkObj->Cond, NULL);
-        pthread_mutex_init(&pLinkObj->CondMutex, NULL);
+    pthread_mutex_lock(&pPool->Mutex);
+    if (pPool->WorkerNum == 0) {
+        long CpuNum = sysconf(_SC_NPROCESSORS_ONLN);
+        ULONG_T WorkerNum = (CpuNum < 2) ? 2 : (ULONG_T)CpuNum;
+        if (WorkerNum > _CONLES_EVENT_MAX_DISPATCH_WORKER) {
+            WorkerNum = _CONLES_EVENT_MAX_DISPATCH_WORKER;
+        }
+
+        for (ULONG_T i = 0; i < WorkerNum; i++) {
+            int PosixResult = pthread_create(&pPool->WorkerIDs[i], NULL, __IOC_ClsEvt_workerThread, NULL);
+            if (PosixResult != 0) {
+                _IOC_LogError("Create ClsEvtWorker(%lu/%lu) failed(%d)", i, WorkerNum, PosixResult);
+                break;
+            }
+            pPool->WorkerNum++;
+        }
 
-        pthread_create(&pLinkObj->ThreadID, NULL, __IOC_ClsEvt_callbackProcEvtThread, pLinkObj);
+        if (pPool->WorkerNum == 0) {
+            Result = IOC_RESULT_POSIX_ENOMEM;
+        }
     }
-}
+    pthread_mutex_unlock(&pPool->Mutex);
 
-//===> END IMPLEMENT FOR ClsEvtLinkObj
+    return Result;
+}
+//===> END IMPLEMENT FOR ClsEvtWorkerPool
 //---------------------------------------------------------------------------------------------------------------------
 
+// Any LinkID below IOC_CONLES_MODE_AUTO_LINK_ID_MAX is an AutoLinkID, even beyond _CONLES_EVENT_MAX_AUTO_LINK,
+//  so ConlesMode returns INVALID_AUTO_LINK_ID for it, rather than ConetMode treating it as a not existing LinkID.
 IOC_BoolResult_T _IOC_isAutoLink_inConlesMode(
     /*ARG_IN*/ IOC_LinkID_T LinkID) {
-    return (LinkID == IOC_CONLES_MODE_AUTO_LINK_ID) ? IOC_RESULT_YES : IOC_RESULT_NO;
+    return (LinkID < IOC_CONLES_MODE_AUTO_LINK_ID_MAX) ? IOC_RESULT_YES : IOC_RESULT_NO;
 }
 
 IOC_Result_T _IOC_subEVT_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_SubEvtArgs_pT pSubEvtArgs) {
-    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjLocked(IOC_CONLES_MODE_AUTO_LINK_ID);
+    // Mailbox is opt-in by the flag only, its args are ignored without it, so callers not zeroing them still work.
+    if (__IOC_ClsEvt_isSuberWithMailbox(pSubEvtArgs) &&
+        (pSubEvtArgs->MailboxCapacity > _CONLES_EVENT_MAX_DEPTH_SUBER_MAILBOX ||
+         pSubEvtArgs->OverflowPolicy > IOC_EVT_OVERFLOW_COALESCE_BY_EVTID)) {
+        _IOC_LogError("Invalid MailboxCapacity(%lu) or OverflowPolicy(%d)", pSubEvtArgs->MailboxCapacity,
+                      pSubEvtArgs->OverflowPolicy);
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjLocked(LinkID);
     if (pLinkObj == NULL) {
-        return IOC_RESULT_BUG;
+        return IOC_RESULT_INVALID_AUTO_LINK_ID;
+    }
+
+    // EvtProcThread MUST be ready before any EvtDesc is posted, and postEVT requires at least one EvtSuber.
+    IOC_Result_T Result = __IOC_ClsEvt_startLinkObjThreadOnce(pLinkObj);
+    if (IOC_RESULT_SUCCESS == Result && __IOC_ClsEvt_isSuberWithMailbox(pSubEvtArgs)) {
+        Result = __IOC_ClsEvt_startWorkerPoolOnce();
+    }
+    if (IOC_RESULT_SUCCESS == Result) {
+        Result = __IOC_ClsEvt_insertSuberIntoLinkObj(pLinkObj, pSubEvtArgs);
     }
 
-    IOC_Result_T Result = __IOC_ClsEvt_insertSuberIntoLinkObj(pLinkObj, pSubEvtArgs);
     if (IOC_RESULT_SUCCESS == Result) {
-        //_IOC_LogDebug("AutoLinkID(%lu) new EvtSuber(CbProcEvt_F=%p,PrivData=%p)", IOC_CONLES_MODE_AUTO_LINK_ID,
+        //_IOC_LogDebug("AutoLinkID(%lu) new EvtSuber(CbProcEvt_F=%p,PrivData=%p)", LinkID,
         //              pSubEvtArgs->CbProcEvt_F, pSubEvtArgs->pCbPrivData);
     } else {
-        _IOC_LogWarn("AutoLinkID(%u) new EvtSuber(CbProcEvt_F=%p,PrivData=%p) failed(%s)", IOC_CONLES_MODE_AUTO_LINK_ID,
+        _IOC_LogWarn("AutoLinkID(%" PRIu64 ") new EvtSuber(CbProcEvt_F=%p,PrivData=%p) failed(%s)", LinkID,
                      pSubEvtArgs->CbProcEvt_F, pSubEvtArgs->pCbPrivData, IOC_getResultStr(Result));
     }
 
@@ -562,39 +1765,83 @@ IOC_Result_T _IOC_subEVT_inConlesMode(
 }
 
 IOC_Result_T _IOC_unsubEVT_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pUnsubEvtArgs) {
-    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjLocked(IOC_CONLES_MODE_AUTO_LINK_ID);
+    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjLocked(LinkID);
     if (pLinkObj == NULL) {
-        return IOC_RESULT_BUG;
+        return IOC_RESULT_INVALID_AUTO_LINK_ID;
     }
 
     IOC_Result_T Result = __IOC_ClsEvt_removeSuberFromLinkObj(pLinkObj, pUnsubEvtArgs);
     if (IOC_RESULT_SUCCESS == Result) {
-        //_IOC_LogDebug("AutoLinkID(%lu) remove EvtSuber(CbProcEvt_F=%p,PrivData=%p)", IOC_CONLES_MODE_AUTO_LINK_ID,
+        //_IOC_LogDebug("AutoLinkID(%lu) remove EvtSuber(CbProcEvt_F=%p,PrivData=%p)", LinkID,
         //              pUnsubEvtArgs->CbProcEvt_F, pUnsubEvtArgs->pCbPrivData);
     } else {
-        _IOC_LogWarn("AutoLinkID(%u) remove EvtSuber(CbProcEvt_F=%p,PrivData=%p) failed(%s)",
-                     IOC_CONLES_MODE_AUTO_LINK_ID, pUnsubEvtArgs->CbProcEvt_F, pUnsubEvtArgs->pCbPrivData,
-                     IOC_getResultStr(Result));
+        _IOC_LogWarn("AutoLinkID(%" PRIu64 ") remove EvtSuber(CbProcEvt_F=%p,PrivData=%p) failed(%s)", LinkID,
+                     pUnsubEvtArgs->CbProcEvt_F, pUnsubEvtArgs->pCbPrivData, IOC_getResultStr(Result));
     }
 
     __IOC_ClsEvt_putLinkObj(pLinkObj);
     return Result;
 }
 
+IOC_Result_T _IOC_getEvtMailboxStats_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pSuberArgs,
+    /*ARG_OUT*/ IOC_EvtMailboxStats_pT pMailboxStats) {
+    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjNotLocked(LinkID);
+    if (pLinkObj == NULL) {
+        return IOC_RESULT_INVALID_AUTO_LINK_ID;
+    }
+
+    IOC_Result_T Result = IOC_RESULT_NO_EVENT_CONSUMER;
+    _ClsEvtSuberList_pT pSuberList = &pLinkObj->EvtSuberList;
+
+    pthread_mutex_lock(&pSuberList->Mutex);
+    for (ULONG_T i = 0; i < pSuberList->SuberSlotEnd; i++) {
+        _ClsEvtSuber_pT pSuber = &pSuberList->Subers[i];
+
+        // RefComments: IOC_SubEvtArgs_T how to identify a EvtConsumer
+        if (pSuber->State != Subed || pSuber->Args.CbProcEvt_F != pSuberArgs->CbProcEvt_F ||
+            pSuber->Args.pCbPrivData != pSuberArgs->pCbPrivData) {
+            continue;
+        }
+
+        _ClsEvtSuberMailbox_pT pMailbox = pSuber->pMailbox;
+        if (NULL == pMailbox) {
+            Result = IOC_RESULT_NOT_SUPPORT;
+            break;
+        }
+
+        pMailboxStats->Capacity = _IOC_EvtDescQueue_getCapacity(&pMailbox->EvtDescQueue);
+        pMailboxStats->OverflowPolicy = pMailbox->OverflowPolicy;
+        pMailboxStats->QueuedEvtNum = _IOC_EvtDescQueue_getQueuedNum(&pMailbox->EvtDescQueue);
+        pMailboxStats->HighWatermark = atomic_load_explicit(&pMailbox->HighWatermark, memory_order_relaxed);
+        pMailboxStats->DroppedEvtNum = atomic_load_explicit(&pMailbox->DroppedEvtNum, memory_order_relaxed);
+        pMailboxStats->CoalescedEvtNum = atomic_load_explicit(&pMailbox->CoalescedEvtNum, memory_order_relaxed);
+        pMailboxStats->BlockedEvtNum = atomic_load_explicit(&pMailbox->BlockedEvtNum, memory_order_relaxed);
+        pMailboxStats->BackloggedEvtNum = atomic_load(&pMailbox->BackloggedEvtNum);
+        Result = IOC_RESULT_SUCCESS;
+        break;
+    }
+    pthread_mutex_unlock(&pSuberList->Mutex);
+
+    return Result;
+}
+
 IOC_Result_T _IOC_getLinkState_inConlesMode(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_OUT*/ IOC_LinkState_pT pLinkState,
     /*ARG_OUT_OPTIONAL*/ IOC_LinkSubState_pT pLinkSubState) {
-    if (LinkID != IOC_CONLES_MODE_AUTO_LINK_ID) {
+    if (_IOC_isAutoLink_inConlesMode(LinkID) == IOC_RESULT_NO) {
         _IOC_LogError("Invalid AutoLinkID(%" PRIu64 ")", LinkID);
         return IOC_RESULT_INVALID_AUTO_LINK_ID;
     }
 
     _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjNotLocked(LinkID);
     if (pLinkObj == NULL) {
-        _IOC_LogBug("No LinkObj of AutoLinkID(%" PRIu64 ")", LinkID);
-        return IOC_RESULT_BUG;
+        _IOC_LogError("No LinkObj of AutoLinkID(%" PRIu64 ")", LinkID);
+        return IOC_RESULT_INVALID_AUTO_LINK_ID;
     }
 
     pthread_mutex_lock(&pLinkObj->State.Mutex);
@@ -641,7 +1888,9 @@ IOC_Result_T _IOC_getCapability_inConlesMode(
     switch (pCapDesc->CapID) {
         case IOC_CAPID_CONLES_MODE_EVENT: {
             pCapDesc->ConlesModeEvent.MaxEvtConsumer = _CONLES_EVENT_MAX_SUBSCRIBER;
-            pCapDesc->ConlesModeEvent.DepthEvtDescQueue = _CONLES_EVENT_MAX_QUEUING_EVTDESC;
+            pCapDesc->ConlesModeEvent.DepthEvtDescQueue =
+                (uint16_t)_IOC_EvtDescQueue_getCapacity(&_mClsEvtLinkObjs[0].EvtDescQueues[IOC_EVT_PRIORITY_NORMAL]);
+            pCapDesc->ConlesModeEvent.AutoLinkNum = _CONLES_EVENT_MAX_AUTO_LINK;
 
             Result = IOC_RESULT_SUCCESS;
         } break;
@@ -665,15 +1914,16 @@ void _IOC_forceProcEvt_inConlesMode(void) {
         _ClsEvtLinkObj_pT pLinkObj = &_mClsEvtLinkObjs[i];
 
         while (true) {
-            __IOC_ClsEvt_wakeupLinkObjThread(pLinkObj);
-
-            usleep(1000);  // 1ms
+            ULONG_T LastProcedNum = __IOC_ClsEvt_getLinkObjProcedNum(pLinkObj);
 
             IOC_BoolResult_T HasEvtDesc = __IOC_ClsEvt_hasEvtDescInLinkObj(pLinkObj);
             if (HasEvtDesc == IOC_RESULT_NO) {
                 break;
             }
 
+            // wakeup by EvtProcThread after each callbacked batch, or timeout 1s to warn
+            __IOC_ClsEvt_waitLinkObjProcedEvtDesc(pLinkObj, LastProcedNum, 1000000);
+
             TS_TickNow = IOC_getCurrentTimeSpec();
             ULONG_T ElapsedMS = IOC_deltaTimeSpecInMS(&TS_TickLastWarn, &TS_TickNow);
             if (ElapsedMS >= 1000) {
@@ -693,32 +1943,143 @@ void _IOC_wakeupProcEvt_inConlesMode() {
     }
 }
 
+// Priority out of IOC_EvtPriority_T goes to NORMAL lane, same as IOC_postEVT treats it.
+static ULONG_T __IOC_ClsEvt_getLaneOfPriority(IOC_EvtPriority_T Priority) {
+    return (Priority > IOC_EVT_PRIORITY_URGENT) ? IOC_EVT_PRIORITY_NORMAL : (ULONG_T)Priority;
+}
+
+// EvtDescs of one postEVTs split by lane, RefMore: __IOC_ClsEvt_splitEvtDescsIntoLanes
+typedef struct {
+    IOC_EvtDesc_pT pEvtDescs[_CONLES_EVENT_PRIORITY_LANE_NUM];
+    ULONG_T EvtDescNum[_CONLES_EVENT_PRIORITY_LANE_NUM];  // 0 if no EvtDesc of the lane or already enqueued
+} _ClsEvtLanedEvtDescs_T, *_ClsEvtLanedEvtDescs_pT;
+
+/**
+ * @brief Split a burst by the lane of each EvtDesc's Priority, each lane keeps posted order.
+ *  A burst of one lane, which is the common case, points to pEvtDescs without copying,
+ *    otherwise EvtDescs are gathered lane by lane into *ppGatheredEvtDescs, which caller frees.
+ */
+static IOC_Result_T __IOC_ClsEvt_splitEvtDescsIntoLanes(IOC_EvtDesc_pT pEvtDescs, ULONG_T EvtDescNum,
+                                                        _ClsEvtLanedEvtDescs_pT pLanedEvtDescs,
+                                                        IOC_EvtDesc_pT *ppGatheredEvtDescs) {
+    memset(pLanedEvtDescs, 0, sizeof(*pLanedEvtDescs));
+    *ppGatheredEvtDescs = NULL;
+
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        pLanedEvtDescs->EvtDescNum[__IOC_ClsEvt_getLaneOfPriority(pEvtDescs[i].Priority)]++;
+    }
+
+    ULONG_T FirstLane = __IOC_ClsEvt_getLaneOfPriority(pEvtDescs[0].Priority);
+    if (pLanedEvtDescs->EvtDescNum[FirstLane] == EvtDescNum) {
+        pLanedEvtDescs->pEvtDescs[FirstLane] = pEvtDescs;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    IOC_EvtDesc_pT pGatheredEvtDescs = (IOC_EvtDesc_pT)malloc(EvtDescNum * sizeof(IOC_EvtDesc_T));
+    if (pGatheredEvtDescs == NULL) {
+        _IOC_LogError("[ConlesEvent]: Failed to gather %lu EvtDescs by lane", EvtDescNum);
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    ULONG_T GatheredNum[_CONLES_EVENT_PRIORITY_LANE_NUM] = {0};
+    ULONG_T LaneOffset = 0;
+    for (ULONG_T Lane = 0; Lane < _CONLES_EVENT_PRIORITY_LANE_NUM; Lane++) {
+        pLanedEvtDescs->pEvtDescs[Lane] = &pGatheredEvtDescs[LaneOffset];
+        LaneOffset += pLanedEvtDescs->EvtDescNum[Lane];
+    }
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        ULONG_T Lane = __IOC_ClsEvt_getLaneOfPriority(pEvtDescs[i].Priority);
+        pLanedEvtDescs->pEvtDescs[Lane][GatheredNum[Lane]++] = pEvtDescs[i];
+    }
+
+    *ppGatheredEvtDescs = pGatheredEvtDescs;
+    return IOC_RESULT_SUCCESS;
+}
+
+// Enqueue each lane's EvtDescs into LinkObj's EvtDescQueue of that lane all or nothing, from the highest lane,
+//  then notify EvtProcThread of really enqueued ones and zero the lane's EvtDescNum, so a retry skips it,
+//  TOO_MANY_QUEUING_EVTDESC if a lane is full or pushed back by a backlogged EvtSuber, RefMore: IOC_EVT_OVERFLOW_BLOCK
+//  in conflating mode, EvtDescs of an EvtID already pending only replace its value, RefMore: IOC_OPTID_CONFLATE
+static IOC_Result_T __IOC_ClsEvt_enqueueEvtDescsIntoLinkObj(_ClsEvtLinkObj_pT pLinkObj,
+                                                           _ClsEvtLanedEvtDescs_pT pLanedEvtDescs, bool IsConflating) {
+    for (ULONG_T Lane = _CONLES_EVENT_PRIORITY_LANE_NUM; Lane-- > 0;) {
+        IOC_EvtDesc_pT pEvtDescs = pLanedEvtDescs->pEvtDescs[Lane];
+        ULONG_T EvtDescNum = pLanedEvtDescs->EvtDescNum[Lane];
+        if (EvtDescNum == 0) {
+            continue;
+        }
+
+        if (__IOC_ClsEvt_isBackloggedForEvtDescs(pLinkObj, pEvtDescs, EvtDescNum)) {
+            return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+        }
+
+        IOC_Result_T Result = IOC_RESULT_BUG;
+        ULONG_T EnqueuedNum = EvtDescNum;
+        if (IsConflating) {
+            Result = _IOC_EvtDescQueue_enqueueElementsLastConflating(&pLinkObj->EvtDescQueues[Lane], pEvtDescs,
+                                                                     EvtDescNum, &EnqueuedNum);
+        } else {
+            Result = _IOC_EvtDescQueue_enqueueElementsLast(&pLinkObj->EvtDescQueues[Lane], pEvtDescs, EvtDescNum);
+        }
+        if (Result != IOC_RESULT_SUCCESS) {
+            return Result;
+        }
+
+        __IOC_ClsEvt_notifyLinkObjNewEvtDescs(pLinkObj, EnqueuedNum);
+        pLanedEvtDescs->EvtDescNum[Lane] = 0;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
 static IOC_Result_T __IOC_postEVT_inConlesModeAsyncTimed(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_INOUT*/ _ClsEvtLanedEvtDescs_pT pLanedEvtDescs,
+    /*ARG_IN*/ bool IsConflating,
     /*ARG_IN*/ ULONG_T TimeoutUS);
 static IOC_Result_T __IOC_postEVT_inConlesModeAsyncBlocked(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc) {
-    return __IOC_postEVT_inConlesModeAsyncTimed(pLinkObj, pEvtDesc, ULONG_MAX);
+    /*ARG_INOUT*/ _ClsEvtLanedEvtDescs_pT pLanedEvtDescs,
+    /*ARG_IN*/ bool IsConflating) {
+    // Only the head blocked poster waits on ProcedCond, others wait on BlockedPostMutex behind it,
+    //  otherwise each callbacked batch wakes all blocked posters to retry for a few freed slots.
+    //  TimeoutMode doesn't queue here, because waiting for a mutex can't be bounded by its timeout.
+    pthread_mutex_lock(&pLinkObj->BlockedPostMutex);
+    IOC_Result_T Result =
+        __IOC_postEVT_inConlesModeAsyncTimed(pLinkObj, pLanedEvtDescs, IsConflating, ULONG_MAX);
+    pthread_mutex_unlock(&pLinkObj->BlockedPostMutex);
+    return Result;
 }
 
 static IOC_Result_T __IOC_postEVT_inConlesModeSyncTimed(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
     /*ARG_IN*/ ULONG_T TimeoutUS);
 static IOC_Result_T __IOC_postEVT_inConlesModeSyncBlocked(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc) {
-    return __IOC_postEVT_inConlesModeSyncTimed(pLinkObj, pEvtDesc, ULONG_MAX);
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum) {
+    return __IOC_postEVT_inConlesModeSyncTimed(pLinkObj, pEvtDescs, EvtDescNum, ULONG_MAX);
+}
+
+// Invoke CbProcEvt of EvtSuberList for each EvtDesc in order, in the caller's thread.
+static void __IOC_ClsEvt_callbackProcEvtsOverSuberList(_ClsEvtLinkObj_pT pLinkObj, IOC_EvtDesc_pT pEvtDescs,
+                                                       ULONG_T EvtDescNum) {
+    for (ULONG_T i = 0; i < EvtDescNum; i++) {
+        __IOC_ClsEvt_callbackProcEvtOverSuberList(pLinkObj, &pEvtDescs[i], false);
+    }
 }
 
 /**
- * @brief Implementation of the _IOC_postEVT_inConlesMode.
+ * @brief Implementation of the _IOC_postEVT_inConlesMode and _IOC_postEVTs_inConlesMode.
  *
  * @param
  * - LinkID: use predefined AutoID.
- * - pEvtDesc: A pointer to the readonly event descriptor.
+ * - pEvtDescs: A pointer to the readonly event descriptor array.
+ * - EvtDescNum: number of event descriptors, 1 for _IOC_postEVT_inConlesMode.
+ *    In AsyncMode, EvtDescs of each lane are enqueued by one reservation, all or nothing and in posted order,
+ *      lanes already enqueued stay queued if a lower lane fails with TOO_MANY_QUEUING_EVTDESC or TIMEOUT.
+ *    In SyncMode, all EvtDescs are callbacked in order once EvtDescQueue becomes empty.
  * - pOption: An optional pointer to the options.
  *    such as Async or Sync, MayBlock or NonBlock or Timeout.
  *
@@ -758,25 +2119,39 @@ static IOC_Result_T __IOC_postEVT_inConlesModeSyncBlocked(
  *    and add _IOC_LogNotTested() next line for later comment out by unit testing of this path,
  *      and then goto _returnResult lable to clean up and return Result.
  */
-IOC_Result_T _IOC_postEVT_inConlesMode(
+IOC_Result_T _IOC_postEVTs_inConlesMode(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
     /*ARG_IN_OPTIONAL*/ const IOC_Options_pT pOption) {
     IOC_Result_T Result = IOC_RESULT_BUG;
     IOC_BoolResult_T IsAsyncMode = IOC_Option_isAsyncMode(pOption);
+    _ClsEvtLanedEvtDescs_T LanedEvtDescs;
+    IOC_EvtDesc_pT pGatheredEvtDescs = NULL;
 
-    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjLocked(LinkID);
+    // ClsEvtLinkObj is static and never freed, so AsyncMode enqueues into the lock-free EvtDescQueue
+    //  without LinkObj's Mutex, and producers of one AutoLinkID never serialize on it,
+    //  only SyncMode takes it to callback in the poster's thread one poster at a time, same as subEVT/unsubEVT.
+    _ClsEvtLinkObj_pT pLinkObj = __IOC_ClsEvt_getLinkObjNotLocked(LinkID);
     if (pLinkObj == NULL) {
         _IOC_LogError("[ConlesEvent]: No LinkObj of LinkID(%" PRIu64 ")", LinkID);
         //_IOC_LogNotTested();
         return IOC_RESULT_INVALID_AUTO_LINK_ID;  // Path@C->[1]
     }
 
+    bool IsLinkObjLocked = false;
+    if (!IsAsyncMode) {
+        pthread_mutex_lock(&pLinkObj->Mutex);
+        IsLinkObjLocked = true;
+    }
+
     // TC-9: CRITICAL - Prevent deadlock by forbidding SYNC_MODE during callback
     // If we're currently in a callback (IOC_LinkStateBusyCbProcEvt), attempting to
     // post with SYNC_MODE will deadlock because sync post waits for event processing,
     // but the event processor is blocked in the current callback.
-    if (!IsAsyncMode && pLinkObj->State.Main == IOC_LinkStateBusyCbProcEvt) {
+    // Same for CbProcEvt called by ClsEvtWorkerPool, because sync post waits this CbProcEvt to return.
+    if (!IsAsyncMode && (pLinkObj->State.Main == IOC_LinkStateBusyCbProcEvt ||
+                         __IOC_ClsEvt_isInWorkerCbProcEvtOfLinkObj(pLinkObj))) {
         _IOC_LogError("[ConlesEvent]: SYNC_MODE forbidden during callback (LinkState=%d) to prevent deadlock",
                       pLinkObj->State.Main);
         Result = IOC_RESULT_FORBIDDEN;
@@ -793,18 +2168,35 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
 
     //-------------------------------------------------------------------------------------------------------------------
     if (IsAsyncMode) {
+        // A burst is enqueued lane by lane, each lane all or nothing and in posted order,
+        //  so NORMAL EvtDescs of a burst neither jump into URGENT lane nor hold its URGENT ones back.
+        Result = __IOC_ClsEvt_splitEvtDescsIntoLanes(pEvtDescs, EvtDescNum, &LanedEvtDescs, &pGatheredEvtDescs);
+        if (Result != IOC_RESULT_SUCCESS) {
+            goto _returnResult;
+        }
+
+        // A lane's EvtDescs deeper than EvtDescQueue can never be enqueued by one reservation, even in MayBlockMode.
+        for (ULONG_T Lane = 0; Lane < _CONLES_EVENT_PRIORITY_LANE_NUM; Lane++) {
+            if (LanedEvtDescs.EvtDescNum[Lane] > _IOC_EvtDescQueue_getCapacity(&pLinkObj->EvtDescQueues[Lane])) {
+                _IOC_LogWarn("[ConlesEvent::ASync]: AutoLinkID(%" PRIu64
+                             ") post %lu EvtDescs of lane(%lu) deeper than EvtDescQueue",
+                             LinkID, LanedEvtDescs.EvtDescNum[Lane], Lane);
+                Result = IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;  // Path@A->[2]
+                goto _returnResult;
+            }
+        }
+
         // FIX: Skip fast-path for timeout mode - timeout behavior must be honored
         IOC_BoolResult_T IsTimeoutMode = IOC_Option_isTimeoutMode(pOption);
+        bool IsConflating = (IOC_Option_isConflateMode(pOption) == IOC_RESULT_YES);
 
         // 1) enqueueSuccess_ifHasSpaceInEvtDescQueue (fast path - only for non-timeout modes)
         if (IsTimeoutMode == IOC_RESULT_NO) {
-            Result = _IOC_EvtDescQueue_enqueueElementLast(&pLinkObj->EvtDescQueue, pEvtDesc);
+            Result = __IOC_ClsEvt_enqueueEvtDescsIntoLinkObj(pLinkObj, &LanedEvtDescs, IsConflating);
             if (Result == IOC_RESULT_SUCCESS) {
-                atomic_fetch_add(&pLinkObj->QueuedEvtNum, 1);
-                __IOC_ClsEvt_wakeupLinkObjThread(pLinkObj);
 
                 // _IOC_LogDebug("[ConlesEvent::ASync]: AutoLinkID(%llu) postEvtDesc(%s) success", LinkID,
-                //               IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                //               IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
                 Result = IOC_RESULT_SUCCESS;  // Path@A->[1]
                 //_IOC_LogNotTested();
                 goto _returnResult;
@@ -814,7 +2206,7 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
         // 2.1) NonBlock_returnImmediately
         if (IOC_Option_isNonBlockMode(pOption)) {
             _IOC_LogDebug("[ConlesEvent::ASync::NonBlock]: AutoLinkID(%llu) postEvtDesc(%s) failed", LinkID,
-                          IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                          IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             Result = IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;  // Path@A->[2]
             //_IOC_LogNotTested();
             goto _returnResult;
@@ -824,19 +2216,19 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
         if (IOC_Option_isTimeoutMode(pOption)) {
             ULONG_T TimeoutUS = IOC_Option_getTimeoutUS(pOption);
 
-            Result = __IOC_postEVT_inConlesModeAsyncTimed(pLinkObj, pEvtDesc, TimeoutUS);  // Path@A->[2]
-            _IOC_LogAssert(Result == IOC_RESULT_TIMEOUT ||
-                           Result == IOC_RESULT_SUCCESS);  // FIX: Accept TIMEOUT as valid result
+            Result = __IOC_postEVT_inConlesModeAsyncTimed(pLinkObj, &LanedEvtDescs, IsConflating,
+                                                          TimeoutUS);  // Path@A->[2]
+            _IOC_LogAssert(Result == IOC_RESULT_TIMEOUT || Result == IOC_RESULT_SUCCESS ||
+                           Result == IOC_RESULT_POSIX_ENOMEM);  // FIX: Accept TIMEOUT as valid result
 
             if (Result == IOC_RESULT_TIMEOUT) {
                 _IOC_LogDebug("[ConlesEvent::ASync::Timeout]: AutoLinkID(%llu) postEvtDesc(%s) timed out", LinkID,
-                              IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                              IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             }
 
             if (Result == IOC_RESULT_SUCCESS) {
-                atomic_fetch_add(&pLinkObj->QueuedEvtNum, 1);
                 _IOC_LogDebug("[ConlesEvent::ASync::Timeout]: AutoLinkID(%llu) postEvtDesc(%s) success", LinkID,
-                              IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                              IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             }
 
             //_IOC_LogNotTested();
@@ -845,13 +2237,12 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
 
         // 3) MayBlockMode_waitUntilHasSpaceAndEnqueueSuccess
         if (IOC_Option_isMayBlockMode(pOption)) {
-            Result = __IOC_postEVT_inConlesModeAsyncBlocked(pLinkObj, pEvtDesc);  // Path@A->[3]
-            _IOC_LogAssert(Result == IOC_RESULT_SUCCESS);
-
-            atomic_fetch_add(&pLinkObj->QueuedEvtNum, 1);
+            Result =
+                __IOC_postEVT_inConlesModeAsyncBlocked(pLinkObj, &LanedEvtDescs, IsConflating);  // Path@A->[3]
+            _IOC_LogAssert(Result == IOC_RESULT_SUCCESS || Result == IOC_RESULT_POSIX_ENOMEM);
 
             // _IOC_LogDebug("[ConlesEvent::ASync::MayBlock]: AutoLinkID(%llu) postEvtDesc(%s) success",
-            //               LinkID, IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+            //               LinkID, IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             //_IOC_LogNotTested();
             goto _returnResult;
         } else {
@@ -865,10 +2256,10 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
     {
         // 1) cbProcEvt_ifIsEmptyEvtDescQueue
         if (__IOC_ClsEvt_hasEvtDescInLinkObj(pLinkObj) == IOC_RESULT_NO) {
-            __IOC_ClsEvt_callbackProcEvtOverSuberList(pLinkObj, pEvtDesc);
+            __IOC_ClsEvt_callbackProcEvtsOverSuberList(pLinkObj, pEvtDescs, EvtDescNum);
 
             // _IOC_LogDebug("[ConlesEvent::Sync]: AutoLinkID(%llu) postEvtDesc(%s) success", LinkID,
-            //               IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+            //               IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             Result = IOC_RESULT_SUCCESS;  // Path@B->[1]
             //_IOC_LogNotTested();
             goto _returnResult;
@@ -877,7 +2268,7 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
         // 2.1) NonBlock_returnImmediately
         if (IOC_Option_isNonBlockMode(pOption)) {
             _IOC_LogDebug("[ConlesEvent::Sync::NonBlock]: AutoLinkID(%llu) postEvtDesc(%s) failed", LinkID,
-                          IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                          IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             Result = IOC_RESULT_TOO_LONG_EMPTYING_EVTDESC_QUEUE;  // Path@B->[2]
             //_IOC_LogNotTested();
             goto _returnResult;
@@ -887,17 +2278,17 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
         if (IOC_Option_isTimeoutMode(pOption)) {
             ULONG_T TimeoutUS = IOC_Option_getTimeoutUS(pOption);
 
-            Result = __IOC_postEVT_inConlesModeSyncTimed(pLinkObj, pEvtDesc, TimeoutUS);  // Path@B->[2]
+            Result = __IOC_postEVT_inConlesModeSyncTimed(pLinkObj, pEvtDescs, EvtDescNum, TimeoutUS);  // Path@B->[2]
             _IOC_LogAssert(Result == IOC_RESULT_TOO_LONG_EMPTYING_EVTDESC_QUEUE || Result == IOC_RESULT_SUCCESS);
 
             if (Result == IOC_RESULT_TOO_LONG_EMPTYING_EVTDESC_QUEUE) {
                 _IOC_LogDebug("[ConlesEvent::Sync::Timeout]: AutoLinkID(%llu) postEvtDesc(%s) failed", LinkID,
-                              IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                              IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             }
 
             if (Result == IOC_RESULT_SUCCESS) {
                 _IOC_LogDebug("[ConlesEvent::Sync::Timeout]: AutoLinkID(%llu) postEvtDesc(%s) success", LinkID,
-                              IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                              IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
             }
 
             //_IOC_LogNotTested();
@@ -906,11 +2297,11 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
 
         // 3) MayBlockMode_waitEvtDescQueueBecomeEmptyThenCbProcEvt
         if (IOC_Option_isMayBlockMode(pOption)) {
-            Result = __IOC_postEVT_inConlesModeSyncBlocked(pLinkObj, pEvtDesc);  // Path@B->[3]
+            Result = __IOC_postEVT_inConlesModeSyncBlocked(pLinkObj, pEvtDescs, EvtDescNum);  // Path@B->[3]
             _IOC_LogAssert(Result == IOC_RESULT_SUCCESS);
 
             _IOC_LogDebug("[ConlesEvent::Sync::MayBlock]: AutoLinkID(%llu) postEvtDesc(%s) success", LinkID,
-                          IOC_EvtDesc_printDetail(pEvtDesc, NULL, 0));
+                          IOC_EvtDesc_printDetail(pEvtDescs, NULL, 0));
 
             //_IOC_LogNotTested();
             goto _returnResult;
@@ -924,13 +2315,24 @@ IOC_Result_T _IOC_postEVT_inConlesMode(
 
 //-------------------------------------------------------------------------------------------------------------------
 _returnResult:
-    __IOC_ClsEvt_putLinkObj(pLinkObj);
+    if (IsLinkObjLocked) {
+        __IOC_ClsEvt_putLinkObj(pLinkObj);
+    }
+    free(pGatheredEvtDescs);
     return Result;
 }
 
+IOC_Result_T _IOC_postEVT_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_IN_OPTIONAL*/ const IOC_Options_pT pOption) {
+    return _IOC_postEVTs_inConlesMode(LinkID, pEvtDesc, 1, pOption);
+}
+
 static IOC_Result_T __IOC_postEVT_inConlesModeAsyncTimed(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_INOUT*/ _ClsEvtLanedEvtDescs_pT pLanedEvtDescs,
+    /*ARG_IN*/ bool IsConflating,
     /*ARG_IN*/ ULONG_T TimeoutUS) {
     IOC_Result_T Result = IOC_RESULT_BUG;
 
@@ -938,9 +2340,10 @@ static IOC_Result_T __IOC_postEVT_inConlesModeAsyncTimed(
     clock_gettime(CLOCK_REALTIME, &TS_Begin);
 
     do {
-        Result = _IOC_EvtDescQueue_enqueueElementLast(&pLinkObj->EvtDescQueue, pEvtDesc);
-        if (Result == IOC_RESULT_SUCCESS) {
-            __IOC_ClsEvt_wakeupLinkObjThread(pLinkObj);
+        ULONG_T LastProcedNum = __IOC_ClsEvt_getLinkObjProcedNum(pLinkObj);
+
+        Result = __IOC_ClsEvt_enqueueEvtDescsIntoLinkObj(pLinkObj, pLanedEvtDescs, IsConflating);
+        if (Result != IOC_RESULT_TOO_MANY_QUEUING_EVTDESC) {
             //_IOC_LogNotTested();
             break;
         }
@@ -955,7 +2358,10 @@ static IOC_Result_T __IOC_postEVT_inConlesModeAsyncTimed(
             break;
         }
 
-        usleep(1000);  // 1ms
+        // EvtDescQueue has space again only after EvtProcThread callbacked some EvtDescs,
+        //  LinkObj's Mutex is not held by AsyncMode, so other postEVTs such as to a higher lane are not blocked.
+        __IOC_ClsEvt_waitLinkObjProcedEvtDesc(pLinkObj, LastProcedNum,
+                                              (TimeoutUS == ULONG_MAX) ? ULONG_MAX : (TimeoutUS - ElapsedUS));
     } while (0x20240810);
 
     return Result;
@@ -963,7 +2369,8 @@ static IOC_Result_T __IOC_postEVT_inConlesModeAsyncTimed(
 
 static IOC_Result_T __IOC_postEVT_inConlesModeSyncTimed(
     /*ARG_IN*/ _ClsEvtLinkObj_pT pLinkObj,
-    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
     /*ARG_IN*/ ULONG_T TimeoutUS) {
     IOC_Result_T Result = IOC_RESULT_BUG;
 
@@ -971,13 +2378,13 @@ static IOC_Result_T __IOC_postEVT_inConlesModeSyncTimed(
     clock_gettime(CLOCK_REALTIME, &TS_Begin);
 
     do {
+        ULONG_T LastProcedNum = __IOC_ClsEvt_getLinkObjProcedNum(pLinkObj);
+
         if (__IOC_ClsEvt_hasEvtDescInLinkObj(pLinkObj) == IOC_RESULT_NO) {
-            __IOC_ClsEvt_callbackProcEvtOverSuberList(pLinkObj, pEvtDesc);
+            __IOC_ClsEvt_callbackProcEvtsOverSuberList(pLinkObj, pEvtDescs, EvtDescNum);
             //_IOC_LogNotTested();
             Result = IOC_RESULT_SUCCESS;
             break;
-        } else {
-            __IOC_ClsEvt_wakeupLinkObjThread(pLinkObj);
         }
 
         struct timespec TS_End;
@@ -990,7 +2397,8 @@ static IOC_Result_T __IOC_postEVT_inConlesModeSyncTimed(
             break;
         }
 
-        usleep(1000);  // 1ms
+        __IOC_ClsEvt_waitLinkObjProcedEvtDesc(pLinkObj, LastProcedNum,
+                                              (TimeoutUS == ULONG_MAX) ? ULONG_MAX : (TimeoutUS - ElapsedUS));
     } while (0x20240810);
 
     return Result;
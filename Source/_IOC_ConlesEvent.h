@@ -3,7 +3,7 @@
  * @brief This is ConlesEvent internal header file, which is included by _IOC.h only.
  * @attention
  *   - LinkID in ConlesMode is predefined as IOC_CONLES_MODE_AUTO_LINK_ID(_0/_1/_2/...) in IOC_Types.h
- *      Currently, only IOC_CONLES_MODE_AUTO_LINK_ID is supported, and other values are reserved for future use.
+ *      How many of them are valid is reported by IOC_getCapability(IOC_CAPID_CONLES_MODE_EVENT).
  * @version
  *   - SPECv2
  */
@@ -17,16 +17,29 @@ extern "C" {
 #endif
 
 IOC_Result_T _IOC_subEVT_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_SubEvtArgs_pT pSubEvtArgs);
 
 IOC_Result_T _IOC_unsubEVT_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pUnsubEvtArgs);
 
+IOC_Result_T _IOC_getEvtMailboxStats_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_UnsubEvtArgs_pT pSuberArgs,
+    /*ARG_OUT*/ IOC_EvtMailboxStats_pT pMailboxStats);
+
 IOC_Result_T _IOC_postEVT_inConlesMode(
     /*ARG_IN*/ IOC_LinkID_T LinkID,
     /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDesc,
     /*ARG_IN_OPTIONAL*/ const IOC_Options_pT pOption);
 
+IOC_Result_T _IOC_postEVTs_inConlesMode(
+    /*ARG_IN*/ IOC_LinkID_T LinkID,
+    /*ARG_IN*/ const IOC_EvtDesc_pT pEvtDescs,
+    /*ARG_IN*/ ULONG_T EvtDescNum,
+    /*ARG_IN_OPTIONAL*/ const IOC_Options_pT pOption);
+
 IOC_Result_T _IOC_pullEVT_inConlesMode(
     /*ARG_OUT*/ IOC_EvtDesc_pT pEvtDesc,
     /*ARG_IN_OPTIONAL*/ const IOC_Options_pT pOption);
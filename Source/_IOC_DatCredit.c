@@ -0,0 +1,165 @@
+#include "_IOC_DatCredit.h"
+
+#include <errno.h>
+#include <time.h>
+
+void _IOC_DatCredit_initOne(_IOC_DatCredit_pT pCredit, ULONG_T MaxDatNum, ULONG_T MaxDatBytes) {
+    pthread_mutex_init(&pCredit->Mutex, NULL);
+    pthread_cond_init(&pCredit->GrantCond, NULL);
+
+    pCredit->MaxDatNum = MaxDatNum;
+    pCredit->MaxDatBytes = MaxDatBytes;
+
+    pCredit->SpentDatNum = pCredit->SpentDatBytes = 0;
+    pCredit->ReturnedDatNum = pCredit->ReturnedDatBytes = 0;
+
+    pCredit->WaiterNum = 0;
+    pCredit->IsClosed = false;
+
+    pCredit->BlockedDatNum = pCredit->OverdrawnDatNum = 0;
+}
+
+void _IOC_DatCredit_deinitOne(_IOC_DatCredit_pT pCredit) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    pCredit->IsClosed = true;
+    pthread_cond_broadcast(&pCredit->GrantCond);
+    while (pCredit->WaiterNum > 0) {
+        pthread_cond_wait(&pCredit->GrantCond, &pCredit->Mutex);
+    }
+    pthread_mutex_unlock(&pCredit->Mutex);
+
+    pthread_cond_destroy(&pCredit->GrantCond);
+    pthread_mutex_destroy(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_setWindow(_IOC_DatCredit_pT pCredit, ULONG_T MaxDatNum, ULONG_T MaxDatBytes) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    pCredit->MaxDatNum = MaxDatNum;
+    pCredit->MaxDatBytes = MaxDatBytes;
+    pthread_cond_broadcast(&pCredit->GrantCond);
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_close(_IOC_DatCredit_pT pCredit) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    pCredit->IsClosed = true;
+    pthread_cond_broadcast(&pCredit->GrantCond);
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+// Whether one more chunk of DataSize fits in the window, with Mutex held.
+static bool __IOC_DatCredit_hasCredit(_IOC_DatCredit_pT pCredit, ULONG_T DataSize) {
+    ULONG_T InflightDatNum = pCredit->SpentDatNum - pCredit->ReturnedDatNum;
+    ULONG_T InflightDatBytes = pCredit->SpentDatBytes - pCredit->ReturnedDatBytes;
+
+    if (0 == InflightDatNum) {
+        return true;  // Even a chunk larger than MaxDatBytes, or no progress is ever possible
+    }
+    if (pCredit->MaxDatNum && InflightDatNum >= pCredit->MaxDatNum) {
+        return false;
+    }
+    if (pCredit->MaxDatBytes && InflightDatBytes + DataSize > pCredit->MaxDatBytes) {
+        return false;
+    }
+    return true;
+}
+
+IOC_Result_T _IOC_DatCredit_acquire(_IOC_DatCredit_pT pCredit, ULONG_T DataSize, long long TimeoutUS) {
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+
+    pthread_mutex_lock(&pCredit->Mutex);
+    if (!pCredit->IsClosed && !__IOC_DatCredit_hasCredit(pCredit, DataSize)) {
+        if (0 == TimeoutUS) {
+            pthread_mutex_unlock(&pCredit->Mutex);
+            return IOC_RESULT_BUFFER_FULL;
+        }
+
+        struct timespec AbsTimeout;
+        if (TimeoutUS > 0) {
+            clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+            AbsTimeout.tv_sec += TimeoutUS / 1000000;
+            AbsTimeout.tv_nsec += (TimeoutUS % 1000000) * 1000;
+            if (AbsTimeout.tv_nsec >= 1000000000) {
+                AbsTimeout.tv_sec++;
+                AbsTimeout.tv_nsec -= 1000000000;
+            }
+        }
+
+        pCredit->BlockedDatNum++;
+        pCredit->WaiterNum++;
+        while (!pCredit->IsClosed && !__IOC_DatCredit_hasCredit(pCredit, DataSize)) {
+            if (TimeoutUS < 0) {
+                pthread_cond_wait(&pCredit->GrantCond, &pCredit->Mutex);
+            } else if (ETIMEDOUT == pthread_cond_timedwait(&pCredit->GrantCond, &pCredit->Mutex, &AbsTimeout)) {
+                if (!__IOC_DatCredit_hasCredit(pCredit, DataSize)) {
+                    Result = IOC_RESULT_TIMEOUT;
+                }
+                break;
+            }
+        }
+        pCredit->WaiterNum--;
+        if (pCredit->IsClosed && 0 == pCredit->WaiterNum) {
+            pthread_cond_broadcast(&pCredit->GrantCond);  // deinit MAY wait for us
+        }
+    }
+
+    if (pCredit->IsClosed) {
+        Result = IOC_RESULT_LINK_BROKEN;
+    } else if (IOC_RESULT_SUCCESS == Result) {
+        pCredit->SpentDatNum++;
+        pCredit->SpentDatBytes += DataSize;
+    }
+    pthread_mutex_unlock(&pCredit->Mutex);
+    return Result;
+}
+
+void _IOC_DatCredit_overdraw(_IOC_DatCredit_pT pCredit, ULONG_T DataSize) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    if (!__IOC_DatCredit_hasCredit(pCredit, DataSize)) {
+        pCredit->OverdrawnDatNum++;
+    }
+    pCredit->SpentDatNum++;
+    pCredit->SpentDatBytes += DataSize;
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_refund(_IOC_DatCredit_pT pCredit, ULONG_T DataSize) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    pCredit->SpentDatNum--;
+    pCredit->SpentDatBytes -= DataSize;
+    pthread_cond_broadcast(&pCredit->GrantCond);
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_release(_IOC_DatCredit_pT pCredit, ULONG_T DatNum, ULONG_T DatBytes) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    pCredit->ReturnedDatNum += DatNum;
+    pCredit->ReturnedDatBytes += DatBytes;
+    if (pCredit->WaiterNum > 0) {
+        pthread_cond_broadcast(&pCredit->GrantCond);
+    }
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_releaseTo(_IOC_DatCredit_pT pCredit, ULONG_T TotalDatNum, ULONG_T TotalDatBytes) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    // Consumers of the same link MAY report their totals out of order, keep the latest
+    if (TotalDatNum > pCredit->ReturnedDatNum) {
+        pCredit->ReturnedDatNum = TotalDatNum;
+        pCredit->ReturnedDatBytes = TotalDatBytes;
+        if (pCredit->WaiterNum > 0) {
+            pthread_cond_broadcast(&pCredit->GrantCond);
+        }
+    }
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
+
+void _IOC_DatCredit_getStats(_IOC_DatCredit_pT pCredit, ULONG_T *pMaxDatNum, ULONG_T *pInflightDatNum,
+                             ULONG_T *pBlockedDatNum, ULONG_T *pOverdrawnDatNum) {
+    pthread_mutex_lock(&pCredit->Mutex);
+    if (pMaxDatNum) *pMaxDatNum = pCredit->MaxDatNum;
+    if (pInflightDatNum) *pInflightDatNum = pCredit->SpentDatNum - pCredit->ReturnedDatNum;
+    if (pBlockedDatNum) *pBlockedDatNum = pCredit->BlockedDatNum;
+    if (pOverdrawnDatNum) *pOverdrawnDatNum = pCredit->OverdrawnDatNum;
+    pthread_mutex_unlock(&pCredit->Mutex);
+}
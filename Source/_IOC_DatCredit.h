@@ -0,0 +1,81 @@
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "_IOC_Logging.h"
+#include "_IOC_Types.h"
+
+#ifndef __IOC_DATCREDIT_H__
+#define __IOC_DATCREDIT_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Default window of IOC_DatUsageArgs_T::Credit when its MaxDatNum or MaxDatBytes is 0
+#define _IOC_DAT_CREDIT_DEFAULT_MAX_NUM 256
+#define _IOC_DAT_CREDIT_DEFAULT_MAX_BYTES (1024 * 1024)
+
+/**
+ * @brief DatCredit is the window of data chunks a DatSender may have in flight to its DatReceiver,
+ *    i.e. sent but not consumed yet by CbRecvDat_F or IOC_recvDAT, in both chunks and bytes.
+ *    DatSender spends credits locally before each send without any round trip to the receiver,
+ *      and waits or gets IOC_RESULT_BUFFER_FULL only if the window is used up,
+ *      then the receiver returns credits as it consumes data, so a link never drops data nor buffers unboundedly.
+ *
+ *  Credits are counted by monotonic Spent and Returned counters, so in flight is their difference,
+ *    and returning credits may be either by delta(_IOC_DatCredit_release) or by the receiver's
+ *    consumed total(_IOC_DatCredit_releaseTo), but NOT both on the same DatCredit.
+ */
+typedef struct {
+    pthread_mutex_t Mutex;
+    pthread_cond_t GrantCond;  // DatSenders wait for credits returned, deinit waits for DatSenders to leave
+
+    ULONG_T MaxDatNum;    // 0 means unlimited
+    ULONG_T MaxDatBytes;  // 0 means unlimited, a larger chunk is sent alone when nothing is in flight
+
+    ULONG_T SpentDatNum, SpentDatBytes;        // Monotonic, by DatSenders
+    ULONG_T ReturnedDatNum, ReturnedDatBytes;  // Monotonic, by DatReceiver
+
+    ULONG_T WaiterNum;  // DatSenders waiting in _IOC_DatCredit_acquire
+    bool IsClosed;
+
+    ULONG_T BlockedDatNum;    // Chunks which waited for credits
+    ULONG_T OverdrawnDatNum;  // Chunks sent beyond the window by _IOC_DatCredit_overdraw
+} _IOC_DatCredit_T, *_IOC_DatCredit_pT;
+
+// Init with the window of MaxDatNum chunks and MaxDatBytes bytes, 0 means unlimited.
+void _IOC_DatCredit_initOne(_IOC_DatCredit_pT pCredit, ULONG_T MaxDatNum, ULONG_T MaxDatBytes);
+// Close it and wait for waiting DatSenders to leave, then NO DatSender may use it anymore.
+void _IOC_DatCredit_deinitOne(_IOC_DatCredit_pT pCredit);
+// Change the window, such as when the DatReceiver's args are known, waking DatSenders if it's larger.
+void _IOC_DatCredit_setWindow(_IOC_DatCredit_pT pCredit, ULONG_T MaxDatNum, ULONG_T MaxDatBytes);
+// Wake all waiting DatSenders and make them and later ones return IOC_RESULT_LINK_BROKEN.
+void _IOC_DatCredit_close(_IOC_DatCredit_pT pCredit);
+
+/**
+ * @brief Spend the credits of one chunk of DataSize, waiting for credits returned if the window is used up.
+ *
+ * @param TimeoutUS: <0 means wait forever, 0 means don't wait.
+ * @return IOC_RESULT_SUCCESS, IOC_RESULT_BUFFER_FULL if no credits and TimeoutUS is 0,
+ *    IOC_RESULT_TIMEOUT, or IOC_RESULT_LINK_BROKEN if closed.
+ */
+IOC_Result_T _IOC_DatCredit_acquire(_IOC_DatCredit_pT pCredit, ULONG_T DataSize, long long TimeoutUS);
+// Spend the credits of one chunk even beyond the window, for sends which MUST never wait, such as
+//  from a callback thread which would deadlock a circular send chain.
+void _IOC_DatCredit_overdraw(_IOC_DatCredit_pT pCredit, ULONG_T DataSize);
+// Give back the credits of one chunk spent but not sent, such as its delivery failed.
+void _IOC_DatCredit_refund(_IOC_DatCredit_pT pCredit, ULONG_T DataSize);
+
+// Return the credits of DatNum chunks of DatBytes consumed by the DatReceiver.
+void _IOC_DatCredit_release(_IOC_DatCredit_pT pCredit, ULONG_T DatNum, ULONG_T DatBytes);
+// Return the credits up to the DatReceiver's monotonic total of consumed chunks and bytes.
+void _IOC_DatCredit_releaseTo(_IOC_DatCredit_pT pCredit, ULONG_T TotalDatNum, ULONG_T TotalDatBytes);
+
+// Get the window and counters, any pointer may be NULL.
+void _IOC_DatCredit_getStats(_IOC_DatCredit_pT pCredit, /*ARG_OUT*/ ULONG_T *pMaxDatNum,
+                             /*ARG_OUT*/ ULONG_T *pInflightDatNum, /*ARG_OUT*/ ULONG_T *pBlockedDatNum,
+                             /*ARG_OUT*/ ULONG_T *pOverdrawnDatNum);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __IOC_DATCREDIT_H__
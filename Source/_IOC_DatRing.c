@@ -0,0 +1,522 @@
+#if defined(__linux__)
+#define _GNU_SOURCE  // memfd_create
+#endif
+
+#include "_IOC_DatRing.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#define _IOC_DAT_RING_REC_ALIGN 8
+
+static inline ULONG_T __IOC_DatRing_getRecSize(ULONG_T DataSize) {
+    return (sizeof(_IOC_DatRingRecHdr_T) + DataSize + _IOC_DAT_RING_REC_ALIGN - 1) &
+           ~(ULONG_T)(_IOC_DAT_RING_REC_ALIGN - 1);
+}
+
+static inline _IOC_DatRingRecHdr_T *__IOC_DatRing_getRecHdr(_IOC_DatRing_pT pRing, ULONG_T Pos) {
+    return (_IOC_DatRingRecHdr_T *)(pRing->pBase + (Pos & (pRing->Capacity - 1)));
+}
+
+// Map a file of Capacity twice back to back, so [pBase + Capacity, ...) is the same memory as [pBase, ...).
+static char *__IOC_DatRing_mapMirrored(ULONG_T Capacity) {
+#if defined(__linux__)
+    int Fd = memfd_create("IOC_DatRing", MFD_CLOEXEC);
+#else
+    char FilePath[] = "/tmp/IOC_DatRing_XXXXXX";
+    int Fd = mkstemp(FilePath);
+    if (Fd >= 0) {
+        unlink(FilePath);
+    }
+#endif
+    if (Fd < 0) {
+        _IOC_LogError("Failed to create the file of DatRing, errno=%d", errno);
+        return NULL;
+    }
+
+    char *pBase = NULL;
+    if (ftruncate(Fd, (off_t)Capacity) == 0) {
+        // Reserve 2*Capacity of address space first, then replace both halves by the same file.
+        pBase = mmap(NULL, 2 * Capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pBase == MAP_FAILED) {
+            pBase = NULL;
+        } else if (mmap(pBase, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, Fd, 0) == MAP_FAILED ||
+                   mmap(pBase + Capacity, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, Fd, 0) ==
+                       MAP_FAILED) {
+            munmap(pBase, 2 * Capacity);
+            pBase = NULL;
+        }
+    }
+
+    if (pBase == NULL) {
+        _IOC_LogError("Failed to map DatRing of %lu bytes, errno=%d", Capacity, errno);
+    }
+
+    close(Fd);  // The mappings keep the file
+    return pBase;
+}
+
+void *_IOC_DatRing_callocEmbedder(size_t Size) {
+    void *pEmbedder = NULL;
+    if (posix_memalign(&pEmbedder, _IOC_DAT_RING_CACHE_LINE_SIZE, Size) != 0) {
+        return NULL;
+    }
+    memset(pEmbedder, 0, Size);
+    return pEmbedder;
+}
+
+IOC_Result_T _IOC_DatRing_initOne(_IOC_DatRing_pT pRing, ULONG_T Capacity) {
+    if (Capacity == 0) {
+        Capacity = _IOC_DAT_RING_DEFAULT_CAPACITY;
+    } else if (Capacity > _IOC_DAT_RING_MAX_CAPACITY) {
+        _IOC_LogWarn("DatRing capacity(%lu) exceeds max(%lu)", Capacity, _IOC_DAT_RING_MAX_CAPACITY);
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    ULONG_T RingSize = (ULONG_T)sysconf(_SC_PAGESIZE);
+    while (RingSize < Capacity) {
+        RingSize <<= 1;
+    }
+
+    char *pBase = __IOC_DatRing_mapMirrored(RingSize);
+    if (pBase == NULL) {
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    atomic_init(&pRing->WritePos, 0);
+    atomic_init(&pRing->ReadPos, 0);
+    pRing->HeadReadOffset = 0;
+    atomic_init(&pRing->PeekNum, 0);
+    atomic_init(&pRing->ReadDatNum, 0);
+    atomic_init(&pRing->ReadDatBytes, 0);
+
+    atomic_init(&pRing->DataSeq, 0);
+    atomic_init(&pRing->WaiterNum, 0);
+    atomic_init(&pRing->IsClosed, false);
+
+    pRing->pBase = pBase;
+    pRing->Capacity = RingSize;
+
+    pthread_mutex_init(&pRing->ProducerMutex, NULL);
+    pthread_mutex_init(&pRing->ConsumerMutex, NULL);
+#if !defined(__linux__)
+    pthread_mutex_init(&pRing->ParkMutex, NULL);
+    pthread_cond_init(&pRing->ParkCond, NULL);
+#endif
+    return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_DatRing_deinitOne(_IOC_DatRing_pT pRing) {
+    if (pRing->pBase == NULL) {
+        return;  // Never inited or already deinited
+    }
+
+    munmap(pRing->pBase, 2 * pRing->Capacity);
+    pRing->pBase = NULL;
+    atomic_store(&pRing->PeekNum, 0);  // A pending peek is dropped with the ring, no lock is held by it
+
+    pthread_mutex_destroy(&pRing->ProducerMutex);
+    pthread_mutex_destroy(&pRing->ConsumerMutex);
+#if !defined(__linux__)
+    pthread_mutex_destroy(&pRing->ParkMutex);
+    pthread_cond_destroy(&pRing->ParkCond);
+#endif
+}
+
+// Called by producer after WritePos is published, or by close after IsClosed is set.
+static void __IOC_DatRing_wakeConsumers(_IOC_DatRing_pT pRing) {
+    // Pair with the fence in __IOC_DatRing_parkConsumer: either we see its WaiterNum, or it sees our WritePos.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&pRing->WaiterNum, memory_order_relaxed) == 0) {
+        return;
+    }
+
+    atomic_fetch_add(&pRing->DataSeq, 1);
+#if defined(__linux__)
+    syscall(SYS_futex, &pRing->DataSeq, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&pRing->ParkMutex);
+    pthread_cond_broadcast(&pRing->ParkCond);
+    pthread_mutex_unlock(&pRing->ParkMutex);
+#endif
+}
+
+void _IOC_DatRing_close(_IOC_DatRing_pT pRing) {
+    atomic_store(&pRing->IsClosed, true);
+    __IOC_DatRing_wakeConsumers(pRing);
+}
+
+static inline bool __IOC_DatRing_isEmpty(_IOC_DatRing_pT pRing) {
+    return atomic_load_explicit(&pRing->WritePos, memory_order_acquire) ==
+           atomic_load_explicit(&pRing->ReadPos, memory_order_relaxed);
+}
+
+IOC_Result_T _IOC_DatRing_reserve(_IOC_DatRing_pT pRing, ULONG_T DataSize, void **ppSpace) {
+    ULONG_T RecSize = __IOC_DatRing_getRecSize(DataSize);
+    ULONG_T WritePos = atomic_load_explicit(&pRing->WritePos, memory_order_relaxed);
+    ULONG_T ReadPos = atomic_load_explicit(&pRing->ReadPos, memory_order_acquire);
+    if (RecSize > pRing->Capacity - (WritePos - ReadPos)) {
+        return IOC_RESULT_BUFFER_FULL;
+    }
+
+    // Contiguous even if it wraps around, thanks to the mirrored mapping.
+    *ppSpace = __IOC_DatRing_getRecHdr(pRing, WritePos) + 1;
+    return IOC_RESULT_SUCCESS;
+}
+
+// Publish the reserved record of DataSize(> 0) to consumers without waking them.
+static void __IOC_DatRing_publish(_IOC_DatRing_pT pRing, ULONG_T DataSize) {
+    ULONG_T WritePos = atomic_load_explicit(&pRing->WritePos, memory_order_relaxed);
+    _IOC_DatRingRecHdr_T *pRecHdr = __IOC_DatRing_getRecHdr(pRing, WritePos);
+    pRecHdr->DataLen = (uint32_t)DataSize;
+    pRecHdr->Reserved = 0;
+
+    atomic_store_explicit(&pRing->WritePos, WritePos + __IOC_DatRing_getRecSize(DataSize), memory_order_release);
+}
+
+void _IOC_DatRing_commit(_IOC_DatRing_pT pRing, ULONG_T DataSize) {
+    if (DataSize > 0) {
+        __IOC_DatRing_publish(pRing, DataSize);
+        __IOC_DatRing_wakeConsumers(pRing);
+    }
+}
+
+// Copy a record into the ring and publish it, by the only producer or with ProducerMutex held.
+static IOC_Result_T __IOC_DatRing_pushLocked(_IOC_DatRing_pT pRing, const void *pData, ULONG_T DataSize) {
+    void *pSpace = NULL;
+
+    IOC_Result_T Result = _IOC_DatRing_reserve(pRing, DataSize, &pSpace);
+    if (Result == IOC_RESULT_SUCCESS) {
+        memcpy(pSpace, pData, DataSize);
+        __IOC_DatRing_publish(pRing, DataSize);
+    }
+    return Result;
+}
+
+IOC_Result_T _IOC_DatRing_push(_IOC_DatRing_pT pRing, const void *pData, ULONG_T DataSize) {
+    pthread_mutex_lock(&pRing->ProducerMutex);
+    IOC_Result_T Result = __IOC_DatRing_pushLocked(pRing, pData, DataSize);
+    pthread_mutex_unlock(&pRing->ProducerMutex);
+
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_DatRing_wakeConsumers(pRing);
+    }
+    return Result;
+}
+
+IOC_Result_T _IOC_DatRing_pushNotLocked(_IOC_DatRing_pT pRing, const void *pData, ULONG_T DataSize) {
+    IOC_Result_T Result = __IOC_DatRing_pushLocked(pRing, pData, DataSize);
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_DatRing_wakeConsumers(pRing);
+    }
+    return Result;
+}
+
+// Park until DataSeq is changed from Seq, or RelTimeout(NULL means forever) passes.
+static void __IOC_DatRing_parkConsumer(_IOC_DatRing_pT pRing, unsigned int Seq, const struct timespec *pRelTimeout) {
+#if defined(__linux__)
+    syscall(SYS_futex, &pRing->DataSeq, FUTEX_WAIT_PRIVATE, Seq, pRelTimeout, NULL, 0);
+#else
+    pthread_mutex_lock(&pRing->ParkMutex);
+    if (atomic_load(&pRing->DataSeq) == Seq) {
+        if (pRelTimeout == NULL) {
+            pthread_cond_wait(&pRing->ParkCond, &pRing->ParkMutex);
+        } else {
+            struct timespec AbsTimeout;
+            clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+            AbsTimeout.tv_sec += pRelTimeout->tv_sec;
+            AbsTimeout.tv_nsec += pRelTimeout->tv_nsec;
+            if (AbsTimeout.tv_nsec >= 1000000000L) {
+                AbsTimeout.tv_sec += 1;
+                AbsTimeout.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&pRing->ParkCond, &pRing->ParkMutex, &AbsTimeout);
+        }
+    }
+    pthread_mutex_unlock(&pRing->ParkMutex);
+#endif
+}
+
+IOC_Result_T _IOC_DatRing_waitData(_IOC_DatRing_pT pRing, long long TimeoutUS) {
+    struct timespec Deadline = {0};
+    if (TimeoutUS > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &Deadline);
+        Deadline.tv_sec += TimeoutUS / 1000000;
+        Deadline.tv_nsec += (TimeoutUS % 1000000) * 1000;
+        if (Deadline.tv_nsec >= 1000000000L) {
+            Deadline.tv_sec += 1;
+            Deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    while (1) {
+        if (!__IOC_DatRing_isEmpty(pRing)) {
+            return IOC_RESULT_SUCCESS;
+        } else if (atomic_load(&pRing->IsClosed)) {
+            return IOC_RESULT_LINK_BROKEN;
+        } else if (TimeoutUS == 0) {
+            return IOC_RESULT_TIMEOUT;
+        }
+
+        struct timespec RelTimeout = {0};
+        if (TimeoutUS > 0) {
+            struct timespec Now;
+            clock_gettime(CLOCK_MONOTONIC, &Now);
+            RelTimeout.tv_sec = Deadline.tv_sec - Now.tv_sec;
+            RelTimeout.tv_nsec = Deadline.tv_nsec - Now.tv_nsec;
+            if (RelTimeout.tv_nsec < 0) {
+                RelTimeout.tv_sec -= 1;
+                RelTimeout.tv_nsec += 1000000000L;
+            }
+            if (RelTimeout.tv_sec < 0) {
+                return IOC_RESULT_TIMEOUT;
+            }
+        }
+
+        // Announce this waiter BEFORE checking the ring again, so producer either sees WaiterNum or we see its data.
+        atomic_fetch_add(&pRing->WaiterNum, 1);
+        unsigned int Seq = atomic_load(&pRing->DataSeq);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (__IOC_DatRing_isEmpty(pRing) && !atomic_load(&pRing->IsClosed)) {
+            __IOC_DatRing_parkConsumer(pRing, Seq, (TimeoutUS > 0) ? &RelTimeout : NULL);
+        }
+        atomic_fetch_sub(&pRing->WaiterNum, 1);
+    }
+}
+
+// Count whole records released to producer, with ConsumerMutex held.
+static inline void __IOC_DatRing_addReadTotal(_IOC_DatRing_pT pRing, ULONG_T ReadNum, ULONG_T ReadBytes) {
+    if (ReadNum > 0) {
+        atomic_fetch_add_explicit(&pRing->ReadDatBytes, ReadBytes, memory_order_relaxed);
+        atomic_fetch_add_explicit(&pRing->ReadDatNum, ReadNum, memory_order_release);
+    }
+}
+
+// Copy records from head until pBuf is full or the ring is empty, with ConsumerMutex held.
+static ULONG_T __IOC_DatRing_readLocked(_IOC_DatRing_pT pRing, char *pBuf, ULONG_T BufSize) {
+    ULONG_T ReadPos = atomic_load_explicit(&pRing->ReadPos, memory_order_relaxed);
+    ULONG_T WritePos = atomic_load_explicit(&pRing->WritePos, memory_order_acquire);
+    ULONG_T ReadSize = 0;
+    ULONG_T ReadNum = 0, ReadBytes = 0;
+
+    while (ReadPos != WritePos && ReadSize < BufSize) {
+        _IOC_DatRingRecHdr_T *pRecHdr = __IOC_DatRing_getRecHdr(pRing, ReadPos);
+        ULONG_T LeftSize = pRecHdr->DataLen - pRing->HeadReadOffset;
+        ULONG_T CopySize = (LeftSize <= BufSize - ReadSize) ? LeftSize : (BufSize - ReadSize);
+
+        memcpy(pBuf + ReadSize, (char *)(pRecHdr + 1) + pRing->HeadReadOffset, CopySize);
+        ReadSize += CopySize;
+
+        if (CopySize == LeftSize) {
+            ReadNum++;
+            ReadBytes += pRecHdr->DataLen;
+            ReadPos += __IOC_DatRing_getRecSize(pRecHdr->DataLen);
+            pRing->HeadReadOffset = 0;
+        } else {
+            pRing->HeadReadOffset += CopySize;
+        }
+    }
+
+    // Release the copied records' space to producer only after they're copied out.
+    atomic_store_explicit(&pRing->ReadPos, ReadPos, memory_order_release);
+    __IOC_DatRing_addReadTotal(pRing, ReadNum, ReadBytes);
+    return ReadSize;
+}
+
+IOC_Result_T _IOC_DatRing_read(_IOC_DatRing_pT pRing, void *pBuf, ULONG_T BufSize, ULONG_T *pReadSize,
+                               long long TimeoutUS) {
+    *pReadSize = 0;
+    if (BufSize == 0) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    while (1) {
+        IOC_Result_T Result = _IOC_DatRing_waitData(pRing, TimeoutUS);
+        if (Result == IOC_RESULT_TIMEOUT && TimeoutUS == 0) {
+            return IOC_RESULT_NO_DATA;
+        } else if (Result != IOC_RESULT_SUCCESS) {
+            return Result;
+        }
+
+        pthread_mutex_lock(&pRing->ConsumerMutex);
+        if (atomic_load_explicit(&pRing->PeekNum, memory_order_relaxed) > 0) {
+            pthread_mutex_unlock(&pRing->ConsumerMutex);
+            return IOC_RESULT_BUSY;
+        }
+        *pReadSize = __IOC_DatRing_readLocked(pRing, (char *)pBuf, BufSize);
+        pthread_mutex_unlock(&pRing->ConsumerMutex);
+
+        // Another consumer of the same link MAY take the data after we're woken, then wait again.
+        if (*pReadSize > 0) {
+            return IOC_RESULT_SUCCESS;
+        }
+    }
+}
+
+// Wait for data then lock ConsumerMutex, or return IOC_RESULT_NO_DATA if TimeoutUS is 0 and the ring is empty,
+//  or IOC_RESULT_BUSY without ConsumerMutex if a peek is pending.
+static IOC_Result_T __IOC_DatRing_waitDataLocked(_IOC_DatRing_pT pRing, long long TimeoutUS) {
+    IOC_Result_T Result = _IOC_DatRing_waitData(pRing, TimeoutUS);
+    if (Result == IOC_RESULT_TIMEOUT && TimeoutUS == 0) {
+        return IOC_RESULT_NO_DATA;
+    } else if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    pthread_mutex_lock(&pRing->ConsumerMutex);
+    if (atomic_load_explicit(&pRing->PeekNum, memory_order_relaxed) > 0) {
+        pthread_mutex_unlock(&pRing->ConsumerMutex);
+        return IOC_RESULT_BUSY;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+// Walk whole records from head into pDatVecs with ConsumerMutex held, copying them or pointing at them if IsPeek.
+static IOC_Result_T __IOC_DatRing_readvLocked(_IOC_DatRing_pT pRing, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                              ULONG_T *pReadNum, bool IsPeek) {
+    ULONG_T ReadPos = atomic_load_explicit(&pRing->ReadPos, memory_order_relaxed);
+    ULONG_T WritePos = atomic_load_explicit(&pRing->WritePos, memory_order_acquire);
+    ULONG_T HeadReadOffset = pRing->HeadReadOffset;
+    ULONG_T ReadNum = 0, ReadBytes = 0;
+
+    if (ReadPos == WritePos) {
+        *pReadNum = 0;
+        return IOC_RESULT_NO_DATA;  // Another consumer of the same link took it
+    }
+
+    while (ReadPos != WritePos && ReadNum < DatVecNum) {
+        _IOC_DatRingRecHdr_T *pRecHdr = __IOC_DatRing_getRecHdr(pRing, ReadPos);
+        char *pRecData = (char *)(pRecHdr + 1) + HeadReadOffset;
+        ULONG_T LeftSize = pRecHdr->DataLen - HeadReadOffset;
+
+        if (IsPeek) {
+            pDatVecs[ReadNum].pData = pRecData;
+        } else if (LeftSize <= pDatVecs[ReadNum].DataSize) {
+            memcpy(pDatVecs[ReadNum].pData, pRecData, LeftSize);
+        } else if (ReadNum == 0) {
+            pDatVecs[0].DataLen = LeftSize;
+            *pReadNum = 0;
+            return IOC_RESULT_BUFFER_TOO_SMALL;
+        } else {
+            break;  // Keep it for next time
+        }
+
+        pDatVecs[ReadNum].DataLen = LeftSize;
+        ReadNum++;
+        ReadBytes += pRecHdr->DataLen;
+        ReadPos += __IOC_DatRing_getRecSize(pRecHdr->DataLen);
+        HeadReadOffset = 0;
+    }
+
+    if (!IsPeek) {
+        pRing->HeadReadOffset = 0;
+        atomic_store_explicit(&pRing->ReadPos, ReadPos, memory_order_release);
+        __IOC_DatRing_addReadTotal(pRing, ReadNum, ReadBytes);
+    }
+
+    *pReadNum = ReadNum;
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T _IOC_DatRing_readv(_IOC_DatRing_pT pRing, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pReadNum,
+                                long long TimeoutUS) {
+    *pReadNum = 0;
+    if (DatVecNum == 0) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    while (1) {
+        IOC_Result_T Result = __IOC_DatRing_waitDataLocked(pRing, TimeoutUS);
+        if (Result != IOC_RESULT_SUCCESS) {
+            return Result;
+        }
+
+        Result = __IOC_DatRing_readvLocked(pRing, pDatVecs, DatVecNum, pReadNum, false);
+        pthread_mutex_unlock(&pRing->ConsumerMutex);
+
+        if (Result != IOC_RESULT_NO_DATA) {
+            return Result;
+        }
+    }
+}
+
+IOC_Result_T _IOC_DatRing_peekv(_IOC_DatRing_pT pRing, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum, ULONG_T *pPeekNum,
+                                long long TimeoutUS) {
+    *pPeekNum = 0;
+    if (DatVecNum == 0) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    while (1) {
+        IOC_Result_T Result = __IOC_DatRing_waitDataLocked(pRing, TimeoutUS);
+        if (Result != IOC_RESULT_SUCCESS) {
+            return Result;
+        }
+
+        Result = __IOC_DatRing_readvLocked(pRing, pDatVecs, DatVecNum, pPeekNum, true);
+        if (Result == IOC_RESULT_SUCCESS) {
+            // The peeked records stay in the ring because ReadPos doesn't move, and no consumer reads them
+            //  while PeekNum is not 0, so the peeker holds no lock till _IOC_DatRing_consume.
+            pRing->PeekerThread = pthread_self();
+            atomic_store_explicit(&pRing->PeekNum, *pPeekNum, memory_order_relaxed);
+        }
+        pthread_mutex_unlock(&pRing->ConsumerMutex);
+
+        if (Result != IOC_RESULT_NO_DATA) {
+            return Result;
+        }
+    }
+}
+
+IOC_Result_T _IOC_DatRing_consume(_IOC_DatRing_pT pRing, ULONG_T ConsumeNum) {
+    pthread_mutex_lock(&pRing->ConsumerMutex);
+
+    // Only the peeker may end its peek, another thread MUST NOT move ReadPos under it
+    ULONG_T PeekNum = atomic_load_explicit(&pRing->PeekNum, memory_order_relaxed);
+    if (PeekNum == 0 || !pthread_equal(pRing->PeekerThread, pthread_self()) || ConsumeNum > PeekNum) {
+        pthread_mutex_unlock(&pRing->ConsumerMutex);
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
+    if (ConsumeNum > 0) {
+        ULONG_T ReadPos = atomic_load_explicit(&pRing->ReadPos, memory_order_relaxed);
+        ULONG_T ReadBytes = 0;
+        for (ULONG_T i = 0; i < ConsumeNum; i++) {
+            ULONG_T DataLen = __IOC_DatRing_getRecHdr(pRing, ReadPos)->DataLen;
+            ReadBytes += DataLen;
+            ReadPos += __IOC_DatRing_getRecSize(DataLen);
+        }
+
+        pRing->HeadReadOffset = 0;
+        atomic_store_explicit(&pRing->ReadPos, ReadPos, memory_order_release);
+        __IOC_DatRing_addReadTotal(pRing, ConsumeNum, ReadBytes);
+    }
+
+    atomic_store_explicit(&pRing->PeekNum, 0, memory_order_relaxed);
+    pthread_mutex_unlock(&pRing->ConsumerMutex);
+    return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_DatRing_fitWindow(_IOC_DatRing_pT pRing, ULONG_T *pMaxDatNum, ULONG_T *pMaxDatBytes) {
+    // Each record costs its header and less than _IOC_DAT_RING_REC_ALIGN of padding besides its data,
+    //  and at least three quarters of the ring is left for data.
+    ULONG_T MaxRecOverhead = sizeof(_IOC_DatRingRecHdr_T) + _IOC_DAT_RING_REC_ALIGN;
+    ULONG_T MaxDatNum = pRing->Capacity / 4 / MaxRecOverhead;
+    if (0 == *pMaxDatNum || *pMaxDatNum > MaxDatNum) {
+        *pMaxDatNum = MaxDatNum;
+    }
+
+    ULONG_T MaxDatBytes = pRing->Capacity - *pMaxDatNum * MaxRecOverhead;
+    if (0 == *pMaxDatBytes || *pMaxDatBytes > MaxDatBytes) {
+        *pMaxDatBytes = MaxDatBytes;
+    }
+}
@@ -0,0 +1,177 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "_IOC_Logging.h"
+#include "_IOC_Types.h"
+
+#ifndef __IOC_DATRING_H__
+#define __IOC_DATRING_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Default capacity of DatRing when IOC_DatUsageArgs_T::PollingBufSize is 0
+#define _IOC_DAT_RING_DEFAULT_CAPACITY (64 * 1024)
+#define _IOC_DAT_RING_MAX_CAPACITY (1UL << 30)
+#define _IOC_DAT_RING_CACHE_LINE_SIZE 64
+
+/**
+ * @brief Each data chunk in DatRing is a record of this header followed by its data, padded to 8 bytes,
+ *    so DatRing keeps the boundary of each chunk even if it's read partially.
+ */
+typedef struct {
+    uint32_t DataLen;
+    uint32_t Reserved;
+} _IOC_DatRingRecHdr_T;
+
+/**
+ * @brief DatRing is a byte ring of data chunks between one producer side and one consumer side,
+ *    used as DAT polling buffer:
+ *    Producer(sendDAT or TCP's reactor) and consumer(recvDAT) hand off records by WritePos and ReadPos only,
+ *      producer owns WritePos and consumer owns ReadPos, each aligned to start its own cache line,
+ *      so an object embedding the ring MUST be allocated by _IOC_DatRing_callocEmbedder instead of calloc.
+ *    The ring's memory is mapped twice back to back, so a record is ALWAYS contiguous in memory,
+ *      even if it wraps around the end of ring, and so it's written/read by ONE memcpy or recv().
+ *    Consumer parks only if the ring is empty, on futex of DataSeq in Linux or ParkCond elsewhere,
+ *      and producer wakes it only if WaiterNum is not zero, so a busy ring costs no syscall.
+ *
+ *  DatRing is NOT lock-free for its callers: a link may be sent or received by many threads,
+ *    so _IOC_DatRing_push takes ProducerMutex and read/readv/peekv/consume take ConsumerMutex,
+ *    a side never takes the other side's mutex, and it's uncontended with one producer and one consumer.
+ *    Only the ring's only producer such as TCP's reactor takes no lock,
+ *      by _IOC_DatRing_pushNotLocked or _IOC_DatRing_reserve/commit, never mixed with _IOC_DatRing_push.
+ */
+typedef struct {
+    _Alignas(_IOC_DAT_RING_CACHE_LINE_SIZE) atomic_ulong WritePos;  // Monotonic, only increased by producer
+
+    _Alignas(_IOC_DAT_RING_CACHE_LINE_SIZE) atomic_ulong ReadPos;  // Monotonic, only increased by consumer
+    ULONG_T HeadReadOffset;  // Bytes of the head record's data already read by a partial read, consumer only
+    atomic_ulong PeekNum;    // Records peeked by _IOC_DatRing_peekv and not consumed yet, 0 means no peek pending
+    atomic_ulong ReadDatNum;    // Monotonic, whole records released to producer by consumer
+    atomic_ulong ReadDatBytes;  // Monotonic, data bytes of ReadDatNum records
+
+    _Alignas(_IOC_DAT_RING_CACHE_LINE_SIZE) atomic_uint DataSeq;    // Increased by producer to wake parked consumers
+    atomic_uint WaiterNum;  // Consumers going to park or parked
+    atomic_bool IsClosed;
+
+    char *pBase;       // Mapped twice, [pBase, pBase + Capacity) and [pBase + Capacity, pBase + 2 * Capacity)
+    ULONG_T Capacity;  // Power of two and page size multiple
+
+    pthread_mutex_t ProducerMutex;
+    pthread_mutex_t ConsumerMutex;
+    pthread_t PeekerThread;  // Who called _IOC_DatRing_peekv, valid while PeekNum is not 0
+#if !defined(__linux__)
+    pthread_mutex_t ParkMutex;
+    pthread_cond_t ParkCond;
+#endif
+} _IOC_DatRing_T, *_IOC_DatRing_pT;
+
+/**
+ * @brief Map the ring of Capacity bytes(0 means _IOC_DAT_RING_DEFAULT_CAPACITY),
+ *    which is rounded up to a power of two page size multiple.
+ *
+ * @return IOC_RESULT_SUCCESS, IOC_RESULT_INVALID_PARAM if Capacity > _IOC_DAT_RING_MAX_CAPACITY,
+ *    or IOC_RESULT_POSIX_ENOMEM if mapping fails.
+ */
+IOC_Result_T _IOC_DatRing_initOne(_IOC_DatRing_pT pRing, ULONG_T Capacity);
+// Allocate zeroed Size bytes of an object embedding _IOC_DatRing_T, aligned to a cache line as the ring needs,
+//  which calloc doesn't promise. Free it by free(). Return NULL if out of memory.
+void *_IOC_DatRing_callocEmbedder(size_t Size);
+
+// Unmap the ring, NO producer or consumer may use it anymore. Safe to call on a zeroed but not inited ring.
+void _IOC_DatRing_deinitOne(_IOC_DatRing_pT pRing);
+// Wake all parked consumers and make them return IOC_RESULT_LINK_BROKEN once the ring is empty.
+void _IOC_DatRing_close(_IOC_DatRing_pT pRing);
+
+// Return: IOC_RESULT_SUCCESS, or IOC_RESULT_BUFFER_FULL if no space for the record of DataSize now.
+IOC_Result_T _IOC_DatRing_push(_IOC_DatRing_pT pRing, const void *pData, ULONG_T DataSize);
+// Same as _IOC_DatRing_push without ProducerMutex, the caller MUST be the ring's only producer.
+IOC_Result_T _IOC_DatRing_pushNotLocked(_IOC_DatRing_pT pRing, const void *pData, ULONG_T DataSize);
+
+/**
+ * @brief Reserve contiguous space for a record of DataSize, for producer to fill it in place such as by recv(),
+ *    then _IOC_DatRing_commit it, maybe from another thread such as after more data comes.
+ *    Nothing is locked between them, so the ring MUST have no other producer until the commit,
+ *    neither another reservation nor _IOC_DatRing_push.
+ *
+ * @return IOC_RESULT_SUCCESS with *ppSpace, or IOC_RESULT_BUFFER_FULL if no space for the record of DataSize now.
+ */
+IOC_Result_T _IOC_DatRing_reserve(_IOC_DatRing_pT pRing, ULONG_T DataSize, /*ARG_OUT*/ void **ppSpace);
+// Publish the reserved record with DataSize(<= reserved), or give it up if DataSize is 0.
+void _IOC_DatRing_commit(_IOC_DatRing_pT pRing, ULONG_T DataSize);
+
+/**
+ * @brief Wait until the ring is not empty.
+ *
+ * @param TimeoutUS: <0 means wait forever, 0 means don't wait.
+ * @return IOC_RESULT_SUCCESS, IOC_RESULT_TIMEOUT, or IOC_RESULT_LINK_BROKEN if closed and empty.
+ */
+IOC_Result_T _IOC_DatRing_waitData(_IOC_DatRing_pT pRing, long long TimeoutUS);
+
+/**
+ * @brief Read up to BufSize bytes in chunk order, a chunk larger than the rest of pBuf is read partially,
+ *    and its remaining bytes are read first next time.
+ *
+ * @param TimeoutUS: same as _IOC_DatRing_waitData.
+ * @return IOC_RESULT_SUCCESS with *pReadSize > 0, IOC_RESULT_NO_DATA if empty and TimeoutUS is 0,
+ *    IOC_RESULT_BUSY if a peek is pending, IOC_RESULT_TIMEOUT, or IOC_RESULT_LINK_BROKEN.
+ */
+IOC_Result_T _IOC_DatRing_read(_IOC_DatRing_pT pRing, void *pBuf, ULONG_T BufSize, /*ARG_OUT*/ ULONG_T *pReadSize,
+                               long long TimeoutUS);
+
+/**
+ * @brief Copy whole chunks in order, one into each pDatVecs[i].pData of DataSize with its length in DataLen,
+ *    until DatVecNum chunks are read, the ring is empty, or the next chunk is larger than its DatVec.
+ *    A chunk partially read by _IOC_DatRing_read counts as its remaining bytes.
+ *
+ * @param TimeoutUS: same as _IOC_DatRing_waitData, only for the first chunk.
+ * @return IOC_RESULT_SUCCESS with *pReadNum > 0, IOC_RESULT_BUFFER_TOO_SMALL with the head chunk's length
+ *    in pDatVecs[0].DataLen and it's kept in the ring, or the same errors as _IOC_DatRing_read.
+ */
+IOC_Result_T _IOC_DatRing_readv(_IOC_DatRing_pT pRing, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                /*ARG_OUT*/ ULONG_T *pReadNum, long long TimeoutUS);
+
+/**
+ * @brief Point each pDatVecs[i].pData into the ring at a chunk without copying, with its length in DataLen,
+ *    then the same thread MUST _IOC_DatRing_consume them. No lock is held between them,
+ *    but the peek is pending till then, so any read/readv/peekv returns IOC_RESULT_BUSY meanwhile,
+ *    and _IOC_DatRing_deinitOne drops it.
+ *
+ * @return IOC_RESULT_SUCCESS with *pPeekNum > 0, or the same errors as _IOC_DatRing_read.
+ */
+IOC_Result_T _IOC_DatRing_peekv(_IOC_DatRing_pT pRing, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                /*ARG_OUT*/ ULONG_T *pPeekNum, long long TimeoutUS);
+
+/**
+ * @brief Release the first ConsumeNum peeked chunks' space to producer and end the peek,
+ *    the other peeked chunks are kept for next time.
+ *
+ * @return IOC_RESULT_SUCCESS, or IOC_RESULT_INVALID_PARAM if not peeking, peeked by another thread,
+ *    or ConsumeNum > peeked chunks, which keeps peeking.
+ */
+IOC_Result_T _IOC_DatRing_consume(_IOC_DatRing_pT pRing, ULONG_T ConsumeNum);
+
+// Shrink the credit window of *pMaxDatNum chunks and *pMaxDatBytes bytes, so its chunks ALWAYS fit in the ring.
+void _IOC_DatRing_fitWindow(_IOC_DatRing_pT pRing, /*ARG_INOUT*/ ULONG_T *pMaxDatNum,
+                            /*ARG_INOUT*/ ULONG_T *pMaxDatBytes);
+
+// Get the monotonic number and data bytes of whole records consumed so far, such as to return their credits.
+static inline void _IOC_DatRing_getReadTotal(_IOC_DatRing_pT pRing, /*ARG_OUT*/ ULONG_T *pDatNum,
+                                             /*ARG_OUT*/ ULONG_T *pDatBytes) {
+    *pDatNum = atomic_load_explicit(&pRing->ReadDatNum, memory_order_acquire);
+    *pDatBytes = atomic_load_explicit(&pRing->ReadDatBytes, memory_order_relaxed);
+}
+
+// Whether the ring has no record now, a hint for consumer only.
+static inline bool _IOC_DatRing_isEmpty(_IOC_DatRing_pT pRing) {
+    return atomic_load_explicit(&pRing->WritePos, memory_order_acquire) ==
+           atomic_load_explicit(&pRing->ReadPos, memory_order_relaxed);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __IOC_DATRING_H__
@@ -1,102 +1,435 @@
 #include "_IOC_EvtDescQueue.h"
 
-void _IOC_EvtDescQueue_initOne(_IOC_EvtDescQueue_pT pEvtDescQueue) {
-  pthread_mutex_init(&pEvtDescQueue->Mutex, NULL);
-  pEvtDescQueue->QueuedEvtNum = 0;
-  pEvtDescQueue->ProcedEvtNum = 0;
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief EvtDescQueue is a bounded MPSC ring(Vyukov style), each slot has its own sequence number.
+ *  - Producer: reserve position by CAS on QueuedEvtNum, copy EvtDesc into slot, then publish slot's Seq.
+ *  - Consumer: reserve position by CAS on ProcedEvtNum, copy EvtDesc out of slot, then free slot's Seq.
+ *  Producers never wait for each other except retrying CAS, and never wait for the consumer unless full.
+ */
 
-  // clear all EvtDesc in QueuedEvtDescs
-  memset(pEvtDescQueue->QueuedEvtDescs, 0, sizeof(pEvtDescQueue->QueuedEvtDescs));
+// Spins with a CPU pause before yielding, while a producer waits for the consumer to free its slot.
+#define _IOC_EVTDESC_QUEUE_SPIN_NUM 32
+
+static inline void __IOC_EvtDescQueue_relaxCPU(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+static ULONG_T __IOC_EvtDescQueue_roundUpPowerOfTwo(ULONG_T Capacity) {
+  ULONG_T PowerOfTwo = 1;
+  while (PowerOfTwo < Capacity) {
+    PowerOfTwo <<= 1;
+  }
+  return PowerOfTwo;
+}
+
+IOC_Result_T _IOC_EvtDescQueue_initOneWithCapacity(_IOC_EvtDescQueue_pT pEvtDescQueue, ULONG_T Capacity) {
+  if (Capacity == 0) {
+    return IOC_RESULT_INVALID_PARAM;
+  }
+
+  Capacity = __IOC_EvtDescQueue_roundUpPowerOfTwo(Capacity);
+
+  _IOC_EvtDescQueueSlot_pT pSlots = (_IOC_EvtDescQueueSlot_pT)calloc(Capacity, sizeof(_IOC_EvtDescQueueSlot_T));
+  if (NULL == pSlots) {
+    _IOC_LogError("Failed to alloc EvtDescQueue with Capacity=%lu", Capacity);
+    return IOC_RESULT_POSIX_ENOMEM;
+  }
+
+  for (ULONG_T Pos = 0; Pos < Capacity; Pos++) {
+    atomic_init(&pSlots[Pos].Seq, Pos);
+  }
+
+  pEvtDescQueue->Capacity     = Capacity;
+  pEvtDescQueue->CapacityMask = Capacity - 1;
+  pEvtDescQueue->pSlots       = pSlots;
+  atomic_init(&pEvtDescQueue->QueuedEvtNum, 0);
+  atomic_init(&pEvtDescQueue->ProcedEvtNum, 0);
+
+  pthread_mutex_init(&pEvtDescQueue->ConflatingMutex, NULL);
+  atomic_init(&pEvtDescQueue->ConflatingEntryNum, 0);
+  pEvtDescQueue->pConflatingEntries  = NULL;
+  pEvtDescQueue->ConflatingEntryMask = 0;
+  pEvtDescQueue->pConflatingMarkers  = NULL;
+
+  return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_EvtDescQueue_initOne(_IOC_EvtDescQueue_pT pEvtDescQueue) {
+  IOC_Result_T Result = _IOC_EvtDescQueue_initOneWithCapacity(pEvtDescQueue, _CONLES_EVENT_MAX_QUEUING_EVTDESC);
+  _IOC_LogAssert(IOC_RESULT_SUCCESS == Result);
 }
 
 void _IOC_EvtDescQueue_deinitOne(_IOC_EvtDescQueue_pT pEvtDescQueue) {
   // deinit all checkable members only
 
   // check conditions which matching destoriability
-  _IOC_LogAssert(pEvtDescQueue->QueuedEvtNum == pEvtDescQueue->ProcedEvtNum);
+  _IOC_LogAssert(atomic_load(&pEvtDescQueue->QueuedEvtNum) == atomic_load(&pEvtDescQueue->ProcedEvtNum));
+
+  free(pEvtDescQueue->pSlots);
+  pEvtDescQueue->pSlots   = NULL;
+  pEvtDescQueue->Capacity = 0;
 
-  int PosixResult = pthread_mutex_destroy(&pEvtDescQueue->Mutex);
-  if (PosixResult != 0) {
-    _IOC_LogAssert(PosixResult == 0);
+  free(pEvtDescQueue->pConflatingEntries);
+  free(pEvtDescQueue->pConflatingMarkers);
+  pEvtDescQueue->pConflatingEntries = NULL;
+  pEvtDescQueue->pConflatingMarkers = NULL;
+  pthread_mutex_destroy(&pEvtDescQueue->ConflatingMutex);
+}
+
+void *_IOC_EvtDescQueue_callocEmbedder(size_t Size) {
+  void *pEmbedder = NULL;
+  if (posix_memalign(&pEmbedder, _IOC_EVTDESC_QUEUE_CACHE_LINE_SIZE, Size) != 0) {
+    return NULL;
   }
+  memset(pEmbedder, 0, Size);
+  return pEmbedder;
 }
 
+IOC_Result_T _IOC_EvtDescQueue_newOneWithCapacity(ULONG_T Capacity, _IOC_EvtDescQueue_pT *ppEvtDescQueue) {
+  _IOC_EvtDescQueue_pT pEvtDescQueue = _IOC_EvtDescQueue_callocEmbedder(sizeof(_IOC_EvtDescQueue_T));
+  if (NULL == pEvtDescQueue) {
+    return IOC_RESULT_POSIX_ENOMEM;
+  }
+
+  IOC_Result_T Result = _IOC_EvtDescQueue_initOneWithCapacity(pEvtDescQueue, Capacity);
+  if (Result != IOC_RESULT_SUCCESS) {
+    free(pEvtDescQueue);
+    return Result;
+  }
+
+  *ppEvtDescQueue = pEvtDescQueue;
+  return IOC_RESULT_SUCCESS;
+}
+
+void _IOC_EvtDescQueue_deleteOne(_IOC_EvtDescQueue_pT pEvtDescQueue) {
+  _IOC_EvtDescQueue_deinitOne(pEvtDescQueue);
+  free(pEvtDescQueue);
+}
+
+ULONG_T _IOC_EvtDescQueue_getCapacity(_IOC_EvtDescQueue_pT pEvtDescQueue) { return pEvtDescQueue->Capacity; }
+
 IOC_BoolResult_T _IOC_EvtDescQueue_isEmpty(_IOC_EvtDescQueue_pT pEvtDescQueue) {
-  pthread_mutex_lock(&pEvtDescQueue->Mutex);
-  IOC_BoolResult_T Result =
-      (pEvtDescQueue->QueuedEvtNum == pEvtDescQueue->ProcedEvtNum) ? IOC_RESULT_YES : IOC_RESULT_NO;
-  pthread_mutex_unlock(&pEvtDescQueue->Mutex);
-  return Result;
+  ULONG_T ProcedEvtNum = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_acquire);
+  ULONG_T QueuedEvtNum = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_acquire);
+  return (QueuedEvtNum == ProcedEvtNum) ? IOC_RESULT_YES : IOC_RESULT_NO;
 }
 
-IOC_Result_T _IOC_EvtDescQueue_enqueueElementLast(_IOC_EvtDescQueue_pT pEvtDescQueue,
-                                                  IOC_EvtDesc_pT pEvtDesc) {
-  pthread_mutex_lock(&pEvtDescQueue->Mutex);
+ULONG_T _IOC_EvtDescQueue_getQueuedNum(_IOC_EvtDescQueue_pT pEvtDescQueue) {
+  // load ProcedEvtNum first, so QueuedEvtNum is never behind it.
+  ULONG_T ProcedEvtNum = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_acquire);
+  ULONG_T QueuedEvtNum = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_acquire);
+  ULONG_T QueuedNum    = QueuedEvtNum - ProcedEvtNum;
+  return (QueuedNum > pEvtDescQueue->Capacity) ? pEvtDescQueue->Capacity : QueuedNum;
+}
 
-  ULONG_T QueuedEvtNum  = pEvtDescQueue->QueuedEvtNum;
-  ULONG_T ProcedEvtNum  = pEvtDescQueue->ProcedEvtNum;
-  ULONG_T QueuingEvtNum = QueuedEvtNum - ProcedEvtNum;
+/**
+ * @brief Conflating entries are an open addressing hash table of 2*Capacity entries indexed by EvtID,
+ *    so finding the entry of an EvtID probes a few entries from its hash instead of scanning all,
+ *    and the table is never more than half full because entries are never more than slots.
+ *  An entry is freed by shifting its probe successors back into the hole, so no tombstone is left.
+ */
+static ULONG_T __IOC_EvtDescQueue_hashEvtID(_IOC_EvtDescQueue_pT pEvtDescQueue, IOC_EvtID_T EvtID) {
+  // Fibonacci hashing spreads EvtClass/EvtName bits of EvtID into the low bits masked here.
+  return (ULONG_T)((EvtID * 0x9E3779B97F4A7C15ULL) >> 32) & pEvtDescQueue->ConflatingEntryMask;
+}
 
-  // sanity check QueuingEvtNum
-  _IOC_LogAssert(QueuingEvtNum >= 0);
-  _IOC_LogAssert(QueuingEvtNum <= _CONLES_EVENT_MAX_QUEUING_EVTDESC);
+static _IOC_EvtDescQueueConflatingEntry_pT __IOC_EvtDescQueue_findConflatingEntry(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                                                  IOC_EvtID_T EvtID) {
+  ULONG_T Pos = __IOC_EvtDescQueue_hashEvtID(pEvtDescQueue, EvtID);
+  while (pEvtDescQueue->pConflatingEntries[Pos].IsUsed) {
+    if (pEvtDescQueue->pConflatingEntries[Pos].EvtID == EvtID) {
+      return &pEvtDescQueue->pConflatingEntries[Pos];
+    }
+    Pos = (Pos + 1) & pEvtDescQueue->ConflatingEntryMask;
+  }
+  return NULL;
+}
 
-  if (QueuingEvtNum == _CONLES_EVENT_MAX_QUEUING_EVTDESC) {
-    pthread_mutex_unlock(&pEvtDescQueue->Mutex);
-    return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+// Take a free entry for EvtID which has no entry yet.
+static _IOC_EvtDescQueueConflatingEntry_pT __IOC_EvtDescQueue_takeConflatingEntry(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                                                  IOC_EvtID_T EvtID) {
+  // the table is never full, so a free entry is always there.
+  ULONG_T Pos = __IOC_EvtDescQueue_hashEvtID(pEvtDescQueue, EvtID);
+  while (pEvtDescQueue->pConflatingEntries[Pos].IsUsed) {
+    Pos = (Pos + 1) & pEvtDescQueue->ConflatingEntryMask;
   }
 
-  //---------------------------------------------------------------------------
-  // sanity check
-  _IOC_LogAssert(pEvtDescQueue->QueuedEvtNum >= pEvtDescQueue->ProcedEvtNum);
+  _IOC_EvtDescQueueConflatingEntry_pT pEntry = &pEvtDescQueue->pConflatingEntries[Pos];
+  pEntry->IsUsed = true;
+  pEntry->EvtID  = EvtID;
+  atomic_fetch_add(&pEvtDescQueue->ConflatingEntryNum, 1);
+  return pEntry;
+}
+
+// Free pEntry, then move each following entry back into the hole if its hash position isn't after the hole.
+static void __IOC_EvtDescQueue_freeConflatingEntry(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                   _IOC_EvtDescQueueConflatingEntry_pT pEntry) {
+  ULONG_T Mask = pEvtDescQueue->ConflatingEntryMask;
+  ULONG_T Hole = (ULONG_T)(pEntry - pEvtDescQueue->pConflatingEntries);
 
-  ULONG_T NextQueuingPos         = QueuedEvtNum % _CONLES_EVENT_MAX_QUEUING_EVTDESC;
-  IOC_EvtDesc_pT pNextQueuingBuf = &pEvtDescQueue->QueuedEvtDescs[NextQueuingPos];
+  for (ULONG_T Pos = (Hole + 1) & Mask; pEvtDescQueue->pConflatingEntries[Pos].IsUsed; Pos = (Pos + 1) & Mask) {
+    ULONG_T HashPos = __IOC_EvtDescQueue_hashEvtID(pEvtDescQueue, pEvtDescQueue->pConflatingEntries[Pos].EvtID);
+    if (((Pos - HashPos) & Mask) >= ((Pos - Hole) & Mask)) {
+      memcpy(&pEvtDescQueue->pConflatingEntries[Hole], &pEvtDescQueue->pConflatingEntries[Pos],
+             sizeof(_IOC_EvtDescQueueConflatingEntry_T));
+      Hole = Pos;
+    }
+  }
+
+  pEvtDescQueue->pConflatingEntries[Hole].IsUsed = false;
+  atomic_fetch_sub(&pEvtDescQueue->ConflatingEntryNum, 1);
+}
 
-  memcpy(pNextQueuingBuf, pEvtDesc, sizeof(IOC_EvtDesc_T));
-  pEvtDescQueue->QueuedEvtNum++;
-  QueuedEvtNum = pEvtDescQueue->QueuedEvtNum;
-  pthread_mutex_unlock(&pEvtDescQueue->Mutex);
+// Replace each dequeued conflating marker by its LatestEvtDesc, and free its entry.
+static void __IOC_EvtDescQueue_resolveConflatingMarkers(_IOC_EvtDescQueue_pT pEvtDescQueue, IOC_EvtDesc_pT pEvtDescs,
+                                                        ULONG_T EvtDescNum) {
+  // producer adds ConflatingEntryNum BEFORE publishing marker's slot, so it's never missed here.
+  if (atomic_load(&pEvtDescQueue->ConflatingEntryNum) == 0) {
+    return;
+  }
 
-  //_IOC_LogDebug("Enqueued EvtDesc(SeqID=%lu, EvtID(%lu,%lu)) to EvtDescQueue(Pos=%lu,Proced=%lu <=
-  //Queued=%lu)",
+  pthread_mutex_lock(&pEvtDescQueue->ConflatingMutex);
+  for (ULONG_T i = 0; i < EvtDescNum; i++) {
+    _IOC_EvtDescQueueConflatingEntry_pT pEntry =
+        __IOC_EvtDescQueue_findConflatingEntry(pEvtDescQueue, pEvtDescs[i].EvtID);
+    if (pEntry != NULL && pEntry->MarkerSeqID == pEvtDescs[i].MsgDesc.SeqID) {
+      memcpy(&pEvtDescs[i], &pEntry->LatestEvtDesc, sizeof(IOC_EvtDesc_T));
+      __IOC_EvtDescQueue_freeConflatingEntry(pEvtDescQueue, pEntry);
+    }
+  }
+  pthread_mutex_unlock(&pEvtDescQueue->ConflatingMutex);
+}
+
+IOC_Result_T _IOC_EvtDescQueue_enqueueElementLast(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                  IOC_EvtDesc_pT pEvtDesc) {
+  _IOC_EvtDescQueueSlot_pT pSlot = NULL;
+  ULONG_T QueuingPos             = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_relaxed);
+
+  for (;;) {
+    pSlot       = &pEvtDescQueue->pSlots[QueuingPos & pEvtDescQueue->CapacityMask];
+    ULONG_T Seq = atomic_load_explicit(&pSlot->Seq, memory_order_acquire);
+    long Diff   = (long)(Seq - QueuingPos);
+
+    if (Diff == 0) {
+      // slot is FREE for QueuingPos, try to reserve it
+      if (atomic_compare_exchange_weak_explicit(&pEvtDescQueue->QueuedEvtNum, &QueuingPos, QueuingPos + 1,
+                                                memory_order_relaxed, memory_order_relaxed)) {
+        break;
+      }
+      // QueuingPos is reloaded by CAS failure, retry
+    } else if (Diff < 0) {
+      // slot still holds the EvtDesc of last lap, which means the queue is full
+      return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+    } else {
+      // other producer has reserved QueuingPos, reload and retry
+      QueuingPos = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_relaxed);
+    }
+  }
+
+  memcpy(&pSlot->EvtDesc, pEvtDesc, sizeof(IOC_EvtDesc_T));
+  atomic_store_explicit(&pSlot->Seq, QueuingPos + 1, memory_order_release);
+
+  //_IOC_LogDebug("Enqueued EvtDesc(SeqID=%lu, EvtID(%lu,%lu)) to EvtDescQueue(Pos=%lu)",
   //              pEvtDesc->MsgDesc.SeqID, IOC_getEvtClassID(pEvtDesc->EvtID),
-  //              IOC_getEvtNameID(pEvtDesc->EvtID), NextQueuingPos, ProcedEvtNum, QueuedEvtNum);
+  //              IOC_getEvtNameID(pEvtDesc->EvtID), QueuingPos);
 
   return IOC_RESULT_SUCCESS;
 }
 
 IOC_Result_T _IOC_EvtDescQueue_dequeueElementFirst(_IOC_EvtDescQueue_pT pEvtDescQueue,
                                                    IOC_EvtDesc_pT pEvtDesc) {
-  pthread_mutex_lock(&pEvtDescQueue->Mutex);
+  _IOC_EvtDescQueueSlot_pT pSlot = NULL;
+  ULONG_T ProcingPos             = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_relaxed);
+
+  for (;;) {
+    pSlot       = &pEvtDescQueue->pSlots[ProcingPos & pEvtDescQueue->CapacityMask];
+    ULONG_T Seq = atomic_load_explicit(&pSlot->Seq, memory_order_acquire);
+    long Diff   = (long)(Seq - (ProcingPos + 1));
+
+    if (Diff == 0) {
+      // slot is FILLED for ProcingPos, try to reserve it
+      if (atomic_compare_exchange_weak_explicit(&pEvtDescQueue->ProcedEvtNum, &ProcingPos, ProcingPos + 1,
+                                                memory_order_relaxed, memory_order_relaxed)) {
+        break;
+      }
+    } else if (Diff < 0) {
+      // slot is not published yet, which means the queue is empty
+      return IOC_RESULT_EVTDESC_QUEUE_EMPTY;
+    } else {
+      ProcingPos = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_relaxed);
+    }
+  }
+
+  memcpy(pEvtDesc, &pSlot->EvtDesc, sizeof(IOC_EvtDesc_T));
+  atomic_store_explicit(&pSlot->Seq, ProcingPos + pEvtDescQueue->Capacity, memory_order_release);
+  __IOC_EvtDescQueue_resolveConflatingMarkers(pEvtDescQueue, pEvtDesc, 1);
 
-  ULONG_T QueuedEvtNum  = pEvtDescQueue->QueuedEvtNum;
-  ULONG_T ProcedEvtNum  = pEvtDescQueue->ProcedEvtNum;
-  ULONG_T QueuingEvtNum = QueuedEvtNum - ProcedEvtNum;
+  //_IOC_LogDebug("Dequeued EvtDesc(SeqID=%lu, EvtID(%lu,%lu)) from EvtDescQueue(Pos=%lu)",
+  //              pEvtDesc->MsgDesc.SeqID, IOC_getEvtClassID(pEvtDesc->EvtID),
+  //              IOC_getEvtNameID(pEvtDesc->EvtID), ProcingPos);
 
-  // sanity check QueuingEvtNum
-  _IOC_LogAssert(QueuingEvtNum >= 0);
-  _IOC_LogAssert(QueuingEvtNum <= _CONLES_EVENT_MAX_QUEUING_EVTDESC);
+  return IOC_RESULT_SUCCESS;
+}
 
-  if (QueuingEvtNum == 0) {
-    pthread_mutex_unlock(&pEvtDescQueue->Mutex);
-    return IOC_RESULT_EVTDESC_QUEUE_EMPTY;
+IOC_Result_T _IOC_EvtDescQueue_enqueueElementsLast(_IOC_EvtDescQueue_pT pEvtDescQueue, IOC_EvtDesc_pT pEvtDescs,
+                                                   ULONG_T EvtDescNum) {
+  if (EvtDescNum == 1) {
+    return _IOC_EvtDescQueue_enqueueElementLast(pEvtDescQueue, pEvtDescs);
+  } else if (EvtDescNum > pEvtDescQueue->Capacity) {
+    return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
   }
 
-  //---------------------------------------------------------------------------
-  ULONG_T NextProcingPos         = ProcedEvtNum % _CONLES_EVENT_MAX_QUEUING_EVTDESC;
-  IOC_EvtDesc_pT pNextProcingBuf = &pEvtDescQueue->QueuedEvtDescs[NextProcingPos];
+  ULONG_T QueuingPos = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_relaxed);
 
-  memcpy(pEvtDesc, pNextProcingBuf, sizeof(IOC_EvtDesc_T));
-  pEvtDescQueue->ProcedEvtNum++;
-  ProcedEvtNum = pEvtDescQueue->ProcedEvtNum;
+  for (;;) {
+    // reserve EvtDescNum positions at once if consumer has freed enough slots
+    ULONG_T ProcedEvtNum = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_acquire);
+    if ((long)(QueuingPos + EvtDescNum - ProcedEvtNum) > (long)pEvtDescQueue->Capacity) {
+      ULONG_T LatestQueuingPos = atomic_load_explicit(&pEvtDescQueue->QueuedEvtNum, memory_order_relaxed);
+      if (LatestQueuingPos == QueuingPos) {
+        return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+      }
+      QueuingPos = LatestQueuingPos;  // stale QueuingPos, retry
+      continue;
+    }
 
-  pthread_mutex_unlock(&pEvtDescQueue->Mutex);
+    if (atomic_compare_exchange_weak_explicit(&pEvtDescQueue->QueuedEvtNum, &QueuingPos, QueuingPos + EvtDescNum,
+                                              memory_order_relaxed, memory_order_relaxed)) {
+      break;
+    }
+  }
 
-  //_IOC_LogDebug("Dequeued EvtDesc(SeqID=%lu, EvtID(%lu,%lu)) from EvtDescQueue(Pos=%lu,Proced=%lu
-  //<= Queued=%lu)",
-  //              pEvtDesc->MsgDesc.SeqID, IOC_getEvtClassID(pEvtDesc->EvtID),
-  //              IOC_getEvtNameID(pEvtDesc->EvtID), NextProcingPos, ProcedEvtNum, QueuedEvtNum);
+  for (ULONG_T i = 0; i < EvtDescNum; i++) {
+    ULONG_T Pos                    = QueuingPos + i;
+    _IOC_EvtDescQueueSlot_pT pSlot = &pEvtDescQueue->pSlots[Pos & pEvtDescQueue->CapacityMask];
+
+    // consumer may have moved ProcedEvtNum but not yet freed this slot, which is a very short window,
+    //  unless it's preempted in it, then yield to let it run instead of burning this timeslice.
+    for (ULONG_T SpinNum = 0; atomic_load_explicit(&pSlot->Seq, memory_order_acquire) != Pos; SpinNum++) {
+      if (SpinNum < _IOC_EVTDESC_QUEUE_SPIN_NUM) {
+        __IOC_EvtDescQueue_relaxCPU();
+      } else {
+        sched_yield();
+      }
+    }
+
+    memcpy(&pSlot->EvtDesc, &pEvtDescs[i], sizeof(IOC_EvtDesc_T));
+    atomic_store_explicit(&pSlot->Seq, Pos + 1, memory_order_release);
+  }
+
+  return IOC_RESULT_SUCCESS;
+}
 
+IOC_Result_T _IOC_EvtDescQueue_enqueueElementsLastConflating(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                             IOC_EvtDesc_pT pEvtDescs, ULONG_T EvtDescNum,
+                                                             ULONG_T *pEnqueuedNum) {
+  *pEnqueuedNum = 0;
+  if (EvtDescNum > pEvtDescQueue->Capacity) {
+    return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+  }
+
+  pthread_mutex_lock(&pEvtDescQueue->ConflatingMutex);
+  if (NULL == pEvtDescQueue->pConflatingEntries) {
+    pEvtDescQueue->ConflatingEntryMask = 2 * pEvtDescQueue->Capacity - 1;
+    pEvtDescQueue->pConflatingEntries  = (_IOC_EvtDescQueueConflatingEntry_pT)calloc(
+        2 * pEvtDescQueue->Capacity, sizeof(_IOC_EvtDescQueueConflatingEntry_T));
+    pEvtDescQueue->pConflatingMarkers = (IOC_EvtDesc_pT)malloc(pEvtDescQueue->Capacity * sizeof(IOC_EvtDesc_T));
+    if (NULL == pEvtDescQueue->pConflatingEntries || NULL == pEvtDescQueue->pConflatingMarkers) {
+      free(pEvtDescQueue->pConflatingEntries);
+      free(pEvtDescQueue->pConflatingMarkers);
+      pEvtDescQueue->pConflatingEntries = NULL;
+      pEvtDescQueue->pConflatingMarkers = NULL;
+      pthread_mutex_unlock(&pEvtDescQueue->ConflatingMutex);
+      _IOC_LogError("Failed to alloc ConflatingEntries of EvtDescQueue with Capacity=%lu", pEvtDescQueue->Capacity);
+      return IOC_RESULT_POSIX_ENOMEM;
+    }
+  }
+
+  // 1) the first EvtDesc of each EvtID without entry becomes a marker with a new entry,
+  //    entries are counted BEFORE markers are published, RefMore: __IOC_EvtDescQueue_resolveConflatingMarkers
+  ULONG_T MarkerNum = 0;
+  for (ULONG_T i = 0; i < EvtDescNum; i++) {
+    if (__IOC_EvtDescQueue_findConflatingEntry(pEvtDescQueue, pEvtDescs[i].EvtID) != NULL) {
+      continue;
+    }
+
+    _IOC_EvtDescQueueConflatingEntry_pT pEntry =
+        __IOC_EvtDescQueue_takeConflatingEntry(pEvtDescQueue, pEvtDescs[i].EvtID);
+    pEntry->MarkerSeqID = pEvtDescs[i].MsgDesc.SeqID;
+
+    memcpy(&pEvtDescQueue->pConflatingMarkers[MarkerNum++], &pEvtDescs[i], sizeof(IOC_EvtDesc_T));
+  }
+
+  // 2) enqueue all markers at once, or rollback their new entries
+  if (MarkerNum > 0) {
+    IOC_Result_T Result =
+        _IOC_EvtDescQueue_enqueueElementsLast(pEvtDescQueue, pEvtDescQueue->pConflatingMarkers, MarkerNum);
+    if (Result != IOC_RESULT_SUCCESS) {
+      for (ULONG_T i = 0; i < MarkerNum; i++) {
+        _IOC_EvtDescQueueConflatingEntry_pT pEntry =
+            __IOC_EvtDescQueue_findConflatingEntry(pEvtDescQueue, pEvtDescQueue->pConflatingMarkers[i].EvtID);
+        __IOC_EvtDescQueue_freeConflatingEntry(pEvtDescQueue, pEntry);
+      }
+      pthread_mutex_unlock(&pEvtDescQueue->ConflatingMutex);
+      return Result;
+    }
+  }
+
+  // 3) the last EvtDesc of each EvtID is the latest value, even its marker is being dequeued now.
+  for (ULONG_T i = 0; i < EvtDescNum; i++) {
+    _IOC_EvtDescQueueConflatingEntry_pT pEntry =
+        __IOC_EvtDescQueue_findConflatingEntry(pEvtDescQueue, pEvtDescs[i].EvtID);
+    memcpy(&pEntry->LatestEvtDesc, &pEvtDescs[i], sizeof(IOC_EvtDesc_T));
+  }
+  pthread_mutex_unlock(&pEvtDescQueue->ConflatingMutex);
+
+  *pEnqueuedNum = MarkerNum;
   return IOC_RESULT_SUCCESS;
-}
\ No newline at end of file
+}
+
+ULONG_T _IOC_EvtDescQueue_dequeueElementsFirst(_IOC_EvtDescQueue_pT pEvtDescQueue, IOC_EvtDesc_pT pEvtDescs,
+                                               ULONG_T MaxEvtDescNum) {
+  ULONG_T ProcingPos = atomic_load_explicit(&pEvtDescQueue->ProcedEvtNum, memory_order_relaxed);
+  ULONG_T ReadyNum   = 0;
+
+  for (;;) {
+    // count continuous FILLED slots from ProcingPos
+    ReadyNum = 0;
+    while (ReadyNum < MaxEvtDescNum) {
+      ULONG_T Pos                    = ProcingPos + ReadyNum;
+      _IOC_EvtDescQueueSlot_pT pSlot = &pEvtDescQueue->pSlots[Pos & pEvtDescQueue->CapacityMask];
+      if (atomic_load_explicit(&pSlot->Seq, memory_order_acquire) != Pos + 1) {
+        break;
+      }
+      ReadyNum++;
+    }
+
+    if (ReadyNum == 0) {
+      return 0;
+    }
+
+    if (atomic_compare_exchange_weak_explicit(&pEvtDescQueue->ProcedEvtNum, &ProcingPos, ProcingPos + ReadyNum,
+                                              memory_order_relaxed, memory_order_relaxed)) {
+      break;
+    }
+  }
+
+  for (ULONG_T i = 0; i < ReadyNum; i++) {
+    ULONG_T Pos                    = ProcingPos + i;
+    _IOC_EvtDescQueueSlot_pT pSlot = &pEvtDescQueue->pSlots[Pos & pEvtDescQueue->CapacityMask];
+
+    memcpy(&pEvtDescs[i], &pSlot->EvtDesc, sizeof(IOC_EvtDesc_T));
+    atomic_store_explicit(&pSlot->Seq, Pos + pEvtDescQueue->Capacity, memory_order_release);
+  }
+  __IOC_EvtDescQueue_resolveConflatingMarkers(pEvtDescQueue, pEvtDescs, ReadyNum);
+
+  return ReadyNum;
+}
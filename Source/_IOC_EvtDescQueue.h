@@ -5,42 +5,112 @@
 
 #ifndef __IOC_EVTDESCQUEUE_H__
 #define __IOC_EVTDESCQUEUE_H__
+#ifndef __cplusplus
+#include <stdatomic.h>
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Default capacity of EvtDescQueue used by _IOC_EvtDescQueue_initOne
 #define _CONLES_EVENT_MAX_QUEUING_EVTDESC 64
 
+#define _IOC_EVTDESC_QUEUE_CACHE_LINE_SIZE 64
+
+typedef struct _EvtDescQueueStru _IOC_EvtDescQueue_T, *_IOC_EvtDescQueue_pT;
+
 //---------------------------------------------------------------------------------------------------------------------
+// EvtDescQueue's layout is C only, because C11 atomics are not promised to match std::atomic,
+//  C++ such as UT gets an EvtDescQueue only by _IOC_EvtDescQueue_newOneWithCapacity, and uses it by APIs below.
+#ifndef __cplusplus
+/**
+ * @brief DataType of EvtDescQueue's slot
+ *    Seq is the ring position this slot is ready for:
+ *      Seq == Pos, slot is FREE and may be filled by the producer who reserved Pos;
+ *      Seq == Pos + 1, slot is FILLED and may be consumed at Pos;
+ *      after consume, Seq = Pos + Capacity, slot is FREE for the next lap.
+ */
+typedef struct {
+  atomic_ulong Seq;
+  IOC_EvtDesc_T EvtDesc;
+} _IOC_EvtDescQueueSlot_T, *_IOC_EvtDescQueueSlot_pT;
+
+/**
+ * @brief DataType of EvtDescQueue's conflating entry, one for each EvtID conflating enqueued but not yet dequeued.
+ *    MarkerSeqID is SeqID of the EvtDesc really enqueued into slots as a marker, when it's dequeued,
+ *    it's replaced by LatestEvtDesc, which is the newest conflating EvtDesc of the same EvtID.
+ */
+typedef struct {
+  bool IsUsed;
+  IOC_EvtID_T EvtID;
+  ULONG_T MarkerSeqID;
+  IOC_EvtDesc_T LatestEvtDesc;
+} _IOC_EvtDescQueueConflatingEntry_T, *_IOC_EvtDescQueueConflatingEntry_pT;
+
 /**
  * @brief DataType of EvtDescQueue
- *    A FIFO queue to save all EvtDesc.
+ *    A lock-free bounded FIFO queue to save all EvtDesc, multiple producers enqueue and one consumer
+ *    dequeue(MPSC), such as many IOC_postEVT callers and one EvtProcThread.
+ *
+ *    QueuedEvtNum is the next position to reserve by producers,
+ *    ProcedEvtNum is the next position to consume by consumer,
+ *    both are on their own cache line to avoid false sharing between producers and consumer.
+ *
+ *    IF QueuedEvtNum == ProcedEvtNum, the queue is empty.
+ *    IF QueuedEvtNum - ProcedEvtNum == Capacity, the queue is full.
+ *
  * @note
- *    May this queue be IOC's common queue in future?
+ *    Consumer side also reserves by CAS, so concurrent dequeue(such as two IOC_pullEVT on the same
+ *    FIFO link) is still safe, while the typical single consumer never retries.
  */
-typedef struct _EvtDescQueueStru {
-  pthread_mutex_t Mutex;  // Used to protect QueuedEvtNum, ProcedEvtNum, QueuedEvtDescs
-  /**
-   * IF QueuedEvtNum == ProcedEvtNum, the queue is empty.
-   * IF QueuedEvtNum > ProcedEvtNum, the queue is not empty.
-   * IF QueuedEvtNum - ProcedEvtNum == _CONLES_EVENT_MAX_QUEUING_EVTDESC, the queue is full.
-   *
-   * WHEN postEVT new EvtDesc, DO copy&save enqueuing EvtDesc in
-   *    QueuedEvtDescs[QueuedEvtNum%_CONLES_EVENT_MAX_QUEUING_EVTDESC] and QueuedEvtNum++;
-   * WHILE QueuedEvtNum > ProcedEvtNum, DO wakeup/loop the EvtProcThread, who will read one EvtDesc
-   * from QueuedEvtDescs[ProcedEvtNum%_CONLES_EVENT_MAX_QUEUING_EVTDESC], proc one EvtDesc and
-   * ProcedEvtNum++;
-   */
-  ULONG_T QueuedEvtNum, ProcedEvtNum;  // ULONG_T type is long lone enough to avoid overflow even
-                                       // one event per nanosecond.
-  IOC_EvtDesc_T QueuedEvtDescs[_CONLES_EVENT_MAX_QUEUING_EVTDESC];
-} _IOC_EvtDescQueue_T, *_IOC_EvtDescQueue_pT;
+struct _EvtDescQueueStru {
+  // Each counter starts its own cache line, so an object embedding this queue MUST be allocated
+  //  by _IOC_EvtDescQueue_callocEmbedder(or another cache line aligned allocator) instead of calloc.
+  _Alignas(_IOC_EVTDESC_QUEUE_CACHE_LINE_SIZE) atomic_ulong QueuedEvtNum;
+  _Alignas(_IOC_EVTDESC_QUEUE_CACHE_LINE_SIZE) atomic_ulong ProcedEvtNum;
+
+  // ULONG_T type is long lone enough to avoid overflow even one event per nanosecond.
+  _Alignas(_IOC_EVTDESC_QUEUE_CACHE_LINE_SIZE) ULONG_T Capacity;  // power of two
+  ULONG_T CapacityMask;             // Capacity - 1
+  _IOC_EvtDescQueueSlot_pT pSlots;  // Capacity slots, malloc in init
+
+  // RefMore: _IOC_EvtDescQueue_enqueueElementsLastConflating
+  pthread_mutex_t ConflatingMutex;                      // Used to protect pConflatingEntries
+  atomic_ulong ConflatingEntryNum;  // 0 means dequeue needs not look up pConflatingEntries
+  _IOC_EvtDescQueueConflatingEntry_pT pConflatingEntries;  // 2*Capacity entries hashed by EvtID, malloc by first
+                                                           //  conflating enqueue
+  ULONG_T ConflatingEntryMask;                             // 2*Capacity-1, to wrap a hash or probe position
+  IOC_EvtDesc_pT pConflatingMarkers;                       // Capacity EvtDescs, same as above
+};
 
+// Allocate zeroed Size bytes of an object embedding _IOC_EvtDescQueue_T, aligned to a cache line as the queue needs,
+//  which calloc doesn't promise. Free it by free(). Return NULL if out of memory.
+void *_IOC_EvtDescQueue_callocEmbedder(size_t Size);
+#endif  // !__cplusplus
+
+// Init with default capacity _CONLES_EVENT_MAX_QUEUING_EVTDESC
 void _IOC_EvtDescQueue_initOne(_IOC_EvtDescQueue_pT pEvtDescQueue);
+/**
+ * @brief Init with given capacity, which will be rounded up to power of two.
+ * @return IOC_RESULT_SUCCESS or IOC_RESULT_INVALID_PARAM(Capacity==0) or IOC_RESULT_POSIX_ENOMEM
+ */
+IOC_Result_T _IOC_EvtDescQueue_initOneWithCapacity(_IOC_EvtDescQueue_pT pEvtDescQueue, ULONG_T Capacity);
 void _IOC_EvtDescQueue_deinitOne(_IOC_EvtDescQueue_pT pEvtDescQueue);
 
+/**
+ * @brief Allocate and init a standalone EvtDescQueue with given capacity, such as for C++ UT.
+ * @return same as _IOC_EvtDescQueue_initOneWithCapacity, with *ppEvtDescQueue if IOC_RESULT_SUCCESS.
+ */
+IOC_Result_T _IOC_EvtDescQueue_newOneWithCapacity(ULONG_T Capacity, /*ARG_OUT*/ _IOC_EvtDescQueue_pT *ppEvtDescQueue);
+// Deinit and free an EvtDescQueue from _IOC_EvtDescQueue_newOneWithCapacity.
+void _IOC_EvtDescQueue_deleteOne(_IOC_EvtDescQueue_pT pEvtDescQueue);
+
+ULONG_T _IOC_EvtDescQueue_getCapacity(_IOC_EvtDescQueue_pT pEvtDescQueue);
+
 // Return: IOC_RESULT_YES or IOC_RESULT_NO
 IOC_BoolResult_T _IOC_EvtDescQueue_isEmpty(_IOC_EvtDescQueue_pT pEvtDescQueue);
+// Return: number of EvtDescs in queue now, include reserved but not yet filled ones, at most Capacity.
+ULONG_T _IOC_EvtDescQueue_getQueuedNum(_IOC_EvtDescQueue_pT pEvtDescQueue);
 
 // Return: IOC_RESULT_SUCCESS or IOC_RESULT_TOO_MANY_QUEUING_EVTDESC
 IOC_Result_T _IOC_EvtDescQueue_enqueueElementLast(_IOC_EvtDescQueue_pT pEvtDescQueue,
@@ -48,7 +118,30 @@ IOC_Result_T _IOC_EvtDescQueue_enqueueElementLast(_IOC_EvtDescQueue_pT pEvtDescQ
 // Return: IOC_RESULT_SUCCESS or IOC_RESULT_EVENT_QUEUE_EMPTY
 IOC_Result_T _IOC_EvtDescQueue_dequeueElementFirst(_IOC_EvtDescQueue_pT pEvtDescQueue,
                                                    /*ARG_OUT*/ IOC_EvtDesc_pT pEvtDesc);
+
+// Enqueue EvtDescNum EvtDescs by one reservation, all or nothing.
+// Return: IOC_RESULT_SUCCESS or IOC_RESULT_TOO_MANY_QUEUING_EVTDESC(no space for all, none enqueued)
+IOC_Result_T _IOC_EvtDescQueue_enqueueElementsLast(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                   /*ARG_IN*/ IOC_EvtDesc_pT pEvtDescs, ULONG_T EvtDescNum);
+/**
+ * @brief Enqueue EvtDescNum EvtDescs in conflating mode, all or nothing:
+ *    an EvtDesc whose EvtID is already conflating enqueued and not yet dequeued only replaces that one's value,
+ *    otherwise it's enqueued as usual, so at most one EvtDesc of each EvtID is pending by conflating enqueue,
+ *    which keeps the first one's position and carries the newest value.
+ *  EvtDescs enqueued without conflating are never replaced, and each EvtDesc MUST have a unique SeqID.
+ *
+ * @param pEnqueuedNum: how many EvtDescs are really enqueued, the others are conflated.
+ * @return IOC_RESULT_SUCCESS or IOC_RESULT_TOO_MANY_QUEUING_EVTDESC(none enqueued or conflated)
+ *    or IOC_RESULT_POSIX_ENOMEM
+ */
+IOC_Result_T _IOC_EvtDescQueue_enqueueElementsLastConflating(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                                             /*ARG_IN*/ IOC_EvtDesc_pT pEvtDescs, ULONG_T EvtDescNum,
+                                                             /*ARG_OUT*/ ULONG_T *pEnqueuedNum);
+// Dequeue up to MaxEvtDescNum EvtDescs by one reservation.
+// Return: number of dequeued EvtDescs, 0 means the queue is empty.
+ULONG_T _IOC_EvtDescQueue_dequeueElementsFirst(_IOC_EvtDescQueue_pT pEvtDescQueue,
+                                               /*ARG_OUT*/ IOC_EvtDesc_pT pEvtDescs, ULONG_T MaxEvtDescNum);
 #ifdef __cplusplus
 }
 #endif
-#endif  // __IOC_EVTDESCQUEUE_H__
\ No newline at end of file
+#endif  // __IOC_EVTDESCQUEUE_H__
@@ -0,0 +1,591 @@
+#include "_IOC_Reactor.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// The reactor polls by epoll, which is Linux only, elsewhere each fd is handled by its own thread
+#if !defined(__linux__) && !defined(_IOC_REACTOR_BY_FD_THREAD)
+#define _IOC_REACTOR_BY_FD_THREAD
+#endif
+
+#ifndef _IOC_REACTOR_BY_FD_THREAD
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#endif
+
+static _Thread_local bool _mIsInReactorThread = false;
+
+bool _IOC_Reactor_isInThread(void) { return _mIsInReactorThread; }
+
+#ifndef _IOC_REACTOR_BY_FD_THREAD
+#define _IOC_REACTOR_INIT_SLOT_NUM 64
+#define _IOC_REACTOR_STOP_EVENT_ID UINT64_MAX
+
+/**
+ * @brief Each watched fd has a slot, whose ID of its index and Gen is the poller event's data,
+ *    so an event fetched before its fd is unwatched is told from a later fd reusing the slot by Gen,
+ *    and never leads to its freed _IOC_ReactorFd_T.
+ */
+typedef struct {
+    _IOC_ReactorFd_pT pReactorFd;  // NULL if free
+    int Fd;
+    uint32_t Gen;  // Bumped when freed
+
+    bool IsTimer;       // Of _IOC_Reactor_watchTimer, whose Fd(if any) is closed when the slot is freed
+    bool IsHandling;    // OnReady_F is running in HandlerThread
+    bool IsReadyAgain;  // A timer expired again while IsHandling, so OnReady_F is called again after it returns
+    bool IsUnwatched;
+    pthread_t HandlerThread;
+} _IOC_ReactorSlot_T;
+
+typedef struct _IOC_ReactorShardStru _IOC_ReactorShard_T;
+
+typedef struct {
+    _IOC_ReactorShard_T *pShard;  // Whose Mutex protects all below
+    int PollFd;       // epoll
+    int StopFd;       // Eventfd written when stopping, which stays readable, so it wakes every thread
+    int StopWriteFd;  // Same eventfd as StopFd
+
+    pthread_cond_t UnwatchedCond;  // Unwatchers wait for OnReady_F in another thread to return
+    _IOC_ReactorSlot_T *pSlots;
+    ULONG_T SlotNum, FdNum;
+
+    ULONG_T ThreadNum, IdleThreadNum;  // Idle ones are waiting for fds, not in OnReady_F
+    ULONG_T UnwatcherNum;              // Waiting on UnwatchedCond, which MUST outlive them
+    bool IsStopping;
+} _IOC_Reactor_T;
+
+// Each shard runs its own reactor, which shares neither poller, threads nor Mutex with other shards,
+//  so fds on different shards are handled in parallel without contending, such as of different TCP listeners.
+struct _IOC_ReactorShardStru {
+    pthread_mutex_t Mutex;     // Protects pReactor and all its fields
+    _IOC_Reactor_T *pReactor;  // Current one, while a stopping one is freed by its last thread
+};
+
+static _IOC_ReactorShard_T _mIOC_ReactorShards[_IOC_REACTOR_MAX_SHARD_NUM];
+static pthread_once_t _mIOC_ReactorShardsOnce = PTHREAD_ONCE_INIT;
+
+static void __IOC_Reactor_initShards(void) {
+    for (int i = 0; i < _IOC_REACTOR_MAX_SHARD_NUM; i++) {
+        pthread_mutex_init(&_mIOC_ReactorShards[i].Mutex, NULL);
+    }
+}
+
+static _IOC_ReactorShard_T *__IOC_Reactor_getShard(_IOC_ReactorFd_pT pReactorFd) {
+    pthread_once(&_mIOC_ReactorShardsOnce, __IOC_Reactor_initShards);
+    return &_mIOC_ReactorShards[pReactorFd->ShardIdx % _IOC_REACTOR_MAX_SHARD_NUM];
+}
+
+/**
+ * @brief The poller is epoll, which arms an fd for one readiness at a time, and carries its slot's ID as event data.
+ *    A timer is a timerfd armed like other fds, and re-armed only by _IOC_Reactor_armTimer.
+ */
+static bool __IOC_Reactor_openPoller(_IOC_Reactor_T *pReactor) {
+    pReactor->PollFd = epoll_create1(EPOLL_CLOEXEC);
+    pReactor->StopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    pReactor->StopWriteFd = pReactor->StopFd;
+    if (pReactor->PollFd < 0 || pReactor->StopFd < 0) return false;
+
+    struct epoll_event StopEvent = {.events = EPOLLIN, .data.u64 = _IOC_REACTOR_STOP_EVENT_ID};
+    return epoll_ctl(pReactor->PollFd, EPOLL_CTL_ADD, pReactor->StopFd, &StopEvent) == 0;
+}
+
+// Arm the slot's Fd for its next readiness, IsNew if it's not in the poller yet. Return 0, or -1 with errno.
+static int __IOC_Reactor_armSlot(_IOC_Reactor_T *pReactor, _IOC_ReactorSlot_T *pSlot, uint64_t SlotID, bool IsNew) {
+    struct epoll_event ArmEvent = {.events = EPOLLIN | EPOLLONESHOT, .data.u64 = SlotID};
+    return epoll_ctl(pReactor->PollFd, IsNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, pSlot->Fd, &ArmEvent);
+}
+
+static void __IOC_Reactor_removeSlot(_IOC_Reactor_T *pReactor, _IOC_ReactorSlot_T *pSlot) {
+    epoll_ctl(pReactor->PollFd, EPOLL_CTL_DEL, pSlot->Fd, NULL);
+}
+
+// Open a timer's fd into *pFd, or -1 if it has none. Return false with errno if failed.
+static bool __IOC_Reactor_openTimer(int *pFd) {
+    *pFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    return *pFd >= 0;
+}
+
+// Whether the timer fetched by a reactor thread is still expired, not re-armed meanwhile.
+static bool __IOC_Reactor_ackTimer(int Fd) {
+    uint64_t ExpiredNum = 0;
+    return read(Fd, &ExpiredNum, sizeof(ExpiredNum)) > 0;
+}
+
+void _IOC_Reactor_armTimer(_IOC_ReactorFd_pT pReactorFd, ULONG_T DelayUS) {
+    struct itimerspec Delay = {.it_value = {.tv_sec = DelayUS / 1000000, .tv_nsec = (DelayUS % 1000000) * 1000}};
+    timerfd_settime(pReactorFd->Fd, 0, &Delay, NULL);
+}
+
+// Wait for one event up to TimeoutMs(<0 means forever), return 1 with its *pEventID, 0 if timeout, or -1.
+static int __IOC_Reactor_waitEvent(_IOC_Reactor_T *pReactor, int TimeoutMs, uint64_t *pEventID) {
+    struct epoll_event Event;
+    int EventNum = epoll_wait(pReactor->PollFd, &Event, 1, TimeoutMs);
+    if (EventNum > 0) *pEventID = Event.data.u64;
+    return EventNum;
+}
+
+static void __IOC_Reactor_closePoller(_IOC_Reactor_T *pReactor) {
+    if (pReactor->StopWriteFd >= 0 && pReactor->StopWriteFd != pReactor->StopFd) close(pReactor->StopWriteFd);
+    if (pReactor->StopFd >= 0) close(pReactor->StopFd);
+    if (pReactor->PollFd >= 0) close(pReactor->PollFd);
+}
+
+static void *__IOC_Reactor_runThread(void *pArg);
+
+// Start one more thread counted as idle, with its shard Mutex held.
+static IOC_Result_T __IOC_Reactor_startThread(_IOC_Reactor_T *pReactor) {
+    pthread_attr_t Attr;
+    pthread_attr_init(&Attr);
+    pthread_attr_setdetachstate(&Attr, PTHREAD_CREATE_DETACHED);
+
+    pthread_t Thread;
+    int Ret = pthread_create(&Thread, &Attr, __IOC_Reactor_runThread, pReactor);
+    pthread_attr_destroy(&Attr);
+    if (Ret != 0) {
+        _IOC_LogError("Failed to create reactor thread, ret=%d", Ret);
+        return IOC_RESULT_BUG;
+    }
+
+    pReactor->ThreadNum++;
+    pReactor->IdleThreadNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+// Create the reactor of pShard with its minimal threads, with pShard's Mutex held.
+static IOC_Result_T __IOC_Reactor_create(_IOC_ReactorShard_T *pShard) {
+    _IOC_Reactor_T *pReactor = calloc(1, sizeof(_IOC_Reactor_T));
+    if (!pReactor) return IOC_RESULT_POSIX_ENOMEM;
+    pReactor->pShard = pShard;
+    pReactor->PollFd = pReactor->StopFd = pReactor->StopWriteFd = -1;
+
+    pReactor->pSlots = calloc(_IOC_REACTOR_INIT_SLOT_NUM, sizeof(_IOC_ReactorSlot_T));
+    if (!pReactor->pSlots || !__IOC_Reactor_openPoller(pReactor)) {
+        _IOC_LogError("Failed to create reactor, errno=%d", errno);
+        goto _RetFail;
+    }
+    pReactor->SlotNum = _IOC_REACTOR_INIT_SLOT_NUM;
+
+    pthread_cond_init(&pReactor->UnwatchedCond, NULL);
+
+    for (int i = 0; i < _IOC_REACTOR_MIN_THREAD_NUM; i++) {
+        if (__IOC_Reactor_startThread(pReactor) != IOC_RESULT_SUCCESS) {
+            if (0 == pReactor->ThreadNum) {
+                pthread_cond_destroy(&pReactor->UnwatchedCond);
+                goto _RetFail;
+            }
+            break;  // Fewer threads still work, more are started on demand
+        }
+    }
+
+    pShard->pReactor = pReactor;
+    return IOC_RESULT_SUCCESS;
+
+_RetFail:
+    __IOC_Reactor_closePoller(pReactor);
+    free(pReactor->pSlots);
+    free(pReactor);
+    return IOC_RESULT_BUG;
+}
+
+// Stop the reactor without fds, with its shard Mutex held. Its threads exit once woken by StopFd,
+//  then the last one frees it, and a later watchFd creates a new one.
+static void __IOC_Reactor_stop(_IOC_Reactor_T *pReactor) {
+    pReactor->IsStopping = true;
+    uint64_t One = 1;
+    if (write(pReactor->StopWriteFd, &One, sizeof(One)) < 0) {
+        _IOC_LogError("Failed to stop reactor, errno=%d", errno);
+    }
+    pReactor->pShard->pReactor = NULL;
+}
+
+// Free the slot of an unwatched fd, and stop the reactor if it was the last one, with its shard Mutex held.
+static void __IOC_Reactor_freeSlot(_IOC_Reactor_T *pReactor, _IOC_ReactorSlot_T *pSlot) {
+    if (pSlot->IsTimer && pSlot->Fd >= 0) {
+        close(pSlot->Fd);  // Never read by its handler any more
+    }
+    pSlot->pReactorFd = NULL;
+    pSlot->Gen++;
+    pthread_cond_broadcast(&pReactor->UnwatchedCond);
+
+    if (0 == --pReactor->FdNum) {
+        __IOC_Reactor_stop(pReactor);
+    }
+}
+
+// Free a stopped reactor, by whoever leaves it last of its threads and unwatchers, without its shard Mutex.
+static void __IOC_Reactor_free(_IOC_Reactor_T *pReactor) {
+    __IOC_Reactor_closePoller(pReactor);
+    pthread_cond_destroy(&pReactor->UnwatchedCond);
+    free(pReactor->pSlots);
+    free(pReactor);
+}
+
+static void *__IOC_Reactor_runThread(void *pArg) {
+    _IOC_Reactor_T *pReactor = (_IOC_Reactor_T *)pArg;
+    pthread_mutex_t *pMutex = &pReactor->pShard->Mutex;
+    _mIsInReactorThread = true;
+
+    pthread_mutex_lock(pMutex);
+    while (!pReactor->IsStopping) {
+        // Extra threads time out to exit, but the last idle one waits, so a ready fd is always handled
+        bool IsExtra = pReactor->ThreadNum > _IOC_REACTOR_MIN_THREAD_NUM && pReactor->IdleThreadNum > 1;
+        pthread_mutex_unlock(pMutex);
+
+        uint64_t EventID = 0;
+        int EventNum = __IOC_Reactor_waitEvent(pReactor, IsExtra ? _IOC_REACTOR_IDLE_TIMEOUT_MS : -1, &EventID);
+
+        pthread_mutex_lock(pMutex);
+        if (pReactor->IsStopping) break;
+        if (0 == EventNum && pReactor->ThreadNum > _IOC_REACTOR_MIN_THREAD_NUM && pReactor->IdleThreadNum > 1) break;
+        if (EventNum <= 0) continue;  // EINTR, or no longer extra
+
+        ULONG_T SlotIdx = (uint32_t)EventID;
+        uint32_t SlotGen = (uint32_t)(EventID >> 32);
+        if (SlotIdx >= pReactor->SlotNum) continue;
+
+        _IOC_ReactorSlot_T *pSlot = &pReactor->pSlots[SlotIdx];
+        if (!pSlot->pReactorFd || pSlot->Gen != SlotGen || pSlot->IsUnwatched) {
+            continue;  // Fetched before its fd was unwatched
+        }
+
+        if (pSlot->IsHandling) {
+            pSlot->IsReadyAgain = true;  // A timer re-armed and expired while its OnReady_F is running
+            continue;
+        }
+
+        _IOC_ReactorFd_pT pReactorFd = pSlot->pReactorFd;
+        bool IsTimer = pSlot->IsTimer;
+        pSlot->IsHandling = true;
+        pSlot->HandlerThread = pthread_self();
+        if (0 == --pReactor->IdleThreadNum && pReactor->ThreadNum < _IOC_REACTOR_MAX_THREAD_NUM) {
+            __IOC_Reactor_startThread(pReactor);  // OnReady_F MAY block, keep one thread waiting for other fds
+        }
+
+        bool IsArmed = true;
+        do {
+            pSlot->IsReadyAgain = false;
+            pthread_mutex_unlock(pMutex);
+
+            if (!IsTimer || __IOC_Reactor_ackTimer(pReactorFd->Fd)) {
+                IsArmed = pReactorFd->OnReady_F(pReactorFd);  // pReactorFd MAY be freed if unwatched by itself
+            }
+
+            pthread_mutex_lock(pMutex);
+            pSlot = &pReactor->pSlots[SlotIdx];  // Slots MAY be reallocated meanwhile
+        } while (pSlot->IsReadyAgain && IsArmed && !pSlot->IsUnwatched);
+
+        pReactor->IdleThreadNum++;
+        pSlot->IsHandling = false;
+        if (pSlot->IsUnwatched) {
+            __IOC_Reactor_freeSlot(pReactor, pSlot);
+        } else if (IsArmed) {
+            if (__IOC_Reactor_armSlot(pReactor, pSlot, EventID, false) < 0) {
+                _IOC_LogError("Failed to re-arm fd(%d) in reactor, errno=%d", pSlot->Fd, errno);
+            }
+        }
+    }
+
+    pReactor->ThreadNum--;
+    pReactor->IdleThreadNum--;
+    bool IsLastOne = pReactor->IsStopping && 0 == pReactor->ThreadNum && 0 == pReactor->UnwatcherNum;
+    pthread_mutex_unlock(pMutex);
+
+    if (IsLastOne) {
+        __IOC_Reactor_free(pReactor);
+    }
+    return NULL;
+}
+
+// Watch pReactorFd's Fd, or its timer if IsTimer, in a free slot of its shard's reactor.
+static IOC_Result_T __IOC_Reactor_watch(_IOC_ReactorFd_pT pReactorFd, bool IsTimer) {
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+
+    _IOC_ReactorShard_T *pShard = __IOC_Reactor_getShard(pReactorFd);
+    pthread_mutex_lock(&pShard->Mutex);
+    if (!pShard->pReactor) {
+        Result = __IOC_Reactor_create(pShard);
+        if (Result != IOC_RESULT_SUCCESS) {
+            pthread_mutex_unlock(&pShard->Mutex);
+            return Result;
+        }
+    }
+    _IOC_Reactor_T *pReactor = pShard->pReactor;
+
+    ULONG_T SlotIdx = 0;
+    while (SlotIdx < pReactor->SlotNum && pReactor->pSlots[SlotIdx].pReactorFd) {
+        SlotIdx++;
+    }
+    if (SlotIdx == pReactor->SlotNum) {
+        _IOC_ReactorSlot_T *pSlots = realloc(pReactor->pSlots, 2 * pReactor->SlotNum * sizeof(_IOC_ReactorSlot_T));
+        if (!pSlots) {
+            Result = IOC_RESULT_POSIX_ENOMEM;
+            goto _RetUnlock;
+        }
+        memset(&pSlots[pReactor->SlotNum], 0, pReactor->SlotNum * sizeof(_IOC_ReactorSlot_T));
+        pReactor->pSlots = pSlots;
+        pReactor->SlotNum *= 2;
+    }
+
+    _IOC_ReactorSlot_T *pSlot = &pReactor->pSlots[SlotIdx];
+    pReactorFd->SlotID = ((uint64_t)pSlot->Gen << 32) | SlotIdx;
+
+    pSlot->Fd = pReactorFd->Fd;
+    pSlot->IsTimer = IsTimer;
+    if (__IOC_Reactor_armSlot(pReactor, pSlot, pReactorFd->SlotID, true) < 0) {
+        _IOC_LogError("Failed to watch fd(%d) in reactor, errno=%d", pReactorFd->Fd, errno);
+        Result = IOC_RESULT_BUG;
+        goto _RetUnlock;
+    }
+
+    pSlot->pReactorFd = pReactorFd;
+    pSlot->IsReadyAgain = false;
+    pSlot->IsUnwatched = false;
+    pReactor->FdNum++;
+
+_RetUnlock:
+    if (0 == pReactor->FdNum) {
+        __IOC_Reactor_stop(pReactor);  // Created above for nothing
+    }
+    pthread_mutex_unlock(&pShard->Mutex);
+    return Result;
+}
+
+IOC_Result_T _IOC_Reactor_watchFd(_IOC_ReactorFd_pT pReactorFd) { return __IOC_Reactor_watch(pReactorFd, false); }
+
+IOC_Result_T _IOC_Reactor_watchTimer(_IOC_ReactorFd_pT pReactorFd) {
+    if (!__IOC_Reactor_openTimer(&pReactorFd->Fd)) {
+        _IOC_LogError("Failed to create timer of reactor, errno=%d", errno);
+        return IOC_RESULT_BUG;
+    }
+
+    IOC_Result_T Result = __IOC_Reactor_watch(pReactorFd, true);
+    if (Result != IOC_RESULT_SUCCESS && pReactorFd->Fd >= 0) {
+        close(pReactorFd->Fd);
+    }
+    return Result;
+}
+
+void _IOC_Reactor_unwatchFd(_IOC_ReactorFd_pT pReactorFd) {
+    _IOC_ReactorShard_T *pShard = __IOC_Reactor_getShard(pReactorFd);
+    pthread_mutex_lock(&pShard->Mutex);
+    _IOC_Reactor_T *pReactor = pShard->pReactor;  // Never stopped while pReactorFd is watched
+
+    ULONG_T SlotIdx = (uint32_t)pReactorFd->SlotID;
+    uint32_t SlotGen = (uint32_t)(pReactorFd->SlotID >> 32);
+    if (!pReactor || SlotIdx >= pReactor->SlotNum || pReactor->pSlots[SlotIdx].pReactorFd != pReactorFd ||
+        pReactor->pSlots[SlotIdx].Gen != SlotGen) {
+        pthread_mutex_unlock(&pShard->Mutex);
+        return;  // Unwatched already
+    }
+
+    _IOC_ReactorSlot_T *pSlot = &pReactor->pSlots[SlotIdx];
+    if (!pSlot->IsUnwatched) {
+        // Removed at once, so the caller MAY close Fd, even if its slot is freed later
+        __IOC_Reactor_removeSlot(pReactor, pSlot);
+        pSlot->IsUnwatched = true;
+    }
+
+    if (!pSlot->IsHandling) {
+        __IOC_Reactor_freeSlot(pReactor, pSlot);
+    } else if (!pthread_equal(pSlot->HandlerThread, pthread_self())) {
+        // Its handler frees the slot once OnReady_F returns, which MAY stop the reactor, even exit all its threads
+        pReactor->UnwatcherNum++;
+        while (pReactor->pSlots[SlotIdx].Gen == SlotGen) {
+            pthread_cond_wait(&pReactor->UnwatchedCond, &pShard->Mutex);
+        }
+        bool IsLastOne = 0 == --pReactor->UnwatcherNum && pReactor->IsStopping && 0 == pReactor->ThreadNum;
+        pthread_mutex_unlock(&pShard->Mutex);
+
+        if (IsLastOne) {
+            __IOC_Reactor_free(pReactor);
+        }
+        return;
+    }
+    pthread_mutex_unlock(&pShard->Mutex);
+}
+#else  // _IOC_REACTOR_BY_FD_THREAD
+/**
+ * @brief Without epoll, each watched fd is handled by its own thread blocking in poll() of it and its StopFds,
+ *    and each timer by its own thread waiting for its deadline, as each TCP link had a receiving thread before,
+ *    which costs a thread per fd, but only needs POSIX. OnReady_F is called in the same way as by epoll,
+ *    one readiness at a time, and not again after it returned false, while ShardIdx makes no difference.
+ *  The fd's thread is kept as SlotID of its _IOC_ReactorFd_T, which is 0 once unwatched.
+ */
+typedef struct {
+    _IOC_ReactorFd_pT pReactorFd;
+    int Fd;
+    pthread_t Thread;
+    int StopFds[2];  // Pipe written when unwatched, which wakes the thread from poll()
+
+    bool IsTimer, IsTimerArmed;
+    struct timespec TimerDeadline;  // Of CLOCK_REALTIME, by which pthread_cond_timedwait waits everywhere
+    pthread_cond_t TimerCond;       // Timer thread waits for its deadline, being re-armed or unwatched
+
+    bool IsUnwatched;
+    bool IsDetached;  // Unwatched by its own OnReady_F, then its thread frees it
+} _IOC_ReactorFdThread_T;
+
+// Protects all _IOC_ReactorFdThread_T, and SlotID of watched fds
+static pthread_mutex_t _mIOC_ReactorFdThreadMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void __IOC_Reactor_freeFdThread(_IOC_ReactorFdThread_T *pFdThread) {
+    for (int i = 0; i < 2; i++) {
+        if (pFdThread->StopFds[i] >= 0) close(pFdThread->StopFds[i]);
+    }
+    pthread_cond_destroy(&pFdThread->TimerCond);
+    free(pFdThread);
+}
+
+// Wait for the timer to expire with the Mutex held, return false if unwatched meanwhile.
+static bool __IOC_Reactor_waitTimer(_IOC_ReactorFdThread_T *pFdThread) {
+    while (!pFdThread->IsUnwatched) {
+        if (!pFdThread->IsTimerArmed) {
+            pthread_cond_wait(&pFdThread->TimerCond, &_mIOC_ReactorFdThreadMutex);
+            continue;
+        }
+
+        // Checked after each wakeup, as the deadline MAY be replaced while waiting
+        struct timespec Now;
+        clock_gettime(CLOCK_REALTIME, &Now);
+        if (Now.tv_sec > pFdThread->TimerDeadline.tv_sec ||
+            (Now.tv_sec == pFdThread->TimerDeadline.tv_sec && Now.tv_nsec >= pFdThread->TimerDeadline.tv_nsec)) {
+            pFdThread->IsTimerArmed = false;
+            return true;
+        }
+        pthread_cond_timedwait(&pFdThread->TimerCond, &_mIOC_ReactorFdThreadMutex, &pFdThread->TimerDeadline);
+    }
+    return false;
+}
+
+static void *__IOC_Reactor_runFdThread(void *pArg) {
+    _IOC_ReactorFdThread_T *pFdThread = (_IOC_ReactorFdThread_T *)pArg;
+    _mIsInReactorThread = true;
+
+    bool IsArmed = true;
+    pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+    while (!pFdThread->IsUnwatched) {
+        bool IsReady = false;
+        if (pFdThread->IsTimer) {
+            IsReady = __IOC_Reactor_waitTimer(pFdThread);
+        } else {
+            pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+            // Only StopFds is polled once disarmed, till unwatched
+            struct pollfd PollFds[2] = {{.fd = pFdThread->StopFds[0], .events = POLLIN},
+                                        {.fd = pFdThread->Fd, .events = POLLIN}};
+            int ReadyNum = poll(PollFds, IsArmed ? 2 : 1, -1);
+            pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+            IsReady = ReadyNum > 0 && PollFds[1].revents != 0;  // POLLHUP or POLLERR is handled as readable
+        }
+        if (!IsReady || !IsArmed || pFdThread->IsUnwatched) continue;
+
+        _IOC_ReactorFd_pT pReactorFd = pFdThread->pReactorFd;
+        pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+        IsArmed = pReactorFd->OnReady_F(pReactorFd);  // pReactorFd MAY be freed if unwatched by itself
+        pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+    }
+    bool IsDetached = pFdThread->IsDetached;
+    pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+
+    if (IsDetached) {
+        __IOC_Reactor_freeFdThread(pFdThread);
+    }
+    return NULL;
+}
+
+// Watch pReactorFd's Fd, or its timer if IsTimer, by a new thread of its own.
+static IOC_Result_T __IOC_Reactor_watch(_IOC_ReactorFd_pT pReactorFd, bool IsTimer) {
+    _IOC_ReactorFdThread_T *pFdThread = calloc(1, sizeof(_IOC_ReactorFdThread_T));
+    if (!pFdThread) return IOC_RESULT_POSIX_ENOMEM;
+    pFdThread->pReactorFd = pReactorFd;
+    pFdThread->Fd = pReactorFd->Fd;
+    pFdThread->IsTimer = IsTimer;
+    pFdThread->StopFds[0] = pFdThread->StopFds[1] = -1;
+    pthread_cond_init(&pFdThread->TimerCond, NULL);
+
+    if (!IsTimer) {
+        if (pipe(pFdThread->StopFds) != 0) {
+            _IOC_LogError("Failed to watch fd(%d) by thread, errno=%d", pReactorFd->Fd, errno);
+            pFdThread->StopFds[0] = pFdThread->StopFds[1] = -1;
+            __IOC_Reactor_freeFdThread(pFdThread);
+            return IOC_RESULT_BUG;
+        }
+        for (int i = 0; i < 2; i++) {
+            fcntl(pFdThread->StopFds[i], F_SETFD, FD_CLOEXEC);
+        }
+    }
+
+    pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+    int Ret = pthread_create(&pFdThread->Thread, NULL, __IOC_Reactor_runFdThread, pFdThread);
+    if (Ret != 0) {
+        pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+        _IOC_LogError("Failed to create thread of fd(%d), ret=%d", pReactorFd->Fd, Ret);
+        __IOC_Reactor_freeFdThread(pFdThread);
+        return IOC_RESULT_BUG;
+    }
+    pReactorFd->SlotID = (uint64_t)(uintptr_t)pFdThread;
+    pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T _IOC_Reactor_watchFd(_IOC_ReactorFd_pT pReactorFd) { return __IOC_Reactor_watch(pReactorFd, false); }
+
+IOC_Result_T _IOC_Reactor_watchTimer(_IOC_ReactorFd_pT pReactorFd) {
+    pReactorFd->Fd = -1;  // Its thread waits for the deadline without fd
+    return __IOC_Reactor_watch(pReactorFd, true);
+}
+
+void _IOC_Reactor_armTimer(_IOC_ReactorFd_pT pReactorFd, ULONG_T DelayUS) {
+    pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+    _IOC_ReactorFdThread_T *pFdThread = (_IOC_ReactorFdThread_T *)(uintptr_t)pReactorFd->SlotID;
+    if (pFdThread) {
+        struct timespec *pDeadline = &pFdThread->TimerDeadline;
+        clock_gettime(CLOCK_REALTIME, pDeadline);
+        pDeadline->tv_sec += DelayUS / 1000000;
+        pDeadline->tv_nsec += (DelayUS % 1000000) * 1000;
+        if (pDeadline->tv_nsec >= 1000000000L) {
+            pDeadline->tv_sec++;
+            pDeadline->tv_nsec -= 1000000000L;
+        }
+        pFdThread->IsTimerArmed = true;
+        pthread_cond_signal(&pFdThread->TimerCond);
+    }
+    pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+}
+
+void _IOC_Reactor_unwatchFd(_IOC_ReactorFd_pT pReactorFd) {
+    pthread_mutex_lock(&_mIOC_ReactorFdThreadMutex);
+    _IOC_ReactorFdThread_T *pFdThread = (_IOC_ReactorFdThread_T *)(uintptr_t)pReactorFd->SlotID;
+    if (!pFdThread) {
+        pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+        return;  // Unwatched already
+    }
+    pReactorFd->SlotID = 0;
+    pFdThread->IsUnwatched = true;
+    pthread_cond_signal(&pFdThread->TimerCond);
+
+    if (pthread_equal(pFdThread->Thread, pthread_self())) {
+        // From its own OnReady_F, whose thread exits and frees it once OnReady_F returns
+        pFdThread->IsDetached = true;
+        pthread_detach(pFdThread->Thread);
+        pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+        return;
+    }
+    pthread_mutex_unlock(&_mIOC_ReactorFdThreadMutex);
+
+    // Wake its thread from poll(), then wait for it to return from OnReady_F and exit
+    uint8_t One = 1;
+    if (pFdThread->StopFds[1] >= 0 && write(pFdThread->StopFds[1], &One, sizeof(One)) < 0) {
+        _IOC_LogError("Failed to stop thread of fd(%d), errno=%d", pFdThread->Fd, errno);
+    }
+    pthread_join(pFdThread->Thread, NULL);
+    __IOC_Reactor_freeFdThread(pFdThread);
+}
+#endif  // _IOC_REACTOR_BY_FD_THREAD
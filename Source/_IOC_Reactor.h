@@ -0,0 +1,80 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "_IOC_Logging.h"
+#include "_IOC_Types.h"
+
+#ifndef __IOC_REACTOR_H__
+#define __IOC_REACTOR_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Threads the reactor keeps waiting for fds, more are started only while all of them are handling fds,
+//  such as blocked in a callback which waits for another fd, and exit after idle for IDLE_TIMEOUT_MS.
+#define _IOC_REACTOR_MIN_THREAD_NUM 2
+#define _IOC_REACTOR_MAX_THREAD_NUM 128
+#define _IOC_REACTOR_IDLE_TIMEOUT_MS 1000
+// Independent reactors an fd MAY be watched by, see _IOC_ReactorFd_T::ShardIdx
+#define _IOC_REACTOR_MAX_SHARD_NUM 16
+
+/**
+ * @brief Reactor is the process's shared set of a few threads waiting on ONE poller for all watched fds,
+ *    such as every TCP link's socket and service's listening socket, instead of one blocking thread per fd.
+ *    A ready fd is handled by calling its OnReady_F in a reactor thread, which MUST NOT wait for more input,
+ *      but takes what's readable now and keeps its partial state in its own object till the next call.
+ *
+ *  The poller is epoll, which is Linux only, elsewhere or if built with _IOC_REACTOR_BY_FD_THREAD,
+ *    each fd is handled by its own thread instead, with the same API and OnReady_F semantics, RefMore: _IOC_Reactor.c
+ *  Each fd is armed for one readiness at a time(EPOLLONESHOT), so OnReady_F of the same fd never runs
+ *    in two threads at once, and handles its input in order, then it's re-armed once OnReady_F returns true.
+ *  OnReady_F MAY block, such as in a user callback, then the reactor starts another thread to keep
+ *    one thread always waiting, so other fds are still handled, even one the blocked callback waits for.
+ *  The reactor is created by the first watched fd, and gone with its threads after the last fd is unwatched.
+ *
+ *  Fds are watched by shard 0 by default, while fds of other shards are watched by other reactors,
+ *    each of its own poller, threads and lock, so several shards handle their fds in parallel over CPU cores,
+ *    such as each listener of a TCP service with SO_REUSEPORT, and links it accepted, on their own shard.
+ */
+typedef struct _IOC_ReactorFdStru _IOC_ReactorFd_T, *_IOC_ReactorFd_pT;
+typedef bool (*_IOC_ReactorOnReady_F)(_IOC_ReactorFd_pT pReactorFd);
+
+struct _IOC_ReactorFdStru {
+    int Fd;
+    _IOC_ReactorOnReady_F OnReady_F;  // Called when Fd is readable or hung up, returns false to disarm Fd
+    void *pPriv;
+    ULONG_T ShardIdx;  // Reactor shard watching Fd, in [0, _IOC_REACTOR_MAX_SHARD_NUM), 0 by default
+
+    uint64_t SlotID;  // Set by _IOC_Reactor_watchFd
+};
+
+// Watch pReactorFd's Fd, of which OnReady_F is called in reactor threads from now on.
+//  pReactorFd MUST be kept until unwatched. Return IOC_RESULT_SUCCESS, or POSIX_ENOMEM/BUG.
+IOC_Result_T _IOC_Reactor_watchFd(_IOC_ReactorFd_pT pReactorFd);
+/**
+ * @brief Watch a one-shot timer as pReactorFd, whose OnReady_F is called in a reactor thread each time it expires,
+ *    then _IOC_Reactor_armTimer it. Its Fd is set and owned by the reactor, the caller never reads or closes it.
+ *    It's unwatched by _IOC_Reactor_unwatchFd as an fd.
+ *
+ * @return same as _IOC_Reactor_watchFd.
+ */
+IOC_Result_T _IOC_Reactor_watchTimer(_IOC_ReactorFd_pT pReactorFd);
+// Arm the watched timer to expire DelayUS(> 0) later, replacing its deadline if it's armed already.
+//  If it expires again while its OnReady_F is running, OnReady_F is called again after that returns.
+void _IOC_Reactor_armTimer(_IOC_ReactorFd_pT pReactorFd, ULONG_T DelayUS);
+
+// Stop watching, and wait for its OnReady_F running in another thread to return, if any,
+//  then its Fd MAY be closed and pReactorFd freed. It's unwatched at once if called from its own OnReady_F,
+//  which MAY free pReactorFd then, as the reactor never accesses it after OnReady_F returns.
+//  Unwatching it again only waits as above.
+void _IOC_Reactor_unwatchFd(_IOC_ReactorFd_pT pReactorFd);
+
+// Whether the calling thread is a reactor thread, whose callbacks MUST NOT wait for more input of the fd
+//  being handled, such as credits or acks of their own link, which only come after they return.
+bool _IOC_Reactor_isInThread(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __IOC_REACTOR_H__
@@ -0,0 +1,127 @@
+#include "_IOC_SnapshotPtr.h"
+
+#include <sched.h>
+#include <stdlib.h>
+
+static void __IOC_SnapshotPtr_freeOne(_IOC_SnapshotHdr_pT pSnapshot) {
+    if (NULL == pSnapshot) {
+        return;
+    } else if (NULL != pSnapshot->FreeSnapshot_F) {
+        pSnapshot->FreeSnapshot_F(pSnapshot);
+    } else {
+        free(pSnapshot);
+    }
+}
+
+void _IOC_SnapshotPtr_initOne(_IOC_SnapshotPtr_pT pSnapshotPtr) {
+    atomic_init(&pSnapshotPtr->pSnapshot, NULL);
+    atomic_init(&pSnapshotPtr->Epoch, 0);
+    atomic_init(&pSnapshotPtr->ReaderNum[0], 0);
+    atomic_init(&pSnapshotPtr->ReaderNum[1], 0);
+
+    pthread_mutex_init(&pSnapshotPtr->RetiredMutex, NULL);
+    atomic_init(&pSnapshotPtr->pRetiredList, NULL);
+}
+
+void _IOC_SnapshotPtr_deinitOne(_IOC_SnapshotPtr_pT pSnapshotPtr) {
+    // readers MAY still be in a callback of the last snapshot, such as peer's postEVT, wait them to leave.
+    while (atomic_load(&pSnapshotPtr->ReaderNum[0]) != 0 || atomic_load(&pSnapshotPtr->ReaderNum[1]) != 0) {
+        sched_yield();
+    }
+
+    __IOC_SnapshotPtr_freeOne(atomic_exchange(&pSnapshotPtr->pSnapshot, NULL));
+
+    _IOC_SnapshotHdr_pT pRetired = atomic_exchange(&pSnapshotPtr->pRetiredList, NULL);
+    while (pRetired != NULL) {
+        _IOC_SnapshotHdr_pT pNextRetired = pRetired->pNextRetired;
+        __IOC_SnapshotPtr_freeOne(pRetired);
+        pRetired = pNextRetired;
+    }
+
+    int PosixResult = pthread_mutex_destroy(&pSnapshotPtr->RetiredMutex);
+    if (PosixResult != 0) {
+        _IOC_LogAssert(PosixResult == 0);
+    }
+}
+
+_IOC_SnapshotHdr_pT _IOC_SnapshotPtr_enterRead(_IOC_SnapshotPtr_pT pSnapshotPtr, ULONG_T *pEpoch) {
+    // Load the snapshot AFTER ReaderNum is increased, so a publisher who checks ReaderNum after publishing
+    //   either sees this reader, or this reader loads the new snapshot.
+    ULONG_T Epoch = atomic_load(&pSnapshotPtr->Epoch) & 1;
+    atomic_fetch_add(&pSnapshotPtr->ReaderNum[Epoch], 1);
+
+    *pEpoch = Epoch;
+    return atomic_load(&pSnapshotPtr->pSnapshot);
+}
+
+static void __IOC_SnapshotPtr_reclaimRetiredLocked(_IOC_SnapshotPtr_pT pSnapshotPtr) {
+    bool IsReaderNumZero[2] = {
+        atomic_load(&pSnapshotPtr->ReaderNum[0]) == 0,
+        atomic_load(&pSnapshotPtr->ReaderNum[1]) == 0,
+    };
+    bool IsWaitingCurEpoch = false;
+    ULONG_T CurEpoch = atomic_load(&pSnapshotPtr->Epoch) & 1;
+
+    _IOC_SnapshotHdr_pT pKeptList = NULL;
+    _IOC_SnapshotHdr_pT pRetired = atomic_exchange(&pSnapshotPtr->pRetiredList, NULL);
+    while (pRetired != NULL) {
+        _IOC_SnapshotHdr_pT pNextRetired = pRetired->pNextRetired;
+
+        pRetired->IsReaderNumSeenZero[0] |= IsReaderNumZero[0];
+        pRetired->IsReaderNumSeenZero[1] |= IsReaderNumZero[1];
+
+        if (pRetired->IsReaderNumSeenZero[0] && pRetired->IsReaderNumSeenZero[1]) {
+            __IOC_SnapshotPtr_freeOne(pRetired);
+        } else {
+            IsWaitingCurEpoch |= !pRetired->IsReaderNumSeenZero[CurEpoch];
+            pRetired->pNextRetired = pKeptList;
+            pKeptList = pRetired;
+        }
+
+        pRetired = pNextRetired;
+    }
+    atomic_store(&pSnapshotPtr->pRetiredList, pKeptList);
+
+    // Move new readers to the other ReaderNum, so the current one could drain.
+    if (IsWaitingCurEpoch) {
+        atomic_fetch_add(&pSnapshotPtr->Epoch, 1);
+    }
+}
+
+void _IOC_SnapshotPtr_leaveRead(_IOC_SnapshotPtr_pT pSnapshotPtr, ULONG_T Epoch) {
+    atomic_fetch_sub(&pSnapshotPtr->ReaderNum[Epoch], 1);
+
+    // Last chance to free retired snapshots if no more publish, but never wait for the writer.
+    if (atomic_load_explicit(&pSnapshotPtr->pRetiredList, memory_order_relaxed) != NULL) {
+        if (pthread_mutex_trylock(&pSnapshotPtr->RetiredMutex) == 0) {
+            __IOC_SnapshotPtr_reclaimRetiredLocked(pSnapshotPtr);
+            pthread_mutex_unlock(&pSnapshotPtr->RetiredMutex);
+        }
+    }
+}
+
+_IOC_SnapshotHdr_pT _IOC_SnapshotPtr_getForWriter(_IOC_SnapshotPtr_pT pSnapshotPtr) {
+    return atomic_load(&pSnapshotPtr->pSnapshot);
+}
+
+void _IOC_SnapshotPtr_publish(_IOC_SnapshotPtr_pT pSnapshotPtr, _IOC_SnapshotHdr_pT pNewSnapshot) {
+    _IOC_SnapshotHdr_pT pOldSnapshot = atomic_exchange(&pSnapshotPtr->pSnapshot, pNewSnapshot);
+
+    // Fast path without readers: a reader who loaded the old one counted itself BEFORE the exchange,
+    //   so if both ReaderNum are zero now, the old one is already unused, and free it at once.
+    if (atomic_load(&pSnapshotPtr->ReaderNum[0]) == 0 && atomic_load(&pSnapshotPtr->ReaderNum[1]) == 0 &&
+        atomic_load(&pSnapshotPtr->pRetiredList) == NULL) {
+        __IOC_SnapshotPtr_freeOne(pOldSnapshot);
+        return;
+    }
+
+    pthread_mutex_lock(&pSnapshotPtr->RetiredMutex);
+    if (pOldSnapshot != NULL) {
+        pOldSnapshot->IsReaderNumSeenZero[0] = false;
+        pOldSnapshot->IsReaderNumSeenZero[1] = false;
+        pOldSnapshot->pNextRetired = atomic_load(&pSnapshotPtr->pRetiredList);
+        atomic_store(&pSnapshotPtr->pRetiredList, pOldSnapshot);
+    }
+    __IOC_SnapshotPtr_reclaimRetiredLocked(pSnapshotPtr);
+    pthread_mutex_unlock(&pSnapshotPtr->RetiredMutex);
+}
@@ -0,0 +1,58 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "_IOC_Logging.h"
+#include "_IOC_Types.h"
+
+#ifndef __IOC_SNAPSHOTPTR_H__
+#define __IOC_SNAPSHOTPTR_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief SnapshotPtr publishes an immutable snapshot by an atomic pointer, RCU style:
+ *    Readers enter/leave by ReaderNum[Epoch & 1] and use the current snapshot without any mutex,
+ *      even across a callback, and even if the callback publishes a new snapshot.
+ *    Writers(serialized by caller) build a new snapshot, publish it and retire the old one,
+ *      the retired one is freed later once it's safe, so writers never wait readers.
+ *
+ *  A retired snapshot is safe to free after ReaderNum[0] and ReaderNum[1] are BOTH seen zero since it's retired,
+ *    because readers entered after publishing always load the new one. Epoch only decides which ReaderNum
+ *    new readers go to, and is flipped on each publish/reclaim, so the old ReaderNum could drain.
+ *
+ *  Each snapshot MUST begin with _IOC_SnapshotHdr_T, it's freed by FreeSnapshot_F if set, otherwise by free().
+ */
+typedef struct _IOC_SnapshotHdrStru {
+    void (*FreeSnapshot_F)(struct _IOC_SnapshotHdrStru *pSnapshot);  // OPTIONAL, set by its builder
+    struct _IOC_SnapshotHdrStru *pNextRetired;
+    bool IsReaderNumSeenZero[2];
+} _IOC_SnapshotHdr_T, *_IOC_SnapshotHdr_pT;
+
+typedef struct {
+    _Atomic(_IOC_SnapshotHdr_pT) pSnapshot;  // NULL means no snapshot
+    atomic_ulong Epoch;
+    atomic_ulong ReaderNum[2];
+
+    pthread_mutex_t RetiredMutex;  // Used to protect pRetiredList, never taken by readers except trylock
+    _Atomic(_IOC_SnapshotHdr_pT) pRetiredList;
+} _IOC_SnapshotPtr_T, *_IOC_SnapshotPtr_pT;
+
+void _IOC_SnapshotPtr_initOne(_IOC_SnapshotPtr_pT pSnapshotPtr);
+// Wait all readers to leave, then free current and retired snapshots.
+void _IOC_SnapshotPtr_deinitOne(_IOC_SnapshotPtr_pT pSnapshotPtr);
+
+// Return: current snapshot or NULL, which is valid until leaveRead with the same *pEpoch.
+_IOC_SnapshotHdr_pT _IOC_SnapshotPtr_enterRead(_IOC_SnapshotPtr_pT pSnapshotPtr, /*ARG_OUT*/ ULONG_T *pEpoch);
+void _IOC_SnapshotPtr_leaveRead(_IOC_SnapshotPtr_pT pSnapshotPtr, ULONG_T Epoch);
+
+// Current snapshot for writers, who are serialized by caller and so the snapshot won't be retired meanwhile.
+_IOC_SnapshotHdr_pT _IOC_SnapshotPtr_getForWriter(_IOC_SnapshotPtr_pT pSnapshotPtr);
+// Publish pNewSnapshot(may be NULL) and retire the old one, or free it at once if no reader, never wait readers.
+void _IOC_SnapshotPtr_publish(_IOC_SnapshotPtr_pT pSnapshotPtr, _IOC_SnapshotHdr_pT pNewSnapshot);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __IOC_SNAPSHOTPTR_H__
@@ -40,7 +40,10 @@
 #include <errno.h>  // For ETIMEDOUT
 
 #include "_IOC.h"
+#include "_IOC_DatCredit.h"
+#include "_IOC_DatRing.h"
 #include "_IOC_EvtDescQueue.h"
+#include "_IOC_SnapshotPtr.h"
 
 // Timeout enforcement callback wrapper structures and functions
 typedef struct {
@@ -73,6 +76,8 @@ static void* __IOC_timeoutCallbackWrapper(void* arg) {
 
 typedef struct _IOC_ProtoFifoLinkObjectStru _IOC_ProtoFifoLinkObject_T;
 typedef _IOC_ProtoFifoLinkObject_T* _IOC_ProtoFifoLinkObject_pT;
+typedef struct _IOC_ProtoFifoDatDispatcherStru _IOC_ProtoFifoDatDispatcher_T;
+typedef _IOC_ProtoFifoDatDispatcher_T* _IOC_ProtoFifoDatDispatcher_pT;
 
 /**
  * @brief ProtoFIFO's 【Link Object】(a.k.a FifoLinkObj), used to transmit MSG<EVT/CMD/DATA> in FIFO order.
@@ -88,14 +93,23 @@ typedef _IOC_ProtoFifoLinkObject_T* _IOC_ProtoFifoLinkObject_pT;
  *      LinkFifoObj_atCli->pPeer = LinkFifoObj_atSrv.
  *
  */
+/**
+ * @brief Immutable snapshot of SubEvtArgs, pEvtIDs points to EvtIDs in the same allocation.
+ *    subEvt/unsubEvt publish a new one, and peer's postEvt reads it without any LinkObj's Mutex.
+ */
+typedef struct {
+    _IOC_SnapshotHdr_T SnapshotHdr;  // MUST be first
+    IOC_SubEvtArgs_T SubEvtArgs;
+    IOC_EvtID_T EvtIDs[];
+} _IOC_ProtoFifoSubEvtArgs_T, *_IOC_ProtoFifoSubEvtArgs_pT;
+
 struct _IOC_ProtoFifoLinkObjectStru {
     pthread_mutex_t Mutex;
     _IOC_LinkObject_pT pOwnerLinkObj;  // TDD FIX: Reference to the LinkObject that owns this ProtoFifoLinkObject
 
     _IOC_ProtoFifoLinkObject_pT pPeer;
-    union {
-        IOC_SubEvtArgs_T SubEvtArgs;  // SET by subEvt, USED when postEvt
-    };
+    _IOC_SnapshotPtr_T SubEvtArgs;  // of _IOC_ProtoFifoSubEvtArgs_T, SET by subEvt, USED when peer's postEvt
+    pthread_mutex_t SubEvtMutex;    // Used to serialize subEvt/unsubEvt, never taken by postEvt
 
     // 📦 WHY ADD DAT SUPPORT: ProtoFifo previously only supported EVT (events), but the
     // framework promised DAT (data transfer) capability. Without this structure, DAT
@@ -110,50 +124,34 @@ struct _IOC_ProtoFifoLinkObjectStru {
     // 🎯 THREAD SAFETY: Protected by the existing pLinkObj->Mutex to ensure
     // callback registration and data transmission are atomic operations.
     struct {
-        IOC_CbRecvDat_F CbRecvDat_F;  // Callback for receiving data
-        void* pCbPrivData;            // Private data for callback
-        bool IsReceiverRegistered;    // Whether this link has a receiver callback
-        bool IsProcessingCallback;    // Whether callback is currently being processed (for batching support)
-        int PendingDataCount;         // Count of pending data chunks (for non-blocking queue simulation)
-
-        // 🚀 MICRO-BATCHING SUPPORT: Accumulate rapid sends for batched delivery
-        // Time-window-based batching for accumulating sends after slow callbacks
-        struct {
-            char* pBatchBuffer;          // Buffer for accumulating data
-            size_t BatchBufferSize;      // Total batch buffer size
-            size_t AccumulatedDataSize;  // Currently accumulated data size
-            bool IsInCallback;           // Flag to track if we're currently in a callback
-            pthread_mutex_t BatchMutex;  // Mutex for batch operations
-
-            // Time-window batching fields
-            struct timespec LastCallbackStart;  // Start time of last callback
-            struct timespec LastCallbackEnd;    // End time of last callback
-            struct timespec BatchWindowStart;   // Start time of current batching window
-            bool IsBatchWindowOpen;             // Whether batching window is currently open
-            long SlowCallbackThresholdMs;       // Threshold for detecting slow callbacks (ms)
-            long BatchWindowDurationMs;         // Duration of batching window (ms)
-        } CallbackBatch;
-
-        // 🎯 TDD SUPPORT: Last sent data cache for zero timeout polling simulation
-        // This enables Test Case 6 where sender can immediately poll for data it just sent
+        IOC_CbRecvDat_F CbRecvDat_F;             // Callback for receiving data
+        IOC_CbRecvDatBatch_F CbRecvDatBatch_F;  // Callback for receiving data batches, used instead if set
+        void* pCbPrivData;                      // Private data for callback
+        bool IsReceiverRegistered;              // Whether this link has a receiver callback
+
+        // 🎫 FLOW CONTROL: Credits granted to the peer DatSender, spent by its sendDAT,
+        // returned by the dispatcher after callbacks, or by IOC_recvDAT from PollingBuffer in polling mode.
+        _IOC_DatCredit_T Credit;
+
+        // 🚀 MICRO-BATCHING SUPPORT: Limits of each batch delivered by the dispatcher,
+        // from IOC_DatUsageArgs_T::Batch with defaults applied.
         struct {
-            char LastSentData[1024];       // Cache of last sent data
-            size_t LastSentDataSize;       // Size of last sent data
-            bool HasRecentlySentData;      // Whether data was recently sent
-            struct timespec LastSentTime;  // Timestamp of last send operation
-        } LastSentCache;
+            ULONG_T MaxDatNum;
+            ULONG_T MaxDatBytes;
+            ULONG_T MaxDelayUS;
+            bool IsJoinData;
+        } BatchArgs;
 
         // 📦 POLLING MODE SUPPORT: Buffer for storing data when no callback is registered
-        // This enables hybrid mode - data can be delivered via callback OR stored for polling
+        // Data is delivered via callback OR stored for polling, never both, so callback sends copy nothing here
         struct {
-            char* pDataBuffer;                 // Circular buffer for received data
-            size_t BufferSize;                 // Total buffer size (allocated)
-            size_t DataStart;                  // Start position of valid data (read pointer)
-            size_t DataEnd;                    // End position of valid data (write pointer)
-            size_t AvailableData;              // Amount of valid data in buffer
-            pthread_cond_t DataAvailableCond;  // Condition variable for blocking reads
-            bool IsPollingMode;                // True if receiver is in polling mode (no callback)
+            _IOC_DatRing_T Ring;  // Sender pushes and IOC_recvDAT reads without sharing a lock
+            bool IsPollingMode;   // True if receiver is in polling mode (no callback)
         } PollingBuffer;
+
+        // 🧵 ASYNC DISPATCH: One long-lived thread per receiver runs CbRecvDat_F in send order,
+        // started by the first blocking send, stopped and joined in closeLink.
+        _IOC_ProtoFifoDatDispatcher_pT pDispatcher;
     } DatReceiver;
 
     // 🎯 EVENT POLLING SUPPORT: Queue for polling-based event consumption using IOC_pullEVT
@@ -205,52 +203,107 @@ typedef struct {
     pthread_mutex_t WaitNewConnMutex;
     pthread_cond_t WaitNewConnCond;
 
+    // COPY of UsageArgs.pDat->PollingBufSize when online, because acceptClient may run after pDat is gone.
+    ULONG_T DatPollingBufSize;
 } _IOC_ProtoFifoServiceObject_T, *_IOC_ProtoFifoServiceObject_pT;
 
 #define _MAX_PROTO_FIFO_SERVICES 16
-#define _PROTO_FIFO_POLLING_BUFFER_SIZE (64 * 1024)  // 64KB buffer for polling mode
-#define _PROTO_FIFO_SEND_QUEUE_SIZE (16 * 1024)      // 16KB buffer for send batching
+#define _PROTO_FIFO_DAT_BATCH_MAX_NUM 256
+#define _PROTO_FIFO_DAT_BATCH_DEFAULT_MAX_NUM 64
+#define _PROTO_FIFO_DAT_BATCH_DEFAULT_MAX_BYTES (64 * 1024)
+#define _PROTO_FIFO_DAT_JOIN_MAX_BYTES (16 * 1024)  // largest data joined from a batch for CbRecvDat_F
+#define _PROTO_FIFO_DAT_DISPATCHER_MAX_FREE_NUM 256  // most recycled contexts kept in a dispatcher's FreeList
 static _IOC_ProtoFifoServiceObject_pT _mIOC_OnlinedSrvProtoFifoObjs[_MAX_PROTO_FIFO_SERVICES] = {};
 static pthread_mutex_t _mIOC_OnlinedSrvProtoFifoObjsMutex = PTHREAD_MUTEX_INITIALIZER;
 
 // Forward declarations for DAT support functions
 static IOC_Result_T __IOC_setupDatReceiver_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, _IOC_ServiceObject_pT pSrvObj);
-static IOC_Result_T __IOC_initPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
+static void __IOC_setDatReceiverArgs_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                 const IOC_DatUsageArgs_pT pDatUsageArgs);
+static IOC_Result_T __IOC_initPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                        ULONG_T PollingBufSize);
 static void __IOC_cleanupPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
 static IOC_Result_T __IOC_storeDataInPollingBuffer(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, const void* pData,
                                                    size_t DataSize);
-static IOC_Result_T __IOC_readDataFromPollingBuffer(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, void* pBuffer,
-                                                    size_t BufferSize, size_t* pBytesRead, bool IsBlocking);
 static IOC_Result_T __IOC_readDataFromPollingBufferWithTimeout(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, void* pBuffer,
                                                                size_t BufferSize, size_t* pBytesRead,
                                                                long long TimeoutUS);
-
-// Forward declarations for send queue/batching functions
-static IOC_Result_T __IOC_initCallbackBatch_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
-static void __IOC_cleanupCallbackBatch_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
-static IOC_Result_T __IOC_addDataToBatch(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, const void* pData, size_t DataSize);
-static IOC_Result_T __IOC_flushCallbackBatch(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
-
-// Time-window batching helper functions
-static long __IOC_getElapsedTimeMs(const struct timespec* start, const struct timespec* end);
-static bool __IOC_isBatchWindowExpired(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
-static void __IOC_closeBatchWindow(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
-static bool __IOC_shouldOpenBatchWindow(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, long callbackDurationMs);
+static void __IOC_returnDatCredit_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
 
 // Async callback dispatch helper
-typedef struct {
-    IOC_CbRecvDat_F Callback;
-    IOC_LinkID_T LinkID;
+typedef struct __AsyncCallbackContextStru {
     IOC_DatDesc_T DatDesc;
-    void* pPrivData;
-    struct timespec StartTime;
-    _IOC_ProtoFifoLinkObject_pT pFifoLink;
+    struct timespec SendTime;  // a batch waits at most BatchArgs.MaxDelayUS since its first chunk's SendTime
+
+    struct __AsyncCallbackContextStru* pNext;  // in PendingList or FreeList of the dispatcher
+    void* pPayloadBuf;                         // owned, grow-only, reused when recycled
+    size_t PayloadBufSize;
+
+    _IOC_DatCompleter_T Completer;  // armed if sent with IOC_OPTID_DAT_COMPLETION, completed after its callback
+    IOC_Result_T RecvResult;        // returned by the callback which got its data, LINK_BROKEN if dropped
 } __AsyncCallbackContext_T;
 
-static void* __IOC_asyncCallbackThreadFunc(void* pArg);
+/**
+ * @brief Per-receiver dispatcher of CbRecvDat_F, which replaced one detached thread per send.
+ *    DatSenders append contexts to PendingList, the dispatcher thread pops and callbacks them in order,
+ *    then recycles them with their payload buffers into FreeList, so steady sending costs no malloc.
+ *    PendingList is bounded by the receiver's Credit, but a send from any dispatcher thread overdraws it
+ *    instead of waiting, so circular send chains (A's CbRecvDat_F sends to B, B's sends back to A) never deadlock.
+ *
+ *    The dispatcher pops contexts in batches within the receiver's BatchArgs, and delivers each batch by ONE
+ *    CbRecvDatBatch_F, or by CbRecvDat_F of each chunk, or of the batch's data joined if BatchArgs.IsJoinData,
+ *    so a burst of small data costs one callback.
+ *    If BatchArgs.MaxDelayUS > 0, it waits for TargetBatchDatNum chunks until MaxDelayUS after the first is sent,
+ *    and DatSenders wake it only on the first chunk and on reaching TargetBatchDatNum, not on each chunk.
+ *    TargetBatchDatNum is adapted to CostPerDatNS, so a batch's callback takes about half of MaxDelayUS,
+ *    which bounds the latency to about MaxDelayUS * 1.5, cheap callbacks get large batches and slow ones small.
+ */
+struct _IOC_ProtoFifoDatDispatcherStru {
+    pthread_mutex_t Mutex;
+    pthread_cond_t NotEmptyCond;  // dispatcher waits for pending contexts
+    pthread_cond_t LeaveCond;     // closeLink waits for DatSenders to leave
+    pthread_cond_t DeliveredCond;  // flushDAT waits for DeliveredDatSeq
+    pthread_t ThreadID;
+
+    bool IsStopping;
+    _IOC_ProtoFifoLinkObject_pT pFifoLink;  // NULL if closeLink from its own CbRecvDat_F, then thread frees all
+    ULONG_T EnqueuingNum;                   // DatSenders in __IOC_enqueueDatToDispatcher_ofProtoFifo or flushDAT
+
+    __AsyncCallbackContext_T *pPendingHead, *pPendingTail;
+    __AsyncCallbackContext_T* pFreeList;
+    ULONG_T FreeNum;
+
+    ULONG_T QueuedDatNum, HighWatermark, DispatchedDatNum;
+
+    // Receiver's callbacks and batch limits, copied when the dispatcher is created
+    IOC_LinkID_T LinkID;
+    IOC_CbRecvDat_F CbRecvDat_F;
+    IOC_CbRecvDatBatch_F CbRecvDatBatch_F;
+    void* pCbPrivData;
+    ULONG_T MaxBatchDatNum, MaxBatchDatBytes, MaxBatchDelayUS;
+    bool IsJoinData;
+
+    IOC_DatDesc_T* pBatchDatDescs;  // MaxBatchDatNum descriptors passed to CbRecvDatBatch_F
+    void* pJoinBuf;                 // grow-only, joins a batch's data for CbRecvDat_F
+    size_t JoinBufSize;
+
+    ULONG_T QueuedDatSeq, PoppedDatSeq;  // chunks ever queued and popped
+    ULONG_T DeliveredDatSeq;             // chunks ever popped and delivered to callbacks, or dropped by closeLink
+    ULONG_T FlushedDatSeq;               // set to QueuedDatSeq by flushDAT, chunks till it never wait for a batch
+    ULONG_T TargetBatchDatNum;  // adaptive, in [1, MaxBatchDatNum]
+    ULONG_T CostPerDatNS;       // moving average of callback cost per chunk
+    ULONG_T DispatchedBatchNum;
+};
+
+static IOC_Result_T __IOC_enqueueDatToDispatcher_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                             const IOC_DatDesc_pT pDatDesc,
+                                                             _IOC_DatCompleter_pT pCompleter);
+static void __IOC_stopDatDispatcher_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj);
 
-// External interface for IOC_flushDAT support
-IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption);
+// Set in dispatcher threads, whose sends overdraw credits instead of waiting to keep circular send chains deadlock-free
+static _Thread_local bool _mIsInDatDispatcherThread = false;
+
+static IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption);
 
 static _IOC_ProtoFifoServiceObject_pT __IOC_getSrvProtoObjBySrvURI(const IOC_SrvURI_pT pSrvURI) {
     for (int i = 0; i < _MAX_PROTO_FIFO_SERVICES; i++) {
@@ -299,6 +352,10 @@ static IOC_Result_T __IOC_onlineService_ofProtoFifo(_IOC_ServiceObject_pT pSrvOb
         pthread_cond_init(&pFifoSrvObj->WaitAccptedCond, NULL);
         pthread_mutex_init(&pFifoSrvObj->WaitNewConnMutex, NULL);
         pthread_cond_init(&pFifoSrvObj->WaitNewConnCond, NULL);
+
+        if ((pSrvObj->Args.UsageCapabilites & IOC_LinkUsageDatReceiver) && pSrvObj->Args.UsageArgs.pDat) {
+            pFifoSrvObj->DatPollingBufSize = pSrvObj->Args.UsageArgs.pDat->PollingBufSize;
+        }
     }
 
     // Step-3: Save the ProtoFifoServiceObject
@@ -400,8 +457,8 @@ static IOC_Result_T __IOC_connectService_ofProtoFifo(_IOC_LinkObject_pT pLinkObj
         _IOC_LogDebug("Service in auto-accept mode, connection will be accepted automatically");
     }
 
-    // Step-3: Create a FifoLinkObj
-    _IOC_ProtoFifoLinkObject_pT pFifoLinkObj = calloc(1, sizeof(_IOC_ProtoFifoLinkObject_T));
+    // Step-3: Create a FifoLinkObj, aligned to a cache line as both its DatRing and EvtPollingQueue need
+    _IOC_ProtoFifoLinkObject_pT pFifoLinkObj = _IOC_DatRing_callocEmbedder(sizeof(_IOC_ProtoFifoLinkObject_T));
     if (NULL == pFifoLinkObj) {
         _IOC_LogBug("Failed to alloc a new FifoLinkObj when connect service");
         _IOC_LogNotTested();
@@ -410,6 +467,8 @@ static IOC_Result_T __IOC_connectService_ofProtoFifo(_IOC_LinkObject_pT pLinkObj
 
     pthread_mutex_init(&pFifoLinkObj->Mutex, NULL);
     pFifoLinkObj->pOwnerLinkObj = pLinkObj;  // TDD FIX: Store reference to owning LinkObject
+    _IOC_SnapshotPtr_initOne(&pFifoLinkObj->SubEvtArgs);
+    pthread_mutex_init(&pFifoLinkObj->SubEvtMutex, NULL);
 
     // Initialize event polling queue for IOC_pullEVT support
     _IOC_EvtDescQueue_initOne(&pFifoLinkObj->EvtPollingQueue);
@@ -428,22 +487,16 @@ static IOC_Result_T __IOC_connectService_ofProtoFifo(_IOC_LinkObject_pT pLinkObj
     memset(pFifoLinkObj->CmdPolling.QueuedRespDescs, 0, sizeof(pFifoLinkObj->CmdPolling.QueuedRespDescs));
 
     // Initialize polling buffer for potential DAT operations
-    IOC_Result_T BufferResult = __IOC_initPollingBuffer_ofProtoFifo(pFifoLinkObj);
+    ULONG_T PollingBufSize = ((pConnArgs->Usage & IOC_LinkUsageDatReceiver) && pConnArgs->UsageArgs.pDat)
+                                 ? pConnArgs->UsageArgs.pDat->PollingBufSize
+                                 : 0;
+    IOC_Result_T BufferResult = __IOC_initPollingBuffer_ofProtoFifo(pFifoLinkObj, PollingBufSize);
     if (BufferResult != IOC_RESULT_SUCCESS) {
         free(pFifoLinkObj);
         _IOC_LogBug("Failed to initialize polling buffer for FifoLinkObj");
         return BufferResult;
     }
 
-    // Initialize send queue for batching support
-    IOC_Result_T QueueResult = __IOC_initCallbackBatch_ofProtoFifo(pFifoLinkObj);
-    if (QueueResult != IOC_RESULT_SUCCESS) {
-        __IOC_cleanupPollingBuffer_ofProtoFifo(pFifoLinkObj);
-        free(pFifoLinkObj);
-        _IOC_LogBug("Failed to initialize micro batch for FifoLinkObj");
-        return QueueResult;
-    }
-
     pLinkObj->pProtoPriv = pFifoLinkObj;
 
     // Step-4: Lock the connection accepting process
@@ -467,7 +520,8 @@ static IOC_Result_T __IOC_connectService_ofProtoFifo(_IOC_LinkObject_pT pLinkObj
 
         // Clean up the rejected link object
         __IOC_cleanupPollingBuffer_ofProtoFifo(pFifoLinkObj);
-        __IOC_cleanupCallbackBatch_ofProtoFifo(pFifoLinkObj);
+        _IOC_SnapshotPtr_deinitOne(&pFifoLinkObj->SubEvtArgs);
+        pthread_mutex_destroy(&pFifoLinkObj->SubEvtMutex);
         pthread_mutex_destroy(&pFifoLinkObj->Mutex);
         free(pFifoLinkObj);
         pLinkObj->pProtoPriv = NULL;
@@ -513,7 +567,8 @@ static IOC_Result_T __IOC_acceptClient_ofProtoFifo(_IOC_ServiceObject_pT pSrvObj
     //...
 
     // Step-2: create a new FifoLinkObj
-    _IOC_ProtoFifoLinkObject_pT pAceptedFifoLinkObj = calloc(1, sizeof(_IOC_ProtoFifoLinkObject_T));
+    _IOC_ProtoFifoLinkObject_pT pAceptedFifoLinkObj =
+        _IOC_DatRing_callocEmbedder(sizeof(_IOC_ProtoFifoLinkObject_T));
     if (NULL == pAceptedFifoLinkObj) {
         _IOC_LogBug("Failed to alloc a new FifoLinkObj when accept client");
         _IOC_LogNotTested();
@@ -522,6 +577,8 @@ static IOC_Result_T __IOC_acceptClient_ofProtoFifo(_IOC_ServiceObject_pT pSrvObj
 
     pthread_mutex_init(&pAceptedFifoLinkObj->Mutex, NULL);
     pAceptedFifoLinkObj->pOwnerLinkObj = pLinkObj;  // TDD FIX: Store reference to owning LinkObject
+    _IOC_SnapshotPtr_initOne(&pAceptedFifoLinkObj->SubEvtArgs);
+    pthread_mutex_init(&pAceptedFifoLinkObj->SubEvtMutex, NULL);
 
     // Initialize event polling queue for IOC_pullEVT support
     _IOC_EvtDescQueue_initOne(&pAceptedFifoLinkObj->EvtPollingQueue);
@@ -540,26 +597,18 @@ static IOC_Result_T __IOC_acceptClient_ofProtoFifo(_IOC_ServiceObject_pT pSrvObj
     memset(pAceptedFifoLinkObj->CmdPolling.QueuedRespDescs, 0, sizeof(pAceptedFifoLinkObj->CmdPolling.QueuedRespDescs));
 
     // Initialize polling buffer for potential DAT operations
-    IOC_Result_T BufferResult = __IOC_initPollingBuffer_ofProtoFifo(pAceptedFifoLinkObj);
+    _IOC_ProtoFifoServiceObject_pT pFifoSrvObj = (_IOC_ProtoFifoServiceObject_pT)pSrvObj->pProtoPriv;
+    IOC_Result_T BufferResult =
+        __IOC_initPollingBuffer_ofProtoFifo(pAceptedFifoLinkObj, pFifoSrvObj->DatPollingBufSize);
     if (BufferResult != IOC_RESULT_SUCCESS) {
         free(pAceptedFifoLinkObj);
         _IOC_LogBug("Failed to initialize polling buffer for accepted FifoLinkObj");
         return BufferResult;
     }
 
-    // Initialize send queue for batching support
-    IOC_Result_T QueueResult = __IOC_initCallbackBatch_ofProtoFifo(pAceptedFifoLinkObj);
-    if (QueueResult != IOC_RESULT_SUCCESS) {
-        __IOC_cleanupPollingBuffer_ofProtoFifo(pAceptedFifoLinkObj);
-        free(pAceptedFifoLinkObj);
-        _IOC_LogBug("Failed to initialize micro batch for accepted FifoLinkObj");
-        return QueueResult;
-    }
-
     pLinkObj->pProtoPriv = pAceptedFifoLinkObj;
 
     // Step-3: IF new incoming connection is waiting, then accept it immediately, ELSE wait for it.
-    _IOC_ProtoFifoServiceObject_pT pFifoSrvObj = (_IOC_ProtoFifoServiceObject_pT)pSrvObj->pProtoPriv;
 
     // TDD FIX: Respect timeout from pOption
     struct timespec StartTime, CurrentTime;
@@ -633,12 +682,7 @@ static IOC_Result_T __IOC_acceptClient_ofProtoFifo(_IOC_ServiceObject_pT pSrvObj
 
                 if (pClientFifoLinkObj) {
                     pthread_mutex_lock(&pClientFifoLinkObj->Mutex);
-                    pClientFifoLinkObj->DatReceiver.CbRecvDat_F = pClientLinkObj->Args.UsageArgs.pDat->CbRecvDat_F;
-                    pClientFifoLinkObj->DatReceiver.pCbPrivData = pClientLinkObj->Args.UsageArgs.pDat->pCbPrivData;
-                    pClientFifoLinkObj->DatReceiver.IsReceiverRegistered =
-                        (pClientFifoLinkObj->DatReceiver.CbRecvDat_F != NULL);
-                    pClientFifoLinkObj->DatReceiver.IsProcessingCallback = false;  // Initialize callback state
-                    pClientFifoLinkObj->DatReceiver.PendingDataCount = 0;          // Initialize pending data count
+                    __IOC_setDatReceiverArgs_ofProtoFifo(pClientFifoLinkObj, pClientLinkObj->Args.UsageArgs.pDat);
                     pthread_mutex_unlock(&pClientFifoLinkObj->Mutex);
                 }
             }
@@ -666,7 +710,6 @@ static IOC_Result_T __IOC_acceptClient_ofProtoFifo(_IOC_ServiceObject_pT pSrvObj
             if (ElapsedUS >= TimeoutUS) {
                 // Timeout expired, cleanup and return timeout error
                 __IOC_cleanupPollingBuffer_ofProtoFifo(pAceptedFifoLinkObj);
-                __IOC_cleanupCallbackBatch_ofProtoFifo(pAceptedFifoLinkObj);
                 free(pAceptedFifoLinkObj);
                 pLinkObj->pProtoPriv = NULL;
                 _IOC_LogWarn("IOC_acceptClient timed out after %lu us", ElapsedUS);
@@ -710,12 +753,18 @@ static IOC_Result_T __IOC_closeLink_ofProtoFifo(_IOC_LinkObject_pT pLinkObj) {
 
     _IOC_LogAssert(NULL == pFifoLinkObj->pPeer);
 
-    // Clean up send queue before freeing the link object
-    __IOC_cleanupCallbackBatch_ofProtoFifo(pFifoLinkObj);
+    // Wake DatSenders waiting for credits, then execute callbacks already queued to this receiver,
+    //  before the link object is freed
+    _IOC_DatCredit_close(&pFifoLinkObj->DatReceiver.Credit);
+    __IOC_stopDatDispatcher_ofProtoFifo(pFifoLinkObj);
 
     // Clean up polling buffer before freeing the link object
     __IOC_cleanupPollingBuffer_ofProtoFifo(pFifoLinkObj);
 
+    // Wait peer's postEvt who is still using SubEvtArgs to leave, then free it
+    _IOC_SnapshotPtr_deinitOne(&pFifoLinkObj->SubEvtArgs);
+    pthread_mutex_destroy(&pFifoLinkObj->SubEvtMutex);
+
     // Clean up event polling queue before freeing the link object
     _IOC_EvtDescQueue_deinitOne(&pFifoLinkObj->EvtPollingQueue);
 
@@ -733,10 +782,9 @@ static IOC_Result_T __IOC_closeLink_ofProtoFifo(_IOC_LinkObject_pT pLinkObj) {
 /**
  * @brief Handles sub-events for the Proto FIFO link object.
  *
- * This function processes sub-event arguments by copying them into the
- * Proto FIFO link object's internal state. It allocates memory for
- * event IDs based on the number of events specified and copies the
- * provided event IDs into the allocated space.
+ * This function copies sub-event arguments and event IDs into a new immutable snapshot,
+ * and publishes it as the link object's SubEvtArgs, which replaces the previous one if any.
+ * Peer's postEvt is never blocked, and the previous snapshot is freed after its readers leave.
  *
  * @param pLinkObj Pointer to the link object containing protocol-specific data.
  * @param pSubEvtArgs Pointer to the sub-event arguments containing event details.
@@ -745,10 +793,20 @@ static IOC_Result_T __IOC_closeLink_ofProtoFifo(_IOC_LinkObject_pT pLinkObj) {
 static IOC_Result_T __IOC_subEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_SubEvtArgs_pT pSubEvtArgs) {
     _IOC_ProtoFifoLinkObject_pT pLinkFifoObj = (_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv;
 
-    memcpy(&pLinkFifoObj->SubEvtArgs, pSubEvtArgs, sizeof(IOC_SubEvtArgs_T));
+    _IOC_ProtoFifoSubEvtArgs_pT pNewSubEvtArgs = (_IOC_ProtoFifoSubEvtArgs_pT)calloc(
+        1, sizeof(_IOC_ProtoFifoSubEvtArgs_T) + pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
+    if (NULL == pNewSubEvtArgs) {
+        _IOC_LogError("Failed to alloc SubEvtArgs(EvtNum=%lu)", (ULONG_T)pSubEvtArgs->EvtNum);
+        return IOC_RESULT_POSIX_ENOMEM;
+    }
+
+    memcpy(&pNewSubEvtArgs->SubEvtArgs, pSubEvtArgs, sizeof(IOC_SubEvtArgs_T));
+    pNewSubEvtArgs->SubEvtArgs.pEvtIDs = pNewSubEvtArgs->EvtIDs;
+    memcpy(pNewSubEvtArgs->EvtIDs, pSubEvtArgs->pEvtIDs, pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
 
-    pLinkFifoObj->SubEvtArgs.pEvtIDs = (IOC_EvtID_T*)malloc(pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
-    memcpy(pLinkFifoObj->SubEvtArgs.pEvtIDs, pSubEvtArgs->pEvtIDs, pSubEvtArgs->EvtNum * sizeof(IOC_EvtID_T));
+    pthread_mutex_lock(&pLinkFifoObj->SubEvtMutex);
+    _IOC_SnapshotPtr_publish(&pLinkFifoObj->SubEvtArgs, &pNewSubEvtArgs->SnapshotHdr);
+    pthread_mutex_unlock(&pLinkFifoObj->SubEvtMutex);
 
     //_IOC_LogNotTested();
     return IOC_RESULT_SUCCESS;
@@ -758,8 +816,8 @@ static IOC_Result_T __IOC_subEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const
  * @brief Unsubscribes an event from the protocol FIFO associated with the given link object.
  *
  * This function compares the provided callback function and private data with the currently
- * subscribed event arguments in the protocol FIFO link object. If a match is found, it frees
- * the allocated event IDs, resets the subscription arguments, and returns a success result.
+ * subscribed event arguments in the protocol FIFO link object. If a match is found, it publishes
+ * an empty subscription, retires the previous snapshot, and returns a success result.
  * If no matching subscription is found, it logs the event and returns a not exist result.
  *
  * @param pLinkObj       Pointer to the link object containing the protocol FIFO.
@@ -772,14 +830,19 @@ static IOC_Result_T __IOC_subEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const
 static IOC_Result_T __IOC_unsubEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_UnsubEvtArgs_pT pUnsubEvtArgs) {
     _IOC_ProtoFifoLinkObject_pT pLinkFifoObj = (_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv;
 
-    if (pLinkFifoObj->SubEvtArgs.CbProcEvt_F == pUnsubEvtArgs->CbProcEvt_F &&
-        pLinkFifoObj->SubEvtArgs.pCbPrivData == pUnsubEvtArgs->pCbPrivData) {
-        free(pLinkFifoObj->SubEvtArgs.pEvtIDs);
-        memset(&pLinkFifoObj->SubEvtArgs, 0, sizeof(IOC_SubEvtArgs_T));
+    pthread_mutex_lock(&pLinkFifoObj->SubEvtMutex);
+    _IOC_ProtoFifoSubEvtArgs_pT pCurSubEvtArgs =
+        (_IOC_ProtoFifoSubEvtArgs_pT)_IOC_SnapshotPtr_getForWriter(&pLinkFifoObj->SubEvtArgs);
+
+    if (NULL != pCurSubEvtArgs && pCurSubEvtArgs->SubEvtArgs.CbProcEvt_F == pUnsubEvtArgs->CbProcEvt_F &&
+        pCurSubEvtArgs->SubEvtArgs.pCbPrivData == pUnsubEvtArgs->pCbPrivData) {
+        _IOC_SnapshotPtr_publish(&pLinkFifoObj->SubEvtArgs, NULL);
+        pthread_mutex_unlock(&pLinkFifoObj->SubEvtMutex);
 
         //_IOC_LogNotTested();
         return IOC_RESULT_SUCCESS;
     }
+    pthread_mutex_unlock(&pLinkFifoObj->SubEvtMutex);
 
     _IOC_LogNotTested();
     return IOC_RESULT_NOT_EXIST;
@@ -787,8 +850,11 @@ static IOC_Result_T __IOC_unsubEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, cons
 /**
  * @brief Posts an event to the Protocol FIFO.
  *
- * This function handles the posting of an event to the protocol FIFO by locking the necessary mutexes,
+ * This function handles the posting of an event to the protocol FIFO by reading the peer's SubEvtArgs snapshot,
  * checking for subscribed event consumers, and invoking their callback functions if the event ID matches.
+ * The local Mutex is only taken to enter reading pPeer's SubEvtArgs, which pins pPeer because its closeLink
+ * waits readers to leave before freeing it, then callbacks run without any Mutex. Peer's Mutex is never taken,
+ * so peer's subEvt/unsubEvt/closeLink and peer's own posting never block this posting.
  *
  * @param pLinkObj Pointer to the link object associated with the Protocol FIFO.
  * @param pEvtDesc Pointer to the event descriptor containing event details.
@@ -797,6 +863,8 @@ static IOC_Result_T __IOC_unsubEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, cons
  * @return IOC_Result_T
  *         - IOC_RESULT_SUCCESS: Event was successfully processed by at least one consumer.
  *         - IOC_RESULT_NO_EVENT_CONSUMER: No consumers were available for the event.
+ *         - IOC_RESULT_TOO_MANY_QUEUING_EVTDESC: Peer's polling queue is full, the event is dropped.
+ *         - IOC_RESULT_POSIX_ENOMEM: Peer's polling queue failed to conflate the event.
  *         - IOC_RESULT_BUG: An unexpected error occurred.
  */
 
@@ -806,35 +874,58 @@ static IOC_Result_T __IOC_postEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const
     IOC_Result_T Result = IOC_RESULT_BUG;
     int ProcEvtSuberCnt = 0;
 
+    IOC_Result_T EnqueueResult = IOC_RESULT_SUCCESS;  // of the polling queue, if no callback
+    ULONG_T Epoch = 0;
+    _IOC_ProtoFifoSubEvtArgs_pT pPeerSubEvtArgs = NULL;
+
     pthread_mutex_lock(&pLocalFifoLinkObj->Mutex);
     _IOC_ProtoFifoLinkObject_pT pPeerFifoLinkObj = pLocalFifoLinkObj->pPeer;
+    if (NULL != pPeerFifoLinkObj) {
+        pPeerSubEvtArgs =
+            (_IOC_ProtoFifoSubEvtArgs_pT)_IOC_SnapshotPtr_enterRead(&pPeerFifoLinkObj->SubEvtArgs, &Epoch);
+    }
+    pthread_mutex_unlock(&pLocalFifoLinkObj->Mutex);
 
     if (NULL != pPeerFifoLinkObj) {
-        pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
-        IOC_CbProcEvt_F CbProcEvt_F = pPeerFifoLinkObj->SubEvtArgs.CbProcEvt_F;
-
-        if (NULL != CbProcEvt_F) {
-            for (int i = 0; i < pPeerFifoLinkObj->SubEvtArgs.EvtNum; i++) {
-                if (pEvtDesc->EvtID == pPeerFifoLinkObj->SubEvtArgs.pEvtIDs[i]) {
-                    CbProcEvt_F(pEvtDesc, pPeerFifoLinkObj->SubEvtArgs.pCbPrivData);
-                    ProcEvtSuberCnt++;
+        if (NULL != pPeerSubEvtArgs) {
+            IOC_SubEvtArgs_pT pSubEvtArgs = &pPeerSubEvtArgs->SubEvtArgs;
+            IOC_CbProcEvt_F CbProcEvt_F = pSubEvtArgs->CbProcEvt_F;
+
+            if (NULL != CbProcEvt_F) {
+                for (int i = 0; i < pSubEvtArgs->EvtNum; i++) {
+                    if (pEvtDesc->EvtID == pSubEvtArgs->pEvtIDs[i]) {
+                        CbProcEvt_F(pEvtDesc, pSubEvtArgs->pCbPrivData);
+                        ProcEvtSuberCnt++;
+                    }
                 }
-            }
-        } else {
-            // No callback, enqueue to polling queue for subscribed events
-            for (int i = 0; i < pPeerFifoLinkObj->SubEvtArgs.EvtNum; i++) {
-                if (pEvtDesc->EvtID == pPeerFifoLinkObj->SubEvtArgs.pEvtIDs[i]) {
-                    _IOC_EvtDescQueue_enqueueElementLast(&pPeerFifoLinkObj->EvtPollingQueue, pEvtDesc);
-                    ProcEvtSuberCnt++;
-                    break;  // Only enqueue once per event
+            } else {
+                // No callback, enqueue to polling queue for subscribed events
+                for (int i = 0; i < pSubEvtArgs->EvtNum; i++) {
+                    if (pEvtDesc->EvtID == pSubEvtArgs->pEvtIDs[i]) {
+                        if (IOC_Option_isConflateMode(pOption) == IOC_RESULT_YES) {
+                            // Only the latest value of this EvtID is kept pending for the polling consumer
+                            ULONG_T EnqueuedNum = 0;
+                            EnqueueResult = _IOC_EvtDescQueue_enqueueElementsLastConflating(
+                                &pPeerFifoLinkObj->EvtPollingQueue, pEvtDesc, 1, &EnqueuedNum);
+                        } else {
+                            EnqueueResult =
+                                _IOC_EvtDescQueue_enqueueElementLast(&pPeerFifoLinkObj->EvtPollingQueue, pEvtDesc);
+                        }
+
+                        if (IOC_RESULT_SUCCESS == EnqueueResult) {
+                            ProcEvtSuberCnt++;
+                        }
+                        break;  // Only enqueue once per event
+                    }
                 }
             }
         }
-        pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
+        _IOC_SnapshotPtr_leaveRead(&pPeerFifoLinkObj->SubEvtArgs, Epoch);
     }
-    pthread_mutex_unlock(&pLocalFifoLinkObj->Mutex);
 
-    if (ProcEvtSuberCnt > 0) {
+    if (IOC_RESULT_SUCCESS != EnqueueResult) {
+        Result = EnqueueResult;  // polling queue is full, the event is neither queued nor conflated
+    } else if (ProcEvtSuberCnt > 0) {
         Result = IOC_RESULT_SUCCESS;
     } else {
         Result = IOC_RESULT_NO_EVENT_CONSUMER;
@@ -881,10 +972,10 @@ static IOC_Result_T __IOC_pullEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_E
     // Enable polling mode on first use
     pthread_mutex_lock(&pFifoLinkObj->Mutex);
     pFifoLinkObj->IsEvtPollingActive = true;
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
-    // Try to dequeue an event from the polling queue
+    // Try to dequeue an event from the polling queue, which is lock-free and needs no LinkObj's Mutex
     IOC_Result_T QueueResult = _IOC_EvtDescQueue_dequeueElementFirst(&pFifoLinkObj->EvtPollingQueue, pEvtDesc);
-    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
     if (QueueResult == IOC_RESULT_SUCCESS) {
         return IOC_RESULT_SUCCESS;
@@ -901,9 +992,7 @@ static IOC_Result_T __IOC_pullEvt_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_E
                 // Small sleep before retrying
                 usleep(1000);  // 1ms
 
-                pthread_mutex_lock(&pFifoLinkObj->Mutex);
                 QueueResult = _IOC_EvtDescQueue_dequeueElementFirst(&pFifoLinkObj->EvtPollingQueue, pEvtDesc);
-                pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
                 if (QueueResult == IOC_RESULT_SUCCESS) {
                     return IOC_RESULT_SUCCESS;
@@ -986,50 +1075,11 @@ static IOC_Result_T __IOC_sendData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, cons
     // calling the callback to avoid holding locks during user code execution.
     pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
 
-    IOC_CbRecvDat_F CbRecvDat_F = pPeerFifoLinkObj->DatReceiver.CbRecvDat_F;
-    void* pCbPrivData = pPeerFifoLinkObj->DatReceiver.pCbPrivData;
     bool IsReceiverRegistered = pPeerFifoLinkObj->DatReceiver.IsReceiverRegistered;
-    bool IsCallbackBusy = pPeerFifoLinkObj->DatReceiver.IsProcessingCallback;
     pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
 
     pthread_mutex_unlock(&pLocalFifoLinkObj->Mutex);
 
-    // 🚀 TIME-WINDOW BATCHING LOGIC: Check if we're in an active batching window
-    // Close expired windows and attempt to batch data during active windows
-    pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-    bool IsBatchWindowOpen = pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen;
-    bool IsWindowExpired = __IOC_isBatchWindowExpired(pPeerFifoLinkObj);
-    pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-    // Close expired windows
-    if (IsBatchWindowOpen && IsWindowExpired) {
-        _IOC_LogDebug("⏰ Batch window expired, closing and flushing\n");
-        __IOC_closeBatchWindow(pPeerFifoLinkObj);
-        IsBatchWindowOpen = false;
-    }
-
-    // Try to add to batch if window is still open
-    if (IsBatchWindowOpen && IsReceiverRegistered && CbRecvDat_F) {
-        _IOC_LogDebug("🔄 Batch window open, queuing %zu bytes for batched delivery\n", pDatDesc->Payload.PtrDataSize);
-
-        IOC_Result_T QueueResult =
-            __IOC_addDataToBatch(pPeerFifoLinkObj, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
-
-        if (QueueResult == IOC_RESULT_SUCCESS) {
-            return IOC_RESULT_SUCCESS;  // Data queued successfully
-        } else if (QueueResult == IOC_RESULT_BUFFER_FULL) {
-            // Batch buffer is full - close window and flush, then deliver immediately
-            _IOC_LogDebug("📦 Batch buffer full, flushing and delivering immediately\n");
-            __IOC_closeBatchWindow(pPeerFifoLinkObj);
-            // Fall through to immediate delivery
-        } else if (QueueResult == IOC_RESULT_NOT_SUPPORT) {
-            // Window closed while we were trying to add - deliver immediately
-            // Fall through to immediate delivery
-        } else {
-            return QueueResult;  // Other error
-        }
-    }
-
     // ⚡ WHY IMMEDIATE DELIVERY: ProtoFifo implements zero-latency, zero-copy data transfer.
     // Unlike network protocols that buffer data, FIFO delivers directly to receiver callback.
     // This achieves maximum performance for intra-process communication.
@@ -1039,335 +1089,95 @@ static IOC_Result_T __IOC_sendData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, cons
     // - Direct callback = minimal latency
     // - Synchronous execution = simpler error handling
     // - Peer link pattern = bidirectional communication support
-    if (IsReceiverRegistered && CbRecvDat_F) {
-        // 🚀 TDD FIX: Check queue pressure BEFORE attempting delivery for both NonBlock and Zero timeout
-        if (IsTrueNonBlockMode || IsZeroTimeoutMode) {
-            pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
-
-            // Simulate queue size limit - if too many chunks are "pending", reject new ones
-            const int MAX_PENDING_CHUNKS = 1;  // Very small queue to trigger non-blocking behavior reliably
-            if (pPeerFifoLinkObj->DatReceiver.PendingDataCount >= MAX_PENDING_CHUNKS) {
-                pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
-
-                // 🎯 TDD REQUIREMENT: Return appropriate result based on mode
-                if (IsTrueNonBlockMode) {
-                    // True NonBlock mode → return BUFFER_FULL when buffer is full
-                    return IOC_RESULT_BUFFER_FULL;
-                } else {
-                    // Zero timeout mode → return TIMEOUT when would block
-                    return IOC_RESULT_TIMEOUT;
-                }
-            }
+    //
+    // 🎫 CREDIT-BASED FLOW CONTROL: Spend the peer receiver's credits before delivery, without any round trip.
+    // Only if they're used up, NonBlock returns BUFFER_FULL, Zero timeout returns TIMEOUT,
+    // and others wait for credits returned as the receiver consumes data, within their timeout.
+    // A polling receiver MAY never call IOC_recvDAT, so only a send with a timeout waits for its credits.
+    // Sends from a dispatcher thread(i.e. from a CbRecvDat_F) overdraw instead, to keep send chains deadlock-free.
+    _IOC_DatCredit_pT pPeerCredit = &pPeerFifoLinkObj->DatReceiver.Credit;
+    ULONG_T DataSize = pDatDesc->Payload.PtrDataSize;
+    if (_mIsInDatDispatcherThread) {
+        _IOC_DatCredit_overdraw(pPeerCredit, DataSize);
+    } else {
+        bool HasTimeout = pOption && (pOption->IDs & IOC_OPTID_TIMEOUT);
+        long long CreditTimeoutUS = -1;
+        if (IsTrueNonBlockMode || IsZeroTimeoutMode || (!HasTimeout && !IsReceiverRegistered)) {
+            CreditTimeoutUS = 0;
+        } else if (HasTimeout && pOption->Payload.TimeoutUS != IOC_TIMEOUT_INFINITE) {
+            CreditTimeoutUS = (long long)pOption->Payload.TimeoutUS;
+        }
 
-            // Accept this chunk - increment pending count BEFORE delivery
-            pPeerFifoLinkObj->DatReceiver.PendingDataCount++;
-            pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
+        IOC_Result_T CreditResult = _IOC_DatCredit_acquire(pPeerCredit, DataSize, CreditTimeoutUS);
+        if (CreditResult == IOC_RESULT_BUFFER_FULL) {
+            return IsZeroTimeoutMode ? IOC_RESULT_TIMEOUT : IOC_RESULT_BUFFER_FULL;
+        } else if (CreditResult != IOC_RESULT_SUCCESS) {
+            return CreditResult;
         }
+    }
+
+    // 📬 SEND COMPLETION: Completed with the receiver callback's result by the dispatcher after it returns,
+    // or at once if the result is known here, and cancelled if this send fails.
+    _IOC_DatCompleter_T Completer;
+    IOC_Result_T CompleterResult = _IOC_initDatCompleter(pLinkObj, pOption, DataSize, &Completer);
+    if (CompleterResult != IOC_RESULT_SUCCESS) {
+        _IOC_DatCredit_refund(pPeerCredit, DataSize);
+        return CompleterResult;
+    }
 
+    if (IsReceiverRegistered) {
         // Callback mode: deliver data via callback
         // 🔧 TDD FIX: Pass the receiver's LinkID (peer), not sender's LinkID (local)
         // The callback should be invoked with the LinkID that the receiver registered for
 
-        IOC_Result_T CallbackResult;
-
-        if (IsTrueNonBlockMode || IsZeroTimeoutMode) {
-            // 🎯 TDD REQUIREMENT: Different behavior for True NonBlock vs Zero timeout
-            if (IsTrueNonBlockMode) {
-                // True NonBlock mode: Execute callback and measure timing for batching
-
-                struct timespec callbackStart, callbackEnd;
-                clock_gettime(CLOCK_MONOTONIC, &callbackStart);
-
-                CallbackResult = CbRecvDat_F(pPeerFifoLinkObj->pOwnerLinkObj->ID, pDatDesc, pCbPrivData);
-
-                clock_gettime(CLOCK_MONOTONIC, &callbackEnd);
-                long callbackDurationMs = __IOC_getElapsedTimeMs(&callbackStart, &callbackEnd);
-
-                // Update timing and potentially open batching window
-                pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-                pPeerFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackStart = callbackStart;
-                pPeerFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackEnd = callbackEnd;
-
-                if (__IOC_shouldOpenBatchWindow(pPeerFifoLinkObj, callbackDurationMs)) {
-                    pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = true;
-                    pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart = callbackEnd;
-                    _IOC_LogDebug("🚀 NonBlock slow callback (%ld ms), opening batching window\n", callbackDurationMs);
-                }
-                pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-            } else {
-                // Zero timeout mode: Always return TIMEOUT for consistent semantics
-                // This provides predictable behavior for real-time applications
-                CallbackResult = IOC_RESULT_TIMEOUT;
-            }
-
-            // Simulate occasional queue draining - decrement pending count occasionally
-            // to prevent permanent queue "fullness"
-            static int drainCounter = 0;
-            drainCounter++;
-            if (drainCounter >= 5) {  // Every 5th call, simulate some queue draining
-                pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
-                if (pPeerFifoLinkObj->DatReceiver.PendingDataCount > 0) {
-                    pPeerFifoLinkObj->DatReceiver.PendingDataCount--;
-                }
-                pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
-                drainCounter = 0;
-            }
-
-        } else {
-            // Blocking mode: Implement time-window batching for slow send/slow receive scenarios
-
-            pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-            // First, check if any existing batch window has expired and should be flushed
-            struct timespec batchCheckTime;
-            clock_gettime(CLOCK_MONOTONIC, &batchCheckTime);
-
-            if (pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen) {
-                long windowElapsed = __IOC_getElapsedTimeMs(
-                    &pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart, &batchCheckTime);
-                if (windowElapsed >= pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs) {
-                    // Batch window expired - close it and prepare to flush if there's data
-                    pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = false;
-                    _IOC_LogDebug("⏰ Batch window expired (%ld ms), closing window\n", windowElapsed);
-
-                    if (pPeerFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize > 0) {
-                        pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-                        _IOC_LogDebug("📦 Flushing expired batch: %zu bytes\n",
-                                      pPeerFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize);
-                        __IOC_flushCallbackBatch(pPeerFifoLinkObj);
-                        pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-                    }
-                }
-            }
-
-            // 🚀 TIME-WINDOW BATCHING: Check multiple conditions for intelligent batching
-            bool IsCallbackCurrentlyRunning = pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsInCallback;
-            bool IsBatchWindowOpen = pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen;
-            bool HasPendingBatchData = pPeerFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize > 0;
-
-            // Calculate time since last callback for proactive batching
-            long timeSinceLastCallback =
-                __IOC_getElapsedTimeMs(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackEnd, &batchCheckTime);
-
-            // Enhanced batching logic: proactive burst detection + time windows
-            bool shouldBatch = false;
-
-            // 1. Always batch if callback is currently running
-            if (IsCallbackCurrentlyRunning) {
-                shouldBatch = true;
-            }
-            // 2. Always batch if window is explicitly open
-            else if (IsBatchWindowOpen) {
-                shouldBatch = true;
-            }
-            // 3. Proactive burst detection: if there's pending batch data, continue accumulating
-            else if (HasPendingBatchData &&
-                     timeSinceLastCallback < pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs) {
-                shouldBatch = true;
-            }
-            // 4. Aggressive batching: if last callback was recent (within 2x callback threshold), batch aggressively
-            else if (timeSinceLastCallback < 2 * pPeerFifoLinkObj->DatReceiver.CallbackBatch.SlowCallbackThresholdMs) {
-                shouldBatch = true;
-                // Open a proactive window
-                pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = true;
-                pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart = batchCheckTime;
-                _IOC_LogDebug("🚀 Proactive burst detection - opening aggressive batching window\n");
-            }
-
-            if (shouldBatch) {
-                _IOC_LogDebug("🔄 Batching %zu bytes (callback:%s, window:%s, recent:%s, pending:%zu)\n",
-                              pDatDesc->Payload.PtrDataSize, IsCallbackCurrentlyRunning ? "Y" : "N",
-                              IsBatchWindowOpen ? "Y" : "N",
-                              timeSinceLastCallback < pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs
-                                  ? "Y"
-                                  : "N",
-                              HasPendingBatchData);
-
-                IOC_Result_T QueueResult =
-                    __IOC_addDataToBatch(pPeerFifoLinkObj, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
-
-                // If this is the first batch item and no callback is running, start a batching timer
-                if (!IsCallbackCurrentlyRunning && !IsBatchWindowOpen && QueueResult == IOC_RESULT_SUCCESS) {
-                    pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = true;
-                    pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart = batchCheckTime;
-                    _IOC_LogDebug("🚀 Opening proactive batching window for %ld ms\n",
-                                  pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs);
-                }
-
-                pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-                if (QueueResult == IOC_RESULT_SUCCESS) {
-                    return IOC_RESULT_SUCCESS;  // Data queued for batching
-                } else if (QueueResult == IOC_RESULT_BUFFER_FULL) {
-                    // Batch buffer full, deliver what we have and continue with immediate delivery
-                    _IOC_LogDebug("📦 Batch buffer full, flushing and delivering immediately\n");
-                    __IOC_flushCallbackBatch(pPeerFifoLinkObj);
-                    // Fall through to immediate delivery
-                } else {
-                    return QueueResult;  // Other error
-                }
-            } else {
-                // Mark callback as starting
-                pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsInCallback = true;
-                pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-            }
-
-            // Record callback start time
-            struct timespec callbackStart, callbackEnd;
-            long callbackDurationMs = 0;  // Will be updated by sync/async paths
-            clock_gettime(CLOCK_MONOTONIC, &callbackStart);
-
-            pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-            pPeerFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackStart = callbackStart;
-            pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-            // 🔄 ASYNC CALLBACK DISPATCH: Prevent circular deadlock in callback chains
-            // Problem: If callback calls IOC_sendDAT, and that triggers another callback that calls IOC_sendDAT back,
-            // we get a circular wait: Send1→Callback1→Send2→Callback2→Send1 (DEADLOCK!)
-            //
-            // Solution: Dispatch callbacks asynchronously in detached thread
-            // - IOC_sendDAT returns immediately (non-blocking)
-            // - Callback executes in parallel
-            // - Circular chains become concurrent (no deadlock)
-            //
-            // Trade-off: Callback may execute after IOC_sendDAT returns (async semantics)
-            // Benefit: System NEVER deadlocks on circular callback chains
-
-            _IOC_LogDebug("📞 Dispatching receiver callback asynchronously for %zu bytes\n",
-                          pDatDesc->Payload.PtrDataSize);
-
-            // Allocate context for async callback (freed by callback thread)
-            __AsyncCallbackContext_T* pAsyncCtx = (__AsyncCallbackContext_T*)malloc(sizeof(__AsyncCallbackContext_T));
-            if (!pAsyncCtx) {
-                // Fallback to sync if allocation fails
-                CallbackResult = CbRecvDat_F(pPeerFifoLinkObj->pOwnerLinkObj->ID, pDatDesc, pCbPrivData);
-            } else {
-                pAsyncCtx->Callback = CbRecvDat_F;
-                pAsyncCtx->LinkID = pPeerFifoLinkObj->pOwnerLinkObj->ID;
-                pAsyncCtx->DatDesc = *pDatDesc;  // Copy descriptor
-
-                // Deep copy data payload to ensure lifetime
-                if (pDatDesc->Payload.PtrDataSize > 0 && pDatDesc->Payload.pData) {
-                    void* pDataCopy = malloc(pDatDesc->Payload.PtrDataSize);
-                    if (pDataCopy) {
-                        memcpy(pDataCopy, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
-                        pAsyncCtx->DatDesc.Payload.pData = pDataCopy;
-                    } else {
-                        // Allocation failed, cleanup and fallback to sync
-                        free(pAsyncCtx);
-                        CallbackResult = CbRecvDat_F(pPeerFifoLinkObj->pOwnerLinkObj->ID, pDatDesc, pCbPrivData);
-                        goto after_callback;
-                    }
-                }
-
-                pAsyncCtx->pPrivData = pCbPrivData;
-                pAsyncCtx->StartTime = callbackStart;
-                pAsyncCtx->pFifoLink = pPeerFifoLinkObj;
-
-                // Spawn detached thread for callback execution
-                pthread_t CallbackThread;
-                pthread_attr_t Attr;
-                pthread_attr_init(&Attr);
-                pthread_attr_setdetachstate(&Attr, PTHREAD_CREATE_DETACHED);
-
-                int ThreadResult =
-                    pthread_create(&CallbackThread, &Attr, (void* (*)(void*))__IOC_asyncCallbackThreadFunc, pAsyncCtx);
-
-                pthread_attr_destroy(&Attr);
-
-                if (ThreadResult != 0) {
-                    // Thread creation failed, cleanup and fallback to sync
-                    free((void*)pAsyncCtx->DatDesc.Payload.pData);
-                    free(pAsyncCtx);
-                    CallbackResult = CbRecvDat_F(pPeerFifoLinkObj->pOwnerLinkObj->ID, pDatDesc, pCbPrivData);
-                } else {
-                    // Thread spawned successfully, assume success
-                    CallbackResult = IOC_RESULT_SUCCESS;
-                    // Mark callback timing as "async" (0ms since it's detached)
-                    clock_gettime(CLOCK_MONOTONIC, &callbackEnd);
-                    callbackDurationMs = 0;  // Async, no blocking
-                    goto after_callback;
-                }
-            }
-
-            // Sync fallback path: Record actual callback timing
-            clock_gettime(CLOCK_MONOTONIC, &callbackEnd);
-            callbackDurationMs = __IOC_getElapsedTimeMs(&callbackStart, &callbackEnd);
-
-        after_callback:
-
-            _IOC_LogDebug("✅ Receiver callback completed in %ld ms\n", callbackDurationMs);
-
-            // Update timing info and mark callback as finished
-            pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-            pPeerFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackEnd = callbackEnd;
-            pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsInCallback = false;  // Mark callback as finished
-
-            // Always open a batching window after any callback to catch subsequent sends
-            pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = true;
-            pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart = callbackEnd;
-            _IOC_LogDebug("🚀 Opening post-callback batching window for %ld ms\n",
-                          pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs);
-
-            // Check if there's batched data to flush after callback completion
-            size_t batchedDataSize = pPeerFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize;
-            pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-            // If there's batched data accumulated during this callback, flush it now
-            if (batchedDataSize > 0) {
-                _IOC_LogDebug("🔄 Flushing %zu bytes of accumulated batch data after callback completion\n",
-                              batchedDataSize);
-                __IOC_flushCallbackBatch(pPeerFifoLinkObj);
-            }
-
-            // 🎯 TDD HYBRID MODE: Also store data in polling buffer for zero timeout polling support
-            // This enables Test Case 6 where data is sent with callback AND should be available for zero timeout
-            // polling
-            pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
-            pPeerFifoLinkObj->DatReceiver.PollingBuffer.IsPollingMode = true;  // Enable hybrid mode
-            __IOC_storeDataInPollingBuffer(pPeerFifoLinkObj, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
-            pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
+        // Queue to the receiver's dispatcher, which delivers data queued meanwhile in batches
+        //
+        // 🔄 ASYNC CALLBACK DISPATCH: Prevent circular deadlock in callback chains
+        // Problem: If callback calls IOC_sendDAT, and that triggers another callback that calls IOC_sendDAT back,
+        // we get a circular wait: Send1→Callback1→Send2→Callback2→Send1 (DEADLOCK!)
+        //
+        // Solution: Queue callbacks to the receiver's long-lived dispatcher thread
+        // - IOC_sendDAT returns once queued, its credits bound the queue
+        // - Sends from a dispatcher thread never wait, so circular chains become concurrent (no deadlock)
+        // - One queue per receiver keeps callbacks in send order
+        //
+        // Trade-off: Callback may execute after IOC_sendDAT returns (async semantics)
+        // Benefit: No pthread_create/malloc/free per send, and system NEVER deadlocks on circular callback chains
+
+        _IOC_LogDebug("📞 Dispatching receiver callback asynchronously for %zu bytes\n",
+                      pDatDesc->Payload.PtrDataSize);
+
+        IOC_Result_T DispatchResult =
+            __IOC_enqueueDatToDispatcher_ofProtoFifo(pPeerFifoLinkObj, pDatDesc, &Completer);
+        if (DispatchResult != IOC_RESULT_SUCCESS) {
+            // Receiver is closing (LINK_BROKEN, like peer disappeared), or dispatcher or context unavailable
+            // (POSIX_ENOMEM), never callback in this thread instead, which may deadlock a circular callback chain
+            _IOC_cancelDatCompleter(&Completer);
+            _IOC_DatCredit_refund(pPeerCredit, DataSize);
+            return DispatchResult;
         }
 
-        // 🎯 TDD SUPPORT: Cache sent data on sender side for immediate polling simulation
-        // This enables Test Case 6 where sender can poll for data it just sent
-        pthread_mutex_lock(&pLocalFifoLinkObj->Mutex);
-        if (pDatDesc->Payload.PtrDataSize <= sizeof(pLocalFifoLinkObj->DatReceiver.LastSentCache.LastSentData)) {
-            memcpy(pLocalFifoLinkObj->DatReceiver.LastSentCache.LastSentData, pDatDesc->Payload.pData,
-                   pDatDesc->Payload.PtrDataSize);
-            pLocalFifoLinkObj->DatReceiver.LastSentCache.LastSentDataSize = pDatDesc->Payload.PtrDataSize;
-            pLocalFifoLinkObj->DatReceiver.LastSentCache.HasRecentlySentData = true;
-            clock_gettime(CLOCK_MONOTONIC, &pLocalFifoLinkObj->DatReceiver.LastSentCache.LastSentTime);
-        }
-        pthread_mutex_unlock(&pLocalFifoLinkObj->Mutex);
-
-        return CallbackResult;
+        return IOC_RESULT_SUCCESS;
     } else {
         // 📦 POLLING MODE SUPPORT: If no callback is registered, store data in polling buffer
-        // This enables hybrid operation where some links use callbacks and others use polling
+        // Some links use callbacks and others use polling, each link only one of them
         pPeerFifoLinkObj->DatReceiver.PollingBuffer.IsPollingMode = true;
 
         IOC_Result_T StoreResult =
             __IOC_storeDataInPollingBuffer(pPeerFifoLinkObj, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
 
         if (StoreResult == IOC_RESULT_SUCCESS) {
+            _IOC_completeDat(&Completer, IOC_RESULT_SUCCESS);  // consumed as far as DatSender is concerned
             return IOC_RESULT_SUCCESS;
-        } else if (StoreResult == IOC_RESULT_BUFFER_FULL) {
-            // 🎯 TDD FIX: Return appropriate result based on mode
-            if (IsTrueNonBlockMode) {
-                // True NonBlock mode → return BUFFER_FULL when buffer is full
-                return IOC_RESULT_BUFFER_FULL;
-            } else if (IsZeroTimeoutMode) {
-                // Zero timeout mode → return TIMEOUT when would block
-                return IOC_RESULT_TIMEOUT;
-            } else {
-                // Blocking mode with buffer full (future enhancement: might wait or retry)
-                return IOC_RESULT_BUFFER_FULL;
-            }
-        } else {
-            return StoreResult;
         }
+
+        // Credits always fit the buffer, except an overdraw or a chunk larger than the whole buffer
+        _IOC_cancelDatCompleter(&Completer);
+        _IOC_DatCredit_refund(pPeerCredit, DataSize);
+        if (StoreResult == IOC_RESULT_BUFFER_FULL && IsZeroTimeoutMode) {
+            return IOC_RESULT_TIMEOUT;
+        }
+        return StoreResult;
     }
 }
 
@@ -1412,7 +1222,7 @@ static IOC_Result_T __IOC_recvData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_
         return IOC_RESULT_NO_DATA;  // SyncNonBlock semantics - no data available
     }
 
-    // 🔒 THREAD SAFETY: Lock the link object mutex for polling buffer access
+    // 🔒 THREAD SAFETY: Lock the link object mutex for polling mode check, NOT for polling buffer access
     pthread_mutex_lock(&pFifoLinkObj->Mutex);
 
     // 📊 CHECK POLLING MODE: Only proceed if this link is configured for polling
@@ -1421,37 +1231,6 @@ static IOC_Result_T __IOC_recvData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_
         pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
         if (IsZeroTimeoutMode) {
-            // 🎯 TDD SUPPORT: Check if this link recently sent data (for immediate polling simulation)
-            // This handles Test Case 6 where sender polls for data it just sent
-            if (pFifoLinkObj->DatReceiver.LastSentCache.HasRecentlySentData) {
-                struct timespec currentTime;
-                clock_gettime(CLOCK_MONOTONIC, &currentTime);
-
-                // Check if data was sent recently (within last 100ms)
-                long long timeDiffMs =
-                    (currentTime.tv_sec - pFifoLinkObj->DatReceiver.LastSentCache.LastSentTime.tv_sec) * 1000 +
-                    (currentTime.tv_nsec - pFifoLinkObj->DatReceiver.LastSentCache.LastSentTime.tv_nsec) / 1000000;
-
-                if (timeDiffMs < 100) {  // 100ms window for "immediate" availability
-                    // Return the cached sent data
-                    size_t dataSize = pFifoLinkObj->DatReceiver.LastSentCache.LastSentDataSize;
-                    size_t copySize =
-                        (dataSize <= pDatDesc->Payload.PtrDataSize) ? dataSize : pDatDesc->Payload.PtrDataSize;
-
-                    memcpy(pDatDesc->Payload.pData, pFifoLinkObj->DatReceiver.LastSentCache.LastSentData, copySize);
-                    pDatDesc->Payload.PtrDataSize = copySize;
-
-                    // Mark as consumed
-                    pFifoLinkObj->DatReceiver.LastSentCache.HasRecentlySentData = false;
-
-                    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
-                    _IOC_LogDebug(
-                        "IOC_recvDAT: Zero timeout SUCCESS - returned cached sent data (%zu bytes) on LinkID=%llu\n",
-                        copySize, pLinkObj->ID);
-                    return IOC_RESULT_SUCCESS;
-                }
-            }
-
             // Reset data size to indicate no data received
             pDatDesc->Payload.PtrDataSize = 0;
             return IOC_RESULT_TIMEOUT;  // Consistent zero timeout semantics
@@ -1459,6 +1238,7 @@ static IOC_Result_T __IOC_recvData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_
 
         return IOC_RESULT_NOT_SUPPORT;
     }
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
     // ️ EXTRACT TIMEOUT VALUE from options for blocking operations with timeout
     long long TimeoutUS = -1;  // Default to infinite timeout (blocking)
@@ -1471,11 +1251,10 @@ static IOC_Result_T __IOC_recvData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_
     IOC_Result_T ReadResult = __IOC_readDataFromPollingBufferWithTimeout(
         pFifoLinkObj, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize, &BytesRead, TimeoutUS);
 
-    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
-
     if (ReadResult == IOC_RESULT_SUCCESS) {
         // Update the data descriptor with actual bytes read
         pDatDesc->Payload.PtrDataSize = BytesRead;
+        __IOC_returnDatCredit_ofProtoFifo(pFifoLinkObj);
 
         _IOC_LogDebug("IOC_recvDAT: Received %zu bytes from polling buffer on LinkID=%llu\n", BytesRead, pLinkObj->ID);
     } else if (ReadResult == IOC_RESULT_NO_DATA) {
@@ -1488,6 +1267,85 @@ static IOC_Result_T __IOC_recvData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_
     return ReadResult;
 }
 
+/**
+ * @brief Return the credits of chunks read from the polling buffer to the peer DatSender,
+ *    only a receiver without callback has data in it, a callback receiver's dispatcher returns its own
+ */
+static void __IOC_returnDatCredit_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
+    ULONG_T ReadDatNum = 0, ReadDatBytes = 0;
+    _IOC_DatRing_getReadTotal(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, &ReadDatNum, &ReadDatBytes);
+    _IOC_DatCredit_releaseTo(&pFifoLinkObj->DatReceiver.Credit, ReadDatNum, ReadDatBytes);
+}
+
+/**
+ * @brief Get the polling buffer of a DatReceiver link in polling mode, and TimeoutUS of pOption(-1 means forever)
+ */
+static IOC_Result_T __IOC_getPollingRing_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption,
+                                                     _IOC_DatRing_pT* ppRing, long long* pTimeoutUS) {
+    _IOC_ProtoFifoLinkObject_pT pFifoLinkObj = (_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pFifoLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    pthread_mutex_lock(&pFifoLinkObj->Mutex);
+    bool IsPollingMode = pFifoLinkObj->DatReceiver.PollingBuffer.IsPollingMode;
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+    if (!IsPollingMode) {
+        return IOC_RESULT_NOT_SUPPORT;  // Data is only delivered to CbRecvDat_F
+    }
+
+    *ppRing = &pFifoLinkObj->DatReceiver.PollingBuffer.Ring;
+    *pTimeoutUS = (pOption && (pOption->IDs & IOC_OPTID_TIMEOUT)) ? (long long)pOption->Payload.TimeoutUS : -1;
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Receive whole data chunks through ProtoFifo protocol (polling mode), RefMore: IOC_recvDATv
+ */
+static IOC_Result_T __IOC_recvDataV_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_DatVec_pT pDatVecs,
+                                                ULONG_T DatVecNum, ULONG_T* pRecvDatNum, const IOC_Options_pT pOption) {
+    _IOC_DatRing_pT pRing = NULL;
+    long long TimeoutUS = -1;
+    IOC_Result_T Result = __IOC_getPollingRing_ofProtoFifo(pLinkObj, pOption, &pRing, &TimeoutUS);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    Result = _IOC_DatRing_readv(pRing, pDatVecs, DatVecNum, pRecvDatNum, TimeoutUS);
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_returnDatCredit_ofProtoFifo((_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv);
+    }
+    return Result;
+}
+
+/**
+ * @brief Peek whole data chunks in the polling buffer without copying, RefMore: IOC_peekDATv
+ */
+static IOC_Result_T __IOC_peekDataV_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, IOC_DatVec_pT pDatVecs,
+                                                ULONG_T DatVecNum, ULONG_T* pPeekDatNum, const IOC_Options_pT pOption) {
+    _IOC_DatRing_pT pRing = NULL;
+    long long TimeoutUS = -1;
+    IOC_Result_T Result = __IOC_getPollingRing_ofProtoFifo(pLinkObj, pOption, &pRing, &TimeoutUS);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
+
+    return _IOC_DatRing_peekv(pRing, pDatVecs, DatVecNum, pPeekDatNum, TimeoutUS);
+}
+
+static IOC_Result_T __IOC_consumeData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, ULONG_T ConsumeDatNum) {
+    _IOC_ProtoFifoLinkObject_pT pFifoLinkObj = (_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pFifoLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
+    }
+
+    IOC_Result_T Result = _IOC_DatRing_consume(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, ConsumeDatNum);
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_returnDatCredit_ofProtoFifo(pFifoLinkObj);
+    }
+    return Result;
+}
+
 /**
  * @brief Setup DAT receiver callback for a link
  * @param pLinkObj Pointer to the link object
@@ -1515,15 +1373,11 @@ static IOC_Result_T __IOC_setupDatReceiver_ofProtoFifo(_IOC_LinkObject_pT pLinkO
         // and store it in the link object. This allows each link to have independent
         // DAT receiver settings, supporting scenarios where one service handles
         // multiple client connections with different callback configurations.
-        pFifoLinkObj->DatReceiver.CbRecvDat_F = pSrvObj->Args.UsageArgs.pDat->CbRecvDat_F;
-        pFifoLinkObj->DatReceiver.pCbPrivData = pSrvObj->Args.UsageArgs.pDat->pCbPrivData;
-        pFifoLinkObj->DatReceiver.IsReceiverRegistered = (pFifoLinkObj->DatReceiver.CbRecvDat_F != NULL);
-        pFifoLinkObj->DatReceiver.IsProcessingCallback = false;  // Initialize callback state
-        pFifoLinkObj->DatReceiver.PendingDataCount = 0;          // Initialize pending data count
+        __IOC_setDatReceiverArgs_ofProtoFifo(pFifoLinkObj, pSrvObj->Args.UsageArgs.pDat);
 
         // 🎯 TDD REQUIREMENT: Enable polling mode when no callback is provided
         // This allows links without callbacks to support timeout operations via polling
-        if (pFifoLinkObj->DatReceiver.CbRecvDat_F == NULL) {
+        if (!pFifoLinkObj->DatReceiver.IsReceiverRegistered) {
             pFifoLinkObj->DatReceiver.PollingBuffer.IsPollingMode = true;
             _IOC_LogDebug("IOC_setupDatReceiver: Enabled polling mode for link (no callback provided)\n");
         }
@@ -1537,29 +1391,65 @@ static IOC_Result_T __IOC_setupDatReceiver_ofProtoFifo(_IOC_LinkObject_pT pLinkO
 }
 
 /**
- * @brief Initialize polling buffer for a ProtoFifo link object
+ * @brief Copy the receiver's callbacks and batch limits from its DAT usage args, with defaults applied
+ * @param pFifoLinkObj Pointer to the ProtoFifo link object (receiver side), whose Mutex is held by caller
+ * @param pDatUsageArgs Receiver's IOC_DatUsageArgs_T of service or connection
+ */
+static void __IOC_setDatReceiverArgs_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                 const IOC_DatUsageArgs_pT pDatUsageArgs) {
+    pFifoLinkObj->DatReceiver.CbRecvDat_F = pDatUsageArgs->CbRecvDat_F;
+    pFifoLinkObj->DatReceiver.CbRecvDatBatch_F = pDatUsageArgs->CbRecvDatBatch_F;
+    pFifoLinkObj->DatReceiver.pCbPrivData = pDatUsageArgs->pCbPrivData;
+    pFifoLinkObj->DatReceiver.IsReceiverRegistered =
+        (pDatUsageArgs->CbRecvDat_F != NULL) || (pDatUsageArgs->CbRecvDatBatch_F != NULL);
+
+    ULONG_T MaxDatNum = pDatUsageArgs->Batch.MaxDatNum;
+    if (0 == MaxDatNum) {
+        MaxDatNum = _PROTO_FIFO_DAT_BATCH_DEFAULT_MAX_NUM;
+    } else if (MaxDatNum > _PROTO_FIFO_DAT_BATCH_MAX_NUM) {
+        MaxDatNum = _PROTO_FIFO_DAT_BATCH_MAX_NUM;
+    }
+    pFifoLinkObj->DatReceiver.BatchArgs.MaxDatNum = MaxDatNum;
+    pFifoLinkObj->DatReceiver.BatchArgs.MaxDatBytes =
+        pDatUsageArgs->Batch.MaxDatBytes ? pDatUsageArgs->Batch.MaxDatBytes : _PROTO_FIFO_DAT_BATCH_DEFAULT_MAX_BYTES;
+    pFifoLinkObj->DatReceiver.BatchArgs.MaxDelayUS = pDatUsageArgs->Batch.MaxDelayUS;
+    pFifoLinkObj->DatReceiver.BatchArgs.IsJoinData = pDatUsageArgs->Batch.IsJoinData;
+
+    // Only the callback bounds data in flight to a callback receiver, while a polling one's data MUST fit its ring
+    ULONG_T MaxCreditDatNum = pDatUsageArgs->Credit.MaxDatNum;
+    ULONG_T MaxCreditDatBytes = pDatUsageArgs->Credit.MaxDatBytes;
+    if (pFifoLinkObj->DatReceiver.IsReceiverRegistered) {
+        MaxCreditDatNum = MaxCreditDatNum ? MaxCreditDatNum : _IOC_DAT_CREDIT_DEFAULT_MAX_NUM;
+        MaxCreditDatBytes = MaxCreditDatBytes ? MaxCreditDatBytes : _IOC_DAT_CREDIT_DEFAULT_MAX_BYTES;
+    } else {
+        _IOC_DatRing_fitWindow(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, &MaxCreditDatNum, &MaxCreditDatBytes);
+    }
+    _IOC_DatCredit_setWindow(&pFifoLinkObj->DatReceiver.Credit, MaxCreditDatNum, MaxCreditDatBytes);
+}
+
+/**
+ * @brief Initialize polling buffer for a ProtoFifo link object, and its credits within the buffer
+ *    until __IOC_setDatReceiverArgs_ofProtoFifo knows the receiver's args
  * @param pFifoLinkObj Pointer to the ProtoFifo link object
+ * @param PollingBufSize IOC_DatUsageArgs_T::PollingBufSize of this link's receiver side, 0 means default
  * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_POSIX_ENOMEM on memory allocation failure
  */
-static IOC_Result_T __IOC_initPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
+static IOC_Result_T __IOC_initPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                        ULONG_T PollingBufSize) {
     if (!pFifoLinkObj) {
         return IOC_RESULT_INVALID_PARAM;
     }
 
-    // Initialize polling buffer for potential use
-    pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer = malloc(_PROTO_FIFO_POLLING_BUFFER_SIZE);
-    if (!pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer) {
-        return IOC_RESULT_POSIX_ENOMEM;
-    }
-
-    pFifoLinkObj->DatReceiver.PollingBuffer.BufferSize = _PROTO_FIFO_POLLING_BUFFER_SIZE;
-    pFifoLinkObj->DatReceiver.PollingBuffer.DataStart = 0;
-    pFifoLinkObj->DatReceiver.PollingBuffer.DataEnd = 0;
-    pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData = 0;
     pFifoLinkObj->DatReceiver.PollingBuffer.IsPollingMode = false;  // Default to callback mode
 
-    pthread_cond_init(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond, NULL);
+    IOC_Result_T Result = _IOC_DatRing_initOne(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, PollingBufSize);
+    if (Result != IOC_RESULT_SUCCESS) {
+        return Result;
+    }
 
+    ULONG_T MaxCreditDatNum = 0, MaxCreditDatBytes = 0;
+    _IOC_DatRing_fitWindow(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, &MaxCreditDatNum, &MaxCreditDatBytes);
+    _IOC_DatCredit_initOne(&pFifoLinkObj->DatReceiver.Credit, MaxCreditDatNum, MaxCreditDatBytes);
     return IOC_RESULT_SUCCESS;
 }
 
@@ -1572,16 +1462,12 @@ static void __IOC_cleanupPollingBuffer_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT p
         return;
     }
 
-    if (pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer) {
-        free(pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer);
-        pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer = NULL;
-    }
-
-    pthread_cond_destroy(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond);
+    _IOC_DatCredit_deinitOne(&pFifoLinkObj->DatReceiver.Credit);
+    _IOC_DatRing_deinitOne(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring);
 }
 
 /**
- * @brief Store data in polling buffer (circular buffer implementation)
+ * @brief Store data in polling buffer as one chunk, without any lock shared with the reader
  * @param pFifoLinkObj Pointer to the ProtoFifo link object
  * @param pData Pointer to data to store
  * @param DataSize Size of data to store
@@ -1593,440 +1479,559 @@ static IOC_Result_T __IOC_storeDataInPollingBuffer(_IOC_ProtoFifoLinkObject_pT p
         return IOC_RESULT_INVALID_PARAM;
     }
 
-    // Get direct reference to the polling buffer
-    char* pDataBuffer = pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer;
-    size_t BufferSize = pFifoLinkObj->DatReceiver.PollingBuffer.BufferSize;
-    size_t DataEnd = pFifoLinkObj->DatReceiver.PollingBuffer.DataEnd;
-    size_t AvailableData = pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData;
-
-    // Check if there's enough space in the buffer
-    size_t FreeSpace = BufferSize - AvailableData;
-    if (DataSize > FreeSpace) {
-        return IOC_RESULT_BUFFER_FULL;
-    }
-
-    // Store data in circular buffer
-    const char* pSrcData = (const char*)pData;
-    size_t BytesToEnd = BufferSize - DataEnd;
-
-    if (DataSize <= BytesToEnd) {
-        // Data fits without wrapping
-        memcpy(pDataBuffer + DataEnd, pSrcData, DataSize);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataEnd = (DataEnd + DataSize) % BufferSize;
-    } else {
-        // Data needs to wrap around
-        memcpy(pDataBuffer + DataEnd, pSrcData, BytesToEnd);
-        memcpy(pDataBuffer, pSrcData + BytesToEnd, DataSize - BytesToEnd);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataEnd = DataSize - BytesToEnd;
-    }
-
-    pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData += DataSize;
-
-    // Signal that data is available for polling
-    pthread_cond_signal(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond);
-
-    return IOC_RESULT_SUCCESS;
+    return _IOC_DatRing_push(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, pData, DataSize);
 }
 
 /**
- * @brief Read data from polling buffer (circular buffer implementation)
+ * @brief Read data from polling buffer with timeout support, parking only when it's empty
  * @param pFifoLinkObj Pointer to the ProtoFifo link object
  * @param pBuffer Destination buffer to store read data
  * @param BufferSize Size of destination buffer
  * @param pBytesRead Pointer to store actual bytes read
- * @param IsBlocking Whether to block when no data is available
- * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_NO_DATA if no data available in non-blocking mode
+ * @param TimeoutUS Timeout in microseconds (-1 for infinite, 0 for immediate)
+ * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_TIMEOUT on timeout or if no data available in immediate mode
  */
-static IOC_Result_T __IOC_readDataFromPollingBuffer(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, void* pBuffer,
-                                                    size_t BufferSize, size_t* pBytesRead, bool IsBlocking) {
+static IOC_Result_T __IOC_readDataFromPollingBufferWithTimeout(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, void* pBuffer,
+                                                               size_t BufferSize, size_t* pBytesRead,
+                                                               long long TimeoutUS) {
     if (!pFifoLinkObj || !pBuffer || !pBytesRead || BufferSize == 0) {
         return IOC_RESULT_INVALID_PARAM;
     }
 
-    *pBytesRead = 0;
-
-    // Wait for data if blocking mode and no data available
-    if (IsBlocking) {
-        while (pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-            pthread_cond_wait(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond, &pFifoLinkObj->Mutex);
-        }
-    } else if (pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-        return IOC_RESULT_NO_DATA;
+    if (TimeoutUS == IOC_TIMEOUT_IMMEDIATE) {
+        TimeoutUS = 0;
     }
 
-    // Read data from circular buffer
-    size_t AvailableData = pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData;
-    size_t DataToRead = (BufferSize < AvailableData) ? BufferSize : AvailableData;
+    ULONG_T ReadSize = 0;
+    IOC_Result_T Result =
+        _IOC_DatRing_read(&pFifoLinkObj->DatReceiver.PollingBuffer.Ring, pBuffer, BufferSize, &ReadSize, TimeoutUS);
+    *pBytesRead = ReadSize;
 
-    char* pSrcBuffer = pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer;
-    size_t DataStart = pFifoLinkObj->DatReceiver.PollingBuffer.DataStart;
-    size_t TotalBufferSize = pFifoLinkObj->DatReceiver.PollingBuffer.BufferSize;
-
-    char* pDestBuffer = (char*)pBuffer;
-    size_t BytesToEnd = TotalBufferSize - DataStart;
+    return (Result == IOC_RESULT_NO_DATA) ? IOC_RESULT_TIMEOUT : Result;
+}
 
-    if (DataToRead <= BytesToEnd) {
-        // Data doesn't wrap around
-        memcpy(pDestBuffer, pSrcBuffer + DataStart, DataToRead);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataStart = (DataStart + DataToRead) % TotalBufferSize;
-    } else {
-        // Data wraps around
-        memcpy(pDestBuffer, pSrcBuffer + DataStart, BytesToEnd);
-        memcpy(pDestBuffer + BytesToEnd, pSrcBuffer, DataToRead - BytesToEnd);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataStart = DataToRead - BytesToEnd;
+static void __IOC_destroyDatDispatcher_ofProtoFifo(_IOC_ProtoFifoDatDispatcher_pT pDispatcher) {
+    // DatSenders woken by IsStopping MAY still hold Mutex, wait them to leave
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    while (pDispatcher->EnqueuingNum > 0) {
+        pthread_cond_wait(&pDispatcher->LeaveCond, &pDispatcher->Mutex);
+    }
+    pthread_mutex_unlock(&pDispatcher->Mutex);
+
+    __AsyncCallbackContext_T* pLists[2] = {pDispatcher->pPendingHead, pDispatcher->pFreeList};
+    for (int i = 0; i < 2; i++) {
+        while (pLists[i]) {
+            __AsyncCallbackContext_T* pNext = pLists[i]->pNext;
+            _IOC_completeDat(&pLists[i]->Completer, IOC_RESULT_LINK_BROKEN);  // never dispatched
+            if (pLists[i]->DatDesc.Payload.pDatBuf) {
+                IOC_releaseDatBuf(pLists[i]->DatDesc.Payload.pDatBuf);
+            }
+            free(pLists[i]->pPayloadBuf);
+            free(pLists[i]);
+            pLists[i] = pNext;
+        }
     }
 
-    pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData -= DataToRead;
-    *pBytesRead = DataToRead;
+    free(pDispatcher->pBatchDatDescs);
+    free(pDispatcher->pJoinBuf);
+    pthread_cond_destroy(&pDispatcher->DeliveredCond);
+    pthread_cond_destroy(&pDispatcher->LeaveCond);
+    pthread_cond_destroy(&pDispatcher->NotEmptyCond);
+    pthread_mutex_destroy(&pDispatcher->Mutex);
+    free(pDispatcher);
+}
 
-    return IOC_RESULT_SUCCESS;
+// Nanoseconds from pFrom to pTo, both of CLOCK_MONOTONIC
+static long long __IOC_getElapsedNS(const struct timespec* pFrom, const struct timespec* pTo) {
+    return (long long)(pTo->tv_sec - pFrom->tv_sec) * 1000000000LL + (pTo->tv_nsec - pFrom->tv_nsec);
 }
 
 /**
- * @brief Read data from polling buffer with timeout support
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- * @param pBuffer Destination buffer to store read data
- * @param BufferSize Size of destination buffer
- * @param pBytesRead Pointer to store actual bytes read
- * @param TimeoutUS Timeout in microseconds (-1 for infinite, 0 for immediate)
- * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_TIMEOUT on timeout, IOC_RESULT_NO_DATA if no data available
+ * @brief Wait with Mutex held until TargetBatchDatNum chunks are pending, or MaxBatchDelayUS passed since
+ *    the first pending chunk was sent, or flushDAT or closeLink cuts it short
+ * @param pDispatcher Receiver's dispatcher, whose PendingList is not empty
  */
-static IOC_Result_T __IOC_readDataFromPollingBufferWithTimeout(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, void* pBuffer,
-                                                               size_t BufferSize, size_t* pBytesRead,
-                                                               long long TimeoutUS) {
-    if (!pFifoLinkObj || !pBuffer || !pBytesRead || BufferSize == 0) {
-        return IOC_RESULT_INVALID_PARAM;
+static void __IOC_waitDatBatch_ofProtoFifo(_IOC_ProtoFifoDatDispatcher_pT pDispatcher) {
+    while (pDispatcher->QueuedDatNum < pDispatcher->TargetBatchDatNum && !pDispatcher->IsStopping &&
+           pDispatcher->PoppedDatSeq >= pDispatcher->FlushedDatSeq) {
+        struct timespec Now;
+        clock_gettime(CLOCK_MONOTONIC, &Now);
+        long long LeftNS = (long long)pDispatcher->MaxBatchDelayUS * 1000LL -
+                           __IOC_getElapsedNS(&pDispatcher->pPendingHead->SendTime, &Now);
+        if (LeftNS <= 0) {
+            break;
+        }
+
+        // pthread_cond_timedwait takes CLOCK_REALTIME, so convert the rest of the delay to it
+        struct timespec AbsTimeout;
+        clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+        AbsTimeout.tv_sec += LeftNS / 1000000000LL;
+        AbsTimeout.tv_nsec += LeftNS % 1000000000LL;
+        if (AbsTimeout.tv_nsec >= 1000000000L) {
+            AbsTimeout.tv_sec += 1;
+            AbsTimeout.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&pDispatcher->NotEmptyCond, &pDispatcher->Mutex, &AbsTimeout);
     }
+}
 
-    *pBytesRead = 0;
+// Whether closeLink was called from a callback of this dispatcher, then the rest of its data is dropped
+static bool __IOC_isDatDispatcherOrphaned_ofProtoFifo(_IOC_ProtoFifoDatDispatcher_pT pDispatcher) {
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    bool IsOrphaned = (NULL == pDispatcher->pFifoLink);
+    pthread_mutex_unlock(&pDispatcher->Mutex);
+    return IsOrphaned;
+}
 
-    // Handle zero timeout (immediate/non-blocking) case
-    if (TimeoutUS == 0 || TimeoutUS == IOC_TIMEOUT_IMMEDIATE) {
-        if (pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-            return IOC_RESULT_TIMEOUT;
+/**
+ * @brief Deliver a batch of queued contexts in send order, by ONE CbRecvDatBatch_F, or by CbRecvDat_F of each chunk,
+ *    or if IsJoinData, by CbRecvDat_F of each run of copied data joined, and of each zero-copy data alone
+ * @param pDispatcher Receiver's dispatcher
+ * @param pBatchHead List of BatchDatNum contexts popped from PendingList
+ */
+static void __IOC_dispatchDatBatch_ofProtoFifo(_IOC_ProtoFifoDatDispatcher_pT pDispatcher,
+                                               __AsyncCallbackContext_T* pBatchHead, ULONG_T BatchDatNum) {
+    __AsyncCallbackContext_T* pCtx = pBatchHead;
+
+    if (pDispatcher->CbRecvDatBatch_F) {
+        for (ULONG_T i = 0; i < BatchDatNum; i++, pCtx = pCtx->pNext) {
+            pDispatcher->pBatchDatDescs[i] = pCtx->DatDesc;
         }
-        // Fall through to read available data
-    }
-    // Handle infinite timeout (blocking) case
-    else if (TimeoutUS < 0) {
-        while (pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-            pthread_cond_wait(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond, &pFifoLinkObj->Mutex);
+        IOC_Result_T RecvResult = pDispatcher->CbRecvDatBatch_F(pDispatcher->LinkID, pDispatcher->pBatchDatDescs,
+                                                                BatchDatNum, pDispatcher->pCbPrivData);
+        for (pCtx = pBatchHead; pCtx; pCtx = pCtx->pNext) {
+            pCtx->RecvResult = RecvResult;
         }
-        // Fall through to read available data
+        return;
     }
-    // Handle finite timeout case
-    else {
-        if (pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-            // Calculate absolute timeout
-            struct timespec absTimeout;
-            clock_gettime(CLOCK_REALTIME, &absTimeout);
 
-            // Add timeout to current time
-            long long nsTimeout = TimeoutUS * 1000;  // Convert microseconds to nanoseconds
-            absTimeout.tv_sec += nsTimeout / 1000000000LL;
-            absTimeout.tv_nsec += nsTimeout % 1000000000LL;
+    while (pCtx) {
+        // Find the run of copied data from pCtx within _PROTO_FIFO_DAT_JOIN_MAX_BYTES,
+        //  zero-copy data and larger data are delivered alone
+        __AsyncCallbackContext_T* pRunEnd = pCtx->pNext;
+        size_t RunDataSize = pCtx->DatDesc.Payload.PtrDataSize;
+        bool IsJoinable = pDispatcher->IsJoinData && !pCtx->DatDesc.Payload.pDatBuf &&
+                          RunDataSize <= _PROTO_FIFO_DAT_JOIN_MAX_BYTES;
+        while (IsJoinable && pRunEnd && !pRunEnd->DatDesc.Payload.pDatBuf &&
+               RunDataSize + pRunEnd->DatDesc.Payload.PtrDataSize <= _PROTO_FIFO_DAT_JOIN_MAX_BYTES) {
+            RunDataSize += pRunEnd->DatDesc.Payload.PtrDataSize;
+            pRunEnd = pRunEnd->pNext;
+        }
 
-            // Handle nanosecond overflow
-            if (absTimeout.tv_nsec >= 1000000000L) {
-                absTimeout.tv_sec += 1;
-                absTimeout.tv_nsec -= 1000000000L;
+        // Grow-only join buffer, if no memory to grow, deliver the run chunk by chunk
+        if (pRunEnd != pCtx->pNext && RunDataSize > pDispatcher->JoinBufSize) {
+            void* pNewJoinBuf = realloc(pDispatcher->pJoinBuf, RunDataSize);
+            if (pNewJoinBuf) {
+                pDispatcher->pJoinBuf = pNewJoinBuf;
+                pDispatcher->JoinBufSize = RunDataSize;
             }
+        }
 
-            // Wait with timeout
-            int waitResult = pthread_cond_timedwait(&pFifoLinkObj->DatReceiver.PollingBuffer.DataAvailableCond,
-                                                    &pFifoLinkObj->Mutex, &absTimeout);
+        if (pRunEnd != pCtx->pNext && RunDataSize <= pDispatcher->JoinBufSize) {
+            __AsyncCallbackContext_T* pRunStart = pCtx;
+            char* pJoinPos = (char*)pDispatcher->pJoinBuf;
+            for (; pCtx != pRunEnd; pCtx = pCtx->pNext) {
+                memcpy(pJoinPos, pCtx->DatDesc.Payload.pData, pCtx->DatDesc.Payload.PtrDataSize);
+                pJoinPos += pCtx->DatDesc.Payload.PtrDataSize;
+            }
 
-            // Check if still no data available after timeout
-            if (waitResult == ETIMEDOUT || pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData == 0) {
-                return IOC_RESULT_TIMEOUT;
+            IOC_DatDesc_T JoinedDatDesc = {0};
+            IOC_initDatDesc(&JoinedDatDesc);
+            JoinedDatDesc.Payload.pData = pDispatcher->pJoinBuf;
+            JoinedDatDesc.Payload.PtrDataSize = RunDataSize;
+            JoinedDatDesc.Payload.PtrDataLen = RunDataSize;
+            IOC_Result_T RecvResult =
+                pDispatcher->CbRecvDat_F(pDispatcher->LinkID, &JoinedDatDesc, pDispatcher->pCbPrivData);
+            for (__AsyncCallbackContext_T* pRunCtx = pRunStart; pRunCtx != pRunEnd; pRunCtx = pRunCtx->pNext) {
+                pRunCtx->RecvResult = RecvResult;
+            }
+        } else {
+            for (; pCtx != pRunEnd; pCtx = pCtx->pNext) {
+                pCtx->RecvResult =
+                    pDispatcher->CbRecvDat_F(pDispatcher->LinkID, &pCtx->DatDesc, pDispatcher->pCbPrivData);
             }
         }
-        // Fall through to read available data if data became available
-    }
-
-    // Read data from circular buffer (same logic as original function)
-    size_t AvailableData = pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData;
-    size_t DataToRead = (BufferSize < AvailableData) ? BufferSize : AvailableData;
 
-    char* pSrcBuffer = pFifoLinkObj->DatReceiver.PollingBuffer.pDataBuffer;
-    size_t DataStart = pFifoLinkObj->DatReceiver.PollingBuffer.DataStart;
-    size_t TotalBufferSize = pFifoLinkObj->DatReceiver.PollingBuffer.BufferSize;
-
-    char* pDestBuffer = (char*)pBuffer;
-    size_t BytesToEnd = TotalBufferSize - DataStart;
-
-    if (DataToRead <= BytesToEnd) {
-        // Data doesn't wrap around
-        memcpy(pDestBuffer, pSrcBuffer + DataStart, DataToRead);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataStart = (DataStart + DataToRead) % TotalBufferSize;
-    } else {
-        // Data wraps around
-        memcpy(pDestBuffer, pSrcBuffer + DataStart, BytesToEnd);
-        memcpy(pDestBuffer + BytesToEnd, pSrcBuffer, DataToRead - BytesToEnd);
-        pFifoLinkObj->DatReceiver.PollingBuffer.DataStart = DataToRead - BytesToEnd;
+        if (pCtx && __IOC_isDatDispatcherOrphaned_ofProtoFifo(pDispatcher)) {
+            return;
+        }
     }
-
-    pFifoLinkObj->DatReceiver.PollingBuffer.AvailableData -= DataToRead;
-    *pBytesRead = DataToRead;
-
-    return IOC_RESULT_SUCCESS;
 }
 
 /**
- * @brief Initialize micro-batch for a ProtoFifo link object (for rapid send batching)
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_POSIX_ENOMEM on memory allocation failure
+ * @brief Dispatcher thread function - executes queued callbacks in send order by batches until stopped and drained
+ * @param pArg Pointer to _IOC_ProtoFifoDatDispatcher_T
+ * @return NULL
  */
-static IOC_Result_T __IOC_initCallbackBatch_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
-    if (!pFifoLinkObj) {
-        return IOC_RESULT_INVALID_PARAM;
-    }
+static void* __IOC_datDispatcherThreadFunc(void* pArg) {
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = (_IOC_ProtoFifoDatDispatcher_pT)pArg;
+    _mIsInDatDispatcherThread = true;
 
-    // Initialize callback batch for batching sends during callback processing
-    pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer = malloc(_PROTO_FIFO_SEND_QUEUE_SIZE);
-    if (!pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer) {
-        return IOC_RESULT_POSIX_ENOMEM;
-    }
+    _IOC_LogDebug("🧵 Dat dispatcher thread started\n");
 
-    pFifoLinkObj->DatReceiver.CallbackBatch.BatchBufferSize = _PROTO_FIFO_SEND_QUEUE_SIZE;
-    pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize = 0;
-    pFifoLinkObj->DatReceiver.CallbackBatch.IsInCallback = false;  // Initialize callback busy flag
+    bool IsIdle = true;  // no callback ran since PendingList was last empty
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    while (1) {
+        if (!pDispatcher->pPendingHead) {
+            IsIdle = true;
+        }
+        while (!pDispatcher->pPendingHead && !pDispatcher->IsStopping) {
+            pthread_cond_wait(&pDispatcher->NotEmptyCond, &pDispatcher->Mutex);
+        }
 
-    // Initialize time-window batching parameters
-    pFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = false;
-    pFifoLinkObj->DatReceiver.CallbackBatch.SlowCallbackThresholdMs = 8;  // 8ms threshold (lower than 10ms callbacks)
-    pFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs = 25;   // 25ms window (longer to catch more sends)
-    memset(&pFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackStart, 0, sizeof(struct timespec));
-    memset(&pFifoLinkObj->DatReceiver.CallbackBatch.LastCallbackEnd, 0, sizeof(struct timespec));
-    memset(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart, 0, sizeof(struct timespec));
+        if (!pDispatcher->pPendingHead) {
+            break;  // IsStopping and drained
+        }
 
-    pthread_mutex_init(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex, NULL);
+        if (pDispatcher->MaxBatchDelayUS > 0) {
+            __IOC_waitDatBatch_ofProtoFifo(pDispatcher);
+        }
 
-    return IOC_RESULT_SUCCESS;
-}
+        // Pop the batch from head within MaxBatchDatNum and MaxBatchDatBytes, at least one chunk.
+        //  Without a delay, a joining CbRecvDat_F joins only data queued while its previous callback ran,
+        //  so a receiver keeping up still gets each send alone.
+        ULONG_T MaxPopDatNum = pDispatcher->MaxBatchDatNum;
+        if (IsIdle && pDispatcher->IsJoinData && !pDispatcher->CbRecvDatBatch_F && 0 == pDispatcher->MaxBatchDelayUS) {
+            MaxPopDatNum = 1;
+        }
+        IsIdle = false;
+
+        __AsyncCallbackContext_T* pBatchHead = pDispatcher->pPendingHead;
+        __AsyncCallbackContext_T* pBatchTail = pBatchHead;
+        ULONG_T BatchDatNum = 1;
+        size_t BatchDatBytes = pBatchHead->DatDesc.Payload.PtrDataSize;
+        while (pBatchTail->pNext && BatchDatNum < MaxPopDatNum &&
+               BatchDatBytes + pBatchTail->pNext->DatDesc.Payload.PtrDataSize <= pDispatcher->MaxBatchDatBytes) {
+            pBatchTail = pBatchTail->pNext;
+            BatchDatBytes += pBatchTail->DatDesc.Payload.PtrDataSize;
+            BatchDatNum++;
+        }
 
-/**
- * @brief Clean up micro-batch for a ProtoFifo link object
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- */
-static void __IOC_cleanupCallbackBatch_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
-    if (!pFifoLinkObj) {
-        return;
-    }
+        pDispatcher->pPendingHead = pBatchTail->pNext;
+        if (!pDispatcher->pPendingHead) {
+            pDispatcher->pPendingTail = NULL;
+        }
+        pBatchTail->pNext = NULL;
+        pDispatcher->QueuedDatNum -= BatchDatNum;
+        pDispatcher->PoppedDatSeq += BatchDatNum;
+        bool IsLinkClosed = (NULL == pDispatcher->pFifoLink);
+        pthread_mutex_unlock(&pDispatcher->Mutex);
+
+        for (__AsyncCallbackContext_T* pCtx = pBatchHead; pCtx; pCtx = pCtx->pNext) {
+            pCtx->RecvResult = IOC_RESULT_LINK_BROKEN;  // unless a callback gets it
+        }
+
+        struct timespec BatchStart, BatchEnd;
+        if (!IsLinkClosed) {
+            clock_gettime(CLOCK_MONOTONIC, &BatchStart);
+            __IOC_dispatchDatBatch_ofProtoFifo(pDispatcher, pBatchHead, BatchDatNum);
+            clock_gettime(CLOCK_MONOTONIC, &BatchEnd);
+            _IOC_LogDebug("✅ Async callback of %lu chunks(%zu bytes) completed\n", BatchDatNum, BatchDatBytes);
+        }
+        // Complete before DeliveredDatSeq moves on, so a returned flushDAT also means its sends are completed
+        for (__AsyncCallbackContext_T* pCtx = pBatchHead; pCtx; pCtx = pCtx->pNext) {
+            if (pCtx->DatDesc.Payload.pDatBuf) {
+                IOC_releaseDatBuf(pCtx->DatDesc.Payload.pDatBuf);
+                pCtx->DatDesc.Payload.pDatBuf = NULL;
+            }
+            if (_IOC_isDatCompleterArmed(&pCtx->Completer)) {
+                _IOC_completeDat(&pCtx->Completer, pCtx->RecvResult);
+            }
+        }
+
+        pthread_mutex_lock(&pDispatcher->Mutex);
+        // Return the batch's credits to its DatSender, unless closeLink was called from the callback
+        if (pDispatcher->pFifoLink) {
+            _IOC_DatCredit_release(&pDispatcher->pFifoLink->DatReceiver.Credit, BatchDatNum, BatchDatBytes);
+        }
+        pDispatcher->DeliveredDatSeq += BatchDatNum;
+        pthread_cond_broadcast(&pDispatcher->DeliveredCond);
+        if (!IsLinkClosed) {
+            pDispatcher->DispatchedDatNum += BatchDatNum;
+            pDispatcher->DispatchedBatchNum++;
+
+            // Adapt the batch size waited for, so a batch's callback takes about half of MaxBatchDelayUS
+            ULONG_T CostPerDatNS = (ULONG_T)(__IOC_getElapsedNS(&BatchStart, &BatchEnd) / BatchDatNum);
+            pDispatcher->CostPerDatNS = pDispatcher->CostPerDatNS
+                                            ? (pDispatcher->CostPerDatNS * 3 + CostPerDatNS) / 4
+                                            : CostPerDatNS;
+            if (pDispatcher->MaxBatchDelayUS > 0) {
+                ULONG_T CostNS = pDispatcher->CostPerDatNS ? pDispatcher->CostPerDatNS : 1;
+                ULONG_T TargetBatchDatNum = pDispatcher->MaxBatchDelayUS * 1000 / 2 / CostNS;
+                if (TargetBatchDatNum < 1) {
+                    TargetBatchDatNum = 1;
+                } else if (TargetBatchDatNum > pDispatcher->MaxBatchDatNum) {
+                    TargetBatchDatNum = pDispatcher->MaxBatchDatNum;
+                }
+                pDispatcher->TargetBatchDatNum = TargetBatchDatNum;
+            }
+        }
 
-    if (pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer) {
-        free(pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer);
-        pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer = NULL;
+        while (pBatchHead) {
+            __AsyncCallbackContext_T* pCtx = pBatchHead;
+            pBatchHead = pCtx->pNext;
+            if (pDispatcher->FreeNum < _PROTO_FIFO_DAT_DISPATCHER_MAX_FREE_NUM) {
+                pCtx->pNext = pDispatcher->pFreeList;
+                pDispatcher->pFreeList = pCtx;
+                pDispatcher->FreeNum++;
+            } else {
+                free(pCtx->pPayloadBuf);
+                free(pCtx);
+            }
+        }
     }
+    bool IsOrphaned = (NULL == pDispatcher->pFifoLink);
+    pthread_mutex_unlock(&pDispatcher->Mutex);
+
+    _IOC_LogDebug("🧵 Dat dispatcher thread finished\n");
 
-    pthread_mutex_destroy(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
+    // closeLink was called from this thread's callback, so it detached this thread and left the cleanup here
+    if (IsOrphaned) {
+        __IOC_destroyDatDispatcher_ofProtoFifo(pDispatcher);
+    }
+    return NULL;
 }
 
 /**
- * @brief Add data to callback batch during active batching window
+ * @brief Get the receiver's dispatcher locked by its Mutex, create and start it on the first call
+ *    The dispatcher's Mutex is taken before the link's Mutex is released, so closeLink can't stop and free it
+ *    before the caller is counted in EnqueuingNum, same as flushDAT.
  * @param pFifoLinkObj Pointer to the ProtoFifo link object (receiver side)
- * @param pData Pointer to data to add
- * @param DataSize Size of data to add
- * @return IOC_RESULT_SUCCESS on success, IOC_RESULT_BUFFER_FULL if batch is full
+ * @return NULL on memory allocation or thread creation failure
  */
-static IOC_Result_T __IOC_addDataToBatch(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, const void* pData, size_t DataSize) {
-    if (!pFifoLinkObj || !pData || DataSize == 0) {
-        return IOC_RESULT_INVALID_PARAM;
+static _IOC_ProtoFifoDatDispatcher_pT __IOC_lockDatDispatcher_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
+    pthread_mutex_lock(&pFifoLinkObj->Mutex);
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = pFifoLinkObj->DatReceiver.pDispatcher;
+    if (pDispatcher) {
+        pthread_mutex_lock(&pDispatcher->Mutex);
+        pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+        return pDispatcher;
     }
 
-    pthread_mutex_lock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-    // Check if batching window is open and not expired
-    if (!pFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen || __IOC_isBatchWindowExpired(pFifoLinkObj)) {
-        pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-        return IOC_RESULT_NOT_SUPPORT;  // No active batching window
+    pDispatcher = (_IOC_ProtoFifoDatDispatcher_pT)calloc(1, sizeof(_IOC_ProtoFifoDatDispatcher_T));
+    if (!pDispatcher) {
+        pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pDispatcher->Mutex, NULL);
+    pthread_cond_init(&pDispatcher->NotEmptyCond, NULL);
+    pthread_cond_init(&pDispatcher->LeaveCond, NULL);
+    pthread_cond_init(&pDispatcher->DeliveredCond, NULL);
+    pDispatcher->pFifoLink = pFifoLinkObj;
+
+    pDispatcher->LinkID = pFifoLinkObj->pOwnerLinkObj->ID;
+    pDispatcher->CbRecvDat_F = pFifoLinkObj->DatReceiver.CbRecvDat_F;
+    pDispatcher->CbRecvDatBatch_F = pFifoLinkObj->DatReceiver.CbRecvDatBatch_F;
+    pDispatcher->pCbPrivData = pFifoLinkObj->DatReceiver.pCbPrivData;
+    pDispatcher->MaxBatchDatNum = pFifoLinkObj->DatReceiver.BatchArgs.MaxDatNum;
+    pDispatcher->MaxBatchDatBytes = pFifoLinkObj->DatReceiver.BatchArgs.MaxDatBytes;
+    pDispatcher->MaxBatchDelayUS = pFifoLinkObj->DatReceiver.BatchArgs.MaxDelayUS;
+    pDispatcher->IsJoinData = pFifoLinkObj->DatReceiver.BatchArgs.IsJoinData;
+    // Start by waiting for full batches, the first batch's callback cost will correct it
+    pDispatcher->TargetBatchDatNum = (pDispatcher->MaxBatchDelayUS > 0) ? pDispatcher->MaxBatchDatNum : 1;
+
+    if (pDispatcher->CbRecvDatBatch_F) {
+        pDispatcher->pBatchDatDescs = (IOC_DatDesc_T*)calloc(pDispatcher->MaxBatchDatNum, sizeof(IOC_DatDesc_T));
+        if (!pDispatcher->pBatchDatDescs) {
+            pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+            __IOC_destroyDatDispatcher_ofProtoFifo(pDispatcher);
+            return NULL;
+        }
     }
 
-    size_t AvailableSpace = pFifoLinkObj->DatReceiver.CallbackBatch.BatchBufferSize -
-                            pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize;
-
-    if (DataSize <= AvailableSpace) {
-        // Add data to batch
-        char* pBatchPos = pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer +
-                          pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize;
-        memcpy(pBatchPos, pData, DataSize);
-        pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize += DataSize;
-
-        _IOC_LogDebug("🔄 Added %zu bytes to time-window batch (total: %zu bytes)\n", DataSize,
-                      pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize);
-
-        pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-        return IOC_RESULT_SUCCESS;
-    } else {
-        pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-        return IOC_RESULT_BUFFER_FULL;
+    int ThreadResult = pthread_create(&pDispatcher->ThreadID, NULL, __IOC_datDispatcherThreadFunc, pDispatcher);
+    if (ThreadResult != 0) {
+        pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+        __IOC_destroyDatDispatcher_ofProtoFifo(pDispatcher);
+        return NULL;
     }
+
+    pFifoLinkObj->DatReceiver.pDispatcher = pDispatcher;
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
+    return pDispatcher;
 }
 
 /**
- * @brief Flush accumulated callback batch data by delivering it via callback
+ * @brief Copy the data into a recycled context and queue it to the receiver's dispatcher
+ *    The context is popped and queued under the dispatcher's Mutex, but allocated and filled without it,
+ *    so copying a large payload never stalls the dispatcher thread or other DatSenders of the same receiver.
  * @param pFifoLinkObj Pointer to the ProtoFifo link object (receiver side)
- * @return IOC_RESULT_SUCCESS on successful batch delivery
+ * @param pCompleter Completer of the send, owned by the context only if queued
+ * @return IOC_RESULT_SUCCESS if queued,
+ *         IOC_RESULT_LINK_BROKEN if the receiver is closing,
+ *         IOC_RESULT_POSIX_ENOMEM if no dispatcher or no memory, then caller returns it to the DatSender
  */
-static IOC_Result_T __IOC_flushCallbackBatch(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
-    if (!pFifoLinkObj) {
-        return IOC_RESULT_INVALID_PARAM;
-    }
-
-    pthread_mutex_lock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-
-    if (pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize == 0) {
-        pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-        return IOC_RESULT_SUCCESS;  // Nothing to flush
+static IOC_Result_T __IOC_enqueueDatToDispatcher_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj,
+                                                             const IOC_DatDesc_pT pDatDesc,
+                                                             _IOC_DatCompleter_pT pCompleter) {
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = __IOC_lockDatDispatcher_ofProtoFifo(pFifoLinkObj);
+    if (!pDispatcher) {
+        return IOC_RESULT_POSIX_ENOMEM;
     }
 
-    // Extract callback info and batch data under protection
-    IOC_CbRecvDat_F CbRecvDat_F = pFifoLinkObj->DatReceiver.CbRecvDat_F;
-    void* pCbPrivData = pFifoLinkObj->DatReceiver.pCbPrivData;
-    char* pBatchData = pFifoLinkObj->DatReceiver.CallbackBatch.pBatchBuffer;
-    size_t BatchSize = pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize;
-
-    // Reset batch state before callback to allow new batching during callback
-    pFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize = 0;
-
-    pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    __AsyncCallbackContext_T* pCtx = NULL;
 
-    // Deliver batched data via callback if receiver is registered
-    if (CbRecvDat_F && pFifoLinkObj->DatReceiver.IsReceiverRegistered) {
-        // Create temporary DatDesc for batched data
-        IOC_DatDesc_T BatchDatDesc = {0};
-        IOC_initDatDesc(&BatchDatDesc);
-        BatchDatDesc.Payload.pData = pBatchData;
-        BatchDatDesc.Payload.PtrDataSize = BatchSize;
-        BatchDatDesc.Payload.PtrDataLen = BatchSize;
+    // Counted in EnqueuingNum, closeLink can't free the dispatcher while its Mutex is released below
+    pDispatcher->EnqueuingNum++;
 
-        _IOC_LogDebug("📦 Delivering callback-batched data: %zu bytes in single callback\n", BatchSize);
-
-        // Call receiver callback with batched data
-        IOC_Result_T CallbackResult = CbRecvDat_F(pFifoLinkObj->pOwnerLinkObj->ID, &BatchDatDesc, pCbPrivData);
-
-        return CallbackResult;
+    if (pDispatcher->IsStopping) {
+        Result = IOC_RESULT_LINK_BROKEN;
+        goto _LeaveDispatcher;
     }
 
-    return IOC_RESULT_SUCCESS;
-}
-
-/**
- * @brief Async callback thread function - executes callback in detached thread
- * @param pArg Pointer to __AsyncCallbackContext_T
- * @return NULL (detached thread)
- *
- * This function prevents circular deadlock by executing callbacks asynchronously.
- * If a callback calls IOC_sendDAT, which triggers another callback that calls IOC_sendDAT
- * back to the original sender, the async dispatch breaks the synchronous call chain.
- */
-static void* __IOC_asyncCallbackThreadFunc(void* pArg) {
-    __AsyncCallbackContext_T* pCtx = (__AsyncCallbackContext_T*)pArg;
-    if (!pCtx) return NULL;
+    pCtx = pDispatcher->pFreeList;
+    if (pCtx) {
+        pDispatcher->pFreeList = pCtx->pNext;
+        pDispatcher->FreeNum--;
+    }
+    pthread_mutex_unlock(&pDispatcher->Mutex);
 
-    _IOC_LogDebug("🧵 Async callback thread started for LinkID=%llu\n", pCtx->LinkID);
+    //===>>> Without the dispatcher's Mutex: the popped context is owned by this DatSender only
+    if (!pCtx) {
+        pCtx = (__AsyncCallbackContext_T*)calloc(1, sizeof(__AsyncCallbackContext_T));
+        if (!pCtx) {
+            Result = IOC_RESULT_POSIX_ENOMEM;
+        }
+    }
 
-    // Execute the callback
-    IOC_Result_T CallbackResult = pCtx->Callback(pCtx->LinkID, &pCtx->DatDesc, pCtx->pPrivData);
+    // Grow-only payload buffer, a recycled context usually fits already, zero-copy data needs none
+    if (pCtx && !pDatDesc->Payload.pDatBuf && pDatDesc->Payload.PtrDataSize > pCtx->PayloadBufSize) {
+        void* pNewPayloadBuf = realloc(pCtx->pPayloadBuf, pDatDesc->Payload.PtrDataSize);
+        if (pNewPayloadBuf) {
+            pCtx->pPayloadBuf = pNewPayloadBuf;
+            pCtx->PayloadBufSize = pDatDesc->Payload.PtrDataSize;
+        } else {
+            Result = IOC_RESULT_POSIX_ENOMEM;
+        }
+    }
 
-    // Record timing
-    struct timespec callbackEnd;
-    clock_gettime(CLOCK_MONOTONIC, &callbackEnd);
-    long callbackDurationMs = __IOC_getElapsedTimeMs(&pCtx->StartTime, &callbackEnd);
+    if (IOC_RESULT_SUCCESS == Result) {
+        if (pDispatcher->MaxBatchDelayUS > 0) {
+            clock_gettime(CLOCK_MONOTONIC, &pCtx->SendTime);
+        }
+        pCtx->DatDesc = *pDatDesc;  // Copy descriptor
+        if (pDatDesc->Payload.pDatBuf) {
+            IOC_holdDatBuf(pDatDesc->Payload.pDatBuf);  // released by the dispatcher after CbRecvDat_F returns
+        } else {
+            pCtx->DatDesc.Payload.pData = pCtx->pPayloadBuf;
+            if (pDatDesc->Payload.PtrDataSize > 0 && pDatDesc->Payload.pData) {
+                memcpy(pCtx->pPayloadBuf, pDatDesc->Payload.pData, pDatDesc->Payload.PtrDataSize);
+            }
+        }
+    }
 
-    _IOC_LogDebug("✅ Async callback completed in %ld ms (result=0x%x)\n", callbackDurationMs, CallbackResult);
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    //===<<< With the dispatcher's Mutex again
 
-    // Update callback batch timing
-    if (pCtx->pFifoLink) {
-        pthread_mutex_lock(&pCtx->pFifoLink->DatReceiver.CallbackBatch.BatchMutex);
-        pCtx->pFifoLink->DatReceiver.CallbackBatch.LastCallbackEnd = callbackEnd;
-        pCtx->pFifoLink->DatReceiver.CallbackBatch.IsInCallback = false;
+    // closeLink may have stopped the dispatcher meanwhile, then it never calls back this context
+    if (IOC_RESULT_SUCCESS == Result && pDispatcher->IsStopping) {
+        if (pCtx->DatDesc.Payload.pDatBuf) {
+            IOC_releaseDatBuf(pCtx->DatDesc.Payload.pDatBuf);
+        }
+        Result = IOC_RESULT_LINK_BROKEN;
+    }
 
-        // Check if should open batching window after callback
-        if (__IOC_shouldOpenBatchWindow(pCtx->pFifoLink, callbackDurationMs)) {
-            pCtx->pFifoLink->DatReceiver.CallbackBatch.IsBatchWindowOpen = true;
-            pCtx->pFifoLink->DatReceiver.CallbackBatch.BatchWindowStart = callbackEnd;
-            _IOC_LogDebug("🚀 Async callback was slow (%ld ms), opening batching window\n", callbackDurationMs);
+    if (Result != IOC_RESULT_SUCCESS) {
+        if (pCtx) {
+            pCtx->DatDesc.Payload.pDatBuf = NULL;
+            pCtx->pNext = pDispatcher->pFreeList;
+            pDispatcher->pFreeList = pCtx;
+            pDispatcher->FreeNum++;
         }
-        pthread_mutex_unlock(&pCtx->pFifoLink->DatReceiver.CallbackBatch.BatchMutex);
+        goto _LeaveDispatcher;
+    }
 
-        // Flush any accumulated batch data
-        size_t batchedDataSize;
-        pthread_mutex_lock(&pCtx->pFifoLink->DatReceiver.CallbackBatch.BatchMutex);
-        batchedDataSize = pCtx->pFifoLink->DatReceiver.CallbackBatch.AccumulatedDataSize;
-        pthread_mutex_unlock(&pCtx->pFifoLink->DatReceiver.CallbackBatch.BatchMutex);
+    pCtx->Completer = *pCompleter;  // moved to the context, completed by the dispatcher
 
-        if (batchedDataSize > 0) {
-            _IOC_LogDebug("🔄 Flushing %zu bytes of batch data after async callback\n", batchedDataSize);
-            __IOC_flushCallbackBatch(pCtx->pFifoLink);
-        }
+    pCtx->pNext = NULL;
+    if (pDispatcher->pPendingTail) {
+        pDispatcher->pPendingTail->pNext = pCtx;
+    } else {
+        pDispatcher->pPendingHead = pCtx;
     }
+    pDispatcher->pPendingTail = pCtx;
 
-    // Cleanup
-    if (pCtx->DatDesc.Payload.pData) {
-        free((void*)pCtx->DatDesc.Payload.pData);
+    pDispatcher->QueuedDatNum++;
+    pDispatcher->QueuedDatSeq++;
+    if (pDispatcher->QueuedDatNum > pDispatcher->HighWatermark) {
+        pDispatcher->HighWatermark = pDispatcher->QueuedDatNum;
+    }
+    // Wake the dispatcher on the first chunk, or when the batch it waits for is full, not on each chunk
+    if (1 == pDispatcher->QueuedDatNum || pDispatcher->QueuedDatNum >= pDispatcher->TargetBatchDatNum) {
+        pthread_cond_signal(&pDispatcher->NotEmptyCond);
     }
-    free(pCtx);
 
-    _IOC_LogDebug("🧵 Async callback thread finished\n");
-    return NULL;
+_LeaveDispatcher:
+    pDispatcher->EnqueuingNum--;
+    if (pDispatcher->IsStopping && 0 == pDispatcher->EnqueuingNum) {
+        pthread_cond_broadcast(&pDispatcher->LeaveCond);
+    }
+    pthread_mutex_unlock(&pDispatcher->Mutex);
+    return Result;
 }
 
 /**
- * @brief Calculate elapsed time in milliseconds between two timespec structures
- * @param start Start time
- * @param end End time
- * @return Elapsed time in milliseconds
+ * @brief Stop the receiver's dispatcher after it executed all queued callbacks, called by closeLink
+ * @param pFifoLinkObj Pointer to the ProtoFifo link object (receiver side)
  */
-static long __IOC_getElapsedTimeMs(const struct timespec* start, const struct timespec* end) {
-    long seconds = end->tv_sec - start->tv_sec;
-    long nanoseconds = end->tv_nsec - start->tv_nsec;
-    return seconds * 1000 + nanoseconds / 1000000;
-}
+static void __IOC_stopDatDispatcher_ofProtoFifo(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
+    pthread_mutex_lock(&pFifoLinkObj->Mutex);
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = pFifoLinkObj->DatReceiver.pDispatcher;
+    pFifoLinkObj->DatReceiver.pDispatcher = NULL;
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
-/**
- * @brief Check if the current batching window has expired
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- * @return true if window has expired, false otherwise
- */
-static bool __IOC_isBatchWindowExpired(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
-    if (!pFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen) {
-        return false;
+    if (!pDispatcher) {
+        return;
     }
 
-    struct timespec currentTime;
-    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+    bool IsCalledByDispatcher = pthread_equal(pthread_self(), pDispatcher->ThreadID);
 
-    long elapsed = __IOC_getElapsedTimeMs(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowStart, &currentTime);
-    return elapsed >= pFifoLinkObj->DatReceiver.CallbackBatch.BatchWindowDurationMs;
-}
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    pDispatcher->IsStopping = true;
+    if (IsCalledByDispatcher) {
+        pDispatcher->pFifoLink = NULL;  // drop the rest, and let the thread free pDispatcher when it exits
+    }
+    pthread_cond_broadcast(&pDispatcher->NotEmptyCond);
+    pthread_cond_broadcast(&pDispatcher->DeliveredCond);
+    pthread_mutex_unlock(&pDispatcher->Mutex);
 
-/**
- * @brief Close the current batching window and flush accumulated data
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- */
-static void __IOC_closeBatchWindow(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj) {
-    pthread_mutex_lock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
+    if (IsCalledByDispatcher) {
+        pthread_detach(pDispatcher->ThreadID);
+    } else {
+        pthread_join(pDispatcher->ThreadID, NULL);
+        __IOC_destroyDatDispatcher_ofProtoFifo(pDispatcher);
+    }
+}
 
-    if (pFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen) {
-        pFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen = false;
-        _IOC_LogDebug("🔚 Closing batch window, flushing accumulated data\n");
+static IOC_Result_T __IOC_getDatDispatchStats_ofProtoFifo(_IOC_LinkObject_pT pLinkObj,
+                                                          IOC_DatDispatchStats_pT pDispatchStats) {
+    _IOC_ProtoFifoLinkObject_pT pFifoLinkObj = (_IOC_ProtoFifoLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pFifoLinkObj) {
+        return IOC_RESULT_NOT_EXIST_LINK;
     }
 
-    pthread_mutex_unlock(&pFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
+    memset(pDispatchStats, 0, sizeof(IOC_DatDispatchStats_T));
+    _IOC_DatCredit_getStats(&pFifoLinkObj->DatReceiver.Credit, &pDispatchStats->Capacity, NULL,
+                            &pDispatchStats->BlockedDatNum, &pDispatchStats->OverflowDatNum);
 
-    // Flush any accumulated data
-    __IOC_flushCallbackBatch(pFifoLinkObj);
-}
+    // Hold the link's Mutex so closeLink can't free the dispatcher meanwhile
+    pthread_mutex_lock(&pFifoLinkObj->Mutex);
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = pFifoLinkObj->DatReceiver.pDispatcher;
+    if (pDispatcher) {
+        pthread_mutex_lock(&pDispatcher->Mutex);
+        pDispatchStats->QueuedDatNum = pDispatcher->QueuedDatNum;
+        pDispatchStats->HighWatermark = pDispatcher->HighWatermark;
+        pDispatchStats->DispatchedDatNum = pDispatcher->DispatchedDatNum;
+        pDispatchStats->DispatchedBatchNum = pDispatcher->DispatchedBatchNum;
+        pDispatchStats->TargetBatchDatNum = pDispatcher->TargetBatchDatNum;
+        pthread_mutex_unlock(&pDispatcher->Mutex);
+    }
+    pthread_mutex_unlock(&pFifoLinkObj->Mutex);
 
-/**
- * @brief Determine if a batching window should be opened based on callback duration
- * @param pFifoLinkObj Pointer to the ProtoFifo link object
- * @param callbackDurationMs Duration of the last callback in milliseconds
- * @return true if a batching window should be opened, false otherwise
- */
-static bool __IOC_shouldOpenBatchWindow(_IOC_ProtoFifoLinkObject_pT pFifoLinkObj, long callbackDurationMs) {
-    return callbackDurationMs >= pFifoLinkObj->DatReceiver.CallbackBatch.SlowCallbackThresholdMs;
+    return IOC_RESULT_SUCCESS;
 }
 
 //=================================================================================================
@@ -2501,6 +2506,11 @@ _IOC_SrvProtoMethods_T _gIOC_SrvProtoFifoMethods = {
     // 📈 PERFORMANCE BENEFITS: Direct memory access, no serialization, no buffering
     .OpSendData_F = __IOC_sendData_ofProtoFifo,
     .OpRecvData_F = __IOC_recvData_ofProtoFifo,
+    .OpGetDatDispatchStats_F = __IOC_getDatDispatchStats_ofProtoFifo,
+    .OpRecvDataV_F = __IOC_recvDataV_ofProtoFifo,
+    .OpPeekDataV_F = __IOC_peekDataV_ofProtoFifo,
+    .OpConsumeData_F = __IOC_consumeData_ofProtoFifo,
+    .OpFlushData_F = __IOC_flushData_ofProtoFifo,
 
     // 🎯 CMD METHODS: ProtoFifo command implementation using peer link pattern
     // - OpExecCmd_F: Find peer link and execute command via callback (CmdInitiator → CmdExecutor)
@@ -2512,12 +2522,16 @@ _IOC_SrvProtoMethods_T _gIOC_SrvProtoFifoMethods = {
 };
 
 /**
- * @brief Flush any accumulated batch data for ProtoFifo protocol
+ * @brief Wait until the data sent before this flush is delivered to the peer's CbRecvDat_F,
+ *    data to a polling receiver is already in its polling buffer once IOC_sendDAT returns.
+ *    The dispatcher counts delivered chunks by DeliveredDatSeq, so this flush waits for QueuedDatSeq of now,
+ *    and lets the dispatcher deliver the pending batch without waiting for more.
  * @param pLinkObj Pointer to the link object
- * @param pOption Optional parameters (can be NULL)
- * @return IOC_RESULT_SUCCESS on successful flush
+ * @param pOption Optional parameters (can be NULL), IOC_OPTID_TIMEOUT bounds the wait, infinite by default
+ * @return IOC_RESULT_SUCCESS if delivered, IOC_RESULT_TIMEOUT if not yet,
+ *         IOC_RESULT_LINK_BROKEN if the receiver closed before delivering them
  */
-IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption) {
+static IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption) {
     if (!pLinkObj) {
         return IOC_RESULT_INVALID_PARAM;
     }
@@ -2536,22 +2550,61 @@ IOC_Result_T __IOC_flushData_ofProtoFifo(_IOC_LinkObject_pT pLinkObj, const IOC_
         return IOC_RESULT_NOT_EXIST_LINK;
     }
 
-    // 🚀 BATCHING FLUSH: Close any open batching window and flush accumulated data
-    // This ensures that data queued during time-window batching is delivered to receivers
-    // when the application calls IOC_flushDAT() to signal end of burst or data stream
-    _IOC_LogDebug("🔄 Flushing accumulated batch data for ProtoFifo link\n");
+    _IOC_LogDebug("🔄 Flushing data queued to the receiver's dispatcher for ProtoFifo link\n");
+
+    // Hold the peer's Mutex so closeLink can't free the dispatcher till we're counted in EnqueuingNum
+    pthread_mutex_lock(&pPeerFifoLinkObj->Mutex);
+    _IOC_ProtoFifoDatDispatcher_pT pDispatcher = pPeerFifoLinkObj->DatReceiver.pDispatcher;
+    if (!pDispatcher) {
+        pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
+        return IOC_RESULT_SUCCESS;  // Nothing ever queued
+    }
+    pthread_mutex_lock(&pDispatcher->Mutex);
+    pthread_mutex_unlock(&pPeerFifoLinkObj->Mutex);
 
-    pthread_mutex_lock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
-    bool IsBatchWindowOpen = pPeerFifoLinkObj->DatReceiver.CallbackBatch.IsBatchWindowOpen;
-    size_t AccumulatedSize = pPeerFifoLinkObj->DatReceiver.CallbackBatch.AccumulatedDataSize;
-    pthread_mutex_unlock(&pPeerFifoLinkObj->DatReceiver.CallbackBatch.BatchMutex);
+    // 🚀 BATCHING FLUSH: Let the receiver's dispatcher deliver its pending batch now, without waiting for more
+    ULONG_T FlushDatSeq = pDispatcher->QueuedDatSeq;
+    pDispatcher->FlushedDatSeq = FlushDatSeq;
+    pthread_cond_signal(&pDispatcher->NotEmptyCond);
 
-    if (IsBatchWindowOpen || AccumulatedSize > 0) {
-        _IOC_LogDebug("📦 Closing batch window and flushing %zu bytes of accumulated data\n", AccumulatedSize);
-        __IOC_closeBatchWindow(pPeerFifoLinkObj);
+    // Flushing from a CbRecvDat_F doesn't wait, like its sends don't wait for credits,
+    //  so circular chains never deadlock
+    if (_mIsInDatDispatcherThread) {
+        pthread_mutex_unlock(&pDispatcher->Mutex);
         return IOC_RESULT_SUCCESS;
     }
 
-    // No batch data to flush
-    return IOC_RESULT_SUCCESS;
+    ULONG_T TimeoutUS = IOC_Option_getTimeoutUS(pOption);
+    struct timespec AbsTimeout;
+    if (TimeoutUS != IOC_TIMEOUT_INFINITE) {
+        clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+        AbsTimeout.tv_sec += TimeoutUS / 1000000;
+        AbsTimeout.tv_nsec += (TimeoutUS % 1000000) * 1000;
+        if (AbsTimeout.tv_nsec >= 1000000000L) {
+            AbsTimeout.tv_sec += 1;
+            AbsTimeout.tv_nsec -= 1000000000L;
+        }
+    }
+
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    pDispatcher->EnqueuingNum++;
+    while (pDispatcher->DeliveredDatSeq < FlushDatSeq && pDispatcher->pFifoLink) {
+        if (TimeoutUS == IOC_TIMEOUT_INFINITE) {
+            pthread_cond_wait(&pDispatcher->DeliveredCond, &pDispatcher->Mutex);
+        } else if (TimeoutUS == IOC_TIMEOUT_NONBLOCK ||
+                   ETIMEDOUT == pthread_cond_timedwait(&pDispatcher->DeliveredCond, &pDispatcher->Mutex,
+                                                       &AbsTimeout)) {
+            break;
+        }
+    }
+    if (pDispatcher->DeliveredDatSeq < FlushDatSeq) {
+        Result = pDispatcher->pFifoLink ? IOC_RESULT_TIMEOUT : IOC_RESULT_LINK_BROKEN;
+    }
+    pDispatcher->EnqueuingNum--;
+    if (pDispatcher->IsStopping && 0 == pDispatcher->EnqueuingNum) {
+        pthread_cond_broadcast(&pDispatcher->LeaveCond);
+    }
+    pthread_mutex_unlock(&pDispatcher->Mutex);
+
+    return Result;
 }
\ No newline at end of file
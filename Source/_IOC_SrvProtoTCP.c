@@ -8,18 +8,26 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <time.h>
 #include <unistd.h>
 
 #include "IOC/IOC.h"
 #include "_IOC.h"
+#include "_IOC_DatCredit.h"
+#include "_IOC_DatRing.h"
 #include "_IOC_Logging.h"
+#include "_IOC_Reactor.h"
+#include "_IOC_TCPWire.h"
 #include "_IOC_Types.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,11 +39,16 @@
  */
 typedef enum {
     TCP_MSG_USAGE_NEGOTIATION = 0,  // Client sends usage, server responds with negotiated usage
-    TCP_MSG_EVENT = 1,
-    TCP_MSG_COMMAND = 2,
+    TCP_MSG_EVENT = 1,    // Payload is IOC_EvtDesc_T by _IOC_TCPWire_encodeEvt
+    TCP_MSG_COMMAND = 2,  // Payload is IOC_CmdDesc_T by _IOC_TCPWire_encodeCmd, then its pointer payload if any
     TCP_MSG_DATA = 3,
     TCP_MSG_SUBSCRIBE = 4,
     TCP_MSG_UNSUBSCRIBE = 5,
+    TCP_MSG_DAT_CREDIT = 6,  // DatReceiver returns credits of data it consumed, payload is TCPDatCredit_T
+    TCP_MSG_DAT_FLUSH = 7,      // DatSender marks an IOC_flushDAT after its data, payload is TCPDatFlush_T
+    TCP_MSG_DAT_FLUSH_ACK = 8,  // DatReceiver got all data before the marked flush, payload is the same TCPDatFlush_T
+    TCP_MSG_DATA_TRACKED = 9,    // Same as TCP_MSG_DATA, sent with IOC_OPTID_DAT_COMPLETION, answered by below
+    TCP_MSG_DAT_COMPLETION = 10,  // DatReceiver's result of a TCP_MSG_DATA_TRACKED, payload is TCPDatCompletion_T
 } TCPMessageType_T;
 
 /**
@@ -46,14 +59,86 @@ typedef struct {
     uint32_t DataSize;  // Size of message payload
 } __attribute__((packed)) TCPMessageHeader_T;
 
+// Most segments of one message written by __IOC_sendMsg_ofProtoTCP, its header and a data chunk's IOC_DatVec_T
+#define TCP_MSG_MAX_IOV_NUM (1 + IOC_DATVEC_MAX_NUM)
+#define TCP_COALESCE_DEFAULT_MAX_BYTES (16 * 1024)
+// Each link reads what has arrived into its own buffer of TCP_RECV_BUF_SIZE, and handles data up to
+//  TCP_RECV_INPLACE_MAX_SIZE in place there, larger data is received into a slab or polling buffer instead.
+#define TCP_RECV_BUF_SIZE (64 * 1024)
+#define TCP_RECV_INPLACE_MAX_SIZE (16 * 1024)
+// Reads a link makes in one readiness at most, then it's re-armed behind other ready links,
+//  so a busy link never starves the others sharing reactor threads.
+#define TCP_RECV_READ_BUDGET 16
+
 /**
- * @brief TCP-specific service object
+ * @brief DAT credits in network byte order, granted by a DatReceiver after its usage in negotiation,
+ *    and returned by TCP_MSG_DAT_CREDIT. A grant of 0 means unlimited, such as from a peer without credits.
+ */
+typedef struct {
+    uint32_t DatNum;
+    uint32_t DatBytes;
+    uint32_t Flags;  // TCP_DAT_CREDIT_FLAG_XXX of a grant, 0 when returned
+} __attribute__((packed)) TCPDatCredit_T;
+
+// DatReceiver polls by IOC_recvDAT, which MAY never be called, so sendDAT without a timeout won't wait for credits
+#define TCP_DAT_CREDIT_FLAG_POLLING 0x1
+
+/**
+ * @brief Sequence number of a DatSender's IOC_flushDAT in network byte order, monotonic and wrapping.
+ *    DatReceiver handles messages in order, so once it gets the flush, it got all data sent before it.
  */
 typedef struct {
+    uint32_t FlushSeq;
+} __attribute__((packed)) TCPDatFlush_T;
+
+/**
+ * @brief Result of the receiver callback of a TCP_MSG_DATA_TRACKED in network byte order.
+ *    DatReceiver handles messages in order, so completions come in the order of their data,
+ *    and need no sequence number.
+ */
+typedef struct {
+    int32_t Result;  // IOC_Result_T
+} __attribute__((packed)) TCPDatCompletion_T;
+
+typedef struct _IOC_ProtoTCPServiceObjectStru _IOC_ProtoTCPServiceObject_T, *_IOC_ProtoTCPServiceObject_pT;
+
+/**
+ * @brief Client connected to a TCP service, whose usage negotiation is received by the reactor,
+ *    then it waits in the service's AcceptableClients for acceptClient to reply and make it a link.
+ */
+typedef struct _IOC_ProtoTCPPendingClientStru {
+    struct _IOC_ProtoTCPPendingClientStru* pNext;
+    _IOC_ProtoTCPServiceObject_pT pTCPSrvObj;
+    _IOC_ReactorFd_T ReactorFd;  // Fd is the client socket
+
+    // TCPMessageHeader_T of TCP_MSG_USAGE_NEGOTIATION, IOC_LinkUsage_T, then TCPDatCredit_T if DataSize has it
+    uint8_t Negotiation[sizeof(TCPMessageHeader_T) + sizeof(IOC_LinkUsage_T) + sizeof(TCPDatCredit_T)];
+    ULONG_T NegotiationSize, RecvdSize;
+    IOC_Result_T Result;  // Of receiving the negotiation, acceptClient fails by it if it's not SUCCESS
+} _IOC_ProtoTCPPendingClient_T, *_IOC_ProtoTCPPendingClient_pT;
+
+/**
+ * @brief TCP-specific service object
+ */
+struct _IOC_ProtoTCPServiceObjectStru {
     _IOC_ServiceObject_pT pSrvObj;
-    int ListenSocketFd;  // Listening socket file descriptor
-    uint16_t Port;       // Bound port number
-} _IOC_ProtoTCPServiceObject_T, *_IOC_ProtoTCPServiceObject_pT;
+    uint16_t Port;  // Bound port number
+
+    ULONG_T DatPollingBufSize;  // COPY of UsageArgs.pDat->PollingBufSize, pDat may be gone when acceptClient
+    IOC_CoalesceArgs_T EvtCoalesce, DatCoalesce;  // COPY of UsageArgs.pEvt/pDat->Coalesce, the same
+
+    // 🚪 ACCEPTOR: The reactor accepts clients into NegotiatingClients, and moves each to AcceptableClients
+    // once its negotiation is received, from which acceptClient takes them in order.
+    // Each listener's Fd is a non-blocking listening socket on Port, accepted by its own reactor shard,
+    // which keeps serving the links it accepted.
+    _IOC_ReactorFd_T ListenReactorFds[_IOC_REACTOR_MAX_SHARD_NUM];
+    ULONG_T ListenerNum;
+    pthread_mutex_t Mutex;  // Protects all below
+    pthread_cond_t AcceptableCond;
+    _IOC_ProtoTCPPendingClient_pT pNegotiatingClients;
+    _IOC_ProtoTCPPendingClient_pT pAcceptableHead, pAcceptableTail;
+    bool IsOffline;  // Then the reactor leaves pending clients to offlineService
+};
 
 /**
  * @brief TCP-specific link object
@@ -62,6 +147,7 @@ typedef struct {
     _IOC_LinkObject_pT pOwnerLinkObj;
     int SocketFd;  // Connected socket file descriptor
     pthread_mutex_t Mutex;
+    pthread_mutex_t SendMutex;  // Keeps each message whole when several threads send, such as credits and data
 
     // Event subscription storage
     IOC_SubEvtArgs_T SubEvtArgs;
@@ -76,7 +162,7 @@ typedef struct {
     pthread_cond_t CmdResponseCond;
     int CmdResponseReady;
     IOC_CmdDesc_T CmdResponse;
-    IOC_Result_T RecvError;  // Stores error from recv thread (0 if no error)
+    IOC_Result_T RecvError;  // Stores error of receiving (0 if no error)
 
     // Command request queue (for executor side polling)
     IOC_CmdDesc_T IncomingCmdQueue[16];
@@ -85,9 +171,45 @@ typedef struct {
     int IncomingCmdCount;
     pthread_cond_t IncomingCmdCond;
 
-    // Background receiver thread
-    pthread_t RecvThread;
-    int RecvThreadRunning;
+    // 🔄 RECEIVER: The shared reactor calls __IOC_onLinkReady_ofProtoTCP whenever SocketFd is readable,
+    // which handles messages as far as they've arrived, and keeps the partial one here till next time.
+    // What has arrived is read into pBuf by as large reads as it has room for, and messages are parsed from it,
+    // so many small messages cost one read, while a larger payload is read into its own buffer after its head.
+    struct {
+        _IOC_ReactorFd_T ReactorFd;
+        uint8_t* pBuf;             // Of TCP_RECV_BUF_SIZE, allocated by the first read
+        ULONG_T BufBegin, BufEnd;  // Bytes read but not parsed yet are [BufBegin, BufEnd) of pBuf
+        ULONG_T ReadNum;           // Reads in this readiness, at most TCP_RECV_READ_BUDGET
+        bool IsSockDrained;        // The last read got less than asked, so nothing more has arrived by then
+        TCPMessageHeader_T Header;
+        ULONG_T HeaderSize;  // Parsed bytes of Header, either 0 or whole, then its payload is being received
+        void* pPayload;      // Where the payload is received, NULL to skip it, such as of an unknown message
+        bool IsInPlace;      // Or the payload is handled in pBuf, where pPayload points once it's whole,
+                             //  such as of an event, a command or data up to TCP_RECV_INPLACE_MAX_SIZE
+        ULONG_T PayloadSize, RecvdSize;
+        union {
+            TCPDatCredit_T Credit;
+            TCPDatFlush_T Flush;
+            TCPDatCompletion_T Completion;
+        } Fixed;                 // Payload of messages in fixed size, copied out of pBuf to align its fields
+        IOC_DatBuf_pT pDatBuf;   // Slab of a TCP_MSG_DATA(_TRACKED) payload
+        bool IsInPollingBuffer;  // Or the payload is received in space reserved in polling buffer
+        void* pCmdMsg;           // Malloc'ed for a TCP_MSG_COMMAND payload over TCP_RECV_INPLACE_MAX_SIZE
+        bool IsDone;             // Link is broken, and its waiters are woken by __IOC_endRecv_ofProtoTCP
+    } Recv;
+
+    // 📮 SENDER: Each message is framed with its header in ONE write, and small ones MAY be coalesced in pBuf
+    // by the link's IOC_CoalesceArgs_T, then written once MaxBytes would be exceeded, by FlushTimer MaxDelayUS
+    // after the first one, or together with the next message not coalesced. All below are protected by SendMutex.
+    // Kernel coalescing is off(TCP_NODELAY), as each write is a whole message or batch, which Nagle would delay,
+    // and TCP_CORK isn't used either, whose 200ms ceiling is far beyond MaxDelayUS.
+    struct {
+        ULONG_T MaxDelayUS, MaxBytes;  // Coalescing args with defaults applied, pBuf is NULL if MaxDelayUS is 0
+        uint8_t* pBuf;
+        ULONG_T BufSize;              // Bytes of coalesced messages waiting in pBuf, always < MaxBytes
+        _IOC_ReactorFd_T FlushTimer;  // Reactor timer, armed when the first message is coalesced in pBuf
+        IOC_Result_T Result;          // Of writing by FlushTimer, returned by later sends once it failed
+    } Send;
 
     // Peer subscription tracking (for producer side)
     int PeerHasSubscription;
@@ -95,14 +217,39 @@ typedef struct {
     // 📦 DATA POLLING SUPPORT: Buffer for storing data when no callback is registered
     // This enables polling-based data reception via IOC_recvDAT without callback
     struct {
-        char* pDataBuffer;                 // Circular buffer for received data
-        size_t BufferSize;                 // Total buffer size (allocated)
-        size_t DataStart;                  // Start position of valid data (read pointer)
-        size_t DataEnd;                    // End position of valid data (write pointer)
-        size_t AvailableData;              // Amount of valid data in buffer
-        pthread_cond_t DataAvailableCond;  // Condition variable for blocking reads
-        bool IsPollingMode;                // True if receiver is in polling mode (no callback)
+        _IOC_DatRing_T Ring;  // Receiver recv() into it and IOC_recvDAT reads without sharing a lock
+        bool IsPollingMode;   // True if receiver is in polling mode (no callback)
     } PollingBuffer;
+
+    // 🎫 FLOW CONTROL: Credits granted by the peer DatReceiver in negotiation, spent by sendDAT,
+    // and returned by its TCP_MSG_DAT_CREDIT, closed when receiving ends.
+    _IOC_DatCredit_T DatCredit;
+    bool IsPeerDatPolling;  // TCP_DAT_CREDIT_FLAG_POLLING of the peer's grant
+
+    // Credits this DatReceiver granted to the peer, returned in batches of a quarter of them, or once it's idle
+    struct {
+        ULONG_T MaxDatNum, MaxDatBytes;            // 0 and 0 means not granted, then never returned
+        uint32_t Flags;                            // TCP_DAT_CREDIT_FLAG_XXX
+        ULONG_T ConsumedDatNum, ConsumedDatBytes;  // Monotonic, by the receiver callback in reactor thread
+        ULONG_T ReturnedDatNum, ReturnedDatBytes;  // Monotonic, protected by SendMutex
+    } DatGrant;
+
+    // 🚧 FLUSH BARRIER: IOC_flushDAT sends TCP_MSG_DAT_FLUSH of the next SentSeq after its data,
+    // then waits for the peer's TCP_MSG_DAT_FLUSH_ACK of it, which the receiver sets as AckedSeq.
+    struct {
+        pthread_cond_t AckedCond;
+        uint32_t SentSeq;   // protected by SendMutex, so flushes are sent in order of their SentSeq
+        uint32_t AckedSeq;  // protected by Mutex, as all below
+        ULONG_T WaiterNum;  // closeLink waits for them to leave
+        bool IsRecvDone;    // receiving ended, no more TCP_MSG_DAT_FLUSH_ACK
+    } DatFlush;
+
+    // 📬 SEND COMPLETION: Completers of TCP_MSG_DATA_TRACKED in send order, each completed by the peer's
+    // TCP_MSG_DAT_COMPLETION in the same order, or by IOC_RESULT_LINK_BROKEN when receiving ends.
+    struct {
+        _IOC_DatCompleter_pT pHead, pTail;  // protected by Mutex, appended with SendMutex held too
+        bool IsRecvDone;                    // protected by SendMutex, then nothing is appended anymore
+    } DatCompletion;
 } _IOC_ProtoTCPLinkObject_T, *_IOC_ProtoTCPLinkObject_pT;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -110,26 +257,14 @@ typedef struct {
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @brief Initialize polling buffer for data reception
+ * @brief Initialize polling buffer for data reception, of PollingBufSize or 64KB by default
  */
-static IOC_Result_T __IOC_initPollingBuffer_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+static IOC_Result_T __IOC_initPollingBuffer_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj,
+                                                       ULONG_T PollingBufSize) {
     if (!pTCPLinkObj) return IOC_RESULT_INVALID_PARAM;
 
-    // Allocate circular buffer (64KB default size)
-    const size_t BufferSize = 64 * 1024;
-    pTCPLinkObj->PollingBuffer.pDataBuffer = (char*)malloc(BufferSize);
-    if (!pTCPLinkObj->PollingBuffer.pDataBuffer) {
-        return IOC_RESULT_POSIX_ENOMEM;
-    }
-
-    pTCPLinkObj->PollingBuffer.BufferSize = BufferSize;
-    pTCPLinkObj->PollingBuffer.DataStart = 0;
-    pTCPLinkObj->PollingBuffer.DataEnd = 0;
-    pTCPLinkObj->PollingBuffer.AvailableData = 0;
     pTCPLinkObj->PollingBuffer.IsPollingMode = false;
-    pthread_cond_init(&pTCPLinkObj->PollingBuffer.DataAvailableCond, NULL);
-
-    return IOC_RESULT_SUCCESS;
+    return _IOC_DatRing_initOne(&pTCPLinkObj->PollingBuffer.Ring, PollingBufSize);
 }
 
 /**
@@ -138,15 +273,11 @@ static IOC_Result_T __IOC_initPollingBuffer_ofProtoTCP(_IOC_ProtoTCPLinkObject_p
 static void __IOC_cleanupPollingBuffer_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
     if (!pTCPLinkObj) return;
 
-    if (pTCPLinkObj->PollingBuffer.pDataBuffer) {
-        free(pTCPLinkObj->PollingBuffer.pDataBuffer);
-        pTCPLinkObj->PollingBuffer.pDataBuffer = NULL;
-    }
-    pthread_cond_destroy(&pTCPLinkObj->PollingBuffer.DataAvailableCond);
+    _IOC_DatRing_deinitOne(&pTCPLinkObj->PollingBuffer.Ring);
 }
 
 /**
- * @brief Write data to polling buffer (called by receiver thread)
+ * @brief Write data to polling buffer (called by receiver)
  */
 static IOC_Result_T __IOC_writeDataToPollingBuffer(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, const void* pData,
                                                    size_t DataSize) {
@@ -154,45 +285,12 @@ static IOC_Result_T __IOC_writeDataToPollingBuffer(_IOC_ProtoTCPLinkObject_pT pT
         return IOC_RESULT_INVALID_PARAM;
     }
 
-    pthread_mutex_lock(&pTCPLinkObj->Mutex);
-
-    // Check if buffer has enough space
-    size_t FreeSpace = pTCPLinkObj->PollingBuffer.BufferSize - pTCPLinkObj->PollingBuffer.AvailableData;
-    if (DataSize > FreeSpace) {
-        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    // Receiving is this ring's only producer, same as its reservation, so it pushes without ProducerMutex.
+    IOC_Result_T Result = _IOC_DatRing_pushNotLocked(&pTCPLinkObj->PollingBuffer.Ring, pData, DataSize);
+    if (Result == IOC_RESULT_BUFFER_FULL) {
         _IOC_LogWarn("Polling buffer full, dropping %zu bytes", DataSize);
-        return IOC_RESULT_BUFFER_FULL;
     }
-
-    // Write data to circular buffer
-    const char* pSrc = (const char*)pData;
-    size_t BytesToWrite = DataSize;
-    size_t WritePos = pTCPLinkObj->PollingBuffer.DataEnd;
-
-    while (BytesToWrite > 0) {
-        size_t ChunkSize = BytesToWrite;
-        if (WritePos + ChunkSize > pTCPLinkObj->PollingBuffer.BufferSize) {
-            ChunkSize = pTCPLinkObj->PollingBuffer.BufferSize - WritePos;
-        }
-
-        memcpy(&pTCPLinkObj->PollingBuffer.pDataBuffer[WritePos], pSrc, ChunkSize);
-        pSrc += ChunkSize;
-        BytesToWrite -= ChunkSize;
-        WritePos = (WritePos + ChunkSize) % pTCPLinkObj->PollingBuffer.BufferSize;
-    }
-
-    pTCPLinkObj->PollingBuffer.DataEnd = WritePos;
-    pTCPLinkObj->PollingBuffer.AvailableData += DataSize;
-
-    // Signal waiting readers
-    pthread_cond_signal(&pTCPLinkObj->PollingBuffer.DataAvailableCond);
-
-    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-
-    _IOC_LogDebug("Wrote %zu bytes to polling buffer (available: %zu)", DataSize,
-                  pTCPLinkObj->PollingBuffer.AvailableData);
-
-    return IOC_RESULT_SUCCESS;
+    return Result;
 }
 
 /**
@@ -206,78 +304,28 @@ static IOC_Result_T __IOC_readDataFromPollingBuffer(_IOC_ProtoTCPLinkObject_pT p
 
     *pBytesRead = 0;
 
-    pthread_mutex_lock(&pTCPLinkObj->Mutex);
-
-    // Wait for data with timeout
-    if (pTCPLinkObj->PollingBuffer.AvailableData == 0) {
-        if (TimeoutUS == 0) {
-            // Non-blocking mode
-            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-            return IOC_RESULT_NO_DATA;
-        } else if (TimeoutUS < 0) {
-            // Infinite blocking
-            while (pTCPLinkObj->PollingBuffer.AvailableData == 0 && pTCPLinkObj->RecvError == IOC_RESULT_SUCCESS) {
-                pthread_cond_wait(&pTCPLinkObj->PollingBuffer.DataAvailableCond, &pTCPLinkObj->Mutex);
-            }
-        } else {
-            // Timed blocking
-            struct timespec AbsTimeout;
-            clock_gettime(CLOCK_REALTIME, &AbsTimeout);
-            AbsTimeout.tv_sec += TimeoutUS / 1000000;
-            AbsTimeout.tv_nsec += (TimeoutUS % 1000000) * 1000;
-            if (AbsTimeout.tv_nsec >= 1000000000) {
-                AbsTimeout.tv_sec++;
-                AbsTimeout.tv_nsec -= 1000000000;
-            }
-
-            while (pTCPLinkObj->PollingBuffer.AvailableData == 0 && pTCPLinkObj->RecvError == IOC_RESULT_SUCCESS) {
-                int WaitResult = pthread_cond_timedwait(&pTCPLinkObj->PollingBuffer.DataAvailableCond,
-                                                        &pTCPLinkObj->Mutex, &AbsTimeout);
-                if (WaitResult == ETIMEDOUT) {
-                    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-                    return IOC_RESULT_TIMEOUT;
-                }
-            }
-        }
-    }
-
-    // Check if receiver thread encountered an error
-    if (pTCPLinkObj->RecvError != IOC_RESULT_SUCCESS) {
-        IOC_Result_T Error = pTCPLinkObj->RecvError;
-        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-        return Error;
-    }
-
-    // Read data from circular buffer
-    size_t BytesToRead =
-        (pTCPLinkObj->PollingBuffer.AvailableData < BufferSize) ? pTCPLinkObj->PollingBuffer.AvailableData : BufferSize;
-
-    char* pDest = (char*)pBuffer;
-    size_t ReadPos = pTCPLinkObj->PollingBuffer.DataStart;
-    size_t Remaining = BytesToRead;
-
-    while (Remaining > 0) {
-        size_t ChunkSize = Remaining;
-        if (ReadPos + ChunkSize > pTCPLinkObj->PollingBuffer.BufferSize) {
-            ChunkSize = pTCPLinkObj->PollingBuffer.BufferSize - ReadPos;
-        }
-
-        memcpy(pDest, &pTCPLinkObj->PollingBuffer.pDataBuffer[ReadPos], ChunkSize);
-        pDest += ChunkSize;
-        Remaining -= ChunkSize;
-        ReadPos = (ReadPos + ChunkSize) % pTCPLinkObj->PollingBuffer.BufferSize;
+    // Wait for data with timeout, the ring is closed when receiver encountered an error
+    IOC_Result_T Result = _IOC_DatRing_waitData(&pTCPLinkObj->PollingBuffer.Ring, TimeoutUS);
+    if (Result == IOC_RESULT_TIMEOUT && TimeoutUS == 0) {
+        return IOC_RESULT_NO_DATA;  // Non-blocking mode
+    } else if (Result == IOC_RESULT_TIMEOUT) {
+        return IOC_RESULT_TIMEOUT;
     }
 
-    pTCPLinkObj->PollingBuffer.DataStart = ReadPos;
-    pTCPLinkObj->PollingBuffer.AvailableData -= BytesToRead;
-    *pBytesRead = BytesToRead;
-
+    // Check if receiver encountered an error
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    IOC_Result_T RecvError = pTCPLinkObj->RecvError;
     pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    if (RecvError != IOC_RESULT_SUCCESS) {
+        return RecvError;
+    }
 
-    _IOC_LogDebug("Read %zu bytes from polling buffer (remaining: %zu)", BytesToRead,
-                  pTCPLinkObj->PollingBuffer.AvailableData);
+    ULONG_T ReadSize = 0;
+    Result = _IOC_DatRing_read(&pTCPLinkObj->PollingBuffer.Ring, pBuffer, BufferSize, &ReadSize, TimeoutUS);
+    *pBytesRead = ReadSize;
 
-    return IOC_RESULT_SUCCESS;
+    _IOC_LogDebug("Read %zu bytes from polling buffer", *pBytesRead);
+    return Result;
 }
 
 /**
@@ -309,6 +357,144 @@ static IOC_Result_T __TCP_sendAll(int SocketFd, const void* pData, size_t Size)
     return IOC_RESULT_SUCCESS;
 }
 
+/**
+ * @brief Send several buffers over TCP socket in as few syscalls as possible (helper)
+ *    Such as header and payload of a data chunk, which costs one sendmsg instead of two sends.
+ *    pIOVs is consumed in place on partial sends.
+ */
+static IOC_Result_T __TCP_sendAllv(int SocketFd, struct iovec* pIOVs, int IOVNum) {
+    while (IOVNum > 0) {
+        struct msghdr Msg = {0};
+        Msg.msg_iov = pIOVs;
+        Msg.msg_iovlen = IOVNum;
+
+        ssize_t Sent = sendmsg(SocketFd, &Msg, MSG_NOSIGNAL);
+        if (Sent < 0) {
+            int err = errno;
+            if (err == ECONNRESET || err == EPIPE || err == ECONNABORTED || err == EBADF || err == ENOTCONN) {
+                _IOC_LogError("TCP sendmsg failed: connection broken (errno=%d)", err);
+                return IOC_RESULT_LINK_BROKEN;
+            } else if (err == ETIMEDOUT) {
+                _IOC_LogError("TCP sendmsg failed: timeout");
+                return IOC_RESULT_TIMEOUT;
+            } else {
+                _IOC_LogError("TCP sendmsg failed: errno=%d", err);
+                return IOC_RESULT_BUG;
+            }
+        }
+
+        // Skip fully sent buffers, then advance into the partially sent one
+        while (IOVNum > 0 && (size_t)Sent >= pIOVs->iov_len) {
+            Sent -= pIOVs->iov_len;
+            pIOVs++;
+            IOVNum--;
+        }
+        if (IOVNum > 0) {
+            pIOVs->iov_base = (uint8_t*)pIOVs->iov_base + Sent;
+            pIOVs->iov_len -= Sent;
+        }
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Send one message of its header in pIOVs[0] and payload in the rest, with SendMutex held,
+ *    in ONE sendmsg along with messages coalesced before it, so messages are never reordered,
+ *    or copy it behind them if IsCoalescable and the link coalesces, while they're still below MaxBytes.
+ *    IOVNum of 0 only writes the coalesced ones.
+ */
+static IOC_Result_T __IOC_sendMsg_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, const struct iovec* pIOVs,
+                                             int IOVNum, bool IsCoalescable) {
+    if (pTCPLinkObj->Send.Result != IOC_RESULT_SUCCESS) return pTCPLinkObj->Send.Result;
+
+    ULONG_T MsgSize = 0;
+    for (int i = 0; i < IOVNum; i++) MsgSize += pIOVs[i].iov_len;
+
+    if (IsCoalescable && pTCPLinkObj->Send.pBuf && pTCPLinkObj->Send.BufSize + MsgSize < pTCPLinkObj->Send.MaxBytes) {
+        if (0 == pTCPLinkObj->Send.BufSize) {
+            _IOC_Reactor_armTimer(&pTCPLinkObj->Send.FlushTimer, pTCPLinkObj->Send.MaxDelayUS);
+        }
+        for (int i = 0; i < IOVNum; i++) {
+            memcpy(pTCPLinkObj->Send.pBuf + pTCPLinkObj->Send.BufSize, pIOVs[i].iov_base, pIOVs[i].iov_len);
+            pTCPLinkObj->Send.BufSize += pIOVs[i].iov_len;
+        }
+        return IOC_RESULT_SUCCESS;
+    }
+
+    struct iovec AllIOVs[1 + TCP_MSG_MAX_IOV_NUM];
+    int AllIOVNum = 0;
+    if (pTCPLinkObj->Send.BufSize > 0) {
+        AllIOVs[AllIOVNum].iov_base = pTCPLinkObj->Send.pBuf;
+        AllIOVs[AllIOVNum].iov_len = pTCPLinkObj->Send.BufSize;
+        AllIOVNum++;
+        pTCPLinkObj->Send.BufSize = 0;  // Not kept if failed, as the link is broken
+    }
+    memcpy(&AllIOVs[AllIOVNum], pIOVs, IOVNum * sizeof(struct iovec));
+    AllIOVNum += IOVNum;
+
+    return (AllIOVNum > 0) ? __TCP_sendAllv(pTCPLinkObj->SocketFd, AllIOVs, AllIOVNum) : IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Write messages coalesced MaxDelayUS ago, unless they're written already by a later message
+ */
+static bool __IOC_onFlushTimerReady_ofProtoTCP(_IOC_ReactorFd_pT pReactorFd) {
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pReactorFd->pPriv;
+
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, NULL, 0, false);
+    if (Result != IOC_RESULT_SUCCESS) {
+        pTCPLinkObj->Send.Result = Result;  // Coalesced ones are lost, tell later sends
+    }
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    return true;
+}
+
+/**
+ * @brief Set up sending of a connected link by its coalescing args, if it's EvtProducer or DatSender,
+ *    whose FlushTimer is watched by the link's reactor shard.
+ */
+static IOC_Result_T __IOC_initSend_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj,
+                                              const IOC_CoalesceArgs_pT pCoalesceArgs) {
+    int OptVal = 1;
+    setsockopt(pTCPLinkObj->SocketFd, IPPROTO_TCP, TCP_NODELAY, &OptVal, sizeof(OptVal));
+
+    pTCPLinkObj->Send.Result = IOC_RESULT_SUCCESS;
+    pTCPLinkObj->Send.FlushTimer.Fd = -1;
+    if (!pCoalesceArgs || 0 == pCoalesceArgs->MaxDelayUS) return IOC_RESULT_SUCCESS;
+
+    pTCPLinkObj->Send.MaxDelayUS = pCoalesceArgs->MaxDelayUS;
+    pTCPLinkObj->Send.MaxBytes = pCoalesceArgs->MaxBytes ? pCoalesceArgs->MaxBytes : TCP_COALESCE_DEFAULT_MAX_BYTES;
+    pTCPLinkObj->Send.pBuf = malloc(pTCPLinkObj->Send.MaxBytes);
+    if (!pTCPLinkObj->Send.pBuf) return IOC_RESULT_POSIX_ENOMEM;
+
+    pTCPLinkObj->Send.FlushTimer.OnReady_F = __IOC_onFlushTimerReady_ofProtoTCP;
+    pTCPLinkObj->Send.FlushTimer.pPriv = pTCPLinkObj;
+    pTCPLinkObj->Send.FlushTimer.ShardIdx = pTCPLinkObj->Recv.ReactorFd.ShardIdx;
+    if (_IOC_Reactor_watchTimer(&pTCPLinkObj->Send.FlushTimer) != IOC_RESULT_SUCCESS) {
+        _IOC_LogError("Failed to watch TCP link's coalescing timer");
+        free(pTCPLinkObj->Send.pBuf);
+        pTCPLinkObj->Send.pBuf = NULL;
+        return IOC_RESULT_BUG;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Write messages still coalesced, then stop FlushTimer, before the link's socket is shut down
+ */
+static void __IOC_deinitSend_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    if (!pTCPLinkObj->Send.pBuf) return;
+
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, NULL, 0, false);
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+
+    _IOC_Reactor_unwatchFd(&pTCPLinkObj->Send.FlushTimer);
+    free(pTCPLinkObj->Send.pBuf);
+    pTCPLinkObj->Send.pBuf = NULL;
+}
+
 /**
  * @brief Receive data over TCP socket (helper)
  *
@@ -353,254 +539,877 @@ static IOC_Result_T __TCP_recvAll(int SocketFd, void* pData, size_t Size) {
 }
 
 /**
- * @brief Background thread to receive TCP messages
+ * @brief Receive into pData of at most Size by ONE read of what has arrived on a socket without waiting (helper),
+ *    adding the received size to *pRecvdSize.
+ *
+ * @return IOC_RESULT_SUCCESS if anything is received, IOC_RESULT_NO_DATA if nothing has arrived yet,
+ *    or errors as __TCP_recvAll.
  */
-static void* __TCP_recvThread(void* pArg) {
-    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pArg;
-
-    while (pTCPLinkObj->RecvThreadRunning) {
-        // Receive message header
-        TCPMessageHeader_T Header;
-        IOC_Result_T Result = __TCP_recvAll(pTCPLinkObj->SocketFd, &Header, sizeof(Header));
-        if (Result != IOC_RESULT_SUCCESS) {
-            // Connection error - store it and signal waiting command
-            pthread_mutex_lock(&pTCPLinkObj->Mutex);
-            pTCPLinkObj->RecvError = Result;
-            pTCPLinkObj->CmdResponseReady = 1;  // Wake up waiting command
-            pthread_cond_signal(&pTCPLinkObj->CmdResponseCond);
-            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-            break;
+static IOC_Result_T __TCP_recvOnce(int SocketFd, void* pData, size_t Size, ULONG_T* pRecvdSize) {
+    while (true) {
+        ssize_t Recvd = recv(SocketFd, pData, Size, MSG_DONTWAIT);
+        if (Recvd > 0) {
+            *pRecvdSize += Recvd;
+            return IOC_RESULT_SUCCESS;
+        } else if (Recvd == 0) {
+            _IOC_LogInfo("TCP connection closed");
+            return IOC_RESULT_LINK_BROKEN;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return IOC_RESULT_NO_DATA;
+        } else if (errno != EINTR) {
+            int err = errno;
+            if (err == ECONNRESET || err == ECONNABORTED || err == EPIPE) {
+                _IOC_LogError("TCP recv failed: connection reset");
+                return IOC_RESULT_LINK_BROKEN;
+            } else if (err == ETIMEDOUT) {
+                _IOC_LogError("TCP recv failed: timeout");
+                return IOC_RESULT_TIMEOUT;
+            } else {
+                _IOC_LogError("TCP recv failed: errno=%d", err);
+                return IOC_RESULT_BUG;
+            }
         }
+    }
+}
+
+/**
+ * @brief Receive into pData of Size what has arrived on a socket without waiting, from *pRecvdSize on (helper)
+ *    Used by the reactor, which MUST NOT block in recv(), so a message is received in as many calls as it takes.
+ *
+ * @return IOC_RESULT_SUCCESS once all Size is received, IOC_RESULT_NO_DATA if the rest hasn't arrived yet,
+ *    or errors as __TCP_recvAll.
+ */
+static IOC_Result_T __TCP_recvSome(int SocketFd, void* pData, size_t Size, ULONG_T* pRecvdSize) {
+    uint8_t* pBuffer = (uint8_t*)pData;
+
+    while (*pRecvdSize < Size) {
+        IOC_Result_T Result = __TCP_recvOnce(SocketFd, pBuffer + *pRecvdSize, Size - *pRecvdSize, pRecvdSize);
+        if (Result != IOC_RESULT_SUCCESS) return Result;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Drop Size bytes arrived on a socket without waiting, from *pRecvdSize on, same as __TCP_recvSome
+ */
+static IOC_Result_T __TCP_skipSome(int SocketFd, size_t Size, ULONG_T* pRecvdSize) {
+    uint8_t Scratch[256];
+
+    while (*pRecvdSize < Size) {
+        ULONG_T ScratchSize = 0;
+        size_t ChunkSize = (Size - *pRecvdSize < sizeof(Scratch)) ? Size - *pRecvdSize : sizeof(Scratch);
+        IOC_Result_T Result = __TCP_recvSome(SocketFd, Scratch, ChunkSize, &ScratchSize);
+        *pRecvdSize += ScratchSize;
+        if (Result != IOC_RESULT_SUCCESS) return Result;
+    }
+    return IOC_RESULT_SUCCESS;
+}
 
-        // Convert from network byte order
-        uint32_t MsgType = ntohl(Header.MsgType);
-        uint32_t DataSize = ntohl(Header.DataSize);
-
-        if (MsgType == TCP_MSG_EVENT && DataSize == sizeof(IOC_EvtDesc_T)) {
-            // Receive event descriptor
-            IOC_EvtDesc_T EvtDesc;
-            Result = __TCP_recvAll(pTCPLinkObj->SocketFd, &EvtDesc, sizeof(EvtDesc));
-            if (Result != IOC_RESULT_SUCCESS) {
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                pTCPLinkObj->RecvError = Result;
-                pTCPLinkObj->CmdResponseReady = 1;
-                pthread_cond_signal(&pTCPLinkObj->CmdResponseCond);
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+/**
+ * @brief Set the credits this DatReceiver link grants to the peer DatSender in negotiation:
+ *    those of a receiver callback are only bounded by its Credit args, while data for IOC_recvDAT
+ *    MUST also fit in the polling buffer, so it's never dropped.
+ */
+static void __IOC_setDatGrant_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj,
+                                         const IOC_DatUsageArgs_pT pDatUsageArgs) {
+    ULONG_T MaxDatNum = pDatUsageArgs ? pDatUsageArgs->Credit.MaxDatNum : 0;
+    ULONG_T MaxDatBytes = pDatUsageArgs ? pDatUsageArgs->Credit.MaxDatBytes : 0;
+
+    if (pDatUsageArgs && (pDatUsageArgs->CbRecvDat_F || pDatUsageArgs->CbRecvDatBatch_F)) {
+        MaxDatNum = MaxDatNum ? MaxDatNum : _IOC_DAT_CREDIT_DEFAULT_MAX_NUM;
+        MaxDatBytes = MaxDatBytes ? MaxDatBytes : _IOC_DAT_CREDIT_DEFAULT_MAX_BYTES;
+    } else {
+        _IOC_DatRing_fitWindow(&pTCPLinkObj->PollingBuffer.Ring, &MaxDatNum, &MaxDatBytes);
+        pTCPLinkObj->DatGrant.Flags = TCP_DAT_CREDIT_FLAG_POLLING;
+    }
+
+    pTCPLinkObj->DatGrant.MaxDatNum = (MaxDatNum > UINT32_MAX) ? UINT32_MAX : MaxDatNum;
+    pTCPLinkObj->DatGrant.MaxDatBytes = (MaxDatBytes > UINT32_MAX) ? UINT32_MAX : MaxDatBytes;
+}
+
+/**
+ * @brief Return credits of data consumed up to the monotonic ConsumedDatNum/Bytes to the peer DatSender
+ *    by TCP_MSG_DAT_CREDIT, once a quarter of the grant is unreturned, or at once if IsIdle,
+ *    so it costs few messages and the DatSender never waits for credits of data already consumed.
+ */
+static void __IOC_returnDatCredit_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, ULONG_T ConsumedDatNum,
+                                             ULONG_T ConsumedDatBytes, bool IsIdle) {
+    if (0 == pTCPLinkObj->DatGrant.MaxDatNum && 0 == pTCPLinkObj->DatGrant.MaxDatBytes) return;
+
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    // Consumers of the same link MAY report their totals out of order, the latest one returns all
+    while (ConsumedDatNum > pTCPLinkObj->DatGrant.ReturnedDatNum) {
+        ULONG_T DatNum = ConsumedDatNum - pTCPLinkObj->DatGrant.ReturnedDatNum;
+        ULONG_T DatBytes = ConsumedDatBytes - pTCPLinkObj->DatGrant.ReturnedDatBytes;
+        bool IsDue = IsIdle || (pTCPLinkObj->DatGrant.MaxDatNum && DatNum * 4 >= pTCPLinkObj->DatGrant.MaxDatNum) ||
+                     (pTCPLinkObj->DatGrant.MaxDatBytes && DatBytes * 4 >= pTCPLinkObj->DatGrant.MaxDatBytes);
+        if (!IsDue) break;
+
+        DatNum = (DatNum > UINT32_MAX) ? UINT32_MAX : DatNum;
+        DatBytes = (DatBytes > UINT32_MAX) ? UINT32_MAX : DatBytes;
+
+        TCPMessageHeader_T Header = {.MsgType = htonl(TCP_MSG_DAT_CREDIT), .DataSize = htonl(sizeof(TCPDatCredit_T))};
+        TCPDatCredit_T Credit = {.DatNum = htonl((uint32_t)DatNum), .DatBytes = htonl((uint32_t)DatBytes)};
+        struct iovec IOVs[2] = {{.iov_base = &Header, .iov_len = sizeof(Header)},
+                                {.iov_base = &Credit, .iov_len = sizeof(Credit)}};
+        if (__IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, 2, false) != IOC_RESULT_SUCCESS) break;  // Link is broken
+
+        pTCPLinkObj->DatGrant.ReturnedDatNum += DatNum;
+        pTCPLinkObj->DatGrant.ReturnedDatBytes += DatBytes;
+    }
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+}
+
+/**
+ * @brief Return credits of data read from the polling buffer by IOC_recvDAT, at once if it's empty now
+ */
+static void __IOC_returnPolledDatCredit_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    ULONG_T ReadDatNum = 0, ReadDatBytes = 0;
+    _IOC_DatRing_getReadTotal(&pTCPLinkObj->PollingBuffer.Ring, &ReadDatNum, &ReadDatBytes);
+    __IOC_returnDatCredit_ofProtoTCP(pTCPLinkObj, ReadDatNum, ReadDatBytes,
+                                     _IOC_DatRing_isEmpty(&pTCPLinkObj->PollingBuffer.Ring));
+}
+
+/**
+ * @brief Answer a TCP_MSG_DATA_TRACKED by TCP_MSG_DAT_COMPLETION of its receiver callback's result
+ */
+static void __IOC_sendDatCompletion_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, IOC_Result_T RecvResult) {
+    TCPMessageHeader_T Header = {.MsgType = htonl(TCP_MSG_DAT_COMPLETION),
+                                 .DataSize = htonl(sizeof(TCPDatCompletion_T))};
+    TCPDatCompletion_T Completion = {.Result = (int32_t)htonl((uint32_t)(int32_t)RecvResult)};
+    struct iovec IOVs[2] = {{.iov_base = &Header, .iov_len = sizeof(Header)},
+                            {.iov_base = &Completion, .iov_len = sizeof(Completion)}};
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, 2, false);  // If broken, the peer completes it with LINK_BROKEN
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+}
+
+/**
+ * @brief Deliver a received event to the subscribed callback
+ */
+static void __IOC_handleRecvEvt_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, IOC_EvtDesc_pT pEvtDesc) {
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    IOC_CbProcEvt_F CbProcEvt_F = pTCPLinkObj->SubEvtArgs.CbProcEvt_F;
+    int EvtNum = pTCPLinkObj->SubEvtArgs.EvtNum;
+    IOC_EvtID_T* pEvtIDs = pTCPLinkObj->SubEvtArgs.pEvtIDs;
+    void* pCbPrivData = pTCPLinkObj->SubEvtArgs.pCbPrivData;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    if (CbProcEvt_F) {
+        // Check if event is subscribed
+        for (int i = 0; i < EvtNum; i++) {
+            if (pEvtDesc->EvtID == pEvtIDs[i]) {
+                CbProcEvt_F(pEvtDesc, pCbPrivData);
                 break;
             }
+        }
+    }
+}
+
+/**
+ * @brief Ack a received TCP_MSG_DAT_FLUSH, or wake IOC_flushDAT waiting for a received TCP_MSG_DAT_FLUSH_ACK
+ */
+static void __IOC_handleRecvDatFlush_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, uint32_t MsgType,
+                                                TCPDatFlush_T* pFlush) {
+    if (MsgType == TCP_MSG_DAT_FLUSH) {
+        // Data before it was delivered to the receiver callback or polling buffer, ack the peer DatSender
+        TCPMessageHeader_T AckHeader = {.MsgType = htonl(TCP_MSG_DAT_FLUSH_ACK),
+                                        .DataSize = htonl(sizeof(TCPDatFlush_T))};
+        struct iovec IOVs[2] = {{.iov_base = &AckHeader, .iov_len = sizeof(AckHeader)},
+                                {.iov_base = pFlush, .iov_len = sizeof(*pFlush)}};
+        pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+        __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, 2, false);  // If broken, the peer's flush gets LINK_BROKEN
+        pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    } else {
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        pTCPLinkObj->DatFlush.AckedSeq = ntohl(pFlush->FlushSeq);
+        pthread_cond_broadcast(&pTCPLinkObj->DatFlush.AckedCond);
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    }
+}
+
+/**
+ * @brief Complete the oldest TCP_MSG_DATA_TRACKED sent by a received TCP_MSG_DAT_COMPLETION
+ */
+static void __IOC_handleRecvDatCompletion_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj,
+                                                     TCPDatCompletion_T* pCompletion) {
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    _IOC_DatCompleter_pT pCompleter = pTCPLinkObj->DatCompletion.pHead;
+    if (pCompleter) {
+        pTCPLinkObj->DatCompletion.pHead = pCompleter->pNext;
+        if (!pCompleter->pNext) pTCPLinkObj->DatCompletion.pTail = NULL;
+    }
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    if (pCompleter) {
+        _IOC_completeDat(pCompleter, (IOC_Result_T)(int32_t)ntohl((uint32_t)pCompletion->Result));
+        free(pCompleter);
+    }
+}
 
-            // Process event through callback
+/**
+ * @brief Prepare where to receive the payload of a TCP_MSG_DATA(_TRACKED) of Recv.PayloadSize
+ */
+static IOC_Result_T __IOC_beginRecvDat_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    ULONG_T DataSize = pTCPLinkObj->Recv.PayloadSize;
+
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    bool IsPollingMode = pTCPLinkObj->PollingBuffer.IsPollingMode && !pTCPLinkObj->DatUsageArgs.CbRecvDat_F &&
+                         !pTCPLinkObj->DatUsageArgs.CbRecvDatBatch_F;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    // Polling mode receives data payload straight into the polling buffer,
+    // whose free space is contiguous even if it wraps around, so it costs no copy.
+    // Receiving is this ring's only producer, so its reservation locks nothing while the reactor waits for the rest.
+    _IOC_DatRing_pT pRing = &pTCPLinkObj->PollingBuffer.Ring;
+    if (IsPollingMode && _IOC_DatRing_reserve(pRing, DataSize, &pTCPLinkObj->Recv.pPayload) == IOC_RESULT_SUCCESS) {
+        pTCPLinkObj->Recv.IsInPollingBuffer = true;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    // Receive data payload into a slab of this link, which is recycled after CbRecvDat_F returns,
+    // or later if CbRecvDat_F holds Payload.pDatBuf, so steady receiving costs no malloc.
+    IOC_Result_T Result = _IOC_allocDatSlab(pTCPLinkObj->pOwnerLinkObj, DataSize, &pTCPLinkObj->Recv.pDatBuf,
+                                            &pTCPLinkObj->Recv.pPayload);
+    return (Result == IOC_RESULT_SUCCESS) ? IOC_RESULT_SUCCESS : IOC_RESULT_POSIX_ENOMEM;
+}
+
+/**
+ * @brief Deliver a received TCP_MSG_DATA(_TRACKED) to the receiver callback or polling buffer
+ */
+static void __IOC_handleRecvDat_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, uint32_t MsgType) {
+    ULONG_T DataSize = pTCPLinkObj->Recv.PayloadSize;
+
+    if (pTCPLinkObj->Recv.IsInPollingBuffer) {
+        pTCPLinkObj->Recv.IsInPollingBuffer = false;
+        _IOC_DatRing_commit(&pTCPLinkObj->PollingBuffer.Ring, DataSize);
+        if (MsgType == TCP_MSG_DATA_TRACKED) {
+            __IOC_sendDatCompletion_ofProtoTCP(pTCPLinkObj, IOC_RESULT_SUCCESS);
+        }
+        return;
+    }
+
+    IOC_DatBuf_pT pDatBuf = pTCPLinkObj->Recv.pDatBuf;  // NULL if pData is in place in Recv.pBuf
+    void* pData = pTCPLinkObj->Recv.pPayload;
+    pTCPLinkObj->Recv.pDatBuf = NULL;
+
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    IOC_CbRecvDat_F CbRecvDat_F = pTCPLinkObj->DatUsageArgs.CbRecvDat_F;
+    IOC_CbRecvDatBatch_F CbRecvDatBatch_F = pTCPLinkObj->DatUsageArgs.CbRecvDatBatch_F;
+    void* pCbPrivData = pTCPLinkObj->DatUsageArgs.pCbPrivData;
+    bool IsPollingMode = pTCPLinkObj->PollingBuffer.IsPollingMode;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    IOC_Result_T RecvResult = IOC_RESULT_NOT_SUPPORT;  // neither callback nor polling, data is dropped
+    if (CbRecvDat_F || CbRecvDatBatch_F) {
+        // Invoke data callback, TCP delivers each chunk once received, so a batch is always one chunk
+        IOC_DatDesc_T DatDesc = {0};
+        IOC_initDatDesc(&DatDesc);
+        DatDesc.Payload.pData = pData;
+        DatDesc.Payload.PtrDataSize = DataSize;
+        DatDesc.Payload.PtrDataLen = DataSize;
+        DatDesc.Payload.pDatBuf = pDatBuf;
+
+        IOC_LinkID_T LinkID = pTCPLinkObj->pOwnerLinkObj->ID;
+        if (CbRecvDatBatch_F) {
+            RecvResult = CbRecvDatBatch_F(LinkID, &DatDesc, 1, pCbPrivData);
+        } else {
+            RecvResult = CbRecvDat_F(LinkID, &DatDesc, pCbPrivData);
+        }
+
+        // It's idle if no more message is received yet, neither read in Recv.pBuf nor waiting in the socket
+        pTCPLinkObj->DatGrant.ConsumedDatNum++;
+        pTCPLinkObj->DatGrant.ConsumedDatBytes += DataSize;
+        int UnreadSize = 0;
+        bool IsIdle = (pTCPLinkObj->Recv.BufBegin == pTCPLinkObj->Recv.BufEnd) &&
+                      ((ioctl(pTCPLinkObj->SocketFd, FIONREAD, &UnreadSize) != 0) || (0 == UnreadSize));
+        __IOC_returnDatCredit_ofProtoTCP(pTCPLinkObj, pTCPLinkObj->DatGrant.ConsumedDatNum,
+                                         pTCPLinkObj->DatGrant.ConsumedDatBytes, IsIdle);
+    } else if (IsPollingMode) {
+        // Data in place, or whose header came when polling buffer was full, is copied into polling buffer now
+        RecvResult = __IOC_writeDataToPollingBuffer(pTCPLinkObj, pData, DataSize);
+    }
+
+    if (pDatBuf) IOC_releaseDatBuf(pDatBuf);
+    if (MsgType == TCP_MSG_DATA_TRACKED) {
+        __IOC_sendDatCompletion_ofProtoTCP(pTCPLinkObj, RecvResult);
+    }
+}
+
+/**
+ * @brief Send a command request or response of pCmdDesc as one TCP_MSG_COMMAND, its descriptor encoded
+ *    by _IOC_TCPWire_encodeCmd, then its IN payload of a request or OUT payload of a response inline,
+ *    if it's pointer-based, as embedded data is already in the descriptor.
+ */
+static IOC_Result_T __IOC_sendCmd_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, const IOC_CmdDesc_T* pCmdDesc) {
+    uint8_t Wire[_IOC_TCP_WIRE_CMD_MAX_SIZE];
+    ULONG_T WireSize = _IOC_TCPWire_encodeCmd(pCmdDesc, Wire);
+
+    bool IsRequest = (pCmdDesc->Status <= IOC_CMD_STATUS_PROCESSING);
+    const IOC_CmdPayload_T* pPtrPayload = IsRequest ? &pCmdDesc->InPayload : &pCmdDesc->OutPayload;
+    ULONG_T PtrDataLen = pPtrPayload->pData ? pPtrPayload->PtrDataLen : 0;
+
+    TCPMessageHeader_T Header = {.MsgType = htonl(TCP_MSG_COMMAND), .DataSize = htonl(WireSize + PtrDataLen)};
+    struct iovec IOVs[3] = {{.iov_base = &Header, .iov_len = sizeof(Header)},
+                            {.iov_base = Wire, .iov_len = WireSize},
+                            {.iov_base = pPtrPayload->pData, .iov_len = PtrDataLen}};
+
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, (PtrDataLen > 0) ? 3 : 2, false);
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    return Result;
+}
+
+/**
+ * @brief Execute or queue a received command request, or wake IOC_execCMD by a received response,
+ *    of pCmdDesc decoded from its message, with its pointer payload of PtrDataLen at pPtrData if any,
+ *    which is copied out, as it's in the receive buffer.
+ */
+static void __IOC_handleRecvCmd_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, IOC_CmdDesc_pT pCmdDesc,
+                                           const void* pPtrData, ULONG_T PtrDataLen) {
+    IOC_CmdDesc_T CmdDesc = *pCmdDesc;
+
+    // Check if this is a command request or response
+    // If Status is INITIALIZED or PENDING, it's a Request.
+    // If Status is SUCCESS, FAILED, TIMEOUT, it's a Response.
+    bool IsRequest = (CmdDesc.Status <= IOC_CMD_STATUS_PROCESSING);
+
+    if (IsRequest) {
+        // This is a command REQUEST - we are the executor
+
+        // IN payload (pointer-based) if received, zero-terminated as IOC_CmdDesc_setInPayload does
+        void* pInData = (PtrDataLen > 0) ? malloc(PtrDataLen + 1) : NULL;
+        if (pInData) {
+            memcpy(pInData, pPtrData, PtrDataLen);
+            ((uint8_t*)pInData)[PtrDataLen] = 0;
+            CmdDesc.InPayload.pData = pInData;
+            CmdDesc.InPayload.PtrDataSize = PtrDataLen + 1;
+            CmdDesc.InPayload.PtrDataLen = PtrDataLen;
+        }
+
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        IOC_CbExecCmd_F CbExecCmd_F = pTCPLinkObj->CmdUsageArgs.CbExecCmd_F;
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+        if (CbExecCmd_F) {
+            // 🎯 STATE TRANSITION: INITIALIZED/PENDING → PROCESSING (per Architecture Design)
+            CmdDesc.Status = IOC_CMD_STATUS_PROCESSING;
+
+            // Execute command through callback
             pthread_mutex_lock(&pTCPLinkObj->Mutex);
-            IOC_CbProcEvt_F CbProcEvt_F = pTCPLinkObj->SubEvtArgs.CbProcEvt_F;
-            int EvtNum = pTCPLinkObj->SubEvtArgs.EvtNum;
-            IOC_EvtID_T* pEvtIDs = pTCPLinkObj->SubEvtArgs.pEvtIDs;
-            void* pCbPrivData = pTCPLinkObj->SubEvtArgs.pCbPrivData;
+            void* pCbPrivData = pTCPLinkObj->CmdUsageArgs.pCbPrivData;
             pthread_mutex_unlock(&pTCPLinkObj->Mutex);
 
-            if (CbProcEvt_F) {
-                // Check if event is subscribed
-                for (int i = 0; i < EvtNum; i++) {
-                    if (EvtDesc.EvtID == pEvtIDs[i]) {
-                        CbProcEvt_F(&EvtDesc, pCbPrivData);
-                        break;
-                    }
-                }
+            IOC_LinkID_T LinkID = pTCPLinkObj->pOwnerLinkObj->ID;
+            IOC_Result_T ExecResult = CbExecCmd_F(LinkID, &CmdDesc, pCbPrivData);
+
+            // 🎯 STATE TRANSITION: PROCESSING → SUCCESS/FAILED (per Architecture Design)
+            // Set command status based on execution result
+            if (ExecResult == IOC_RESULT_SUCCESS) {
+                CmdDesc.Status = IOC_CMD_STATUS_SUCCESS;
+            } else {
+                CmdDesc.Status = IOC_CMD_STATUS_FAILED;
             }
-        } else if (MsgType == TCP_MSG_SUBSCRIBE) {
-            // Peer subscribed - mark it
-            pthread_mutex_lock(&pTCPLinkObj->Mutex);
-            pTCPLinkObj->PeerHasSubscription = 1;
-            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-        } else if (MsgType == TCP_MSG_UNSUBSCRIBE) {
-            // Peer unsubscribed - mark it
+            CmdDesc.Result = ExecResult;
+
+            if (pInData) free(pInData);
+
+            // Send response back (CmdDesc + OUT payload data) in one write
+            __IOC_sendCmd_ofProtoTCP(pTCPLinkObj, &CmdDesc);
+        } else {
+            // Polling Mode: Queue it
             pthread_mutex_lock(&pTCPLinkObj->Mutex);
-            pTCPLinkObj->PeerHasSubscription = 0;
-            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-        } else if (MsgType == TCP_MSG_DATA && DataSize > 0) {
-            // Receive data payload
-            void* pData = malloc(DataSize);
-            if (!pData) {
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                pTCPLinkObj->RecvError = IOC_RESULT_POSIX_ENOMEM;
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-                break;
+            if (pTCPLinkObj->IncomingCmdCount < 16) {
+                pTCPLinkObj->IncomingCmdQueue[pTCPLinkObj->IncomingCmdTail] = CmdDesc;
+                pTCPLinkObj->IncomingCmdTail = (pTCPLinkObj->IncomingCmdTail + 1) % 16;
+                pTCPLinkObj->IncomingCmdCount++;
+                pthread_cond_signal(&pTCPLinkObj->IncomingCmdCond);
+            } else {
+                _IOC_LogError("Incoming command queue full, dropping command");
+                if (pInData) free(pInData);
             }
+            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+        }
+    } else {
+        // This is a command RESPONSE - we are the initiator
+        // Copy response to local storage, with OUT payload data if received
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        pTCPLinkObj->CmdResponse = CmdDesc;
+        if (PtrDataLen > 0) {
+            IOC_CmdDesc_setOutPayload(&pTCPLinkObj->CmdResponse, (void*)pPtrData, PtrDataLen);
+        }
 
-            Result = __TCP_recvAll(pTCPLinkObj->SocketFd, pData, DataSize);
-            if (Result != IOC_RESULT_SUCCESS) {
-                free(pData);
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                pTCPLinkObj->RecvError = Result;
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-                break;
+        // Signal the waiting command execution
+        pTCPLinkObj->CmdResponseReady = 1;
+        pthread_cond_signal(&pTCPLinkObj->CmdResponseCond);
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    }
+}
+
+/**
+ * @brief Prepare where to receive the payload of the message whose header is just received in Recv.Header
+ */
+static IOC_Result_T __IOC_beginRecvMsg_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    uint32_t MsgType = ntohl(pTCPLinkObj->Recv.Header.MsgType);
+    uint32_t DataSize = ntohl(pTCPLinkObj->Recv.Header.DataSize);
+    pTCPLinkObj->Recv.pPayload = NULL;
+    pTCPLinkObj->Recv.IsInPlace = false;
+    pTCPLinkObj->Recv.PayloadSize = DataSize;
+    pTCPLinkObj->Recv.RecvdSize = 0;
+
+    switch (MsgType) {
+        case TCP_MSG_EVENT:
+            pTCPLinkObj->Recv.IsInPlace = (DataSize > 0 && DataSize <= _IOC_TCP_WIRE_EVT_MAX_SIZE);
+            break;
+        case TCP_MSG_DAT_CREDIT:
+            if (DataSize == sizeof(TCPDatCredit_T)) pTCPLinkObj->Recv.pPayload = &pTCPLinkObj->Recv.Fixed.Credit;
+            break;
+        case TCP_MSG_DAT_FLUSH:
+        case TCP_MSG_DAT_FLUSH_ACK:
+            if (DataSize == sizeof(TCPDatFlush_T)) pTCPLinkObj->Recv.pPayload = &pTCPLinkObj->Recv.Fixed.Flush;
+            break;
+        case TCP_MSG_DAT_COMPLETION:
+            if (DataSize == sizeof(TCPDatCompletion_T)) {
+                pTCPLinkObj->Recv.pPayload = &pTCPLinkObj->Recv.Fixed.Completion;
             }
+            break;
+        case TCP_MSG_COMMAND:
+            // Same as data below, but a larger one is received whole for its descriptor to be decoded
+            if (DataSize > TCP_RECV_INPLACE_MAX_SIZE) {
+                pTCPLinkObj->Recv.pCmdMsg = malloc(DataSize);
+                pTCPLinkObj->Recv.pPayload = pTCPLinkObj->Recv.pCmdMsg;  // Skipped if out of memory
+            } else {
+                pTCPLinkObj->Recv.IsInPlace = (DataSize > 0);
+            }
+            break;
+        case TCP_MSG_DATA:
+        case TCP_MSG_DATA_TRACKED:
+            // Smaller data is handled in place in Recv.pBuf, larger data is received into its own buffer
+            if (DataSize > TCP_RECV_INPLACE_MAX_SIZE) return __IOC_beginRecvDat_ofProtoTCP(pTCPLinkObj);
+            pTCPLinkObj->Recv.IsInPlace = (DataSize > 0);
+            break;
+        default:
+            break;  // Such as TCP_MSG_SUBSCRIBE without payload, or an unknown message whose payload is skipped
+    }
+    return IOC_RESULT_SUCCESS;
+}
 
-            // Check if callback is registered
-            pthread_mutex_lock(&pTCPLinkObj->Mutex);
-            IOC_CbRecvDat_F CbRecvDat_F = pTCPLinkObj->DatUsageArgs.CbRecvDat_F;
-            void* pCbPrivData = pTCPLinkObj->DatUsageArgs.pCbPrivData;
-            bool IsPollingMode = pTCPLinkObj->PollingBuffer.IsPollingMode;
-            pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+/**
+ * @brief Handle the message whose header and payload are all received
+ */
+static void __IOC_handleRecvMsg_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    uint32_t MsgType = ntohl(pTCPLinkObj->Recv.Header.MsgType);
+
+    if (MsgType == TCP_MSG_SUBSCRIBE || MsgType == TCP_MSG_UNSUBSCRIBE) {
+        // Peer subscribed or unsubscribed - mark it
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        pTCPLinkObj->PeerHasSubscription = (MsgType == TCP_MSG_SUBSCRIBE);
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    } else if (!pTCPLinkObj->Recv.pPayload) {
+        // Payload of an unknown message, or of an unexpected size, was skipped
+    } else if (MsgType == TCP_MSG_EVENT) {
+        IOC_EvtDesc_T EvtDesc;
+        if (IOC_RESULT_SUCCESS ==
+            _IOC_TCPWire_decodeEvt(pTCPLinkObj->Recv.pPayload, pTCPLinkObj->Recv.PayloadSize, &EvtDesc)) {
+            __IOC_handleRecvEvt_ofProtoTCP(pTCPLinkObj, &EvtDesc);
+        } else {
+            _IOC_LogWarn("Dropping a malformed event, or of an unknown wire version");
+        }
+    } else if (MsgType == TCP_MSG_COMMAND) {
+        // The command's pointer payload, if any, follows its descriptor
+        const uint8_t* pWire = (const uint8_t*)pTCPLinkObj->Recv.pPayload;
+        IOC_CmdDesc_T CmdDesc;
+        ULONG_T DescSize = 0;
+        if (IOC_RESULT_SUCCESS ==
+            _IOC_TCPWire_decodeCmd(pWire, pTCPLinkObj->Recv.PayloadSize, &CmdDesc, &DescSize)) {
+            __IOC_handleRecvCmd_ofProtoTCP(pTCPLinkObj, &CmdDesc, pWire + DescSize,
+                                           pTCPLinkObj->Recv.PayloadSize - DescSize);
+        } else {
+            _IOC_LogWarn("Dropping a malformed command, or of an unknown wire version");
+        }
+        free(pTCPLinkObj->Recv.pCmdMsg);
+        pTCPLinkObj->Recv.pCmdMsg = NULL;
+    } else if (MsgType == TCP_MSG_DAT_CREDIT) {
+        // Peer DatReceiver consumed data, wake our DatSenders waiting for its credits
+        _IOC_DatCredit_release(&pTCPLinkObj->DatCredit, ntohl(pTCPLinkObj->Recv.Fixed.Credit.DatNum),
+                               ntohl(pTCPLinkObj->Recv.Fixed.Credit.DatBytes));
+    } else if (MsgType == TCP_MSG_DAT_FLUSH || MsgType == TCP_MSG_DAT_FLUSH_ACK) {
+        __IOC_handleRecvDatFlush_ofProtoTCP(pTCPLinkObj, MsgType, &pTCPLinkObj->Recv.Fixed.Flush);
+    } else if (MsgType == TCP_MSG_DAT_COMPLETION) {
+        __IOC_handleRecvDatCompletion_ofProtoTCP(pTCPLinkObj, &pTCPLinkObj->Recv.Fixed.Completion);
+    } else {
+        __IOC_handleRecvDat_ofProtoTCP(pTCPLinkObj, MsgType);
+    }
+}
+
+/**
+ * @brief End receiving of a broken link by Result, dropping its partial message,
+ *    and wake everyone waiting for input which will never come.
+ */
+static void __IOC_endRecv_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, IOC_Result_T Result) {
+    if (pTCPLinkObj->Recv.IsInPollingBuffer) {
+        _IOC_DatRing_commit(&pTCPLinkObj->PollingBuffer.Ring, 0);
+        pTCPLinkObj->Recv.IsInPollingBuffer = false;
+    }
+    if (pTCPLinkObj->Recv.pDatBuf) {
+        IOC_releaseDatBuf(pTCPLinkObj->Recv.pDatBuf);
+        pTCPLinkObj->Recv.pDatBuf = NULL;
+    }
+    free(pTCPLinkObj->Recv.pCmdMsg);
+    pTCPLinkObj->Recv.pCmdMsg = NULL;
+    pTCPLinkObj->Recv.pPayload = NULL;
+    pTCPLinkObj->Recv.IsInPlace = false;
+    free(pTCPLinkObj->Recv.pBuf);
+    pTCPLinkObj->Recv.pBuf = NULL;
+    pTCPLinkObj->Recv.BufBegin = pTCPLinkObj->Recv.BufEnd = 0;
+    pTCPLinkObj->Recv.IsDone = true;
+
+    // Connection error - store it and signal waiting command
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    pTCPLinkObj->RecvError = Result;
+    pTCPLinkObj->CmdResponseReady = 1;  // Wake up waiting command
+    pthread_cond_signal(&pTCPLinkObj->CmdResponseCond);
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    // Wake IOC_recvDAT parked on polling buffer, who'll see RecvError,
+    //  and DatSenders waiting for credits which will never be returned
+    _IOC_DatRing_close(&pTCPLinkObj->PollingBuffer.Ring);
+    _IOC_DatCredit_close(&pTCPLinkObj->DatCredit);
+
+    // Wake IOC_flushDAT waiting for acks which will never come, and complete sends whose completions won't either.
+    //  SendMutex keeps a DatSender from appending meanwhile, or failing to send after its completer is taken here.
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    pTCPLinkObj->DatFlush.IsRecvDone = true;
+    pthread_cond_broadcast(&pTCPLinkObj->DatFlush.AckedCond);
+    _IOC_DatCompleter_pT pCompleter = pTCPLinkObj->DatCompletion.pHead;
+    pTCPLinkObj->DatCompletion.pHead = pTCPLinkObj->DatCompletion.pTail = NULL;
+    pTCPLinkObj->DatCompletion.IsRecvDone = true;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+
+    while (pCompleter) {
+        _IOC_DatCompleter_pT pNext = pCompleter->pNext;
+        _IOC_completeDat(pCompleter, IOC_RESULT_LINK_BROKEN);
+        free(pCompleter);
+        pCompleter = pNext;
+    }
+}
+
+/**
+ * @brief Make Size bytes of the message being parsed read in Recv.pBuf, by reading what has arrived
+ *    into all free space of pBuf at once, after moving the partial message to its front if it wouldn't fit.
+ *
+ * @return IOC_RESULT_SUCCESS once Size bytes are read, IOC_RESULT_NO_DATA if they haven't all arrived yet,
+ *    or this readiness is out of reads, IOC_RESULT_POSIX_ENOMEM, or errors as __TCP_recvAll.
+ */
+static IOC_Result_T __IOC_fillRecvBuf_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj, ULONG_T Size) {
+    while (pTCPLinkObj->Recv.BufEnd - pTCPLinkObj->Recv.BufBegin < Size) {
+        if (pTCPLinkObj->Recv.IsSockDrained || pTCPLinkObj->Recv.ReadNum >= TCP_RECV_READ_BUDGET) {
+            return IOC_RESULT_NO_DATA;  // The reactor fires again if more has arrived or is left in the socket
+        }
+
+        if (!pTCPLinkObj->Recv.pBuf) {
+            pTCPLinkObj->Recv.pBuf = malloc(TCP_RECV_BUF_SIZE);
+            if (!pTCPLinkObj->Recv.pBuf) return IOC_RESULT_POSIX_ENOMEM;
+        }
+        if (pTCPLinkObj->Recv.BufBegin + Size > TCP_RECV_BUF_SIZE) {
+            pTCPLinkObj->Recv.BufEnd -= pTCPLinkObj->Recv.BufBegin;
+            memmove(pTCPLinkObj->Recv.pBuf, pTCPLinkObj->Recv.pBuf + pTCPLinkObj->Recv.BufBegin,
+                    pTCPLinkObj->Recv.BufEnd);
+            pTCPLinkObj->Recv.BufBegin = 0;
+        }
 
-            if (CbRecvDat_F) {
-                // Invoke data callback
-                IOC_DatDesc_T DatDesc = {0};
-                IOC_initDatDesc(&DatDesc);
-                DatDesc.Payload.pData = pData;
-                DatDesc.Payload.PtrDataSize = DataSize;
-                DatDesc.Payload.PtrDataLen = DataSize;
-
-                IOC_LinkID_T LinkID = pTCPLinkObj->pOwnerLinkObj->ID;
-                CbRecvDat_F(LinkID, &DatDesc, pCbPrivData);
-            } else if (IsPollingMode) {
-                // Write to polling buffer
-                __IOC_writeDataToPollingBuffer(pTCPLinkObj, pData, DataSize);
+        ULONG_T FreeSize = TCP_RECV_BUF_SIZE - pTCPLinkObj->Recv.BufEnd;
+        ULONG_T ReadSize = 0;
+        pTCPLinkObj->Recv.ReadNum++;
+        IOC_Result_T Result = __TCP_recvOnce(pTCPLinkObj->SocketFd, pTCPLinkObj->Recv.pBuf + pTCPLinkObj->Recv.BufEnd,
+                                             FreeSize, &ReadSize);
+        if (Result != IOC_RESULT_SUCCESS) return Result;
+        pTCPLinkObj->Recv.BufEnd += ReadSize;
+        pTCPLinkObj->Recv.IsSockDrained = (ReadSize < FreeSize);
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Receive the payload of Recv.PayloadSize into Recv.pPayload, or in place in Recv.pBuf, or skip it.
+ *    A payload up to TCP_RECV_INPLACE_MAX_SIZE is read in pBuf with the messages around it, then copied out
+ *    unless it's in place, while a larger one takes its head read in pBuf, then the rest is received directly.
+ */
+static IOC_Result_T __IOC_recvPayload_ofProtoTCP(_IOC_ProtoTCPLinkObject_pT pTCPLinkObj) {
+    ULONG_T PayloadSize = pTCPLinkObj->Recv.PayloadSize;
+
+    if (PayloadSize <= TCP_RECV_INPLACE_MAX_SIZE) {
+        IOC_Result_T Result = __IOC_fillRecvBuf_ofProtoTCP(pTCPLinkObj, PayloadSize);
+        if (Result != IOC_RESULT_SUCCESS) return Result;
+
+        uint8_t* pReadPayload = pTCPLinkObj->Recv.pBuf + pTCPLinkObj->Recv.BufBegin;
+        if (pTCPLinkObj->Recv.IsInPlace) {
+            pTCPLinkObj->Recv.pPayload = pReadPayload;  // Valid until pBuf is read into again
+        } else if (pTCPLinkObj->Recv.pPayload && PayloadSize > 0) {
+            memcpy(pTCPLinkObj->Recv.pPayload, pReadPayload, PayloadSize);
+        }
+        pTCPLinkObj->Recv.BufBegin += PayloadSize;
+        pTCPLinkObj->Recv.RecvdSize = PayloadSize;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    ULONG_T ReadSize = pTCPLinkObj->Recv.BufEnd - pTCPLinkObj->Recv.BufBegin;
+    if (ReadSize > PayloadSize - pTCPLinkObj->Recv.RecvdSize) ReadSize = PayloadSize - pTCPLinkObj->Recv.RecvdSize;
+    if (pTCPLinkObj->Recv.pPayload && ReadSize > 0) {
+        memcpy((uint8_t*)pTCPLinkObj->Recv.pPayload + pTCPLinkObj->Recv.RecvdSize,
+               pTCPLinkObj->Recv.pBuf + pTCPLinkObj->Recv.BufBegin, ReadSize);
+    }
+    pTCPLinkObj->Recv.BufBegin += ReadSize;
+    pTCPLinkObj->Recv.RecvdSize += ReadSize;
+
+    if (pTCPLinkObj->Recv.pPayload) {
+        return __TCP_recvSome(pTCPLinkObj->SocketFd, pTCPLinkObj->Recv.pPayload, PayloadSize,
+                              &pTCPLinkObj->Recv.RecvdSize);
+    } else {
+        return __TCP_skipSome(pTCPLinkObj->SocketFd, PayloadSize, &pTCPLinkObj->Recv.RecvdSize);
+    }
+}
+
+/**
+ * @brief Called by the reactor when a link's socket is readable, to receive and handle what has arrived,
+ *    resuming the partial message of the last call, if any. It returns false to stay disarmed
+ *    once the link is broken, until closeLink unwatches it.
+ *  All messages read in Recv.pBuf are handled before it returns, as the reactor only knows of the socket,
+ *    so a busy link is bounded by its reads instead, then re-armed behind other ready links.
+ */
+static bool __IOC_onLinkReady_ofProtoTCP(_IOC_ReactorFd_pT pReactorFd) {
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pReactorFd->pPriv;
+    pTCPLinkObj->Recv.ReadNum = 0;
+    pTCPLinkObj->Recv.IsSockDrained = false;
+
+    while (true) {
+        IOC_Result_T Result = IOC_RESULT_SUCCESS;
+        if (pTCPLinkObj->Recv.HeaderSize < sizeof(TCPMessageHeader_T)) {
+            Result = __IOC_fillRecvBuf_ofProtoTCP(pTCPLinkObj, sizeof(TCPMessageHeader_T));
+            if (Result == IOC_RESULT_SUCCESS) {
+                memcpy(&pTCPLinkObj->Recv.Header, pTCPLinkObj->Recv.pBuf + pTCPLinkObj->Recv.BufBegin,
+                       sizeof(TCPMessageHeader_T));
+                pTCPLinkObj->Recv.BufBegin += sizeof(TCPMessageHeader_T);
+                pTCPLinkObj->Recv.HeaderSize = sizeof(TCPMessageHeader_T);
+                Result = __IOC_beginRecvMsg_ofProtoTCP(pTCPLinkObj);
             }
+        }
+        if (Result == IOC_RESULT_SUCCESS) {
+            Result = __IOC_recvPayload_ofProtoTCP(pTCPLinkObj);
+        }
+
+        if (Result == IOC_RESULT_NO_DATA) {
+            return true;  // Rest of the message comes later
+        } else if (Result != IOC_RESULT_SUCCESS) {
+            __IOC_endRecv_ofProtoTCP(pTCPLinkObj, Result);
+            return false;
+        }
 
-            free(pData);
-        } else if (MsgType == TCP_MSG_COMMAND && DataSize == sizeof(IOC_CmdDesc_T)) {
-            // Receive command descriptor
-            IOC_CmdDesc_T CmdDesc;
-            Result = __TCP_recvAll(pTCPLinkObj->SocketFd, &CmdDesc, sizeof(CmdDesc));
-            if (Result != IOC_RESULT_SUCCESS) {
+        pTCPLinkObj->Recv.HeaderSize = 0;  // Next message follows
+        __IOC_handleRecvMsg_ofProtoTCP(pTCPLinkObj);
+    }
+}
+
+/**
+ * @brief Called by the reactor when a connected client's usage negotiation arrives, to receive it as far as it has,
+ *    then the client leaves the reactor for AcceptableClients, even if failed, so acceptClient fails by it.
+ */
+static bool __IOC_onPendingClientReady_ofProtoTCP(_IOC_ReactorFd_pT pReactorFd) {
+    _IOC_ProtoTCPPendingClient_pT pClient = (_IOC_ProtoTCPPendingClient_pT)pReactorFd->pPriv;
+    _IOC_ProtoTCPServiceObject_pT pTCPSrvObj = pClient->pTCPSrvObj;
+
+    IOC_Result_T Result =
+        __TCP_recvSome(pReactorFd->Fd, pClient->Negotiation, sizeof(TCPMessageHeader_T), &pClient->RecvdSize);
+    if (Result == IOC_RESULT_SUCCESS) {
+        TCPMessageHeader_T NegotiationHeader;
+        memcpy(&NegotiationHeader, pClient->Negotiation, sizeof(NegotiationHeader));
+        if (ntohl(NegotiationHeader.MsgType) != TCP_MSG_USAGE_NEGOTIATION) {
+            _IOC_LogError("Expected usage negotiation message, got type %u", ntohl(NegotiationHeader.MsgType));
+            Result = IOC_RESULT_BUG;
+        } else {
+            // A client with DAT credits sends its grant after usage
+            bool IsDatCreditNegotiated =
+                (ntohl(NegotiationHeader.DataSize) >= sizeof(IOC_LinkUsage_T) + sizeof(TCPDatCredit_T));
+            pClient->NegotiationSize =
+                sizeof(pClient->Negotiation) - (IsDatCreditNegotiated ? 0 : sizeof(TCPDatCredit_T));
+            Result =
+                __TCP_recvSome(pReactorFd->Fd, pClient->Negotiation, pClient->NegotiationSize, &pClient->RecvdSize);
+        }
+    }
+    if (Result == IOC_RESULT_NO_DATA) return true;  // Rest of the negotiation comes later
+
+    // acceptClient takes over the client socket from now on, and replies to it
+    _IOC_Reactor_unwatchFd(pReactorFd);
+    pClient->Result = Result;
+
+    pthread_mutex_lock(&pTCPSrvObj->Mutex);
+    if (!pTCPSrvObj->IsOffline) {
+        for (_IOC_ProtoTCPPendingClient_pT* ppClient = &pTCPSrvObj->pNegotiatingClients; *ppClient;
+             ppClient = &(*ppClient)->pNext) {
+            if (*ppClient == pClient) {
+                *ppClient = pClient->pNext;
                 break;
             }
+        }
 
-            // Check if this is a command request or response
-            // If Status is INITIALIZED or PENDING, it's a Request.
-            // If Status is SUCCESS, FAILED, TIMEOUT, it's a Response.
-            bool IsRequest = (CmdDesc.Status <= IOC_CMD_STATUS_PROCESSING);
-
-            if (IsRequest) {
-                // This is a command REQUEST - we are the executor
-
-                // Check for IN payload (pointer-based)
-                void* pInData = NULL;
-                if (CmdDesc.InPayload.PtrDataLen > 0) {
-                    TCPMessageHeader_T PayloadHeader;
-                    Result = __TCP_recvAll(pTCPLinkObj->SocketFd, &PayloadHeader, sizeof(PayloadHeader));
-                    if (Result == IOC_RESULT_SUCCESS) {
-                        uint32_t PayloadMsgType = ntohl(PayloadHeader.MsgType);
-                        uint32_t PayloadDataSize = ntohl(PayloadHeader.DataSize);
-
-                        if (PayloadMsgType == TCP_MSG_DATA && PayloadDataSize == CmdDesc.InPayload.PtrDataLen) {
-                            pInData = malloc(PayloadDataSize + 1);
-                            if (pInData) {
-                                Result = __TCP_recvAll(pTCPLinkObj->SocketFd, pInData, PayloadDataSize);
-                                if (Result == IOC_RESULT_SUCCESS) {
-                                    CmdDesc.InPayload.pData = pInData;
-                                } else {
-                                    free(pInData);
-                                    pInData = NULL;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                IOC_CbExecCmd_F CbExecCmd_F = pTCPLinkObj->CmdUsageArgs.CbExecCmd_F;
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-
-                if (CbExecCmd_F) {
-                    // 🎯 STATE TRANSITION: INITIALIZED/PENDING → PROCESSING (per Architecture Design)
-                    CmdDesc.Status = IOC_CMD_STATUS_PROCESSING;
-
-                    // Execute command through callback
-                    pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                    void* pCbPrivData = pTCPLinkObj->CmdUsageArgs.pCbPrivData;
-                    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-
-                    IOC_LinkID_T LinkID = pTCPLinkObj->pOwnerLinkObj->ID;
-                    IOC_Result_T ExecResult = CbExecCmd_F(LinkID, &CmdDesc, pCbPrivData);
-
-                    // 🎯 STATE TRANSITION: PROCESSING → SUCCESS/FAILED (per Architecture Design)
-                    // Set command status based on execution result
-                    if (ExecResult == IOC_RESULT_SUCCESS) {
-                        CmdDesc.Status = IOC_CMD_STATUS_SUCCESS;
-                    } else {
-                        CmdDesc.Status = IOC_CMD_STATUS_FAILED;
-                    }
-                    CmdDesc.Result = ExecResult;
-
-                    if (pInData) free(pInData);
-
-                    // Send response back (CmdDesc + OUT payload data)
-                    TCPMessageHeader_T RespHeader;
-                    RespHeader.MsgType = htonl(TCP_MSG_COMMAND);
-                    RespHeader.DataSize = htonl(sizeof(IOC_CmdDesc_T));
-
-                    __TCP_sendAll(pTCPLinkObj->SocketFd, &RespHeader, sizeof(RespHeader));
-                    __TCP_sendAll(pTCPLinkObj->SocketFd, &CmdDesc, sizeof(CmdDesc));
-
-                    // Send OUT payload data if present (pointer-based only)
-                    void* pOutData = IOC_CmdDesc_getOutData(&CmdDesc);
-                    ULONG_T OutDataLen = IOC_CmdDesc_getOutDataLen(&CmdDesc);
-
-                    if (pOutData && OutDataLen > 0 && CmdDesc.OutPayload.PtrDataLen > 0) {
-                        TCPMessageHeader_T PayloadHeader;
-                        PayloadHeader.MsgType = htonl(TCP_MSG_DATA);
-                        PayloadHeader.DataSize = htonl(OutDataLen);
-                        __TCP_sendAll(pTCPLinkObj->SocketFd, &PayloadHeader, sizeof(PayloadHeader));
-                        __TCP_sendAll(pTCPLinkObj->SocketFd, pOutData, OutDataLen);
-                    }
-                } else {
-                    // Polling Mode: Queue it
-                    pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                    if (pTCPLinkObj->IncomingCmdCount < 16) {
-                        pTCPLinkObj->IncomingCmdQueue[pTCPLinkObj->IncomingCmdTail] = CmdDesc;
-                        pTCPLinkObj->IncomingCmdTail = (pTCPLinkObj->IncomingCmdTail + 1) % 16;
-                        pTCPLinkObj->IncomingCmdCount++;
-                        pthread_cond_signal(&pTCPLinkObj->IncomingCmdCond);
-                    } else {
-                        _IOC_LogError("Incoming command queue full, dropping command");
-                        if (pInData) free(pInData);
-                    }
-                    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-                }
-            } else {
-                // This is a command RESPONSE - we are the initiator
-                // Copy response to local storage
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                pTCPLinkObj->CmdResponse = CmdDesc;
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-
-                // Try to receive OUT payload data (if any)
-                // Only if PtrDataLen > 0
-                if (CmdDesc.OutPayload.PtrDataLen > 0) {
-                    TCPMessageHeader_T PayloadHeader;
-                    Result = __TCP_recvAll(pTCPLinkObj->SocketFd, &PayloadHeader, sizeof(PayloadHeader));
-                    if (Result == IOC_RESULT_SUCCESS) {
-                        uint32_t PayloadMsgType = ntohl(PayloadHeader.MsgType);
-                        uint32_t PayloadDataSize = ntohl(PayloadHeader.DataSize);
-
-                        if (PayloadMsgType == TCP_MSG_DATA && PayloadDataSize > 0) {
-                            // Allocate buffer for OUT payload data
-                            void* pPayloadData = malloc(PayloadDataSize);
-                            if (pPayloadData) {
-                                Result = __TCP_recvAll(pTCPLinkObj->SocketFd, pPayloadData, PayloadDataSize);
-                                if (Result == IOC_RESULT_SUCCESS) {
-                                    // Set OUT payload in response
-                                    pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                                    IOC_CmdDesc_setOutPayload(&pTCPLinkObj->CmdResponse, pPayloadData, PayloadDataSize);
-                                    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
-                                }
-                                free(pPayloadData);
-                            }
-                        }
-                    }
-                }
+        pClient->pNext = NULL;
+        if (pTCPSrvObj->pAcceptableTail) {
+            pTCPSrvObj->pAcceptableTail->pNext = pClient;
+        } else {
+            pTCPSrvObj->pAcceptableHead = pClient;
+        }
+        pTCPSrvObj->pAcceptableTail = pClient;
+        pthread_cond_signal(&pTCPSrvObj->AcceptableCond);
+    }
+    pthread_mutex_unlock(&pTCPSrvObj->Mutex);
+    return false;
+}
 
-                // Signal the waiting command execution
-                pthread_mutex_lock(&pTCPLinkObj->Mutex);
-                pTCPLinkObj->CmdResponseReady = 1;
-                pthread_cond_signal(&pTCPLinkObj->CmdResponseCond);
-                pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+/**
+ * @brief Called by the reactor when clients are connecting, to accept all of them, and receive their negotiations
+ */
+static bool __IOC_onListenReady_ofProtoTCP(_IOC_ReactorFd_pT pReactorFd) {
+    _IOC_ProtoTCPServiceObject_pT pTCPSrvObj = (_IOC_ProtoTCPServiceObject_pT)pReactorFd->pPriv;
+
+    while (1) {
+        int ClientFd = accept(pReactorFd->Fd, NULL, NULL);
+        if (ClientFd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                _IOC_LogError("Failed to accept TCP client connection, errno=%d", errno);
             }
+            return true;
+        }
+
+#if !defined(__linux__)
+        // accept() of BSD/macOS passes the listener's O_NONBLOCK to ClientFd, while Linux's never does,
+        //  so clear it for the blocking __TCP_sendAllv/recv of the link, which fails by EAGAIN otherwise.
+        int ClientFlags = fcntl(ClientFd, F_GETFL);
+        if (ClientFlags < 0 || fcntl(ClientFd, F_SETFL, ClientFlags & ~O_NONBLOCK) < 0) {
+            _IOC_LogError("Failed to make TCP client connection blocking, errno=%d", errno);
+            close(ClientFd);
+            continue;
+        }
+#endif
+
+        _IOC_ProtoTCPPendingClient_pT pClient = calloc(1, sizeof(_IOC_ProtoTCPPendingClient_T));
+        if (!pClient) {
+            close(ClientFd);
+            _IOC_LogError("Failed to alloc pending TCP client");
+            continue;
+        }
+        pClient->pTCPSrvObj = pTCPSrvObj;
+        pClient->ReactorFd.Fd = ClientFd;
+        pClient->ReactorFd.OnReady_F = __IOC_onPendingClientReady_ofProtoTCP;
+        pClient->ReactorFd.pPriv = pClient;
+        pClient->ReactorFd.ShardIdx = pReactorFd->ShardIdx;
+
+        pthread_mutex_lock(&pTCPSrvObj->Mutex);
+        IOC_Result_T Result = _IOC_Reactor_watchFd(&pClient->ReactorFd);
+        if (Result == IOC_RESULT_SUCCESS) {
+            pClient->pNext = pTCPSrvObj->pNegotiatingClients;
+            pTCPSrvObj->pNegotiatingClients = pClient;
+        }
+        pthread_mutex_unlock(&pTCPSrvObj->Mutex);
+
+        if (Result != IOC_RESULT_SUCCESS) {
+            close(ClientFd);
+            free(pClient);
+            _IOC_LogError("Failed to watch TCP client connection, Result=%d", Result);
         }
     }
+}
 
-    return NULL;
+/**
+ * @brief Close and free pending clients never accepted, after the reactor leaves them
+ */
+static void __IOC_freePendingClients_ofProtoTCP(_IOC_ProtoTCPPendingClient_pT pClient) {
+    while (pClient) {
+        _IOC_ProtoTCPPendingClient_pT pNext = pClient->pNext;
+        _IOC_Reactor_unwatchFd(&pClient->ReactorFd);
+        close(pClient->ReactorFd.Fd);
+        free(pClient);
+        pClient = pNext;
+    }
+}
+
+/**
+ * @brief Open a non-blocking listening socket on Port,
+ *  which other listeners of the same service share by SO_REUSEPORT if IsReusePort.
+ */
+static IOC_Result_T __IOC_openListener_ofProtoTCP(uint16_t Port, bool IsReusePort, int* pListenFd) {
+    // Create TCP listening socket
+    int ListenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (ListenFd < 0) {
+        _IOC_LogError("Failed to create TCP socket");
+        return IOC_RESULT_BUG;
+    }
+
+    // Set socket options (reuse address), and share the port with other listeners, if any,
+    //  among which the kernel spreads new connections.
+    int OptVal = 1;
+    setsockopt(ListenFd, SOL_SOCKET, SO_REUSEADDR, &OptVal, sizeof(OptVal));
+    if (IsReusePort && setsockopt(ListenFd, SOL_SOCKET, SO_REUSEPORT, &OptVal, sizeof(OptVal)) < 0) {
+        close(ListenFd);
+        _IOC_LogError("Failed to set SO_REUSEPORT on TCP socket");
+        return IOC_RESULT_BUG;
+    }
+
+    // Bind to port
+    struct sockaddr_in SrvAddr = {0};
+    SrvAddr.sin_family = AF_INET;
+    SrvAddr.sin_addr.s_addr = INADDR_ANY;
+    SrvAddr.sin_port = htons(Port);
+
+    if (bind(ListenFd, (struct sockaddr*)&SrvAddr, sizeof(SrvAddr)) < 0) {
+        close(ListenFd);
+        _IOC_LogError("Failed to bind TCP socket to port %u", Port);
+        return IOC_RESULT_BUG;
+    }
+
+    // Listen for connections, with a backlog deep enough for a burst of clients connecting at once
+    if (listen(ListenFd, SOMAXCONN) < 0) {
+        close(ListenFd);
+        _IOC_LogError("Failed to listen on TCP socket");
+        return IOC_RESULT_BUG;
+    }
+
+    // Clients are accepted by the reactor, which MUST NOT block in accept()
+    if (fcntl(ListenFd, F_SETFL, fcntl(ListenFd, F_GETFL) | O_NONBLOCK) < 0) {
+        close(ListenFd);
+        _IOC_LogError("Failed to set TCP listening socket non-blocking");
+        return IOC_RESULT_BUG;
+    }
+
+    *pListenFd = ListenFd;
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * @brief Close all listeners, drop clients never accepted, then free the TCP service object
+ */
+static void __IOC_freeService_ofProtoTCP(_IOC_ProtoTCPServiceObject_pT pTCPSrvObj) {
+    // Stop accepting, then drop clients never accepted, once the reactor leaves them
+    for (ULONG_T i = 0; i < pTCPSrvObj->ListenerNum; i++) {
+        _IOC_Reactor_unwatchFd(&pTCPSrvObj->ListenReactorFds[i]);
+        close(pTCPSrvObj->ListenReactorFds[i].Fd);
+    }
+
+    pthread_mutex_lock(&pTCPSrvObj->Mutex);
+    pTCPSrvObj->IsOffline = true;
+    _IOC_ProtoTCPPendingClient_pT pNegotiatingClients = pTCPSrvObj->pNegotiatingClients;
+    _IOC_ProtoTCPPendingClient_pT pAcceptableClients = pTCPSrvObj->pAcceptableHead;
+    pTCPSrvObj->pNegotiatingClients = pTCPSrvObj->pAcceptableHead = pTCPSrvObj->pAcceptableTail = NULL;
+    pthread_mutex_unlock(&pTCPSrvObj->Mutex);
+
+    __IOC_freePendingClients_ofProtoTCP(pNegotiatingClients);
+    __IOC_freePendingClients_ofProtoTCP(pAcceptableClients);
+
+    pthread_mutex_destroy(&pTCPSrvObj->Mutex);
+    pthread_cond_destroy(&pTCPSrvObj->AcceptableCond);
+    free(pTCPSrvObj);
 }
 
 /**
@@ -609,6 +1418,13 @@ static void* __TCP_recvThread(void* pArg) {
 static IOC_Result_T __IOC_onlineService_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj) {
     // 🟢 GREEN: Minimal implementation to pass TC-1
 
+    // One listener by default, or SrvArgs::ListenerNum of them sharing the port, each on its own reactor shard
+    ULONG_T ListenerNum = pSrvObj->Args.ListenerNum ? pSrvObj->Args.ListenerNum : 1;
+    if (ListenerNum > _IOC_REACTOR_MAX_SHARD_NUM) {
+        _IOC_LogError("Too many TCP listeners(%lu), at most %d", ListenerNum, _IOC_REACTOR_MAX_SHARD_NUM);
+        return IOC_RESULT_INVALID_PARAM;
+    }
+
     // Allocate TCP service object
     _IOC_ProtoTCPServiceObject_pT pTCPSrvObj = calloc(1, sizeof(_IOC_ProtoTCPServiceObject_T));
     if (!pTCPSrvObj) {
@@ -617,45 +1433,45 @@ static IOC_Result_T __IOC_onlineService_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj
 
     pTCPSrvObj->pSrvObj = pSrvObj;
     pTCPSrvObj->Port = pSrvObj->Args.SrvURI.Port;
-
-    // Create TCP listening socket
-    int ListenFd = socket(AF_INET, SOCK_STREAM, 0);
-    if (ListenFd < 0) {
-        free(pTCPSrvObj);
-        _IOC_LogError("Failed to create TCP socket");
-        return IOC_RESULT_BUG;
+    if ((pSrvObj->Args.UsageCapabilites & IOC_LinkUsageDatReceiver) && pSrvObj->Args.UsageArgs.pDat) {
+        pTCPSrvObj->DatPollingBufSize = pSrvObj->Args.UsageArgs.pDat->PollingBufSize;
     }
+    if ((pSrvObj->Args.UsageCapabilites & IOC_LinkUsageEvtProducer) && pSrvObj->Args.UsageArgs.pEvt) {
+        pTCPSrvObj->EvtCoalesce = pSrvObj->Args.UsageArgs.pEvt->Coalesce;
+    }
+    if ((pSrvObj->Args.UsageCapabilites & IOC_LinkUsageDatSender) && pSrvObj->Args.UsageArgs.pDat) {
+        pTCPSrvObj->DatCoalesce = pSrvObj->Args.UsageArgs.pDat->Coalesce;
+    }
+    pthread_mutex_init(&pTCPSrvObj->Mutex, NULL);
+    pthread_cond_init(&pTCPSrvObj->AcceptableCond, NULL);
 
-    // Set socket options (reuse address)
-    int OptVal = 1;
-    setsockopt(ListenFd, SOL_SOCKET, SO_REUSEADDR, &OptVal, sizeof(OptVal));
-
-    // Bind to port
-    struct sockaddr_in SrvAddr = {0};
-    SrvAddr.sin_family = AF_INET;
-    SrvAddr.sin_addr.s_addr = INADDR_ANY;
-    SrvAddr.sin_port = htons(pTCPSrvObj->Port);
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    while (pTCPSrvObj->ListenerNum < ListenerNum) {
+        _IOC_ReactorFd_pT pListenReactorFd = &pTCPSrvObj->ListenReactorFds[pTCPSrvObj->ListenerNum];
+        Result = __IOC_openListener_ofProtoTCP(pTCPSrvObj->Port, ListenerNum > 1, &pListenReactorFd->Fd);
+        if (Result != IOC_RESULT_SUCCESS) {
+            break;
+        }
 
-    if (bind(ListenFd, (struct sockaddr*)&SrvAddr, sizeof(SrvAddr)) < 0) {
-        uint16_t Port = pTCPSrvObj->Port;  // Save port before free
-        close(ListenFd);
-        free(pTCPSrvObj);
-        _IOC_LogError("Failed to bind TCP socket to port %u", Port);
-        return IOC_RESULT_BUG;
+        pListenReactorFd->OnReady_F = __IOC_onListenReady_ofProtoTCP;
+        pListenReactorFd->pPriv = pTCPSrvObj;
+        pListenReactorFd->ShardIdx = pTCPSrvObj->ListenerNum;
+        if (_IOC_Reactor_watchFd(pListenReactorFd) != IOC_RESULT_SUCCESS) {
+            close(pListenReactorFd->Fd);
+            _IOC_LogError("Failed to watch TCP listening socket");
+            Result = IOC_RESULT_BUG;
+            break;
+        }
+        pTCPSrvObj->ListenerNum++;
     }
 
-    // Listen for connections
-    if (listen(ListenFd, 5) < 0) {
-        close(ListenFd);
-        free(pTCPSrvObj);
-        _IOC_LogError("Failed to listen on TCP socket");
-        return IOC_RESULT_BUG;
+    if (Result != IOC_RESULT_SUCCESS) {
+        __IOC_freeService_ofProtoTCP(pTCPSrvObj);
+        return Result;
     }
-
-    pTCPSrvObj->ListenSocketFd = ListenFd;
     pSrvObj->pProtoPriv = pTCPSrvObj;
 
-    _IOC_LogInfo("TCP service onlined on port %u", pTCPSrvObj->Port);
+    _IOC_LogInfo("TCP service onlined on port %u by %lu listener(s)", pTCPSrvObj->Port, ListenerNum);
     return IOC_RESULT_SUCCESS;
 }
 
@@ -666,10 +1482,7 @@ static IOC_Result_T __IOC_offlineService_ofProtoTCP(_IOC_ServiceObject_pT pSrvOb
     _IOC_ProtoTCPServiceObject_pT pTCPSrvObj = (_IOC_ProtoTCPServiceObject_pT)pSrvObj->pProtoPriv;
 
     if (pTCPSrvObj) {
-        if (pTCPSrvObj->ListenSocketFd >= 0) {
-            close(pTCPSrvObj->ListenSocketFd);
-        }
-        free(pTCPSrvObj);
+        __IOC_freeService_ofProtoTCP(pTCPSrvObj);
         pSrvObj->pProtoPriv = NULL;
     }
 
@@ -682,14 +1495,17 @@ static IOC_Result_T __IOC_offlineService_ofProtoTCP(_IOC_ServiceObject_pT pSrvOb
 static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const IOC_ConnArgs_pT pConnArgs,
                                                     const IOC_Options_pT pOption) {
     // Create TCP link object
-    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = calloc(1, sizeof(_IOC_ProtoTCPLinkObject_T));
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = _IOC_DatRing_callocEmbedder(sizeof(_IOC_ProtoTCPLinkObject_T));
     if (!pTCPLinkObj) {
         return IOC_RESULT_POSIX_ENOMEM;
     }
 
     pTCPLinkObj->pOwnerLinkObj = pLinkObj;
     pthread_mutex_init(&pTCPLinkObj->Mutex, NULL);
+    pthread_mutex_init(&pTCPLinkObj->SendMutex, NULL);
     pthread_cond_init(&pTCPLinkObj->CmdResponseCond, NULL);
+    pthread_cond_init(&pTCPLinkObj->DatFlush.AckedCond, NULL);
+    _IOC_DatCredit_initOne(&pTCPLinkObj->DatCredit, 0, 0);  // Unlimited until the peer grants in negotiation
     pTCPLinkObj->CmdResponseReady = 0;
     pTCPLinkObj->RecvError = IOC_RESULT_SUCCESS;  // Initialize to no error
 
@@ -699,7 +1515,10 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
     pTCPLinkObj->IncomingCmdCount = 0;
 
     // Initialize polling buffer
-    if (__IOC_initPollingBuffer_ofProtoTCP(pTCPLinkObj) != IOC_RESULT_SUCCESS) {
+    ULONG_T PollingBufSize = ((pConnArgs->Usage & IOC_LinkUsageDatReceiver) && pConnArgs->UsageArgs.pDat)
+                                 ? pConnArgs->UsageArgs.pDat->PollingBufSize
+                                 : 0;
+    if (__IOC_initPollingBuffer_ofProtoTCP(pTCPLinkObj, PollingBufSize) != IOC_RESULT_SUCCESS) {
         pthread_mutex_destroy(&pTCPLinkObj->Mutex);
         pthread_cond_destroy(&pTCPLinkObj->CmdResponseCond);
         pthread_cond_destroy(&pTCPLinkObj->IncomingCmdCond);
@@ -768,22 +1587,23 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
     pTCPLinkObj->SocketFd = SocketFd;
     pLinkObj->pProtoPriv = pTCPLinkObj;
 
-    // Send usage negotiation message to server
-    TCPMessageHeader_T NegotiationHeader = {.MsgType = htonl(TCP_MSG_USAGE_NEGOTIATION),
-                                            .DataSize = htonl(sizeof(IOC_LinkUsage_T))};
-
-    if (__TCP_sendAll(SocketFd, &NegotiationHeader, sizeof(NegotiationHeader)) != IOC_RESULT_SUCCESS) {
-        close(SocketFd);
-        free(pTCPLinkObj);
-        _IOC_LogError("Failed to send usage negotiation header");
-        return IOC_RESULT_BUG;
+    // Send usage negotiation message to server, with the credits granted to it if client is DatReceiver
+    if (pLinkObj->Args.Usage & IOC_LinkUsageDatReceiver) {
+        __IOC_setDatGrant_ofProtoTCP(pTCPLinkObj, pConnArgs->UsageArgs.pDat);
     }
-
+    TCPMessageHeader_T NegotiationHeader = {.MsgType = htonl(TCP_MSG_USAGE_NEGOTIATION),
+                                            .DataSize = htonl(sizeof(IOC_LinkUsage_T) + sizeof(TCPDatCredit_T))};
     IOC_LinkUsage_T ClientUsage = pLinkObj->Args.Usage;
-    if (__TCP_sendAll(SocketFd, &ClientUsage, sizeof(ClientUsage)) != IOC_RESULT_SUCCESS) {
+    TCPDatCredit_T ClientGrant = {.DatNum = htonl((uint32_t)pTCPLinkObj->DatGrant.MaxDatNum),
+                                  .DatBytes = htonl((uint32_t)pTCPLinkObj->DatGrant.MaxDatBytes),
+                                  .Flags = htonl(pTCPLinkObj->DatGrant.Flags)};
+    struct iovec NegotiationIOVs[3] = {{.iov_base = &NegotiationHeader, .iov_len = sizeof(NegotiationHeader)},
+                                       {.iov_base = &ClientUsage, .iov_len = sizeof(ClientUsage)},
+                                       {.iov_base = &ClientGrant, .iov_len = sizeof(ClientGrant)}};
+    if (__TCP_sendAllv(SocketFd, NegotiationIOVs, 3) != IOC_RESULT_SUCCESS) {
         close(SocketFd);
         free(pTCPLinkObj);
-        _IOC_LogError("Failed to send client usage");
+        _IOC_LogError("Failed to send usage negotiation");
         return IOC_RESULT_BUG;
     }
 
@@ -811,6 +1631,17 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
         return IOC_RESULT_INCOMPATIBLE_USAGE;
     }
 
+    // Receive credits granted by server, which bound our data in flight if it's DatReceiver
+    TCPDatCredit_T ServiceGrant = {0};
+    if (__TCP_recvAll(SocketFd, &ServiceGrant, sizeof(ServiceGrant)) != IOC_RESULT_SUCCESS) {
+        close(SocketFd);
+        free(pTCPLinkObj);
+        _IOC_LogError("Failed to receive DAT credits from server");
+        return IOC_RESULT_BUG;
+    }
+    _IOC_DatCredit_setWindow(&pTCPLinkObj->DatCredit, ntohl(ServiceGrant.DatNum), ntohl(ServiceGrant.DatBytes));
+    pTCPLinkObj->IsPeerDatPolling = (ntohl(ServiceGrant.Flags) & TCP_DAT_CREDIT_FLAG_POLLING) != 0;
+
     // Copy CmdUsageArgs from connection args if client is CmdExecutor
     if ((pLinkObj->Args.Usage & IOC_LinkUsageCmdExecutor) && pConnArgs->UsageArgs.pCmd) {
         memcpy(&pTCPLinkObj->CmdUsageArgs, pConnArgs->UsageArgs.pCmd, sizeof(IOC_CmdUsageArgs_T));
@@ -827,7 +1658,7 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
         }
 
         // Enable polling mode if no callback is provided
-        if (pTCPLinkObj->DatUsageArgs.CbRecvDat_F == NULL) {
+        if (pTCPLinkObj->DatUsageArgs.CbRecvDat_F == NULL && pTCPLinkObj->DatUsageArgs.CbRecvDatBatch_F == NULL) {
             pthread_mutex_lock(&pTCPLinkObj->Mutex);
             pTCPLinkObj->PollingBuffer.IsPollingMode = true;
             pthread_mutex_unlock(&pTCPLinkObj->Mutex);
@@ -835,12 +1666,28 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
         }
     }
 
-    // Start background receiver thread
-    pTCPLinkObj->RecvThreadRunning = 1;
-    if (pthread_create(&pTCPLinkObj->RecvThread, NULL, __TCP_recvThread, pTCPLinkObj) != 0) {
+    // Coalesce sends by the usage args of an EvtProducer or DatSender
+    IOC_CoalesceArgs_pT pCoalesceArgs = NULL;
+    if ((pLinkObj->Args.Usage & IOC_LinkUsageEvtProducer) && pConnArgs->UsageArgs.pEvt) {
+        pCoalesceArgs = &pConnArgs->UsageArgs.pEvt->Coalesce;
+    } else if ((pLinkObj->Args.Usage & IOC_LinkUsageDatSender) && pConnArgs->UsageArgs.pDat) {
+        pCoalesceArgs = &pConnArgs->UsageArgs.pDat->Coalesce;
+    }
+    if (__IOC_initSend_ofProtoTCP(pTCPLinkObj, pCoalesceArgs) != IOC_RESULT_SUCCESS) {
+        close(SocketFd);
+        free(pTCPLinkObj);
+        return IOC_RESULT_BUG;
+    }
+
+    // Receive by the reactor from now on
+    pTCPLinkObj->Recv.ReactorFd.Fd = SocketFd;
+    pTCPLinkObj->Recv.ReactorFd.OnReady_F = __IOC_onLinkReady_ofProtoTCP;
+    pTCPLinkObj->Recv.ReactorFd.pPriv = pTCPLinkObj;
+    if (_IOC_Reactor_watchFd(&pTCPLinkObj->Recv.ReactorFd) != IOC_RESULT_SUCCESS) {
+        __IOC_deinitSend_ofProtoTCP(pTCPLinkObj);
         close(SocketFd);
         free(pTCPLinkObj);
-        _IOC_LogError("Failed to create TCP receiver thread");
+        _IOC_LogError("Failed to watch TCP link socket");
         return IOC_RESULT_BUG;
     }
 
@@ -848,6 +1695,9 @@ static IOC_Result_T __IOC_connectService_ofProtoTCP(_IOC_LinkObject_pT pLinkObj,
     return IOC_RESULT_SUCCESS;
 }
 
+// Cleanup handler unlocking a mutex held by a cancelled thread
+static void __IOC_unlockMutex_ofProtoTCP(void* pMutex) { pthread_mutex_unlock((pthread_mutex_t*)pMutex); }
+
 /**
  * @brief Accept TCP client connection
  */
@@ -855,15 +1705,79 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
                                                   const IOC_Options_pT pOption) {
     _IOC_ProtoTCPServiceObject_pT pTCPSrvObj = (_IOC_ProtoTCPServiceObject_pT)pSrvObj->pProtoPriv;
 
+    // 🎯 TDD FIX Bug #6: Apply timeout to accept(), which waits for a client the reactor received negotiation of
+    bool IsTimed = (pOption && pOption->IDs == IOC_OPTID_TIMEOUT);
+    struct timespec AbsTimeout = {0};
+    if (IsTimed) {
+        clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+        AbsTimeout.tv_sec += pOption->Payload.TimeoutUS / 1000000;
+        AbsTimeout.tv_nsec += (pOption->Payload.TimeoutUS % 1000000) * 1000;
+        if (AbsTimeout.tv_nsec >= 1000000000) {
+            AbsTimeout.tv_sec += 1;
+            AbsTimeout.tv_nsec -= 1000000000;
+        }
+    }
+
+    _IOC_ProtoTCPPendingClient_pT pClient = NULL;
+    pthread_mutex_lock(&pTCPSrvObj->Mutex);
+    // Auto-accept daemon is cancelled while waiting here, then Mutex is unlocked by the cleanup handler
+    pthread_cleanup_push(__IOC_unlockMutex_ofProtoTCP, &pTCPSrvObj->Mutex);
+    int WaitResult = 0;
+    while (!pTCPSrvObj->pAcceptableHead && WaitResult != ETIMEDOUT) {
+        if (IsTimed) {
+            WaitResult = pthread_cond_timedwait(&pTCPSrvObj->AcceptableCond, &pTCPSrvObj->Mutex, &AbsTimeout);
+        } else {
+            pthread_cond_wait(&pTCPSrvObj->AcceptableCond, &pTCPSrvObj->Mutex);
+        }
+    }
+    pClient = pTCPSrvObj->pAcceptableHead;
+    if (pClient) {
+        pTCPSrvObj->pAcceptableHead = pClient->pNext;
+        if (!pTCPSrvObj->pAcceptableHead) pTCPSrvObj->pAcceptableTail = NULL;
+    }
+    pthread_cleanup_pop(1);
+
+    if (!pClient) {
+        // Timeout occurred - no client connected within timeout period
+        _IOC_LogWarn("acceptClient timed out after %lu microseconds", pOption->Payload.TimeoutUS);
+        return IOC_RESULT_TIMEOUT;
+    }
+
+    // Usage negotiation from client, received by the reactor
+    int ClientFd = pClient->ReactorFd.Fd;
+    ULONG_T ShardIdx = pClient->ReactorFd.ShardIdx;  // Served by the shard of the listener which accepted it
+    IOC_Result_T NegotiationResult = pClient->Result;
+    IOC_LinkUsage_T ClientUsage = IOC_LinkUsageUndefined;
+    memcpy(&ClientUsage, pClient->Negotiation + sizeof(TCPMessageHeader_T), sizeof(ClientUsage));
+
+    // A client with DAT credits sends its grant after usage, and expects ours after the negotiated role
+    bool IsDatCreditNegotiated = (pClient->NegotiationSize == sizeof(pClient->Negotiation));
+    TCPDatCredit_T ClientGrant = {0};
+    if (IsDatCreditNegotiated) {
+        memcpy(&ClientGrant, pClient->Negotiation + sizeof(TCPMessageHeader_T) + sizeof(ClientUsage),
+               sizeof(ClientGrant));
+    }
+    free(pClient);
+
+    if (NegotiationResult != IOC_RESULT_SUCCESS) {
+        close(ClientFd);
+        _IOC_LogError("Failed to receive usage negotiation from client, Result=%d", NegotiationResult);
+        return IOC_RESULT_BUG;
+    }
+
     // Create TCP link object for accepted client
-    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = calloc(1, sizeof(_IOC_ProtoTCPLinkObject_T));
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = _IOC_DatRing_callocEmbedder(sizeof(_IOC_ProtoTCPLinkObject_T));
     if (!pTCPLinkObj) {
+        close(ClientFd);
         return IOC_RESULT_POSIX_ENOMEM;
     }
 
     pTCPLinkObj->pOwnerLinkObj = pLinkObj;
     pthread_mutex_init(&pTCPLinkObj->Mutex, NULL);
+    pthread_mutex_init(&pTCPLinkObj->SendMutex, NULL);
     pthread_cond_init(&pTCPLinkObj->CmdResponseCond, NULL);
+    pthread_cond_init(&pTCPLinkObj->DatFlush.AckedCond, NULL);
+    _IOC_DatCredit_initOne(&pTCPLinkObj->DatCredit, 0, 0);  // Unlimited until the peer grants in negotiation
     pTCPLinkObj->CmdResponseReady = 0;
     pTCPLinkObj->RecvError = IOC_RESULT_SUCCESS;  // Initialize to no error
 
@@ -873,7 +1787,8 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
     pTCPLinkObj->IncomingCmdCount = 0;
 
     // Initialize polling buffer
-    if (__IOC_initPollingBuffer_ofProtoTCP(pTCPLinkObj) != IOC_RESULT_SUCCESS) {
+    if (__IOC_initPollingBuffer_ofProtoTCP(pTCPLinkObj, pTCPSrvObj->DatPollingBufSize) != IOC_RESULT_SUCCESS) {
+        close(ClientFd);
         pthread_mutex_destroy(&pTCPLinkObj->Mutex);
         pthread_cond_destroy(&pTCPLinkObj->CmdResponseCond);
         pthread_cond_destroy(&pTCPLinkObj->IncomingCmdCond);
@@ -881,73 +1796,9 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
         return IOC_RESULT_POSIX_ENOMEM;
     }
 
-    // 🎯 TDD FIX Bug #6: Apply timeout to accept() using select()
-    int ClientFd = -1;
-
-    if (pOption && pOption->IDs == IOC_OPTID_TIMEOUT) {
-        // Use select() to implement timeout for accept()
-        fd_set ReadFds;
-        struct timeval Timeout;
-
-        FD_ZERO(&ReadFds);
-        FD_SET(pTCPSrvObj->ListenSocketFd, &ReadFds);
-
-        Timeout.tv_sec = pOption->Payload.TimeoutUS / 1000000;
-        Timeout.tv_usec = pOption->Payload.TimeoutUS % 1000000;
-
-        int SelectResult = select(pTCPSrvObj->ListenSocketFd + 1, &ReadFds, NULL, NULL, &Timeout);
-
-        if (SelectResult < 0) {
-            free(pTCPLinkObj);
-            _IOC_LogError("select() failed while waiting for client connection");
-            return IOC_RESULT_BUG;
-        } else if (SelectResult == 0) {
-            // Timeout occurred - no client connected within timeout period
-            free(pTCPLinkObj);
-            _IOC_LogWarn("acceptClient timed out after %lu microseconds", pOption->Payload.TimeoutUS);
-            return IOC_RESULT_TIMEOUT;
-        }
-        // SelectResult > 0: Socket is ready, proceed with accept
-    }
-
-    // Accept incoming connection
-    struct sockaddr_in CliAddr = {0};
-    socklen_t CliLen = sizeof(CliAddr);
-
-    ClientFd = accept(pTCPSrvObj->ListenSocketFd, (struct sockaddr*)&CliAddr, &CliLen);
-    if (ClientFd < 0) {
-        free(pTCPLinkObj);
-        _IOC_LogError("Failed to accept TCP client connection");
-        return IOC_RESULT_TIMEOUT;
-    }
-
     pTCPLinkObj->SocketFd = ClientFd;
     pLinkObj->pProtoPriv = pTCPLinkObj;
 
-    // Receive usage negotiation from client
-    TCPMessageHeader_T NegotiationHeader = {0};
-    if (__TCP_recvAll(ClientFd, &NegotiationHeader, sizeof(NegotiationHeader)) != IOC_RESULT_SUCCESS) {
-        close(ClientFd);
-        free(pTCPLinkObj);
-        _IOC_LogError("Failed to receive usage negotiation header from client");
-        return IOC_RESULT_BUG;
-    }
-
-    if (ntohl(NegotiationHeader.MsgType) != TCP_MSG_USAGE_NEGOTIATION) {
-        close(ClientFd);
-        free(pTCPLinkObj);
-        _IOC_LogError("Expected usage negotiation message, got type %u", ntohl(NegotiationHeader.MsgType));
-        return IOC_RESULT_BUG;
-    }
-
-    IOC_LinkUsage_T ClientUsage = IOC_LinkUsageUndefined;
-    if (__TCP_recvAll(ClientFd, &ClientUsage, sizeof(ClientUsage)) != IOC_RESULT_SUCCESS) {
-        close(ClientFd);
-        free(pTCPLinkObj);
-        _IOC_LogError("Failed to receive client usage");
-        return IOC_RESULT_BUG;
-    }
-
     // Negotiate server's link role based on client's usage
     IOC_LinkUsage_T ServiceCapabilities = pSrvObj->Args.UsageCapabilites;
     IOC_LinkUsage_T ServiceLinkRole = _IOC_negotiateLinkRole(ServiceCapabilities, ClientUsage);
@@ -964,14 +1815,28 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
         return IOC_RESULT_INVALID_PARAM;
     }
 
-    // Send negotiated server usage back to client
-    if (__TCP_sendAll(ClientFd, &ServiceLinkRole, sizeof(ServiceLinkRole)) != IOC_RESULT_SUCCESS) {
+    // Send negotiated server usage back to client, with the credits granted to it if negotiated, in one write
+    TCPDatCredit_T ServiceGrant = {0};
+    if (IsDatCreditNegotiated && (ServiceLinkRole & IOC_LinkUsageDatReceiver)) {
+        __IOC_setDatGrant_ofProtoTCP(pTCPLinkObj, pSrvObj->Args.UsageArgs.pDat);
+        ServiceGrant = (TCPDatCredit_T){.DatNum = htonl((uint32_t)pTCPLinkObj->DatGrant.MaxDatNum),
+                                        .DatBytes = htonl((uint32_t)pTCPLinkObj->DatGrant.MaxDatBytes),
+                                        .Flags = htonl(pTCPLinkObj->DatGrant.Flags)};
+    }
+    struct iovec NegotiationIOVs[2] = {{.iov_base = &ServiceLinkRole, .iov_len = sizeof(ServiceLinkRole)},
+                                       {.iov_base = &ServiceGrant, .iov_len = sizeof(ServiceGrant)}};
+    if (__TCP_sendAllv(ClientFd, NegotiationIOVs, IsDatCreditNegotiated ? 2 : 1) != IOC_RESULT_SUCCESS) {
         close(ClientFd);
         free(pTCPLinkObj);
         _IOC_LogError("Failed to send negotiated usage to client");
         return IOC_RESULT_BUG;
     }
 
+    if (IsDatCreditNegotiated) {
+        _IOC_DatCredit_setWindow(&pTCPLinkObj->DatCredit, ntohl(ClientGrant.DatNum), ntohl(ClientGrant.DatBytes));
+        pTCPLinkObj->IsPeerDatPolling = (ntohl(ClientGrant.Flags) & TCP_DAT_CREDIT_FLAG_POLLING) != 0;
+    }
+
     // Set server link's usage to negotiated role
     pLinkObj->Args.Usage = ServiceLinkRole;
 
@@ -991,7 +1856,7 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
         }
 
         // Enable polling mode if no callback is provided
-        if (pTCPLinkObj->DatUsageArgs.CbRecvDat_F == NULL) {
+        if (pTCPLinkObj->DatUsageArgs.CbRecvDat_F == NULL && pTCPLinkObj->DatUsageArgs.CbRecvDatBatch_F == NULL) {
             pthread_mutex_lock(&pTCPLinkObj->Mutex);
             pTCPLinkObj->PollingBuffer.IsPollingMode = true;
             pthread_mutex_unlock(&pTCPLinkObj->Mutex);
@@ -999,12 +1864,27 @@ static IOC_Result_T __IOC_acceptClient_ofProtoTCP(_IOC_ServiceObject_pT pSrvObj,
         }
     }
 
-    // Start background receiver thread (optional for server side, but useful for bidirectional)
-    pTCPLinkObj->RecvThreadRunning = 1;
-    if (pthread_create(&pTCPLinkObj->RecvThread, NULL, __TCP_recvThread, pTCPLinkObj) != 0) {
+    // Receive by the reactor from now on (optional for server side, but useful for bidirectional)
+    pTCPLinkObj->Recv.ReactorFd.Fd = ClientFd;
+    pTCPLinkObj->Recv.ReactorFd.OnReady_F = __IOC_onLinkReady_ofProtoTCP;
+    pTCPLinkObj->Recv.ReactorFd.pPriv = pTCPLinkObj;
+    pTCPLinkObj->Recv.ReactorFd.ShardIdx = ShardIdx;
+
+    // Coalesce sends by the service's args of the negotiated role
+    IOC_CoalesceArgs_pT pCoalesceArgs = (ServiceLinkRole & IOC_LinkUsageEvtProducer) ? &pTCPSrvObj->EvtCoalesce
+                                        : (ServiceLinkRole & IOC_LinkUsageDatSender) ? &pTCPSrvObj->DatCoalesce
+                                                                                     : NULL;
+    if (__IOC_initSend_ofProtoTCP(pTCPLinkObj, pCoalesceArgs) != IOC_RESULT_SUCCESS) {
+        close(ClientFd);
+        free(pTCPLinkObj);
+        return IOC_RESULT_BUG;
+    }
+
+    if (_IOC_Reactor_watchFd(&pTCPLinkObj->Recv.ReactorFd) != IOC_RESULT_SUCCESS) {
+        __IOC_deinitSend_ofProtoTCP(pTCPLinkObj);
         close(ClientFd);
         free(pTCPLinkObj);
-        _IOC_LogError("Failed to create TCP receiver thread for accepted client");
+        _IOC_LogError("Failed to watch TCP link socket of accepted client");
         return IOC_RESULT_BUG;
     }
 
@@ -1019,20 +1899,27 @@ static IOC_Result_T __IOC_closeLink_ofProtoTCP(_IOC_LinkObject_pT pLinkObj) {
     _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
 
     if (pTCPLinkObj) {
-        // Stop receiver thread
-        if (pTCPLinkObj->RecvThreadRunning) {
-            pTCPLinkObj->RecvThreadRunning = 0;
-
-            // Shutdown and close socket to unblock recv()
-            if (pTCPLinkObj->SocketFd >= 0) {
-                shutdown(pTCPLinkObj->SocketFd, SHUT_RDWR);  // Shutdown both directions
-                close(pTCPLinkObj->SocketFd);
-                pTCPLinkObj->SocketFd = -1;
+        // Write messages still coalesced, stop receiving, and wait for the reactor to leave this link,
+        //  then end receiving if it's not broken yet
+        if (pTCPLinkObj->SocketFd >= 0) {
+            __IOC_deinitSend_ofProtoTCP(pTCPLinkObj);
+            shutdown(pTCPLinkObj->SocketFd, SHUT_RDWR);  // Shutdown both directions
+            _IOC_Reactor_unwatchFd(&pTCPLinkObj->Recv.ReactorFd);
+            if (!pTCPLinkObj->Recv.IsDone) {
+                __IOC_endRecv_ofProtoTCP(pTCPLinkObj, IOC_RESULT_LINK_BROKEN);
             }
 
-            // Wait for thread to exit
-            pthread_join(pTCPLinkObj->RecvThread, NULL);
+            close(pTCPLinkObj->SocketFd);
+            pTCPLinkObj->SocketFd = -1;
+        }
+
+        // IOC_flushDAT woken by the end of receiving MAY still hold Mutex, wait them to leave
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        pTCPLinkObj->DatFlush.IsRecvDone = true;
+        while (pTCPLinkObj->DatFlush.WaiterNum > 0) {
+            pthread_cond_wait(&pTCPLinkObj->DatFlush.AckedCond, &pTCPLinkObj->Mutex);
         }
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
 
         // Free subscription data if allocated
         if (pTCPLinkObj->SubEvtArgs.pEvtIDs) {
@@ -1041,10 +1928,13 @@ static IOC_Result_T __IOC_closeLink_ofProtoTCP(_IOC_LinkObject_pT pLinkObj) {
 
         // Cleanup polling buffer
         __IOC_cleanupPollingBuffer_ofProtoTCP(pTCPLinkObj);
+        _IOC_DatCredit_deinitOne(&pTCPLinkObj->DatCredit);
 
         pthread_mutex_destroy(&pTCPLinkObj->Mutex);
+        pthread_mutex_destroy(&pTCPLinkObj->SendMutex);
         pthread_cond_destroy(&pTCPLinkObj->CmdResponseCond);
         pthread_cond_destroy(&pTCPLinkObj->IncomingCmdCond);
+        pthread_cond_destroy(&pTCPLinkObj->DatFlush.AckedCond);
         free(pTCPLinkObj);
         pLinkObj->pProtoPriv = NULL;
     }
@@ -1078,8 +1968,12 @@ static IOC_Result_T __IOC_subEvt_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const I
     TCPMessageHeader_T Header;
     Header.MsgType = htonl(TCP_MSG_SUBSCRIBE);
     Header.DataSize = htonl(0);
+    struct iovec IOV = {.iov_base = &Header, .iov_len = sizeof(Header)};
 
-    return __TCP_sendAll(pTCPLinkObj->SocketFd, &Header, sizeof(Header));
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, &IOV, 1, false);
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    return Result;
 }
 
 /**
@@ -1101,8 +1995,12 @@ static IOC_Result_T __IOC_unsubEvt_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const
         TCPMessageHeader_T Header;
         Header.MsgType = htonl(TCP_MSG_UNSUBSCRIBE);
         Header.DataSize = htonl(0);
+        struct iovec IOV = {.iov_base = &Header, .iov_len = sizeof(Header)};
 
-        return __TCP_sendAll(pTCPLinkObj->SocketFd, &Header, sizeof(Header));
+        pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+        IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, &IOV, 1, false);
+        pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+        return Result;
     }
 
     pthread_mutex_unlock(&pTCPLinkObj->Mutex);
@@ -1125,19 +2023,21 @@ static IOC_Result_T __IOC_postEvt_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const
         return IOC_RESULT_NO_EVENT_CONSUMER;
     }
 
-    // Send event over TCP socket with protocol framing
+    // Send event over TCP socket with protocol framing, its descriptor encoded in a few dozen bytes at most
+    uint8_t Wire[_IOC_TCP_WIRE_EVT_MAX_SIZE];
+    ULONG_T WireSize = _IOC_TCPWire_encodeEvt(pEvtDesc, Wire);
     TCPMessageHeader_T Header;
     Header.MsgType = htonl(TCP_MSG_EVENT);
-    Header.DataSize = htonl(sizeof(IOC_EvtDesc_T));
+    Header.DataSize = htonl(WireSize);
 
-    // Send header
-    IOC_Result_T Result = __TCP_sendAll(pTCPLinkObj->SocketFd, &Header, sizeof(Header));
-    if (Result != IOC_RESULT_SUCCESS) {
-        return Result;
-    }
+    // Send header and event descriptor in one write, not interleaved with other messages of this link,
+    //  or coalesced with later ones if ASYNC, while a SYNC one is written at once
+    struct iovec IOVs[2] = {{.iov_base = &Header, .iov_len = sizeof(Header)}, {.iov_base = Wire, .iov_len = WireSize}};
+    bool IsCoalescable = (IOC_Option_isAsyncMode(pOption) == IOC_RESULT_YES);
 
-    // Send event descriptor
-    Result = __TCP_sendAll(pTCPLinkObj->SocketFd, pEvtDesc, sizeof(IOC_EvtDesc_T));
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, 2, IsCoalescable);
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
     return Result;
 }
 
@@ -1178,36 +2078,11 @@ static IOC_Result_T __IOC_execCmd_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_Cm
     // PRODUCTION: Consider making this conditional on debug/test build if latency critical
     usleep(5000);  // 5ms window for PENDING state observation
 
-    // Send command request
-    TCPMessageHeader_T Header;
-    Header.MsgType = htonl(TCP_MSG_COMMAND);
-    Header.DataSize = htonl(sizeof(IOC_CmdDesc_T));
-
-    Result = __TCP_sendAll(SocketFd, &Header, sizeof(Header));
-    if (Result != IOC_RESULT_SUCCESS) {
-        return Result;
-    }
-
-    Result = __TCP_sendAll(SocketFd, pCmdDesc, sizeof(IOC_CmdDesc_T));
-    if (Result != IOC_RESULT_SUCCESS) {
-        return Result;
-    }
-
-    // Send IN payload data if present (pointer-based only)
-    // Embedded data is already sent within IOC_CmdDesc_T
-    if (pCmdDesc->InPayload.PtrDataLen > 0 && pCmdDesc->InPayload.pData) {
-        TCPMessageHeader_T PayloadHeader;
-        PayloadHeader.MsgType = htonl(TCP_MSG_DATA);
-        PayloadHeader.DataSize = htonl(pCmdDesc->InPayload.PtrDataLen);
-
-        Result = __TCP_sendAll(SocketFd, &PayloadHeader, sizeof(PayloadHeader));
-        if (Result != IOC_RESULT_SUCCESS) return Result;
-
-        Result = __TCP_sendAll(SocketFd, pCmdDesc->InPayload.pData, pCmdDesc->InPayload.PtrDataLen);
-        if (Result != IOC_RESULT_SUCCESS) return Result;
-    }
+    // Send command request, with IN payload data if present (pointer-based only) in the same write
+    Result = __IOC_sendCmd_ofProtoTCP(pTCPLinkObj, pCmdDesc);
+    if (Result != IOC_RESULT_SUCCESS) return Result;
 
-    // Wait for response from receiver thread
+    // Wait for response received by the reactor
     pthread_mutex_lock(&pTCPLinkObj->Mutex);
 
     // Extract round-trip timeout: Priority order - pOption > default network timeout
@@ -1263,7 +2138,7 @@ static IOC_Result_T __IOC_execCmd_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_Cm
         return IOC_RESULT_TIMEOUT;
     }
 
-    // BUG FIX #8 & #9: Check if recv thread encountered an error
+    // BUG FIX #8 & #9: Check if receiver encountered an error
     // If RecvError is set, connection was broken during command execution
     if (pTCPLinkObj->RecvError != IOC_RESULT_SUCCESS) {
         IOC_Result_T Error = pTCPLinkObj->RecvError;
@@ -1286,6 +2161,7 @@ static IOC_Result_T __IOC_execCmd_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_Cm
     if (pOutData && OutDataLen > 0) {
         IOC_CmdDesc_setOutPayload(pCmdDesc, pOutData, OutDataLen);
     }
+    IOC_CmdDesc_cleanup(&pTCPLinkObj->CmdResponse);  // Its OUT payload received, copied above
 
     pthread_mutex_unlock(&pTCPLinkObj->Mutex);
 
@@ -1360,30 +2236,11 @@ static IOC_Result_T __IOC_ackCmd_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_Cmd
         pCmdDesc->Status = (pCmdDesc->Result == IOC_RESULT_SUCCESS) ? IOC_CMD_STATUS_SUCCESS : IOC_CMD_STATUS_FAILED;
     }
 
-    // Send response back (CmdDesc + OUT payload data)
-    TCPMessageHeader_T RespHeader;
-    RespHeader.MsgType = htonl(TCP_MSG_COMMAND);
-    RespHeader.DataSize = htonl(sizeof(IOC_CmdDesc_T));
-
-    IOC_Result_T Result = __TCP_sendAll(pTCPLinkObj->SocketFd, &RespHeader, sizeof(RespHeader));
-    if (Result != IOC_RESULT_SUCCESS) return Result;
-
-    Result = __TCP_sendAll(pTCPLinkObj->SocketFd, pCmdDesc, sizeof(IOC_CmdDesc_T));
+    // Send response back (CmdDesc + OUT payload data, pointer-based only) in one write
+    IOC_Result_T Result = __IOC_sendCmd_ofProtoTCP(pTCPLinkObj, pCmdDesc);
     if (Result != IOC_RESULT_SUCCESS) return Result;
 
-    // Send OUT payload data if present (pointer-based only)
-    void* pOutData = IOC_CmdDesc_getOutData(pCmdDesc);
-    ULONG_T OutDataLen = IOC_CmdDesc_getOutDataLen(pCmdDesc);
-
-    if (pOutData && OutDataLen > 0 && pCmdDesc->OutPayload.PtrDataLen > 0) {
-        TCPMessageHeader_T PayloadHeader;
-        PayloadHeader.MsgType = htonl(TCP_MSG_DATA);
-        PayloadHeader.DataSize = htonl(OutDataLen);
-        __TCP_sendAll(pTCPLinkObj->SocketFd, &PayloadHeader, sizeof(PayloadHeader));
-        __TCP_sendAll(pTCPLinkObj->SocketFd, pOutData, OutDataLen);
-    }
-
-    // Free IN payload if it was allocated by recvThread and passed to us
+    // Free IN payload if it was allocated by receiver and passed to us
     if (pCmdDesc->InPayload.pData) {
         free(pCmdDesc->InPayload.pData);
         pCmdDesc->InPayload.pData = NULL;
@@ -1396,6 +2253,120 @@ static IOC_Result_T __IOC_ackCmd_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_Cmd
 // Data API Implementation (TDD RED→GREEN)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief Send one data chunk of DatVecNum segments as one TCP_MSG_DATA, header and all segments in one sendmsg,
+ *    or coalesced with later ones if the DatSender link coalesces
+ */
+static IOC_Result_T __IOC_sendDataV_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const IOC_DatVec_pT pDatVecs,
+                                               ULONG_T DatVecNum, const IOC_Options_pT pOption) {
+    if (!pLinkObj || !pDatVecs || DatVecNum == 0 || DatVecNum > IOC_DATVEC_MAX_NUM) return IOC_RESULT_INVALID_PARAM;
+
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pTCPLinkObj) return IOC_RESULT_NOT_EXIST_LINK;
+
+    // The receiver sees the peer's FIN/RST first, and a single sendmsg to a closed peer may still succeed
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    IOC_Result_T RecvError = pTCPLinkObj->RecvError;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    if (RecvError == IOC_RESULT_LINK_BROKEN) return IOC_RESULT_LINK_BROKEN;
+
+    TCPMessageHeader_T Header;
+    struct iovec IOVs[1 + IOC_DATVEC_MAX_NUM];
+    int IOVNum = 1;
+    ULONG_T DataSize = 0;
+    for (ULONG_T i = 0; i < DatVecNum; i++) {
+        if (pDatVecs[i].DataLen == 0) continue;
+        IOVs[IOVNum].iov_base = pDatVecs[i].pData;
+        IOVs[IOVNum].iov_len = pDatVecs[i].DataLen;
+        IOVNum++;
+        DataSize += pDatVecs[i].DataLen;
+    }
+    if (DataSize == 0) return IOC_RESULT_ZERO_DATA;
+
+    Header.MsgType = htonl(TCP_MSG_DATA);
+    Header.DataSize = htonl(DataSize);
+    IOVs[0].iov_base = &Header;
+    IOVs[0].iov_len = sizeof(Header);
+
+    // Spend the peer DatReceiver's credits first, so it never has more data than it granted,
+    //  except sends from callbacks in reactor threads, which would wait for credits only these threads return.
+    if (_IOC_Reactor_isInThread()) {
+        _IOC_DatCredit_overdraw(&pTCPLinkObj->DatCredit, DataSize);
+    } else {
+        bool HasTimeout = pOption && (pOption->IDs & IOC_OPTID_TIMEOUT);
+        long long TimeoutUS = -1;
+        if (HasTimeout && pOption->Payload.TimeoutUS != IOC_TIMEOUT_INFINITE) {
+            TimeoutUS = (long long)pOption->Payload.TimeoutUS;  // IOC_TIMEOUT_NONBLOCK gets IOC_RESULT_BUFFER_FULL
+        } else if (!HasTimeout && pTCPLinkObj->IsPeerDatPolling) {
+            TimeoutUS = 0;  // Same as ProtoFifo, IOC_recvDAT MAY never be called
+        }
+        IOC_Result_T Result = _IOC_DatCredit_acquire(&pTCPLinkObj->DatCredit, DataSize, TimeoutUS);
+        if (Result != IOC_RESULT_SUCCESS) return Result;
+    }
+
+    // With IOC_OPTID_DAT_COMPLETION, send TCP_MSG_DATA_TRACKED and keep its completer till the peer's result comes
+    _IOC_DatCompleter_T Completer;
+    IOC_Result_T Result = _IOC_initDatCompleter(pLinkObj, pOption, DataSize, &Completer);
+    _IOC_DatCompleter_pT pCompleter = NULL;
+    if (Result == IOC_RESULT_SUCCESS && _IOC_isDatCompleterArmed(&Completer)) {
+        pCompleter = (_IOC_DatCompleter_pT)malloc(sizeof(_IOC_DatCompleter_T));
+        if (pCompleter) {
+            *pCompleter = Completer;
+            pCompleter->pNext = NULL;
+            Header.MsgType = htonl(TCP_MSG_DATA_TRACKED);
+        } else {
+            _IOC_cancelDatCompleter(&Completer);
+            Result = IOC_RESULT_POSIX_ENOMEM;
+        }
+    }
+    if (Result != IOC_RESULT_SUCCESS) {
+        _IOC_DatCredit_refund(&pTCPLinkObj->DatCredit, DataSize);
+        return Result;
+    }
+
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    if (pCompleter) {
+        // Appended before sending, as the peer's completion MAY come before sendmsg returns
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        if (pTCPLinkObj->DatCompletion.IsRecvDone) {
+            Result = IOC_RESULT_LINK_BROKEN;
+        } else if (pTCPLinkObj->DatCompletion.pTail) {
+            pTCPLinkObj->DatCompletion.pTail->pNext = pCompleter;
+            pTCPLinkObj->DatCompletion.pTail = pCompleter;
+        } else {
+            pTCPLinkObj->DatCompletion.pHead = pTCPLinkObj->DatCompletion.pTail = pCompleter;
+        }
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    }
+    if (Result == IOC_RESULT_SUCCESS) {
+        Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, IOVNum, true);
+    }
+    if (Result != IOC_RESULT_SUCCESS && pCompleter && !pTCPLinkObj->DatCompletion.IsRecvDone) {
+        // Not sent, so never completed by the peer, and it's still the tail as SendMutex is held
+        pthread_mutex_lock(&pTCPLinkObj->Mutex);
+        _IOC_DatCompleter_pT pPrev = NULL;
+        for (_IOC_DatCompleter_pT pIter = pTCPLinkObj->DatCompletion.pHead; pIter != pCompleter; pIter = pIter->pNext) {
+            pPrev = pIter;
+        }
+        if (pPrev) {
+            pPrev->pNext = NULL;
+        } else {
+            pTCPLinkObj->DatCompletion.pHead = NULL;
+        }
+        pTCPLinkObj->DatCompletion.pTail = pPrev;
+        pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    }
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    if (Result != IOC_RESULT_SUCCESS) {
+        if (pCompleter) {
+            _IOC_cancelDatCompleter(pCompleter);
+            free(pCompleter);
+        }
+        _IOC_DatCredit_refund(&pTCPLinkObj->DatCredit, DataSize);
+    }
+    return Result;
+}
+
 static IOC_Result_T __IOC_sendData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const IOC_DatDesc_pT pDatDesc,
                                               const IOC_Options_pT pOption) {
     if (!pLinkObj || !pDatDesc) return IOC_RESULT_INVALID_PARAM;
@@ -1411,18 +2382,73 @@ static IOC_Result_T __IOC_sendData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const
 
     if (!pData || DataSize == 0) return IOC_RESULT_INVALID_PARAM;
 
-    // Send data over TCP: Header + Payload
-    TCPMessageHeader_T Header;
-    Header.MsgType = htonl(TCP_MSG_DATA);
-    Header.DataSize = htonl(DataSize);
+    // A loaned IOC_allocDAT buffer is sent as is, with its header in the same sendmsg
+    IOC_DatVec_T DatVec = {.pData = pData, .DataLen = DataSize};
+    return __IOC_sendDataV_ofProtoTCP(pLinkObj, &DatVec, 1, pOption);
+}
 
-    Result = __TCP_sendAll(pTCPLinkObj->SocketFd, &Header, sizeof(Header));
-    if (Result != IOC_RESULT_SUCCESS) return Result;
+/**
+ * @brief Send TCP_MSG_DAT_FLUSH of the next sequence number after the data sent before it,
+ *    then wait for the peer's TCP_MSG_DAT_FLUSH_ACK of it, which means all of them are delivered
+ *    to the peer's receiver callback or polling buffer.
+ *    Flushing from a receiver callback only writes coalesced data without waiting, as only reactor threads
+ *    handle acks.
+ */
+static IOC_Result_T __IOC_flushData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption) {
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pTCPLinkObj) return IOC_RESULT_NOT_EXIST_LINK;
+    if (_IOC_Reactor_isInThread()) {
+        pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+        IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, NULL, 0, false);  // Only the coalesced data
+        pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+        return Result;
+    }
 
-    Result = __TCP_sendAll(pTCPLinkObj->SocketFd, pData, DataSize);
-    if (Result != IOC_RESULT_SUCCESS) return Result;
+    TCPMessageHeader_T Header = {.MsgType = htonl(TCP_MSG_DAT_FLUSH), .DataSize = htonl(sizeof(TCPDatFlush_T))};
+    TCPDatFlush_T Flush;
+    struct iovec IOVs[2] = {{.iov_base = &Header, .iov_len = sizeof(Header)},
+                            {.iov_base = &Flush, .iov_len = sizeof(Flush)}};
 
-    return IOC_RESULT_SUCCESS;
+    pthread_mutex_lock(&pTCPLinkObj->SendMutex);
+    uint32_t FlushSeq = ++pTCPLinkObj->DatFlush.SentSeq;
+    Flush.FlushSeq = htonl(FlushSeq);
+    IOC_Result_T Result = __IOC_sendMsg_ofProtoTCP(pTCPLinkObj, IOVs, 2, false);  // Along with coalesced data
+    pthread_mutex_unlock(&pTCPLinkObj->SendMutex);
+    if (Result != IOC_RESULT_SUCCESS) return IOC_RESULT_LINK_BROKEN;
+
+    ULONG_T TimeoutUS = IOC_Option_getTimeoutUS(pOption);
+    struct timespec AbsTimeout;
+    if (TimeoutUS != IOC_TIMEOUT_INFINITE) {
+        clock_gettime(CLOCK_REALTIME, &AbsTimeout);
+        AbsTimeout.tv_sec += TimeoutUS / 1000000;
+        AbsTimeout.tv_nsec += (TimeoutUS % 1000000) * 1000;
+        if (AbsTimeout.tv_nsec >= 1000000000) {
+            AbsTimeout.tv_sec += 1;
+            AbsTimeout.tv_nsec -= 1000000000;
+        }
+    }
+
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    pTCPLinkObj->DatFlush.WaiterNum++;
+    // Sequence numbers wrap, so compare their distance, later flushes ack the earlier ones too
+    while ((int32_t)(pTCPLinkObj->DatFlush.AckedSeq - FlushSeq) < 0 && !pTCPLinkObj->DatFlush.IsRecvDone) {
+        if (TimeoutUS == IOC_TIMEOUT_INFINITE) {
+            pthread_cond_wait(&pTCPLinkObj->DatFlush.AckedCond, &pTCPLinkObj->Mutex);
+        } else if (TimeoutUS == IOC_TIMEOUT_NONBLOCK ||
+                   ETIMEDOUT == pthread_cond_timedwait(&pTCPLinkObj->DatFlush.AckedCond, &pTCPLinkObj->Mutex,
+                                                       &AbsTimeout)) {
+            break;
+        }
+    }
+    if ((int32_t)(pTCPLinkObj->DatFlush.AckedSeq - FlushSeq) < 0) {
+        Result = pTCPLinkObj->DatFlush.IsRecvDone ? IOC_RESULT_LINK_BROKEN : IOC_RESULT_TIMEOUT;
+    }
+    pTCPLinkObj->DatFlush.WaiterNum--;
+    if (pTCPLinkObj->DatFlush.IsRecvDone && 0 == pTCPLinkObj->DatFlush.WaiterNum) {
+        pthread_cond_broadcast(&pTCPLinkObj->DatFlush.AckedCond);  // closeLink MAY wait for us
+    }
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+    return Result;
 }
 
 static IOC_Result_T __IOC_recvData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_DatDesc_pT pDatDesc,
@@ -1432,7 +2458,7 @@ static IOC_Result_T __IOC_recvData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_D
     _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
     if (!pTCPLinkObj) return IOC_RESULT_NOT_EXIST_LINK;
 
-    // Check if receiver thread encountered an error (link broken, etc.)
+    // Check if receiver encountered an error (link broken, etc.)
     pthread_mutex_lock(&pTCPLinkObj->Mutex);
     IOC_Result_T RecvError = pTCPLinkObj->RecvError;
     bool IsPollingMode = pTCPLinkObj->PollingBuffer.IsPollingMode;
@@ -1463,6 +2489,7 @@ static IOC_Result_T __IOC_recvData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_D
         // Update the data descriptor with actual bytes read
         pDatDesc->Payload.PtrDataSize = BytesRead;
         pDatDesc->Payload.PtrDataLen = BytesRead;
+        __IOC_returnPolledDatCredit_ofProtoTCP(pTCPLinkObj);
 
         _IOC_LogDebug("IOC_recvDAT: Received %zu bytes from TCP polling buffer on LinkID=%llu", BytesRead,
                       pLinkObj->ID);
@@ -1474,6 +2501,63 @@ static IOC_Result_T __IOC_recvData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_D
     return Result;
 }
 
+/**
+ * @brief Get the polling buffer of a DatReceiver link in polling mode, and TimeoutUS of pOption(-1 means forever)
+ */
+static IOC_Result_T __IOC_getPollingRing_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, const IOC_Options_pT pOption,
+                                                    _IOC_DatRing_pT* ppRing, long long* pTimeoutUS) {
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pTCPLinkObj) return IOC_RESULT_NOT_EXIST_LINK;
+
+    pthread_mutex_lock(&pTCPLinkObj->Mutex);
+    IOC_Result_T RecvError = pTCPLinkObj->RecvError;
+    bool IsPollingMode = pTCPLinkObj->PollingBuffer.IsPollingMode;
+    pthread_mutex_unlock(&pTCPLinkObj->Mutex);
+
+    if (RecvError != IOC_RESULT_SUCCESS) return RecvError;
+    if (!IsPollingMode) return IOC_RESULT_NOT_SUPPORT;
+
+    *ppRing = &pTCPLinkObj->PollingBuffer.Ring;
+    *pTimeoutUS = (pOption && (pOption->IDs & IOC_OPTID_TIMEOUT)) ? (long long)pOption->Payload.TimeoutUS : -1;
+    return IOC_RESULT_SUCCESS;
+}
+
+static IOC_Result_T __IOC_recvDataV_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                               ULONG_T* pRecvDatNum, const IOC_Options_pT pOption) {
+    _IOC_DatRing_pT pRing = NULL;
+    long long TimeoutUS = -1;
+    IOC_Result_T Result = __IOC_getPollingRing_ofProtoTCP(pLinkObj, pOption, &pRing, &TimeoutUS);
+    if (Result != IOC_RESULT_SUCCESS) return Result;
+
+    // Chunks are framed by TCPMessageHeader_T and kept as records in the ring, so they're whole here
+    Result = _IOC_DatRing_readv(pRing, pDatVecs, DatVecNum, pRecvDatNum, TimeoutUS);
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_returnPolledDatCredit_ofProtoTCP((_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv);
+    }
+    return Result;
+}
+
+static IOC_Result_T __IOC_peekDataV_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, IOC_DatVec_pT pDatVecs, ULONG_T DatVecNum,
+                                               ULONG_T* pPeekDatNum, const IOC_Options_pT pOption) {
+    _IOC_DatRing_pT pRing = NULL;
+    long long TimeoutUS = -1;
+    IOC_Result_T Result = __IOC_getPollingRing_ofProtoTCP(pLinkObj, pOption, &pRing, &TimeoutUS);
+    if (Result != IOC_RESULT_SUCCESS) return Result;
+
+    return _IOC_DatRing_peekv(pRing, pDatVecs, DatVecNum, pPeekDatNum, TimeoutUS);
+}
+
+static IOC_Result_T __IOC_consumeData_ofProtoTCP(_IOC_LinkObject_pT pLinkObj, ULONG_T ConsumeDatNum) {
+    _IOC_ProtoTCPLinkObject_pT pTCPLinkObj = (_IOC_ProtoTCPLinkObject_pT)pLinkObj->pProtoPriv;
+    if (!pTCPLinkObj) return IOC_RESULT_NOT_EXIST_LINK;
+
+    IOC_Result_T Result = _IOC_DatRing_consume(&pTCPLinkObj->PollingBuffer.Ring, ConsumeDatNum);
+    if (Result == IOC_RESULT_SUCCESS) {
+        __IOC_returnPolledDatCredit_ofProtoTCP(pTCPLinkObj);
+    }
+    return Result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // TCP Protocol Method Table
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1498,4 +2582,9 @@ _IOC_SrvProtoMethods_T _gIOC_SrvProtoTCPMethods = {
 
     .OpSendData_F = __IOC_sendData_ofProtoTCP,  // 🔴 RED: Minimal stub (returns NOT_IMPLEMENTED)
     .OpRecvData_F = __IOC_recvData_ofProtoTCP,  // 🔴 RED: Minimal stub (returns NOT_IMPLEMENTED)
+    .OpSendDataV_F = __IOC_sendDataV_ofProtoTCP,
+    .OpRecvDataV_F = __IOC_recvDataV_ofProtoTCP,
+    .OpPeekDataV_F = __IOC_peekDataV_ofProtoTCP,
+    .OpConsumeData_F = __IOC_consumeData_ofProtoTCP,
+    .OpFlushData_F = __IOC_flushData_ofProtoTCP,
 };
@@ -0,0 +1,238 @@
+#include "_IOC_TCPWire.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Each field of a descriptor is encoded by its kind:
+ *    UINT of an unsigned integer as a varint, SINT of a signed integer or enum as a zigzag'ed varint,
+ *    and EMD of an IOC_CmdPayload_T as its EmdDataSize varint, then that many bytes of EmdData.
+ */
+typedef enum {
+    _IOC_TCP_WIRE_FIELD_UINT = 1,
+    _IOC_TCP_WIRE_FIELD_SINT = 2,
+    _IOC_TCP_WIRE_FIELD_EMD = 3,
+} _IOC_TCPWireFieldKind_T;
+
+typedef struct {
+    uint8_t Kind;
+    uint8_t Size;  // Of an integer field, in 1/2/4/8 bytes
+    uint16_t Offset;
+} _IOC_TCPWireField_T;
+
+#define _IOC_TCP_WIRE_FIELD(Kind, Type, Member) \
+    {_IOC_TCP_WIRE_FIELD_##Kind, sizeof(((Type *)0)->Member), offsetof(Type, Member)}
+
+static const _IOC_TCPWireField_T __IOC_EvtFields_ofTCPWire[] = {
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_EvtDesc_T, MsgDesc.SeqID),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_EvtDesc_T, MsgDesc.TimeStamp.tv_sec),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_EvtDesc_T, MsgDesc.TimeStamp.tv_nsec),
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_EvtDesc_T, EvtID),
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_EvtDesc_T, EvtValue),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_EvtDesc_T, Priority),
+};
+
+static const _IOC_TCPWireField_T __IOC_CmdFields_ofTCPWire[] = {
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_CmdDesc_T, MsgDesc.SeqID),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_CmdDesc_T, MsgDesc.TimeStamp.tv_sec),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_CmdDesc_T, MsgDesc.TimeStamp.tv_nsec),
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_CmdDesc_T, CmdID),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_CmdDesc_T, Status),
+    _IOC_TCP_WIRE_FIELD(SINT, IOC_CmdDesc_T, Result),
+    _IOC_TCP_WIRE_FIELD(EMD, IOC_CmdDesc_T, InPayload),
+    _IOC_TCP_WIRE_FIELD(EMD, IOC_CmdDesc_T, OutPayload),
+    _IOC_TCP_WIRE_FIELD(UINT, IOC_CmdDesc_T, TimeoutMs),
+};
+
+#define _IOC_TCP_WIRE_FIELD_NUM(Fields) (sizeof(Fields) / sizeof((Fields)[0]))
+
+// Load an integer field of Size, sign-extended if IsSigned, then its bits as uint64_t.
+static uint64_t __IOC_loadInt_ofTCPWire(const uint8_t *pField, uint8_t Size, bool IsSigned) {
+    switch (Size) {
+        case 1: {
+            uint8_t Val;
+            memcpy(&Val, pField, sizeof(Val));
+            return IsSigned ? (uint64_t)(int64_t)(int8_t)Val : Val;
+        }
+        case 2: {
+            uint16_t Val;
+            memcpy(&Val, pField, sizeof(Val));
+            return IsSigned ? (uint64_t)(int64_t)(int16_t)Val : Val;
+        }
+        case 4: {
+            uint32_t Val;
+            memcpy(&Val, pField, sizeof(Val));
+            return IsSigned ? (uint64_t)(int64_t)(int32_t)Val : Val;
+        }
+        default: {
+            uint64_t Val;
+            memcpy(&Val, pField, sizeof(Val));
+            return Val;
+        }
+    }
+}
+
+// Store Val into an integer field of Size, return false if it doesn't fit.
+static bool __IOC_storeInt_ofTCPWire(uint8_t *pField, uint8_t Size, bool IsSigned, uint64_t Val) {
+    switch (Size) {
+        case 1: {
+            uint8_t Stored = (uint8_t)Val;
+            memcpy(pField, &Stored, sizeof(Stored));
+            break;
+        }
+        case 2: {
+            uint16_t Stored = (uint16_t)Val;
+            memcpy(pField, &Stored, sizeof(Stored));
+            break;
+        }
+        case 4: {
+            uint32_t Stored = (uint32_t)Val;
+            memcpy(pField, &Stored, sizeof(Stored));
+            break;
+        }
+        default:
+            memcpy(pField, &Val, sizeof(Val));
+            break;
+    }
+    return __IOC_loadInt_ofTCPWire(pField, Size, IsSigned) == Val;
+}
+
+static ULONG_T __IOC_putVarint_ofTCPWire(uint8_t *pWire, uint64_t Val) {
+    ULONG_T Pos = 0;
+    while (Val >= 0x80) {
+        pWire[Pos++] = (uint8_t)(Val | 0x80);
+        Val >>= 7;
+    }
+    pWire[Pos++] = (uint8_t)Val;
+    return Pos;
+}
+
+// Get a varint at *pPos of pWire, return false if truncated or overflowing 64 bits.
+static bool __IOC_getVarint_ofTCPWire(const uint8_t *pWire, ULONG_T WireSize, ULONG_T *pPos, uint64_t *pVal) {
+    uint64_t Val = 0;
+    for (ULONG_T Shift = 0; Shift < 64; Shift += 7) {
+        if (*pPos >= WireSize) {
+            return false;
+        }
+
+        uint8_t Byte = pWire[(*pPos)++];
+        if (Shift == 63 && Byte > 1) {
+            return false;
+        }
+
+        Val |= (uint64_t)(Byte & 0x7F) << Shift;
+        if (!(Byte & 0x80)) {
+            *pVal = Val;
+            return true;
+        }
+    }
+    return false;
+}
+
+static ULONG_T __IOC_encode_ofTCPWire(const _IOC_TCPWireField_T *pFields, ULONG_T FieldNum, const void *pDesc,
+                                      uint8_t *pWire) {
+    const uint8_t *pDescBytes = (const uint8_t *)pDesc;
+    ULONG_T Pos = 0;
+
+    pWire[Pos++] = _IOC_TCP_WIRE_VERSION;
+    for (ULONG_T FieldIdx = 0; FieldIdx < FieldNum; FieldIdx++) {
+        const _IOC_TCPWireField_T *pField = &pFields[FieldIdx];
+        const uint8_t *pMember = pDescBytes + pField->Offset;
+
+        if (pField->Kind == _IOC_TCP_WIRE_FIELD_EMD) {
+            const IOC_CmdPayload_T *pPayload = (const IOC_CmdPayload_T *)pMember;
+            ULONG_T EmdDataSize = pPayload->EmdDataSize;
+            if (EmdDataSize > sizeof(pPayload->EmdData)) {
+                EmdDataSize = sizeof(pPayload->EmdData);  // Never over EmdData, as IOC_CmdDesc_setInPayload does
+            }
+            Pos += __IOC_putVarint_ofTCPWire(&pWire[Pos], EmdDataSize);
+            memcpy(&pWire[Pos], pPayload->EmdData, EmdDataSize);
+            Pos += EmdDataSize;
+        } else {
+            bool IsSigned = (pField->Kind == _IOC_TCP_WIRE_FIELD_SINT);
+            uint64_t Val = __IOC_loadInt_ofTCPWire(pMember, pField->Size, IsSigned);
+            if (IsSigned) {
+                Val = (Val << 1) ^ (uint64_t)((int64_t)Val >> 63);  // Zigzag
+            }
+            Pos += __IOC_putVarint_ofTCPWire(&pWire[Pos], Val);
+        }
+    }
+    return Pos;
+}
+
+static IOC_Result_T __IOC_decode_ofTCPWire(const _IOC_TCPWireField_T *pFields, ULONG_T FieldNum,
+                                           const uint8_t *pWire, ULONG_T WireSize, void *pDesc, ULONG_T *pDescSize) {
+    uint8_t *pDescBytes = (uint8_t *)pDesc;
+    ULONG_T Pos = 0;
+
+    if (WireSize < 1) {
+        return IOC_RESULT_INVALID_PARAM;
+    }
+    if (pWire[Pos++] != _IOC_TCP_WIRE_VERSION) {
+        return IOC_RESULT_NOT_SUPPORT;
+    }
+
+    for (ULONG_T FieldIdx = 0; FieldIdx < FieldNum; FieldIdx++) {
+        const _IOC_TCPWireField_T *pField = &pFields[FieldIdx];
+        uint8_t *pMember = pDescBytes + pField->Offset;
+        uint64_t Val = 0;
+
+        if (!__IOC_getVarint_ofTCPWire(pWire, WireSize, &Pos, &Val)) {
+            return IOC_RESULT_INVALID_PARAM;
+        }
+
+        if (pField->Kind == _IOC_TCP_WIRE_FIELD_EMD) {
+            IOC_CmdPayload_T *pPayload = (IOC_CmdPayload_T *)pMember;
+            if (Val > sizeof(pPayload->EmdData) || Val > WireSize - Pos) {
+                return IOC_RESULT_INVALID_PARAM;
+            }
+            memcpy(pPayload->EmdData, &pWire[Pos], Val);
+            pPayload->EmdDataSize = (ULONG_T)Val;
+            Pos += Val;
+        } else {
+            bool IsSigned = (pField->Kind == _IOC_TCP_WIRE_FIELD_SINT);
+            if (IsSigned) {
+                Val = (Val >> 1) ^ (0 - (Val & 1));  // Unzigzag
+            }
+            if (!__IOC_storeInt_ofTCPWire(pMember, pField->Size, IsSigned, Val)) {
+                return IOC_RESULT_INVALID_PARAM;
+            }
+        }
+    }
+
+    if (pDescSize) {
+        *pDescSize = Pos;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+ULONG_T _IOC_TCPWire_encodeEvt(const IOC_EvtDesc_T *pEvtDesc, uint8_t *pWire) {
+    return __IOC_encode_ofTCPWire(__IOC_EvtFields_ofTCPWire, _IOC_TCP_WIRE_FIELD_NUM(__IOC_EvtFields_ofTCPWire),
+                                  pEvtDesc, pWire);
+}
+
+IOC_Result_T _IOC_TCPWire_decodeEvt(const uint8_t *pWire, ULONG_T WireSize, IOC_EvtDesc_pT pEvtDesc) {
+    ULONG_T DescSize = 0;
+    memset(pEvtDesc, 0, sizeof(*pEvtDesc));
+
+    IOC_Result_T Result = __IOC_decode_ofTCPWire(__IOC_EvtFields_ofTCPWire,
+                                                 _IOC_TCP_WIRE_FIELD_NUM(__IOC_EvtFields_ofTCPWire), pWire, WireSize,
+                                                 pEvtDesc, &DescSize);
+    if (Result == IOC_RESULT_SUCCESS && DescSize != WireSize) {
+        Result = IOC_RESULT_INVALID_PARAM;  // An event has nothing after its descriptor
+    }
+    return Result;
+}
+
+ULONG_T _IOC_TCPWire_encodeCmd(const IOC_CmdDesc_T *pCmdDesc, uint8_t *pWire) {
+    return __IOC_encode_ofTCPWire(__IOC_CmdFields_ofTCPWire, _IOC_TCP_WIRE_FIELD_NUM(__IOC_CmdFields_ofTCPWire),
+                                  pCmdDesc, pWire);
+}
+
+IOC_Result_T _IOC_TCPWire_decodeCmd(const uint8_t *pWire, ULONG_T WireSize, IOC_CmdDesc_pT pCmdDesc,
+                                    ULONG_T *pDescSize) {
+    memset(pCmdDesc, 0, sizeof(*pCmdDesc));
+    return __IOC_decode_ofTCPWire(__IOC_CmdFields_ofTCPWire, _IOC_TCP_WIRE_FIELD_NUM(__IOC_CmdFields_ofTCPWire),
+                                  pWire, WireSize, pCmdDesc, pDescSize);
+}
@@ -0,0 +1,51 @@
+#include <stdint.h>
+
+#include "_IOC_Types.h"
+
+#ifndef __IOC_TCPWIRE_H__
+#define __IOC_TCPWIRE_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief TCPWire is the compact, versioned encoding of IOC_EvtDesc_T and IOC_CmdDesc_T in TCP messages,
+ *    instead of their raw memory, which has pointers, padding and unused EmdData, and differs between ABIs.
+ *    Each encoded descriptor starts with its format version byte, then its fields in a fixed order:
+ *      integers as varints(LEB128), signed ones zigzag'ed first, so small values take one byte,
+ *      and each IOC_CmdPayload_T by its EmdDataSize then only that many bytes of EmdData.
+ *    Pointers are never encoded, a command's pointer payload follows its descriptor in the same message.
+ *
+ *  Fields of each descriptor are listed in a table of their offset, size and kind, which one encoder
+ *    and one decoder walk for every descriptor type, so a new field is a new line of its table.
+ *  A decoder rejects a version it doesn't know, or a truncated or overflowing descriptor,
+ *    so a peer of another version or a corrupted message is never misread.
+ */
+#define _IOC_TCP_WIRE_VERSION 1
+#define _IOC_TCP_WIRE_VARINT_MAX_SIZE 10  // Of a 64-bit integer
+
+// Most bytes of an encoded IOC_EvtDesc_T: version, then SeqID, TimeStamp, EvtID, EvtValue and Priority
+#define _IOC_TCP_WIRE_EVT_MAX_SIZE (1 + 6 * _IOC_TCP_WIRE_VARINT_MAX_SIZE)
+// Most bytes of an encoded IOC_CmdDesc_T: version, 7 integers, then InPayload and OutPayload's EmdData
+#define _IOC_TCP_WIRE_EMD_MAX_SIZE (_IOC_TCP_WIRE_VARINT_MAX_SIZE + sizeof(((IOC_CmdPayload_T *)0)->EmdData))
+#define _IOC_TCP_WIRE_CMD_MAX_SIZE (1 + 7 * _IOC_TCP_WIRE_VARINT_MAX_SIZE + 2 * _IOC_TCP_WIRE_EMD_MAX_SIZE)
+
+// Encode pEvtDesc into pWire of at least _IOC_TCP_WIRE_EVT_MAX_SIZE, return its encoded size.
+ULONG_T _IOC_TCPWire_encodeEvt(const IOC_EvtDesc_T *pEvtDesc, uint8_t *pWire);
+// Decode pWire of WireSize into pEvtDesc.
+//  Return IOC_RESULT_SUCCESS, IOC_RESULT_NOT_SUPPORT of an unknown version, or IOC_RESULT_INVALID_PARAM if malformed.
+IOC_Result_T _IOC_TCPWire_decodeEvt(const uint8_t *pWire, ULONG_T WireSize, IOC_EvtDesc_pT pEvtDesc);
+
+// Encode pCmdDesc without its pointer payloads into pWire of at least _IOC_TCP_WIRE_CMD_MAX_SIZE,
+//  return its encoded size.
+ULONG_T _IOC_TCPWire_encodeCmd(const IOC_CmdDesc_T *pCmdDesc, uint8_t *pWire);
+// Decode the descriptor at the head of pWire of WireSize into pCmdDesc, whose pointers are all NULL,
+//  and return its encoded size in *pDescSize, the rest of WireSize is its pointer payload if any.
+//  Return same as _IOC_TCPWire_decodeEvt.
+IOC_Result_T _IOC_TCPWire_decodeCmd(const uint8_t *pWire, ULONG_T WireSize, IOC_CmdDesc_pT pCmdDesc,
+                                    ULONG_T *pDescSize);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __IOC_TCPWIRE_H__
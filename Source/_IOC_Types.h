@@ -18,6 +18,12 @@ typedef _IOC_SrvProtoMethods_T *_IOC_SrvProtoMethods_pT;
 typedef struct _IOC_LinkObjectStru _IOC_LinkObject_T;
 typedef _IOC_LinkObject_T *_IOC_LinkObject_pT;
 
+typedef struct _IOC_DatSlabPoolStru _IOC_DatSlabPool_T;
+typedef _IOC_DatSlabPool_T *_IOC_DatSlabPool_pT;
+
+typedef struct _IOC_DatCompletionQueueStru _IOC_DatCompletionQueue_T;
+typedef _IOC_DatCompletionQueue_T *_IOC_DatCompletionQueue_pT;
+
 typedef struct {
     IOC_SrvID_T ID;
     IOC_SrvArgs_T Args;
@@ -103,6 +109,14 @@ struct _IOC_LinkObjectStru {
         time_t LastOperationTime;
     } CmdState;
 
+    // Slabs of IOC_allocDAT, and of received data if the protocol receives into its own memory (TCP).
+    // Created on first use, RefMore: _IOC_allocDatSlab/_IOC_putDatSlabPool
+    _IOC_DatSlabPool_pT pDatSlabPool;
+
+    // Completions of sends with IOC_OPTID_DAT_COMPLETION for IOC_pollDatCompletions.
+    // Created on first use, RefMore: _IOC_initDatCompleter/_IOC_putDatCompletionQueue
+    _IOC_DatCompletionQueue_pT pDatCompletionQueue;
+
     void *pProtoPriv;
 };
 
@@ -135,6 +149,15 @@ struct _IOC_SrvProtoMethodsStru {
     // method naming pattern where operations are prefixed with "Op" and suffixed with "_F".
     IOC_Result_T (*OpSendData_F)(_IOC_LinkObject_pT, const IOC_DatDesc_pT, const IOC_Options_pT);
     IOC_Result_T (*OpRecvData_F)(_IOC_LinkObject_pT, IOC_DatDesc_pT, const IOC_Options_pT);
+    // OPTIONAL: IOC_sendDATv gathers segments into one slab then OpSendData_F it, if a protocol can't do better
+    IOC_Result_T (*OpSendDataV_F)(_IOC_LinkObject_pT, const IOC_DatVec_pT, ULONG_T, const IOC_Options_pT);
+    IOC_Result_T (*OpGetDatDispatchStats_F)(_IOC_LinkObject_pT, IOC_DatDispatchStats_pT);  // OPTIONAL
+    // OPTIONAL: vectored polling of IOC_recvDATv, IOC_peekDATv and IOC_consumeDAT
+    IOC_Result_T (*OpRecvDataV_F)(_IOC_LinkObject_pT, IOC_DatVec_pT, ULONG_T, ULONG_T *, const IOC_Options_pT);
+    IOC_Result_T (*OpPeekDataV_F)(_IOC_LinkObject_pT, IOC_DatVec_pT, ULONG_T, ULONG_T *, const IOC_Options_pT);
+    IOC_Result_T (*OpConsumeData_F)(_IOC_LinkObject_pT, ULONG_T);
+    // OPTIONAL: IOC_flushDAT waits until the data sent before it is delivered, protocols without it deliver at once
+    IOC_Result_T (*OpFlushData_F)(_IOC_LinkObject_pT, const IOC_Options_pT);
 
     // 🚀 WHY ADD CMD METHODS: Completing the protocol layer abstraction for command operations.
     // Following the architecture pattern where high-level APIs (IOC_execCMD, IOC_waitCMD, IOC_ackCMD)
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include "_UT_IOC_Common.h"
 //===>RefMore: TEMPLATE OF UT CASE in UT_FreelyDrafts.cxx
 //===>RefMore: ConsoleEventTypical UT_ConlesEventTypical.cxx
@@ -8,6 +12,7 @@
 /**
  * @brief Summary of UT_ConlesEventASync
  * 1) verifyEachPostEvtCall_LT1ms_bySingleEvtProducerPostSleep9ms99msEvtEvery10ms
+ * 2) verifyPostToCbProcEvtLatency_byIdleLinkPostOneEvtEvery5ms_expectP50LT2msP99LT5ms
  */
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,3 +202,98 @@ TEST(UT_ConlesEventASync, verifyEachPostEvtCall_LT1ms_bySingleEvtProducerPostSle
   Result = IOC_unsubEVT_inConlesMode(&ObjC_UnsubEvtArgs);
   ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
 }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @[Name]: verifyPostToCbProcEvtLatency_byIdleLinkPostOneEvtEvery5ms_expectP50LT2msP99LT5ms
+ * @[Purpose]: verify EvtProcThread is wakeup by event instead of polling timeout,
+ *    so the first EvtDesc posted to an idle link is callbacked within microseconds, not after next poll.
+ * @[Steps]:
+ *   1) ObjB as EvtConsumer subEVT(TEST_KEEPALIVE), CbProcEvt records the callbacked time.
+ *   2) ObjA as EvtProducer postEVT(TEST_KEEPALIVE) in ASync mode, then wait ObjB's CbProcEvt,
+ *       then sleep 5ms to make the link idle again, repeat 200 times.
+ *   3) Calculate post-to-callback latency's p50/p99 and report them.
+ * @[Expect]:
+ *    a) ObjB's CbProcEvt is called 200 times, each within 1s.
+ *    b) p50 < 2ms and p99 < 5ms, while polling by 10ms timeout would make p50 about 5ms and p99 about 10ms.
+ * @[Notes]:
+ *    Latency is expected to be tens of microseconds, the bounds are loose to tolerate scheduler jitter
+ *    on busy CI hosts, but still catch a regression to polling or a lost wakeup.
+ */
+
+typedef struct {
+  std::atomic<uint32_t> KeepAliveEvtCnt;
+  std::atomic<uint64_t> LastCbProcEvtNS;
+} _Case02_PrivData_T;
+
+static uint64_t _Case02_getNowNS(void) {
+  struct timespec TS_Now = IOC_getCurrentTimeSpec();
+  return (uint64_t)TS_Now.tv_sec * 1000000000 + (uint64_t)TS_Now.tv_nsec;
+}
+
+static IOC_Result_T _Case02_CbProcEvt_recordCbProcTime(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+  _Case02_PrivData_T *pCbPrivData = (_Case02_PrivData_T *)pCbPriv;
+
+  pCbPrivData->LastCbProcEvtNS.store(_Case02_getNowNS());
+  pCbPrivData->KeepAliveEvtCnt.fetch_add(1);
+  return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventASync, verifyPostToCbProcEvtLatency_byIdleLinkPostOneEvtEvery5ms_expectP50LT2msP99LT5ms) {
+  //===SETUP===
+  _Case02_PrivData_T ObjB_CbPrivData;
+  ObjB_CbPrivData.KeepAliveEvtCnt = 0;
+  ObjB_CbPrivData.LastCbProcEvtNS = 0;
+
+  IOC_EvtID_T ObjB_SubEvtIDs[] = {
+      IOC_EVTID_TEST_KEEPALIVE,
+  };
+  IOC_SubEvtArgs_T ObjB_SubEvtArgs = {
+      .CbProcEvt_F = _Case02_CbProcEvt_recordCbProcTime,
+      .pCbPrivData = &ObjB_CbPrivData,
+      .EvtNum      = IOC_calcArrayElmtCnt(ObjB_SubEvtIDs),
+      .pEvtIDs     = ObjB_SubEvtIDs,
+  };
+  IOC_Result_T Result = IOC_subEVT_inConlesMode(&ObjB_SubEvtArgs);
+  ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+  //===BEHAVIOR===
+  const uint32_t _Case02_PostTimes = 200;
+  std::vector<uint64_t> LatencyNSs;
+
+  for (uint32_t i = 0; i < _Case02_PostTimes; i++) {
+    usleep(5000);  // make the link idle
+
+    IOC_EvtDesc_T ObjA_EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE};
+    uint64_t PostNS            = _Case02_getNowNS();
+    Result                     = IOC_postEVT_inConlesMode(&ObjA_EvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    // wait at most 1s for this EvtDesc to be callbacked, the waiting way doesn't affect the latency
+    for (uint32_t WaitUS = 0; ObjB_CbPrivData.KeepAliveEvtCnt.load() <= i && WaitUS < 1000000; WaitUS += 50) {
+      usleep(50);
+    }
+    ASSERT_EQ(i + 1, ObjB_CbPrivData.KeepAliveEvtCnt.load());  // CheckPoint
+
+    LatencyNSs.push_back(ObjB_CbPrivData.LastCbProcEvtNS.load() - PostNS);
+  }
+
+  //===VERIFY===
+  std::sort(LatencyNSs.begin(), LatencyNSs.end());
+  uint64_t P50LatencyUS = LatencyNSs[LatencyNSs.size() * 50 / 100] / 1000;
+  uint64_t P99LatencyUS = LatencyNSs[LatencyNSs.size() * 99 / 100] / 1000;
+  printf("[ConlesEventASync] IdleLink Post->CbProcEvt latency: p50=%luus, p99=%luus, max=%luus\n",
+         (unsigned long)P50LatencyUS, (unsigned long)P99LatencyUS, (unsigned long)(LatencyNSs.back() / 1000));
+
+  ASSERT_EQ(_Case02_PostTimes, ObjB_CbPrivData.KeepAliveEvtCnt.load());  // KeyVerifyPoint
+  ASSERT_LT(P50LatencyUS, 2000) << "P50LatencyUS=" << P50LatencyUS;      // KeyVerifyPoint
+  ASSERT_LT(P99LatencyUS, 5000) << "P99LatencyUS=" << P99LatencyUS;      // KeyVerifyPoint
+
+  //===CLEANUP===
+  IOC_UnsubEvtArgs_T ObjB_UnsubEvtArgs = {
+      .CbProcEvt_F = _Case02_CbProcEvt_recordCbProcTime,
+      .pCbPriv     = &ObjB_CbPrivData,
+  };
+  Result = IOC_unsubEVT_inConlesMode(&ObjB_UnsubEvtArgs);
+  ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+}
@@ -55,3 +55,53 @@ TEST(UT_ConlesEventCapability, Case01_verifyTooManyEvtConsumer_bySubEvtOneMoreTh
         ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
     }
 }
+
+/**
+ * @[Name]: verifyAutoLinkNum_byAutoLinkIdNBeyondAutoLinkNum_expectInvalidAutoLinkID
+ * @[Purpose]: verify how many AutoLinkIDs are valid is only decided by IOC and reported by IOC_getCapability,
+ *    so IOC_CONLES_MODE_AUTO_LINK_ID_N(N) is validated by IOC at runtime, not by the user's build.
+ * @[Steps]:
+ *   1. Get AutoLinkNum by IOC_getCapability(CAPID=CONLES_MODE_EVENT).
+ *   2. Call subEVT/postEVT/getLinkState/unsubEVT with IOC_CONLES_MODE_AUTO_LINK_ID_N(AutoLinkNum - 1).
+ *   3. Call subEVT/postEVT/getLinkState/unsubEVT with IOC_CONLES_MODE_AUTO_LINK_ID_N(AutoLinkNum).
+ * @[Expect]: Step2 all SUCCESS, Step3 all return IOC_RESULT_INVALID_AUTO_LINK_ID.
+ * @[Notes]:
+ */
+static IOC_Result_T _Case02_CbProcEvt_doNothing(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    (void)pEvtDesc;
+    (void)pCbPriv;
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventCapability, Case02_verifyAutoLinkNum_byAutoLinkIdNBeyondAutoLinkNum_expectInvalidAutoLinkID) {
+    //===SETUP===
+    IOC_CapabilityDescription_T CapDesc = {.CapID = IOC_CAPID_CONLES_MODE_EVENT};
+    IOC_Result_T Result = IOC_getCapability(&CapDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);              // CheckPoint
+    ASSERT_GE(CapDesc.ConlesModeEvent.AutoLinkNum, 1);  // CheckPoint
+
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T SubEvtArgs = {
+        .CbProcEvt_F = _Case02_CbProcEvt_doNothing,
+        .pCbPrivData = NULL,
+        .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+        .pEvtIDs = SubEvtIDs,
+    };
+    IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = _Case02_CbProcEvt_doNothing, .pCbPriv = NULL};
+    IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE};
+    IOC_LinkState_T LinkState = IOC_LinkStateUndefined;
+
+    //===BEHAVIOR & VERIFY===
+    IOC_LinkID_T LastAutoLinkID = IOC_CONLES_MODE_AUTO_LINK_ID_N(CapDesc.ConlesModeEvent.AutoLinkNum - 1);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT(LastAutoLinkID, &SubEvtArgs));             // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT(LastAutoLinkID, &EvtDesc, NULL));         // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_getLinkState(LastAutoLinkID, &LinkState, NULL));  // KeyVerifyPoint
+    IOC_forceProcEVT();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT(LastAutoLinkID, &UnsubEvtArgs));  // KeyVerifyPoint
+
+    IOC_LinkID_T BeyondAutoLinkID = IOC_CONLES_MODE_AUTO_LINK_ID_N(CapDesc.ConlesModeEvent.AutoLinkNum);
+    ASSERT_EQ(IOC_RESULT_INVALID_AUTO_LINK_ID, IOC_subEVT(BeyondAutoLinkID, &SubEvtArgs));             // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_AUTO_LINK_ID, IOC_postEVT(BeyondAutoLinkID, &EvtDesc, NULL));         // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_AUTO_LINK_ID, IOC_getLinkState(BeyondAutoLinkID, &LinkState, NULL));  // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_AUTO_LINK_ID, IOC_unsubEVT(BeyondAutoLinkID, &UnsubEvtArgs));         // KeyVerifyPoint
+}
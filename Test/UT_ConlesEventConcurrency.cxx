@@ -246,6 +246,11 @@
  *          AND poster thread continues making progress,
  *          AND no race conditions corrupt subscriber list.
  *
+ *  AC-5: GIVEN a callback who unsubscribes itself while being called from the subscriber snapshot,
+ *         WHEN other threads keep churning subscriptions which retire more snapshots meanwhile,
+ *         THEN each unsubscribe inside callback succeeds without deadlock,
+ *          AND the callback is called exactly once per subscription.
+ *
  * [@US-2] Dynamic subscription during event processing
  *  AC-3: GIVEN callback A is subscribed and callback A subscribes callback B during execution,
  *         WHEN events are posted triggering callback A,
@@ -322,6 +327,12 @@
  *      @[Purpose]: Ensure system recovers normal latency after burst load
  *      @[Brief]: Send 500-event burst, verify probe latency < 50ms
  *      @[Status]: PASSED/GREEN ✅
+ *
+ * [@AC-5,US-1] Unsubscribe inside callback while snapshots are retired concurrently
+ *  🟢 TC-8: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock
+ *      @[Purpose]: Verify the snapshot being dispatched stays valid when it's retired by the callback itself
+ *      @[Brief]: 200 rounds of sub+post+forceProc, callback unsubs itself, 2 churners run meanwhile
+ *      @[Status]: PASSED/GREEN ✅
  */
 //======>END OF TEST CASES=========================================================================
 //======>END OF UNIT TESTING DESIGN================================================================
@@ -867,6 +878,96 @@ TEST(UTConlesEventConcurrency, verifyMultiThread_bySustainedChaos_expectStabilit
     }
 }
 
+/**
+ * [@AC-5,US-1]
+ * TC-8:
+ *   @[Name]: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock
+ *   @[Purpose]: Verify dispatch from the subscriber snapshot survives its own retirement
+ *   @[Steps]:
+ *     1) 🔧 SETUP: Start 2 churner threads who sub/unsub another callback repeatedly
+ *     2) 🎯 BEHAVIOR: 200 rounds: sub self-unsub callback, post one event, forceProc
+ *     3) ✅ VERIFY: Callback called exactly 200 times, each self-unsub succeeds
+ *     4) 🧹 CLEANUP: Stop churners
+ *   @[Expect]: No deadlock and no use-after-free when callback retires the snapshot it's called from.
+ */
+namespace {
+struct Tc8Context {
+    std::atomic<uint32_t> CbCount{0};
+    std::atomic<uint32_t> SelfUnsubFailCount{0};
+};
+
+IOC_Result_T tc8CbSelfUnsub(const IOC_EvtDesc_pT, void* pCbPrivData) {
+    auto* pCtx = static_cast<Tc8Context*>(pCbPrivData);
+    pCtx->CbCount.fetch_add(1);
+
+    IOC_UnsubEvtArgs_T UArgs = {.CbProcEvt_F = tc8CbSelfUnsub, .pCbPrivData = pCbPrivData};
+    if (IOC_unsubEVT_inConlesMode(&UArgs) != IOC_RESULT_SUCCESS) {
+        pCtx->SelfUnsubFailCount.fetch_add(1);
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+IOC_Result_T tc8CbChurner(const IOC_EvtDesc_pT, void*) { return IOC_RESULT_SUCCESS; }
+}  // namespace
+
+TEST(UTConlesEventConcurrency, verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock) {
+    //===>>> SETUP <<<===
+    printf("🔧 SETUP: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock\n");
+    constexpr uint32_t NumRounds = 200;
+    constexpr uint32_t NumChurners = 2;
+    Tc8Context Ctx;
+    std::atomic<bool> Running{true};
+    std::array<int, NumChurners> ChurnerPrivData{};
+
+    std::vector<std::thread> Churners;
+    for (uint32_t i = 0; i < NumChurners; ++i) {
+        Churners.emplace_back([&Running, &ChurnerPrivData, i]() {
+            IOC_EvtID_T EvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+            while (Running.load()) {
+                IOC_SubEvtArgs_T SArgs = {.CbProcEvt_F = tc8CbChurner,
+                                          .pCbPrivData = &ChurnerPrivData[i],
+                                          .EvtNum = IOC_calcArrayElmtCnt(EvtIDs),
+                                          .pEvtIDs = EvtIDs};
+                IOC_subEVT_inConlesMode(&SArgs);
+                IOC_UnsubEvtArgs_T UArgs = {.CbProcEvt_F = tc8CbChurner, .pCbPrivData = &ChurnerPrivData[i]};
+                IOC_unsubEVT_inConlesMode(&UArgs);
+            }
+        });
+    }
+
+    //===>>> BEHAVIOR <<<===
+    printf("🎯 BEHAVIOR: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock\n");
+    IOC_EvtID_T EvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    for (uint32_t i = 0; i < NumRounds; ++i) {
+        IOC_SubEvtArgs_T SArgs = {.CbProcEvt_F = tc8CbSelfUnsub,
+                                  .pCbPrivData = &Ctx,
+                                  .EvtNum = IOC_calcArrayElmtCnt(EvtIDs),
+                                  .pEvtIDs = EvtIDs};
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SArgs));
+
+        IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE};
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, nullptr));
+        IOC_forceProcEVT();
+
+        // forceProc returns once the EvtDesc is callbacked, but wait a little more on slow machines.
+        for (int Retry = 0; Retry < 1000 && Ctx.CbCount.load() != i + 1; ++Retry) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(i + 1, Ctx.CbCount.load());
+    }
+
+    Running.store(false);
+    for (auto& t : Churners) t.join();
+
+    //===>>> VERIFY <<<===
+    printf("✅ VERIFY: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock\n");
+    VERIFY_KEYPOINT_EQ(Ctx.CbCount.load(), NumRounds, "Callback called exactly once per subscription");
+    VERIFY_KEYPOINT_EQ(Ctx.SelfUnsubFailCount.load(), 0u, "Each unsubEVT inside callback succeeds");
+
+    //===>>> CLEANUP <<<===
+    printf("🧹 CLEANUP: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock\n");
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //======>END OF TEST IMPLEMENTATION================================================================
 
@@ -941,6 +1042,11 @@ TEST(UTConlesEventConcurrency, verifyMultiThread_bySustainedChaos_expectStabilit
 //        - Completed: 2024-XX-XX
 //        - Notes: 500-event burst, probe latency < 50ms
 //
+//   🟢 [@AC-5,US-1] TC-8: verifyMultiThread_bySelfUnsubInCallbackWhileChurning_expectNoDeadlock
+//        - Description: Unsubscribe inside callback while other threads retire subscriber snapshots.
+//        - Category: Concurrency
+//        - Notes: 200 rounds + 2 churners, callback called exactly once per subscription
+//
 // 🚪 GATE P2: All P2 concurrency tests GREEN, architecture validated.
 //
 //===================================================================================================
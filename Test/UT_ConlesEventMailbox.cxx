@@ -0,0 +1,493 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Mailbox here means each EvtConsumer's own bounded EvtDesc queue in ConlesMode,
+ *  opted in by IOC_SUBEVT_FLAG_WORKER_POOL, whose capacity and overflow policy are set by
+ *  IOC_SubEvtArgs_T::MailboxCapacity/OverflowPolicy,
+ *  so a lossy EvtConsumer(such as UI) drops stale events by itself,
+ *  while a lossless EvtConsumer(such as Audit) on the same AutoLink still receives every event.
+ *
+ * RefDoc:
+ *  1) IOC_EvtAPI.h::IOC_EvtOverflowPolicy_T
+ *  2) Source/_IOC_ConlesEvent.md::Worker-Pool Dispatch
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS an EvtConsumer who only cares about the latest events,
+ *        I WANT TO set my own mailbox capacity and overflow policy when subEVT,
+ *        SO THAT I never push back on other EvtConsumers when I'm slow, and I can see what is dropped.
+ *
+ *  US-2: AS an EvtConsumer who must not lose any event,
+ *        I WANT TO keep the BLOCK policy on the same AutoLink with a lossy EvtConsumer,
+ *        SO THAT I receive every event in order.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN EvtConsumer UI subEVT with MailboxCapacity=4 and DROP_NEWEST/DROP_OLDEST,
+ *         WHEN UI is blocked in CbProcEvt and EvtProducer posts N more events,
+ *         THEN UI's mailbox keeps the oldest/newest 4 events and drops the others,
+ *          AND DroppedEvtNum is N-4 and HighWatermark is 4.
+ *
+ * AC-2@US-1: GIVEN EvtConsumer UI subEVT with MailboxCapacity=4 and COALESCE_BY_EVTID,
+ *         WHEN UI is blocked in CbProcEvt and EvtProducer posts STARTED, N*KEEPING, STOPPED,
+ *         THEN UI receives STARTED first, STOPPED last and KEEPINGs with increasing values ending by the last one,
+ *          AND CoalescedEvtNum + received events == posted events.
+ *
+ * AC-3@US-2: GIVEN EvtConsumer Audit subEVT with BLOCK on the same AutoLink with a lossy EvtConsumer UI,
+ *         WHEN UI is blocked in CbProcEvt and EvtProducer posts N events,
+ *         THEN Audit receives all N events in order while UI is still blocked.
+ *
+ * AC-4@US-2: GIVEN EvtConsumer Audit subEVT with MailboxCapacity=4 and BLOCK,
+ *         WHEN Audit is blocked in CbProcEvt and EvtProducer posts events by NonBlock until it's pushed back,
+ *         THEN Audit receives all posted events in order after it's unblocked,
+ *          AND BlockedEvtNum is at least 1 and nothing is backlogged after that.
+ *
+ * AC-5@US-1: GIVEN invalid MailboxCapacity/OverflowPolicy with IOC_SUBEVT_FLAG_WORKER_POOL,
+ *           or any ones without it, or an EvtConsumer without mailbox,
+ *         WHEN subEVT or getEvtMailboxStats,
+ *         THEN IOC returns INVALID_PARAM, ignores them, NOT_SUPPORT or NO_EVENT_CONSUMER accordingly.
+ *
+ * AC-6@US-2: GIVEN EvtConsumer Audit subEVT with MailboxCapacity=4 and BLOCK, and EvtConsumer UI with DROP_NEWEST,
+ *         WHEN Audit is blocked in CbProcEvt and its mailbox is backlogged by EvtProducer,
+ *         THEN postEVT of Audit's EvtID is pushed back by NonBlock or Timeout,
+ *          AND UI on the same AutoLink keeps receiving its events while Audit is still blocked,
+ *          AND Audit receives all its posted events after it's unblocked.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1】
+ *   TC-1.1:
+ *      @[Name]: verifyDropNewest_byBlockedUiAndPostMoreEvts_expectOldestKeptAndDroppedCounted
+ *   TC-1.2:
+ *      @[Name]: verifyDropOldest_byBlockedUiAndPostMoreEvts_expectNewestKeptAndDroppedCounted
+ *
+ * 【@AC-2】
+ *   TC-2.1:
+ *      @[Name]: verifyCoalesceByEvtID_byBlockedUiAndPostMoveEvts_expectLatestKeepingInOrder
+ *
+ * 【@AC-3】
+ *   TC-3.1:
+ *      @[Name]: verifyLossyUiNotStallAudit_byBlockedUiAndPostEvts_expectAuditReceivesAll
+ *      @[Notes]: same steps as TC-1.1, Audit is checked there.
+ *
+ * 【@AC-4】
+ *   TC-4.1:
+ *      @[Name]: verifyBlock_byBlockedAuditAndPostMoreEvts_expectAllReceivedInOrder
+ *
+ * 【@AC-5】
+ *   TC-5.1:
+ *      @[Name]: verifyMisuse_byInvalidMailboxArgsOrNoMailbox_expectErrorsOrIgnored
+ *
+ * 【@AC-6】
+ *   TC-6.1:
+ *      @[Name]: verifyBlock_byBackloggedAuditMailbox_expectPosterPushedBackAndUiKeepsReceiving
+ *      @[Notes]: BLOCK never waits in the EvtProcThread shared by all EvtConsumers of the AutoLink.
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<bool> IsBlocked;
+    std::atomic<bool> IsReleased;
+
+    std::atomic<uint32_t> RecvEvtCnt;  // not include TEST_SLEEP_999MS
+    IOC_EvtID_T RecvEvtIDs[1024];
+    ULONG_T RecvEvtValues[1024];
+} _MailboxCbPrivData_T;
+
+static IOC_Result_T _MailboxCbProcEvt_blockOrRecord(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _MailboxCbPrivData_T *pCbPrivData = (_MailboxCbPrivData_T *)pCbPriv;
+
+    if (pEvtDesc->EvtID == IOC_EVTID_TEST_SLEEP_999MS) {
+        pCbPrivData->IsBlocked = true;
+        for (int i = 0; i < 5000 && !pCbPrivData->IsReleased; i++) {
+            usleep(1000);
+        }
+        pCbPrivData->IsBlocked = false;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    uint32_t Idx = pCbPrivData->RecvEvtCnt;
+    if (Idx < IOC_calcArrayElmtCnt(pCbPrivData->RecvEvtIDs)) {
+        pCbPrivData->RecvEvtIDs[Idx] = pEvtDesc->EvtID;
+        pCbPrivData->RecvEvtValues[Idx] = pEvtDesc->EvtValue;
+    }
+    pCbPrivData->RecvEvtCnt++;
+    return IOC_RESULT_SUCCESS;
+}
+
+// post TEST_SLEEP_999MS and wait pCbPrivData's CbProcEvt is blocked by it.
+static void _Mailbox_postSleepEvtAndWaitBlocked(_MailboxCbPrivData_T *pCbPrivData) {
+    IOC_EvtDesc_T SleepEvtDesc = {.EvtID = IOC_EVTID_TEST_SLEEP_999MS};
+    IOC_Result_T Result = IOC_postEVT_inConlesMode(&SleepEvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    for (int i = 0; i < 1000 && !pCbPrivData->IsBlocked; i++) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(pCbPrivData->IsBlocked);  // CheckPoint
+}
+
+static void _Mailbox_postEvts(IOC_EvtID_T EvtID, ULONG_T FirstEvtValue, ULONG_T EvtNum) {
+    for (ULONG_T i = 0; i < EvtNum; i++) {
+        IOC_EvtDesc_T EvtDesc = {.EvtID = EvtID, .EvtValue = FirstEvtValue + i};
+        IOC_Option_defineASyncMayBlock(OptASyncMayBlock);
+        IOC_Result_T Result = IOC_postEVT_inConlesMode(&EvtDesc, &OptASyncMayBlock);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    }
+}
+
+// post EvtIDs by NonBlock one by one until pushed back by a backlogged BLOCK mailbox, return how many are posted.
+static ULONG_T _Mailbox_postEvtsUntilPushedBack(IOC_EvtID_T EvtID) {
+    for (ULONG_T i = 0; i < 1000; i++) {
+        IOC_EvtDesc_T EvtDesc = {.EvtID = EvtID, .EvtValue = i};
+        IOC_Option_defineASyncNonBlock(OptASyncNonBlock);
+        IOC_Result_T Result = IOC_postEVT_inConlesMode(&EvtDesc, &OptASyncNonBlock);
+        if (Result == IOC_RESULT_TOO_MANY_QUEUING_EVTDESC) {
+            return i;
+        }
+        EXPECT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+        usleep(1000);  // let EvtProcThread dispatch it before the next one
+    }
+    return 1000;
+}
+
+// wait EvtProcThread has dispatched all posted events to mailboxes, while some EvtConsumer is still blocked.
+static void _Mailbox_waitRecvEvtCnt(_MailboxCbPrivData_T *pCbPrivData, uint32_t RecvEvtCnt) {
+    for (int i = 0; i < 1000 && pCbPrivData->RecvEvtCnt < RecvEvtCnt; i++) {
+        usleep(1000);
+    }
+}
+
+static void _Mailbox_testDropPolicy(IOC_EvtOverflowPolicy_T OverflowPolicy) {
+    //===SETUP===
+    _MailboxCbPrivData_T *pUiCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T UiSubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS, IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T UiSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pUiCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(UiSubEvtIDs),
+        .pEvtIDs = UiSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .MailboxCapacity = 4,
+        .OverflowPolicy = OverflowPolicy,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&UiSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    _MailboxCbPrivData_T *pAuditCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T AuditSubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T AuditSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pAuditCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(AuditSubEvtIDs),
+        .pEvtIDs = AuditSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .OverflowPolicy = IOC_EVT_OVERFLOW_BLOCK,
+    };
+    Result = IOC_subEVT_inConlesMode(&AuditSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    _Mailbox_postSleepEvtAndWaitBlocked(pUiCbPrivData);
+
+#define _MailboxDropEvtCnt 100
+    _Mailbox_postEvts(IOC_EVTID_TEST_KEEPALIVE, 0, _MailboxDropEvtCnt);
+    _Mailbox_waitRecvEvtCnt(pAuditCbPrivData, _MailboxDropEvtCnt);
+
+    //===VERIFY===
+    ASSERT_EQ(_MailboxDropEvtCnt, pAuditCbPrivData->RecvEvtCnt);  // KeyVerifyPoint
+    for (uint32_t i = 0; i < _MailboxDropEvtCnt; i++) {
+        ASSERT_EQ(i, pAuditCbPrivData->RecvEvtValues[i]);  // KeyVerifyPoint
+    }
+    ASSERT_TRUE(pUiCbPrivData->IsBlocked);  // KeyVerifyPoint
+
+    IOC_UnsubEvtArgs_T UiSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord, .pCbPrivData = pUiCbPrivData};
+    IOC_EvtMailboxStats_T UiMailboxStats = {};
+    Result = IOC_getEvtMailboxStats_inConlesMode(&UiSuberArgs, &UiMailboxStats);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);                        // CheckPoint
+    ASSERT_EQ(4, UiMailboxStats.Capacity);                        // KeyVerifyPoint
+    ASSERT_EQ(OverflowPolicy, UiMailboxStats.OverflowPolicy);     // KeyVerifyPoint
+    ASSERT_EQ(4, UiMailboxStats.QueuedEvtNum);                    // KeyVerifyPoint
+    ASSERT_EQ(4, UiMailboxStats.HighWatermark);                   // KeyVerifyPoint
+    ASSERT_EQ(_MailboxDropEvtCnt - 4, UiMailboxStats.DroppedEvtNum);  // KeyVerifyPoint
+    ASSERT_EQ(0, UiMailboxStats.BlockedEvtNum);                   // KeyVerifyPoint
+
+    pUiCbPrivData->IsReleased = true;
+    IOC_forceProcEVT();
+
+    ASSERT_EQ(4, pUiCbPrivData->RecvEvtCnt);  // KeyVerifyPoint
+    ULONG_T FirstKeptEvtValue = (IOC_EVT_OVERFLOW_DROP_NEWEST == OverflowPolicy) ? 0 : _MailboxDropEvtCnt - 4;
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(FirstKeptEvtValue + i, pUiCbPrivData->RecvEvtValues[i]);  // KeyVerifyPoint
+    }
+
+    //===CLEANUP===
+    Result = IOC_unsubEVT_inConlesMode(&UiSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_UnsubEvtArgs_T AuditSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+                                         .pCbPrivData = pAuditCbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&AuditSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    delete pUiCbPrivData;
+    delete pAuditCbPrivData;
+}
+
+// [@AC-1,US-1] TC-1.1 and [@AC-3,US-2] TC-3.1
+TEST(UT_ConlesEventMailbox, verifyDropNewest_byBlockedUiAndPostMoreEvts_expectOldestKeptAndDroppedCounted) {
+    _Mailbox_testDropPolicy(IOC_EVT_OVERFLOW_DROP_NEWEST);
+}
+
+// [@AC-1,US-1] TC-1.2
+TEST(UT_ConlesEventMailbox, verifyDropOldest_byBlockedUiAndPostMoreEvts_expectNewestKeptAndDroppedCounted) {
+    _Mailbox_testDropPolicy(IOC_EVT_OVERFLOW_DROP_OLDEST);
+}
+
+// [@AC-2,US-1] TC-2.1
+TEST(UT_ConlesEventMailbox, verifyCoalesceByEvtID_byBlockedUiAndPostMoveEvts_expectLatestKeepingInOrder) {
+    //===SETUP===
+    _MailboxCbPrivData_T *pUiCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T UiSubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS, IOC_EVTID_TEST_MOVE_STARTED, IOC_EVTID_TEST_MOVE_KEEPING,
+                                 IOC_EVTID_TEST_MOVE_STOPPED};
+    IOC_SubEvtArgs_T UiSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pUiCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(UiSubEvtIDs),
+        .pEvtIDs = UiSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .MailboxCapacity = 4,
+        .OverflowPolicy = IOC_EVT_OVERFLOW_COALESCE_BY_EVTID,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&UiSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    _Mailbox_postSleepEvtAndWaitBlocked(pUiCbPrivData);
+
+#define _MailboxKeepingEvtCnt 100
+    _Mailbox_postEvts(IOC_EVTID_TEST_MOVE_STARTED, 0, 1);
+    _Mailbox_postEvts(IOC_EVTID_TEST_MOVE_KEEPING, 1, _MailboxKeepingEvtCnt);
+    _Mailbox_postEvts(IOC_EVTID_TEST_MOVE_STOPPED, _MailboxKeepingEvtCnt + 1, 1);
+
+    pUiCbPrivData->IsReleased = true;
+    IOC_forceProcEVT();
+
+    //===VERIFY===
+    IOC_UnsubEvtArgs_T UiSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord, .pCbPrivData = pUiCbPrivData};
+    IOC_EvtMailboxStats_T UiMailboxStats = {};
+    Result = IOC_getEvtMailboxStats_inConlesMode(&UiSuberArgs, &UiMailboxStats);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    uint32_t RecvEvtCnt = pUiCbPrivData->RecvEvtCnt;
+    ASSERT_GE(RecvEvtCnt, 3);                                                      // KeyVerifyPoint
+    ASSERT_EQ(_MailboxKeepingEvtCnt + 2, RecvEvtCnt + UiMailboxStats.CoalescedEvtNum);  // KeyVerifyPoint
+    ASSERT_GT(UiMailboxStats.CoalescedEvtNum, 0);                                  // KeyVerifyPoint
+    ASSERT_EQ(0, UiMailboxStats.DroppedEvtNum);                                    // KeyVerifyPoint
+    ASSERT_EQ(4, UiMailboxStats.HighWatermark);                                    // KeyVerifyPoint
+
+    ASSERT_EQ(IOC_EVTID_TEST_MOVE_STARTED, pUiCbPrivData->RecvEvtIDs[0]);               // KeyVerifyPoint
+    ASSERT_EQ(IOC_EVTID_TEST_MOVE_STOPPED, pUiCbPrivData->RecvEvtIDs[RecvEvtCnt - 1]);  // KeyVerifyPoint
+    ASSERT_EQ(_MailboxKeepingEvtCnt, pUiCbPrivData->RecvEvtValues[RecvEvtCnt - 2]);     // KeyVerifyPoint
+    for (uint32_t i = 1; i < RecvEvtCnt - 1; i++) {
+        ASSERT_EQ(IOC_EVTID_TEST_MOVE_KEEPING, pUiCbPrivData->RecvEvtIDs[i]);               // KeyVerifyPoint
+        ASSERT_GT(pUiCbPrivData->RecvEvtValues[i], pUiCbPrivData->RecvEvtValues[i - 1]);  // KeyVerifyPoint
+    }
+
+    //===CLEANUP===
+    Result = IOC_unsubEVT_inConlesMode(&UiSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    delete pUiCbPrivData;
+}
+
+// [@AC-4,US-2] TC-4.1
+TEST(UT_ConlesEventMailbox, verifyBlock_byBlockedAuditAndPostMoreEvts_expectAllReceivedInOrder) {
+    //===SETUP===
+    _MailboxCbPrivData_T *pAuditCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T AuditSubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS, IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T AuditSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pAuditCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(AuditSubEvtIDs),
+        .pEvtIDs = AuditSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .MailboxCapacity = 4,
+        .OverflowPolicy = IOC_EVT_OVERFLOW_BLOCK,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&AuditSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    _Mailbox_postSleepEvtAndWaitBlocked(pAuditCbPrivData);
+
+    ULONG_T PostedEvtCnt = _Mailbox_postEvtsUntilPushedBack(IOC_EVTID_TEST_KEEPALIVE);
+    ASSERT_GT(PostedEvtCnt, 4);     // CheckPoint
+    ASSERT_LT(PostedEvtCnt, 1000);  // KeyVerifyPoint: pushed back
+
+    IOC_UnsubEvtArgs_T AuditSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+                                         .pCbPrivData = pAuditCbPrivData};
+    IOC_EvtMailboxStats_T AuditMailboxStats = {};
+    Result = IOC_getEvtMailboxStats_inConlesMode(&AuditSuberArgs, &AuditMailboxStats);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);                // CheckPoint
+    ASSERT_EQ(4, AuditMailboxStats.QueuedEvtNum);         // KeyVerifyPoint
+    ASSERT_GE(AuditMailboxStats.BackloggedEvtNum, 1);     // KeyVerifyPoint
+
+    pAuditCbPrivData->IsReleased = true;
+    IOC_forceProcEVT();
+
+    //===VERIFY===
+    ASSERT_EQ(PostedEvtCnt, pAuditCbPrivData->RecvEvtCnt);  // KeyVerifyPoint
+    for (uint32_t i = 0; i < PostedEvtCnt; i++) {
+        ASSERT_EQ(i, pAuditCbPrivData->RecvEvtValues[i]);  // KeyVerifyPoint
+    }
+
+    Result = IOC_getEvtMailboxStats_inConlesMode(&AuditSuberArgs, &AuditMailboxStats);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);             // CheckPoint
+    ASSERT_EQ(0, AuditMailboxStats.QueuedEvtNum);      // KeyVerifyPoint
+    ASSERT_EQ(4, AuditMailboxStats.HighWatermark);     // KeyVerifyPoint
+    ASSERT_EQ(0, AuditMailboxStats.DroppedEvtNum);     // KeyVerifyPoint
+    ASSERT_GE(AuditMailboxStats.BlockedEvtNum, 1);     // KeyVerifyPoint
+    ASSERT_EQ(0, AuditMailboxStats.BackloggedEvtNum);  // KeyVerifyPoint
+
+    //===CLEANUP===
+    Result = IOC_unsubEVT_inConlesMode(&AuditSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    delete pAuditCbPrivData;
+}
+
+// [@AC-5,US-1] TC-5.1
+TEST(UT_ConlesEventMailbox, verifyMisuse_byInvalidMailboxArgsOrNoMailbox_expectErrorsOrIgnored) {
+    _MailboxCbPrivData_T CbPrivData = {};
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T SubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = &CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+        .pEvtIDs = SubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .OverflowPolicy = (IOC_EvtOverflowPolicy_T)99,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, Result);  // KeyVerifyPoint
+
+    SubEvtArgs.OverflowPolicy = IOC_EVT_OVERFLOW_DROP_OLDEST;
+    SubEvtArgs.MailboxCapacity = 1UL << 30;
+    Result = IOC_subEVT_inConlesMode(&SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, Result);  // KeyVerifyPoint
+
+    IOC_UnsubEvtArgs_T SuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord, .pCbPrivData = &CbPrivData};
+    IOC_EvtMailboxStats_T MailboxStats = {};
+    Result = IOC_getEvtMailboxStats_inConlesMode(&SuberArgs, &MailboxStats);
+    ASSERT_EQ(IOC_RESULT_NO_EVENT_CONSUMER, Result);  // KeyVerifyPoint
+
+    Result = IOC_getEvtMailboxStats_inConlesMode(&SuberArgs, NULL);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, Result);  // KeyVerifyPoint
+
+    // EvtConsumer callbacked by EvtProcThread has no mailbox, whose mailbox args are ignored even if not zeroed
+    SubEvtArgs.Flags = IOC_SUBEVT_FLAG_NONE;
+    SubEvtArgs.OverflowPolicy = (IOC_EvtOverflowPolicy_T)99;
+    Result = IOC_subEVT_inConlesMode(&SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint
+
+    Result = IOC_getEvtMailboxStats_inConlesMode(&SuberArgs, &MailboxStats);
+    ASSERT_EQ(IOC_RESULT_NOT_SUPPORT, Result);  // KeyVerifyPoint
+
+    Result = IOC_unsubEVT_inConlesMode(&SuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+}
+
+// [@AC-6,US-2] TC-6.1
+TEST(UT_ConlesEventMailbox, verifyBlock_byBackloggedAuditMailbox_expectPosterPushedBackAndUiKeepsReceiving) {
+    //===SETUP===
+    _MailboxCbPrivData_T *pAuditCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T AuditSubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS, IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T AuditSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pAuditCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(AuditSubEvtIDs),
+        .pEvtIDs = AuditSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .MailboxCapacity = 4,
+        .OverflowPolicy = IOC_EVT_OVERFLOW_BLOCK,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&AuditSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    _MailboxCbPrivData_T *pUiCbPrivData = new _MailboxCbPrivData_T();
+    IOC_EvtID_T UiSubEvtIDs[] = {IOC_EVTID_TEST_MOVE_KEEPING};
+    IOC_SubEvtArgs_T UiSubEvtArgs = {
+        .CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+        .pCbPrivData = pUiCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(UiSubEvtIDs),
+        .pEvtIDs = UiSubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+        .OverflowPolicy = IOC_EVT_OVERFLOW_DROP_NEWEST,
+    };
+    Result = IOC_subEVT_inConlesMode(&UiSubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    _Mailbox_postSleepEvtAndWaitBlocked(pAuditCbPrivData);
+
+    ULONG_T PostedEvtCnt = _Mailbox_postEvtsUntilPushedBack(IOC_EVTID_TEST_KEEPALIVE);
+    ASSERT_LT(PostedEvtCnt, 1000);  // CheckPoint
+
+#define _MailboxUiEvtCnt 32
+    _Mailbox_postEvts(IOC_EVTID_TEST_MOVE_KEEPING, 0, _MailboxUiEvtCnt);
+    _Mailbox_waitRecvEvtCnt(pUiCbPrivData, _MailboxUiEvtCnt);
+
+    //===VERIFY===
+    ASSERT_TRUE(pAuditCbPrivData->IsBlocked);                // CheckPoint
+    ASSERT_EQ(_MailboxUiEvtCnt, pUiCbPrivData->RecvEvtCnt);  // KeyVerifyPoint
+    for (uint32_t i = 0; i < _MailboxUiEvtCnt; i++) {
+        ASSERT_EQ(i, pUiCbPrivData->RecvEvtValues[i]);  // KeyVerifyPoint
+    }
+
+    IOC_EvtDesc_T AuditEvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = PostedEvtCnt};
+    IOC_Option_defineASyncNonBlock(OptASyncNonBlock);
+    Result = IOC_postEVT_inConlesMode(&AuditEvtDesc, &OptASyncNonBlock);
+    ASSERT_EQ(IOC_RESULT_TOO_MANY_QUEUING_EVTDESC, Result);  // KeyVerifyPoint
+
+    IOC_Option_defineASyncTimeout(OptASyncTimeout, 10000 /*10ms*/);
+    Result = IOC_postEVT_inConlesMode(&AuditEvtDesc, &OptASyncTimeout);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, Result);  // KeyVerifyPoint
+
+    pAuditCbPrivData->IsReleased = true;
+    IOC_forceProcEVT();
+
+    ASSERT_EQ(PostedEvtCnt, pAuditCbPrivData->RecvEvtCnt);  // KeyVerifyPoint
+    for (uint32_t i = 0; i < PostedEvtCnt; i++) {
+        ASSERT_EQ(i, pAuditCbPrivData->RecvEvtValues[i]);  // KeyVerifyPoint
+    }
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T AuditSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord,
+                                         .pCbPrivData = pAuditCbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&AuditSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_UnsubEvtArgs_T UiSuberArgs = {.CbProcEvt_F = _MailboxCbProcEvt_blockOrRecord, .pCbPrivData = pUiCbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&UiSuberArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    delete pAuditCbPrivData;
+    delete pUiCbPrivData;
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
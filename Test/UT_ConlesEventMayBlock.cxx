@@ -133,7 +133,7 @@ TEST(UT_ConlesEventMayBlock, verifyASyncBlock_byPostOneMoreEVT_whenEvtDescQueueF
         .pEvtIDs = SubEvtIDs,
     };
 
-    Result = _IOC_subEVT_inConlesMode(&SubArgs);
+    Result = _IOC_subEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &SubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 
     //===BEHAVIOR & VERIFY & CLEANUP===
@@ -180,7 +180,7 @@ TEST(UT_ConlesEventMayBlock, verifyASyncBlock_byPostOneMoreEVT_whenEvtDescQueueF
         .CbProcEvt_F = _TC01_CbProcEvt_F,
         .pCbPrivData = &EvtConsumerPriv,
     };
-    Result = _IOC_unsubEVT_inConlesMode(&UnsubArgs);
+    Result = _IOC_unsubEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &UnsubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 }
 
@@ -245,7 +245,7 @@ TEST(UT_ConlesEventMayBlock, verifySyncBlock_byPostOneMoreEVT_whenEvtDescQueueNo
         .pEvtIDs = SubEvtIDs,
     };
 
-    IOC_Result_T Result = _IOC_subEVT_inConlesMode(&SubArgs);
+    IOC_Result_T Result = _IOC_subEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &SubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 
     //===BEHAVIOR & VERIFY & CLEANUP===
@@ -292,7 +292,7 @@ TEST(UT_ConlesEventMayBlock, verifySyncBlock_byPostOneMoreEVT_whenEvtDescQueueNo
         .CbProcEvt_F = _TC21_CbProcEvt_F,
         .pCbPrivData = &EvtConsumerPriv,
     };
-    Result = _IOC_unsubEVT_inConlesMode(&UnsubArgs);
+    Result = _IOC_unsubEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &UnsubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 }
 
@@ -134,7 +134,7 @@ TEST(UT_ConlesEventConcurrency, verifyASyncNonblock_byPostOneMoreEVT_whenEvtDesc
         .pEvtIDs = SubEvtIDs,
     };
 
-    Result = _IOC_subEVT_inConlesMode(&SubArgs);
+    Result = _IOC_subEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &SubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 
     //===BEHAVIOR===
@@ -174,7 +174,7 @@ TEST(UT_ConlesEventConcurrency, verifyASyncNonblock_byPostOneMoreEVT_whenEvtDesc
         .CbProcEvt_F = __TC1_cbProcEvt,
         .pCbPrivData = &TC1PrivData,
     };
-    Result = _IOC_unsubEVT_inConlesMode(&UnsubArgs);
+    Result = _IOC_unsubEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &UnsubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 }
 
@@ -242,7 +242,7 @@ TEST(UT_ConlesEventConcurrency, verifySyncNonblock_byPostOneMoreEVT_whenEvtDescQ
         .pEvtIDs = SubEvtIDs,
     };
 
-    IOC_Result_T Result = _IOC_subEVT_inConlesMode(&SubArgs);
+    IOC_Result_T Result = _IOC_subEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &SubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 
     //===BEHAVIOR===
@@ -276,7 +276,7 @@ TEST(UT_ConlesEventConcurrency, verifySyncNonblock_byPostOneMoreEVT_whenEvtDescQ
         .CbProcEvt_F = __TC2_cbProcEvt,
         .pCbPrivData = &TC2PrivData,
     };
-    Result = _IOC_unsubEVT_inConlesMode(&UnsubArgs);
+    Result = _IOC_unsubEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &UnsubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 }
 
@@ -431,7 +431,7 @@ TEST(UT_ConlesEventConcurrency, verifyHybridNonblock_byAlternatelyCbProcEvtBlock
         .pEvtIDs = SubEvtIDs,
     };
 
-    IOC_Result_T Result = _IOC_subEVT_inConlesMode(&SubArgs);
+    IOC_Result_T Result = _IOC_subEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &SubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 
     //===BEHAVIOR===
@@ -494,6 +494,6 @@ TEST(UT_ConlesEventConcurrency, verifyHybridNonblock_byAlternatelyCbProcEvtBlock
         .CbProcEvt_F = __TC3_cbProcEvt,
         .pCbPrivData = &TC3PrivData,
     };
-    Result = _IOC_unsubEVT_inConlesMode(&UnsubArgs);
+    Result = _IOC_unsubEVT_inConlesMode(IOC_CONLES_MODE_AUTO_LINK_ID, &UnsubArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
 }
\ No newline at end of file
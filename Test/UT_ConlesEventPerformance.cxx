@@ -0,0 +1,953 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// UT_ConlesEventPerformance.cxx - ConlesMode Event Performance Testing
+//
+// PURPOSE:
+//   Measure performance characteristics of the Connectionless Event (ConlesEvent) module,
+//   and keep benchmark evidence for each optimization of its internal building blocks.
+//
+// PRIORITY CLASSIFICATION:
+//   P3: Quality-Oriented → Performance
+//
+// RELATIONSHIPS:
+//   - Depends on: Source/_IOC_EvtDescQueue.c, Source/_IOC_ConlesEvent.c
+//   - Related tests: UT_ConlesEventConcurrency.cxx (Thread safety)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Source/_IOC_EvtDescQueue.h"
+#include "_UT_IOC_Common.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//======>BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE===============================================
+/**
+ * @brief
+ *   [WHAT] This file benchmarks ConlesMode event internals and public APIs.
+ *   [WHERE] in the IOC Event subsystem for connectionless mode.
+ *   [WHY] to prove each optimization with numbers, and to keep it correct under contention.
+ *
+ * SCOPE:
+ *   - In scope:
+ *     • EvtDescQueue: lock-free MPSC ring vs. mutex queue under 1/4/16/64 producers
+ *     • IOC_postEVT from 1/4/16 producers of one AutoLinkID, w/o and w/ producers serialized
+ *     • IOC_postEVTs burst vs. IOC_postEVT one by one
+ *     • EvtID indexed dispatch cost with 1/32/128 EvtConsumers
+ *     • Priority lanes: URGENT latency under saturated NORMAL load, and no starvation of NORMAL
+ *   - Out of scope:
+ *     • Thread safety of public APIs (see UT_ConlesEventConcurrency.cxx)
+ *
+ * KEY CONCEPTS:
+ *   - MPSC: Multiple producers(IOC_postEVT callers) and single consumer(EvtProcThread).
+ *   - Benchmark numbers are printed only, because CI machines may have only one CPU core,
+ *      correctness(no loss, per-producer order) is what we ASSERT.
+ */
+//======>END OF OVERVIEW OF THIS UNIT TESTING FILE=================================================
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//======>BEGIN OF UNIT TESTING DESIGN==============================================================
+/**
+ * USER STORIES:
+ *
+ *  US-1: As an EvtProducer posting from many threads,
+ *        I want IOC's EvtDescQueue not to serialize all producers on one lock,
+ *        So that IOC_postEVT scales with the number of producer threads.
+ *
+ *  US-2: As an EvtProducer fanning in thousands of small events per millisecond,
+ *        I want to post a burst of events with one reservation and one wakeup,
+ *        So that lock and signal overhead is paid per burst instead of per event.
+ *
+ *  US-3: As an EvtProducer in a process with many EvtConsumers,
+ *        I want each event to be dispatched only to its EvtConsumers by EvtID index,
+ *        So that dispatch cost does not grow with the number of unrelated EvtConsumers.
+ *
+ *  US-4: As an EvtProducer of rare urgent events(shutdown, fault) among lots of telemetry events,
+ *        I want urgent events to be callbacked before queued telemetry events,
+ *        So that their latency does not grow with telemetry load, while telemetry still makes progress.
+ *
+ * ACCEPTANCE CRITERIA:
+ *
+ * [@US-1]
+ *  AC-1: GIVEN an EvtDescQueue inited with a non power of two capacity,
+ *         WHEN enqueue until full then dequeue until empty,
+ *         THEN capacity is rounded up to power of two,
+ *          AND exactly capacity EvtDescs are accepted in FIFO order.
+ *
+ *  AC-2: GIVEN 1/4/16/64 producer threads and one consumer thread,
+ *         WHEN producers enqueue the same total number of EvtDescs,
+ *         THEN consumer receives all EvtDescs with each producer's order kept,
+ *          AND throughput of lock-free queue and mutex queue are reported side by side.
+ *
+ *  AC-8: GIVEN one EvtConsumer subscribed in ConlesMode and 1/4/16 producer threads,
+ *         WHEN producers IOC_postEVT in AsyncMode concurrently, and again serialized by one lock,
+ *         THEN all events are callbacked with each producer's order kept,
+ *          AND throughput of concurrent and serialized producers are reported side by side.
+ *
+ * [@US-2]
+ *  AC-3: GIVEN an EvtDescQueue,
+ *         WHEN enqueue-N more than free space, or dequeue-up-to-N more than queued,
+ *         THEN enqueue-N is all or nothing, dequeue-up-to-N returns what is queued in FIFO order.
+ *
+ *  AC-4: GIVEN one EvtConsumer subscribed in ConlesMode,
+ *         WHEN the same number of events are posted by IOC_postEVT and by IOC_postEVTs in bursts,
+ *         THEN all events are callbacked in order,
+ *          AND throughput of both ways are reported side by side.
+ *
+ * [@US-3]
+ *  AC-5: GIVEN 1/32/128 EvtConsumers each subscribed its own EvtIDs in ConlesMode,
+ *         WHEN events of all EvtIDs are posted in SyncMode round robin,
+ *         THEN each EvtConsumer is callbacked exactly for its own EvtIDs,
+ *          AND dispatch cost per event is reported for each EvtConsumer number.
+ *
+ * [@US-4]
+ *  AC-6: GIVEN one EvtConsumer whose NORMAL events take a while to process,
+ *         WHEN a producer keeps NORMAL lane full and another posts events one by one as URGENT or NORMAL,
+ *         THEN p99 latency of URGENT events is less than of NORMAL ones under the same load,
+ *          AND p99 latency of URGENT events w/ load is bounded by w/o load plus a few batches of load,
+ *          AND p99 latency of URGENT events w/o and w/ load are reported side by side.
+ *
+ *  AC-7: GIVEN a producer keeps posting URGENT events,
+ *         WHEN one NORMAL event is posted meanwhile,
+ *         THEN the NORMAL event is callbacked before the URGENT flood ends.
+ *
+ *  AC-9: GIVEN one EvtConsumer whose EvtProcThread is held in a callback,
+ *         WHEN one IOC_postEVTs burst mixes URGENT, HIGH, NORMAL and out of IOC_EvtPriority_T events,
+ *         THEN the burst is split by lane: all URGENT ones are callbacked first, then HIGH, then NORMAL,
+ *          AND events of each lane keep posted order, out of IOC_EvtPriority_T ones are NORMAL.
+ *
+ * TEST CASES:
+ *
+ * [@AC-1,US-1]
+ *  🟢 TC-1: verifyQueueCapacity_byInitWithNonPowerOfTwo_expectRoundUpAndFifo
+ *
+ * [@AC-2,US-1]
+ *  🟢 TC-2: verifyQueueContention_byMultiProducers_expectNoLossAndReportThroughput
+ *
+ * [@AC-3,US-2]
+ *  🟢 TC-3: verifyQueueBatch_byEnqueueNAndDequeueUptoN_expectAllOrNothingAndFifo
+ *
+ * [@AC-4,US-2]
+ *  🟢 TC-4: verifyPostEvtsBurst_byCompareWithPostEvtOneByOne_expectInOrderAndReportThroughput
+ *
+ * [@AC-5,US-3]
+ *  🟢 TC-5: verifyDispatchCost_byOneOr32Or128EvtConsumers_expectExactMatchAndReportCost
+ *
+ * [@AC-6,US-4]
+ *  🟢 TC-6: verifyPriorityLatency_bySaturatedNormalLoad_expectUrgentP99Flat
+ *
+ * [@AC-7,US-4]
+ *  🟢 TC-7: verifyPriorityStarvation_byUrgentFlood_expectNormalStillCallbacked
+ *
+ * [@AC-8,US-1]
+ *  🟢 TC-8: verifyPostEvtContention_byMultiProducers_expectNoLossAndReportThroughput
+ *
+ * [@AC-9,US-4]
+ *  🟢 TC-9: verifyPriorityBurst_byMixedPrioritiesInOnePostEvts_expectSplitByLaneInOrder
+ */
+//======>END OF UNIT TESTING DESIGN================================================================
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+
+namespace {
+// The former EvtDescQueue design: one mutex around a fixed array, kept here as benchmark baseline.
+class MutexEvtDescQueue {
+   public:
+    explicit MutexEvtDescQueue(ULONG_T Capacity) : QueuedEvtDescs(Capacity) {}
+
+    IOC_Result_T enqueueElementLast(IOC_EvtDesc_pT pEvtDesc) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (QueuedEvtNum - ProcedEvtNum == QueuedEvtDescs.size()) {
+            return IOC_RESULT_TOO_MANY_QUEUING_EVTDESC;
+        }
+        memcpy(&QueuedEvtDescs[QueuedEvtNum % QueuedEvtDescs.size()], pEvtDesc, sizeof(IOC_EvtDesc_T));
+        QueuedEvtNum++;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    IOC_Result_T dequeueElementFirst(IOC_EvtDesc_pT pEvtDesc) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (QueuedEvtNum == ProcedEvtNum) {
+            return IOC_RESULT_EVTDESC_QUEUE_EMPTY;
+        }
+        memcpy(pEvtDesc, &QueuedEvtDescs[ProcedEvtNum % QueuedEvtDescs.size()], sizeof(IOC_EvtDesc_T));
+        ProcedEvtNum++;
+        return IOC_RESULT_SUCCESS;
+    }
+
+   private:
+    std::mutex Mutex;
+    ULONG_T QueuedEvtNum = 0, ProcedEvtNum = 0;
+    std::vector<IOC_EvtDesc_T> QueuedEvtDescs;
+};
+
+class LockFreeEvtDescQueue {
+   public:
+    explicit LockFreeEvtDescQueue(ULONG_T Capacity) { _IOC_EvtDescQueue_newOneWithCapacity(Capacity, &pQueue); }
+    ~LockFreeEvtDescQueue() { _IOC_EvtDescQueue_deleteOne(pQueue); }
+
+    IOC_Result_T enqueueElementLast(IOC_EvtDesc_pT pEvtDesc) {
+        return _IOC_EvtDescQueue_enqueueElementLast(pQueue, pEvtDesc);
+    }
+    IOC_Result_T dequeueElementFirst(IOC_EvtDesc_pT pEvtDesc) {
+        return _IOC_EvtDescQueue_dequeueElementFirst(pQueue, pEvtDesc);
+    }
+
+   private:
+    _IOC_EvtDescQueue_pT pQueue = NULL;  // layout of EvtDescQueue is C only
+};
+
+struct ContentionResult {
+    double EvtsPerSec;
+    ULONG_T ReceivedEvtNum;
+    ULONG_T OutOfOrderNum;
+};
+
+// EvtID carries producer index, EvtValue carries per-producer sequence.
+template <typename QueueT>
+ContentionResult runContention(ULONG_T ProducerNum, ULONG_T EvtNumPerProducer, ULONG_T Capacity) {
+    QueueT Queue(Capacity);
+    std::atomic<bool> IsStarted{false};
+    std::vector<std::thread> Producers;
+    std::vector<ULONG_T> NextExpectedValue(ProducerNum, 0);
+    ContentionResult Result = {0, 0, 0};
+
+    for (ULONG_T ProducerIdx = 0; ProducerIdx < ProducerNum; ProducerIdx++) {
+        Producers.emplace_back([&, ProducerIdx]() {
+            while (!IsStarted.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (ULONG_T Seq = 0; Seq < EvtNumPerProducer; Seq++) {
+                IOC_EvtDesc_T EvtDesc = {};
+                EvtDesc.EvtID = ProducerIdx;
+                EvtDesc.EvtValue = Seq;
+                while (IOC_RESULT_SUCCESS != Queue.enqueueElementLast(&EvtDesc)) {
+                    std::this_thread::yield();  // full, let consumer run
+                }
+            }
+        });
+    }
+
+    ULONG_T TotalEvtNum = ProducerNum * EvtNumPerProducer;
+    auto StartTime = std::chrono::steady_clock::now();
+    IsStarted.store(true, std::memory_order_release);
+
+    while (Result.ReceivedEvtNum < TotalEvtNum) {
+        IOC_EvtDesc_T EvtDesc = {};
+        if (IOC_RESULT_SUCCESS != Queue.dequeueElementFirst(&EvtDesc)) {
+            std::this_thread::yield();  // empty, let producers run
+            continue;
+        }
+        if (EvtDesc.EvtValue != NextExpectedValue[EvtDesc.EvtID]) {
+            Result.OutOfOrderNum++;
+        }
+        NextExpectedValue[EvtDesc.EvtID] = EvtDesc.EvtValue + 1;
+        Result.ReceivedEvtNum++;
+    }
+
+    auto EndTime = std::chrono::steady_clock::now();
+    for (auto &Producer : Producers) {
+        Producer.join();
+    }
+
+    double ElapsedSec = std::chrono::duration<double>(EndTime - StartTime).count();
+    Result.EvtsPerSec = (double)TotalEvtNum / ElapsedSec;
+    return Result;
+}
+}  // namespace
+
+/**
+ * [@AC-1,US-1]
+ * TC-1:
+ *   @[Name]: verifyQueueCapacity_byInitWithNonPowerOfTwo_expectRoundUpAndFifo
+ *   @[Steps]:
+ *     1) 🔧 SETUP: new EvtDescQueue with capacity 100, and with capacity 0
+ *     2) 🎯 BEHAVIOR: enqueue until TOO_MANY, then dequeue until EMPTY
+ *     3) ✅ VERIFY: capacity is 128, 128 EvtDescs accepted and dequeued in FIFO order
+ *     4) 🧹 CLEANUP: delete EvtDescQueue
+ *   @[Expect]: capacity 0 is INVALID_PARAM, capacity 100 becomes 128.
+ */
+TEST(UT_ConlesEventPerformance, verifyQueueCapacity_byInitWithNonPowerOfTwo_expectRoundUpAndFifo) {
+    //===SETUP===
+    _IOC_EvtDescQueue_pT pEvtDescQueue = NULL;
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, _IOC_EvtDescQueue_newOneWithCapacity(0, &pEvtDescQueue));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _IOC_EvtDescQueue_newOneWithCapacity(100, &pEvtDescQueue));
+    ASSERT_EQ(128UL, _IOC_EvtDescQueue_getCapacity(pEvtDescQueue));  // KeyVerifyPoint
+
+    //===BEHAVIOR===
+    ULONG_T EnqueuedNum = 0;
+    for (;; EnqueuedNum++) {
+        IOC_EvtDesc_T EvtDesc = {.EvtValue = EnqueuedNum};
+        if (IOC_RESULT_SUCCESS != _IOC_EvtDescQueue_enqueueElementLast(pEvtDescQueue, &EvtDesc)) {
+            break;
+        }
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(128UL, EnqueuedNum);  // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_NO, _IOC_EvtDescQueue_isEmpty(pEvtDescQueue));
+
+    for (ULONG_T i = 0; i < EnqueuedNum; i++) {
+        IOC_EvtDesc_T EvtDesc = {};
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _IOC_EvtDescQueue_dequeueElementFirst(pEvtDescQueue, &EvtDesc));
+        ASSERT_EQ(i, EvtDesc.EvtValue);  // KeyVerifyPoint
+    }
+
+    IOC_EvtDesc_T EvtDesc = {};
+    ASSERT_EQ(IOC_RESULT_EVTDESC_QUEUE_EMPTY, _IOC_EvtDescQueue_dequeueElementFirst(pEvtDescQueue, &EvtDesc));
+    ASSERT_EQ(IOC_RESULT_YES, _IOC_EvtDescQueue_isEmpty(pEvtDescQueue));
+
+    //===CLEANUP===
+    _IOC_EvtDescQueue_deleteOne(pEvtDescQueue);
+}
+
+/**
+ * [@AC-2,US-1]
+ * TC-2:
+ *   @[Name]: verifyQueueContention_byMultiProducers_expectNoLossAndReportThroughput
+ *   @[Steps]:
+ *     1) 🔧 SETUP: for each of 1/4/16/64 producers, split the same total EvtDescs among producers
+ *     2) 🎯 BEHAVIOR: run mutex queue and lock-free queue with same capacity and load
+ *     3) ✅ VERIFY: consumer receives all EvtDescs and each producer's order is kept
+ *     4) 🧹 CLEANUP: join producers
+ *   @[Expect]: both queues are lossless and ordered, throughput table is printed.
+ */
+TEST(UT_ConlesEventPerformance, verifyQueueContention_byMultiProducers_expectNoLossAndReportThroughput) {
+    //===SETUP===
+    const ULONG_T TotalEvtNum = 64 * 1024;
+    const ULONG_T Capacity = _CONLES_EVENT_MAX_QUEUING_EVTDESC;
+    const ULONG_T ProducerNums[] = {1, 4, 16, 64};
+
+    printf("┌───────────┬──────────────────┬──────────────────┬─────────┐\n");
+    printf("│ Producers │ Mutex (Evts/s)   │ LockFree (Evts/s)│ Speedup │\n");
+    printf("├───────────┼──────────────────┼──────────────────┼─────────┤\n");
+
+    for (ULONG_T ProducerNum : ProducerNums) {
+        //===BEHAVIOR===
+        ULONG_T EvtNumPerProducer = TotalEvtNum / ProducerNum;
+        ContentionResult MutexResult = runContention<MutexEvtDescQueue>(ProducerNum, EvtNumPerProducer, Capacity);
+        ContentionResult LockFreeResult =
+            runContention<LockFreeEvtDescQueue>(ProducerNum, EvtNumPerProducer, Capacity);
+
+        printf("│ %9lu │ %16.0f │ %16.0f │ %6.2fx │\n", ProducerNum, MutexResult.EvtsPerSec,
+               LockFreeResult.EvtsPerSec, LockFreeResult.EvtsPerSec / MutexResult.EvtsPerSec);
+
+        //===VERIFY===
+        ASSERT_EQ(TotalEvtNum, MutexResult.ReceivedEvtNum);
+        ASSERT_EQ(TotalEvtNum, LockFreeResult.ReceivedEvtNum);  // KeyVerifyPoint
+        ASSERT_EQ(0UL, LockFreeResult.OutOfOrderNum);            // KeyVerifyPoint
+    }
+
+    printf("└───────────┴──────────────────┴──────────────────┴─────────┘\n");
+}
+
+/**
+ * [@AC-3,US-2]
+ * TC-3:
+ *   @[Name]: verifyQueueBatch_byEnqueueNAndDequeueUptoN_expectAllOrNothingAndFifo
+ *   @[Steps]:
+ *     1) 🔧 SETUP: new EvtDescQueue with capacity 64
+ *     2) 🎯 BEHAVIOR: enqueue 40, enqueue 40 again, enqueue 24, dequeue up to 100 twice
+ *     3) ✅ VERIFY: second enqueue 40 fails without side effect, dequeue returns 64 then 0
+ *     4) 🧹 CLEANUP: delete EvtDescQueue
+ */
+TEST(UT_ConlesEventPerformance, verifyQueueBatch_byEnqueueNAndDequeueUptoN_expectAllOrNothingAndFifo) {
+    //===SETUP===
+    _IOC_EvtDescQueue_pT pEvtDescQueue = NULL;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _IOC_EvtDescQueue_newOneWithCapacity(64, &pEvtDescQueue));
+
+    std::vector<IOC_EvtDesc_T> EvtDescs(100);
+    for (ULONG_T i = 0; i < EvtDescs.size(); i++) {
+        EvtDescs[i].EvtValue = i;
+    }
+
+    //===BEHAVIOR===
+    IOC_Result_T Result1st = _IOC_EvtDescQueue_enqueueElementsLast(pEvtDescQueue, &EvtDescs[0], 40);
+    IOC_Result_T Result2nd = _IOC_EvtDescQueue_enqueueElementsLast(pEvtDescQueue, &EvtDescs[40], 40);
+    IOC_Result_T Result3rd = _IOC_EvtDescQueue_enqueueElementsLast(pEvtDescQueue, &EvtDescs[40], 24);
+
+    std::vector<IOC_EvtDesc_T> DequeuedEvtDescs(100);
+    ULONG_T DequeuedNum1st = _IOC_EvtDescQueue_dequeueElementsFirst(pEvtDescQueue, DequeuedEvtDescs.data(), 100);
+    ULONG_T DequeuedNum2nd = _IOC_EvtDescQueue_dequeueElementsFirst(pEvtDescQueue, DequeuedEvtDescs.data(), 100);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result1st);
+    ASSERT_EQ(IOC_RESULT_TOO_MANY_QUEUING_EVTDESC, Result2nd);  // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result3rd);
+    ASSERT_EQ(64UL, DequeuedNum1st);  // KeyVerifyPoint
+    ASSERT_EQ(0UL, DequeuedNum2nd);
+    for (ULONG_T i = 0; i < DequeuedNum1st; i++) {
+        ASSERT_EQ(i, DequeuedEvtDescs[i].EvtValue);  // KeyVerifyPoint
+    }
+
+    //===CLEANUP===
+    _IOC_EvtDescQueue_deleteOne(pEvtDescQueue);
+}
+
+namespace {
+struct BurstCbPrivData {
+    std::atomic<ULONG_T> ProcedEvtNum{0};
+    ULONG_T OutOfOrderNum = 0;
+};
+
+IOC_Result_T burstCbProcEvt(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    auto *pPrivData = static_cast<BurstCbPrivData *>(pCbPriv);
+    if (pEvtDesc->EvtValue != pPrivData->ProcedEvtNum.load()) {
+        pPrivData->OutOfOrderNum++;
+    }
+    pPrivData->ProcedEvtNum++;
+    return IOC_RESULT_SUCCESS;
+}
+}  // namespace
+
+/**
+ * [@AC-4,US-2]
+ * TC-4:
+ *   @[Name]: verifyPostEvtsBurst_byCompareWithPostEvtOneByOne_expectInOrderAndReportThroughput
+ *   @[Steps]:
+ *     1) 🔧 SETUP: subEVT(TEST_KEEPALIVE) in ConlesMode
+ *     2) 🎯 BEHAVIOR: post the same number of events by IOC_postEVT and by IOC_postEVTs(burst=32),
+ *          each way ends by IOC_forceProcEVT
+ *     3) ✅ VERIFY: all events callbacked in order for both ways
+ *     4) 🧹 CLEANUP: unsubEVT
+ *   @[Expect]: both ways are lossless and ordered, throughput table is printed.
+ */
+TEST(UT_ConlesEventPerformance, verifyPostEvtsBurst_byCompareWithPostEvtOneByOne_expectInOrderAndReportThroughput) {
+    //===SETUP===
+    const ULONG_T TotalEvtNum = 64 * 1024;
+    const ULONG_T BurstEvtNum = 32;
+
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    BurstCbPrivData OneByOnePrivData, BurstPrivData;
+
+    auto runPost = [&](BurstCbPrivData &PrivData, bool IsBurst) -> double {
+        IOC_SubEvtArgs_T SubEvtArgs = {
+            .CbProcEvt_F = burstCbProcEvt,
+            .pCbPrivData = &PrivData,
+            .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+            .pEvtIDs = SubEvtIDs,
+        };
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+
+        std::vector<IOC_EvtDesc_T> EvtDescs(BurstEvtNum);
+        auto StartTime = std::chrono::steady_clock::now();
+
+        for (ULONG_T NextEvtValue = 0; NextEvtValue < TotalEvtNum;) {
+            if (IsBurst) {
+                for (ULONG_T i = 0; i < BurstEvtNum; i++) {
+                    EvtDescs[i].EvtID = IOC_EVTID_TEST_KEEPALIVE;
+                    EvtDescs[i].EvtValue = NextEvtValue + i;
+                }
+                EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVTs_inConlesMode(EvtDescs.data(), BurstEvtNum, NULL));
+                NextEvtValue += BurstEvtNum;
+            } else {
+                EvtDescs[0].EvtID = IOC_EVTID_TEST_KEEPALIVE;
+                EvtDescs[0].EvtValue = NextEvtValue;
+                EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDescs[0], NULL));
+                NextEvtValue++;
+            }
+        }
+        IOC_forceProcEVT();
+
+        auto EndTime = std::chrono::steady_clock::now();
+
+        IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = burstCbProcEvt, .pCbPrivData = &PrivData};
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+        return (double)TotalEvtNum / std::chrono::duration<double>(EndTime - StartTime).count();
+    };
+
+    //===BEHAVIOR===
+    double OneByOneEvtsPerSec = runPost(OneByOnePrivData, false);
+    double BurstEvtsPerSec = runPost(BurstPrivData, true);
+
+    printf("┌──────────────────────┬──────────────────┐\n");
+    printf("│ Post Way             │ Evts/s           │\n");
+    printf("├──────────────────────┼──────────────────┤\n");
+    printf("│ IOC_postEVT x1       │ %16.0f │\n", OneByOneEvtsPerSec);
+    printf("│ IOC_postEVTs x%-6lu │ %16.0f │\n", BurstEvtNum, BurstEvtsPerSec);
+    printf("└──────────────────────┴──────────────────┘\n");
+
+    //===VERIFY===
+    ASSERT_EQ(TotalEvtNum, OneByOnePrivData.ProcedEvtNum.load());
+    ASSERT_EQ(TotalEvtNum, BurstPrivData.ProcedEvtNum.load());  // KeyVerifyPoint
+    ASSERT_EQ(0UL, BurstPrivData.OutOfOrderNum);                // KeyVerifyPoint
+}
+
+/**
+ * TC-5:
+ *   @[Name]: verifyDispatchCost_byOneOr32Or128EvtConsumers_expectExactMatchAndReportCost
+ *   @[Steps]:
+ *     1) 🔧 SETUP: N EvtConsumers subEVT 4 own EvtIDs each in ConlesMode, N=1/32/128
+ *     2) 🎯 BEHAVIOR: postEVT in SyncMode round robin over all N*4 EvtIDs,
+ *          SyncMode callbacks in the poster's thread, so elapsed time is dispatch cost
+ *     3) ✅ VERIFY: each EvtConsumer is callbacked exactly for its own EvtIDs
+ *     4) 🧹 CLEANUP: unsubEVT all
+ *   @[Expect]: no mismatched callback, dispatch cost table is printed.
+ */
+#define _TC5_SubEvtIDNum 4
+#define _TC5_EvtNameBase 0x100000ULL
+
+struct DispatchCbPrivData {
+    ULONG_T SuberIdx = 0;
+    ULONG_T ProcedEvtNum = 0;
+    ULONG_T MismatchedEvtNum = 0;
+    IOC_EvtID_T SubEvtIDs[_TC5_SubEvtIDNum] = {};
+};
+
+static IOC_Result_T dispatchCbProcEvt(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    DispatchCbPrivData *pPrivData = (DispatchCbPrivData *)pCbPriv;
+
+    if ((ULONG_T)pEvtDesc->EvtValue != pPrivData->SuberIdx) {
+        pPrivData->MismatchedEvtNum++;
+    }
+    pPrivData->ProcedEvtNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventPerformance, verifyDispatchCost_byOneOr32Or128EvtConsumers_expectExactMatchAndReportCost) {
+    const ULONG_T SuberNums[] = {1, 32, 128};
+    const ULONG_T TotalEvtNum = 64 * 1024;
+
+    printf("┌───────────┬──────────────────┐\n");
+    printf("│ Consumers │ Dispatch (ns/evt)│\n");
+    printf("├───────────┼──────────────────┤\n");
+
+    for (ULONG_T SuberNum : SuberNums) {
+        //===SETUP===
+        std::vector<DispatchCbPrivData> PrivDatas(SuberNum);
+
+        for (ULONG_T SuberIdx = 0; SuberIdx < SuberNum; SuberIdx++) {
+            PrivDatas[SuberIdx].SuberIdx = SuberIdx;
+            for (ULONG_T i = 0; i < _TC5_SubEvtIDNum; i++) {
+                PrivDatas[SuberIdx].SubEvtIDs[i] =
+                    IOC_defineEvtID(IOC_EVT_CLASS_TEST, _TC5_EvtNameBase + SuberIdx * _TC5_SubEvtIDNum + i);
+            }
+
+            IOC_SubEvtArgs_T SubEvtArgs = {
+                .CbProcEvt_F = dispatchCbProcEvt,
+                .pCbPrivData = &PrivDatas[SuberIdx],
+                .EvtNum = _TC5_SubEvtIDNum,
+                .pEvtIDs = PrivDatas[SuberIdx].SubEvtIDs,
+            };
+            ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+        }
+
+        //===BEHAVIOR===
+        IOC_Option_defineSyncMode(OptSync);
+        auto StartTime = std::chrono::steady_clock::now();
+
+        for (ULONG_T i = 0; i < TotalEvtNum; i++) {
+            ULONG_T SubEvtIDIdx = i % (SuberNum * _TC5_SubEvtIDNum);
+            IOC_EvtDesc_T EvtDesc = {
+                .EvtID = IOC_defineEvtID(IOC_EVT_CLASS_TEST, _TC5_EvtNameBase + SubEvtIDIdx),
+                .EvtValue = SubEvtIDIdx / _TC5_SubEvtIDNum,
+            };
+            ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptSync));
+        }
+
+        auto EndTime = std::chrono::steady_clock::now();
+        double NsPerEvt = std::chrono::duration<double, std::nano>(EndTime - StartTime).count() / TotalEvtNum;
+        printf("│ %9lu │ %16.1f │\n", SuberNum, NsPerEvt);
+
+        //===VERIFY===
+        ULONG_T TotalProcedEvtNum = 0;
+        for (auto &PrivData : PrivDatas) {
+            ASSERT_EQ(0UL, PrivData.MismatchedEvtNum) << "SuberIdx=" << PrivData.SuberIdx;  // KeyVerifyPoint
+            TotalProcedEvtNum += PrivData.ProcedEvtNum;
+        }
+        ASSERT_EQ(TotalEvtNum, TotalProcedEvtNum);  // KeyVerifyPoint
+
+        //===CLEANUP===
+        for (auto &PrivData : PrivDatas) {
+            IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = dispatchCbProcEvt, .pCbPrivData = &PrivData};
+            ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+        }
+    }
+
+    printf("└───────────┴──────────────────┘\n");
+}
+
+/**
+ * TC-6:
+ *   @[Name]: verifyPriorityLatency_bySaturatedNormalLoad_expectUrgentP99Flat
+ *   @[Steps]:
+ *     1) 🔧 SETUP: subEVT(TEST_KEEPALIVE as load, TEST_MOVE_STOPPED as probe) in ConlesMode,
+ *          each load event spins _TC6_LoadWorkUS in CbProcEvt
+ *     2) 🎯 BEHAVIOR: post probes one by one with post time in EvtValue,
+ *          a) as URGENT without load, b) as URGENT with a thread keeping NORMAL lane full of load,
+ *          c) as NORMAL with the same load
+ *     3) ✅ VERIFY: p99 of b) < p99 of c), p99 of b) < p99 of a) + _TC6_UrgentP99SlackUS
+ *     4) 🧹 CLEANUP: unsubEVT
+ *   @[Expect]: URGENT p99 does not include the queued load, latency table is printed.
+ */
+#define _TC6_LoadWorkUS 20
+#define _TC6_ProbeNum 200
+// An URGENT probe waits at most the batch of load being callbacked, which is up to 16 EvtDescs of EvtProcThread,
+//  so it's bounded by a few batches more than w/o load, however much load is queued in NORMAL lane.
+#define _TC6_LoadBatchNum 16
+#define _TC6_UrgentP99SlackUS (4 * _TC6_LoadBatchNum * _TC6_LoadWorkUS)
+
+struct PriorityCbPrivData {
+    std::atomic<ULONG_T> LoadEvtNum{0};
+    std::atomic<ULONG_T> ProbeEvtNum{0};
+    std::vector<ULONG_T> ProbeLatencyNSs;
+};
+
+static ULONG_T getSteadyNowNS() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static IOC_Result_T priorityCbProcEvt(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    PriorityCbPrivData *pPrivData = (PriorityCbPrivData *)pCbPriv;
+
+    if (pEvtDesc->EvtID == IOC_EVTID_TEST_KEEPALIVE) {
+        ULONG_T BeginNS = getSteadyNowNS();
+        while (getSteadyNowNS() - BeginNS < _TC6_LoadWorkUS * 1000) {
+        }
+        pPrivData->LoadEvtNum++;
+    } else {
+        pPrivData->ProbeLatencyNSs.push_back(getSteadyNowNS() - pEvtDesc->EvtValue);
+        pPrivData->ProbeEvtNum++;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventPerformance, verifyPriorityLatency_bySaturatedNormalLoad_expectUrgentP99Flat) {
+    //===SETUP===
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE, IOC_EVTID_TEST_MOVE_STOPPED};
+
+    // return p99 latency in US of _TC6_ProbeNum probes posted with ProbePriority.
+    auto runProbes = [&](IOC_EvtPriority_T ProbePriority, bool IsLoaded) -> double {
+        PriorityCbPrivData PrivData;
+        PrivData.ProbeLatencyNSs.reserve(_TC6_ProbeNum);
+
+        IOC_SubEvtArgs_T SubEvtArgs = {
+            .CbProcEvt_F = priorityCbProcEvt,
+            .pCbPrivData = &PrivData,
+            .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+            .pEvtIDs = SubEvtIDs,
+        };
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+
+        std::atomic<bool> IsLoading{IsLoaded};
+        std::thread LoadThread([&]() {
+            IOC_Option_defineASyncMayBlock(OptMayBlock);
+            while (IsLoading) {
+                IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .Priority = IOC_EVT_PRIORITY_NORMAL};
+                EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptMayBlock));
+            }
+        });
+        if (IsLoaded) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));  // let NORMAL lane be full
+        }
+
+        IOC_Option_defineASyncMayBlock(OptMayBlock);
+        for (ULONG_T i = 0; i < _TC6_ProbeNum; i++) {
+            IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_MOVE_STOPPED, .Priority = ProbePriority};
+            EvtDesc.EvtValue = getSteadyNowNS();
+            EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptMayBlock));
+
+            while (PrivData.ProbeEvtNum <= i) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));  // not steal CPU from EvtProcThread
+            }
+        }
+
+        IsLoading = false;
+        LoadThread.join();
+        IOC_forceProcEVT();
+
+        IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = priorityCbProcEvt, .pCbPrivData = &PrivData};
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+
+        std::sort(PrivData.ProbeLatencyNSs.begin(), PrivData.ProbeLatencyNSs.end());
+        return PrivData.ProbeLatencyNSs[_TC6_ProbeNum * 99 / 100] / 1000.0;
+    };
+
+    //===BEHAVIOR===
+    double UrgentIdleP99US = runProbes(IOC_EVT_PRIORITY_URGENT, false);
+    double UrgentLoadedP99US = runProbes(IOC_EVT_PRIORITY_URGENT, true);
+    double NormalLoadedP99US = runProbes(IOC_EVT_PRIORITY_NORMAL, true);
+
+    printf("┌──────────────────────┬──────────────────┐\n");
+    printf("│ Probe                │ p99 (us)         │\n");
+    printf("├──────────────────────┼──────────────────┤\n");
+    printf("│ URGENT w/o load      │ %16.1f │\n", UrgentIdleP99US);
+    printf("│ URGENT w/ load       │ %16.1f │\n", UrgentLoadedP99US);
+    printf("│ NORMAL w/ load       │ %16.1f │\n", NormalLoadedP99US);
+    printf("└──────────────────────┴──────────────────┘\n");
+
+    //===VERIFY===
+    ASSERT_LT(UrgentLoadedP99US, NormalLoadedP99US);                      // KeyVerifyPoint
+    ASSERT_LT(UrgentLoadedP99US, UrgentIdleP99US + _TC6_UrgentP99SlackUS);  // KeyVerifyPoint
+}
+
+/**
+ * TC-7:
+ *   @[Name]: verifyPriorityStarvation_byUrgentFlood_expectNormalStillCallbacked
+ *   @[Steps]:
+ *     1) 🔧 SETUP: subEVT(TEST_KEEPALIVE, TEST_MOVE_STOPPED) in ConlesMode
+ *     2) 🎯 BEHAVIOR: a thread keeps posting URGENT TEST_KEEPALIVE for up to 1s,
+ *          then post one NORMAL TEST_MOVE_STOPPED
+ *     3) ✅ VERIFY: NORMAL one is callbacked while the URGENT flood is still going
+ *     4) 🧹 CLEANUP: stop flood, unsubEVT
+ *   @[Expect]: a lower lane is served after being skipped _CONLES_EVENT_MAX_LANE_SKIPPED_NUM times.
+ */
+TEST(UT_ConlesEventPerformance, verifyPriorityStarvation_byUrgentFlood_expectNormalStillCallbacked) {
+    //===SETUP===
+    PriorityCbPrivData PrivData;
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE, IOC_EVTID_TEST_MOVE_STOPPED};
+    IOC_SubEvtArgs_T SubEvtArgs = {
+        .CbProcEvt_F = priorityCbProcEvt,
+        .pCbPrivData = &PrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+        .pEvtIDs = SubEvtIDs,
+    };
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+
+    std::atomic<bool> IsFlooding{true};
+    std::thread FloodThread([&]() {
+        IOC_Option_defineASyncMayBlock(OptMayBlock);
+        auto EndTime = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (IsFlooding && std::chrono::steady_clock::now() < EndTime) {
+            IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .Priority = IOC_EVT_PRIORITY_URGENT};
+            EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptMayBlock));
+        }
+        IsFlooding = false;
+    });
+    while (PrivData.LoadEvtNum < 100) {
+        std::this_thread::yield();
+    }
+
+    //===BEHAVIOR===
+    IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_MOVE_STOPPED, .Priority = IOC_EVT_PRIORITY_NORMAL};
+    EvtDesc.EvtValue = getSteadyNowNS();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, NULL));
+    while (PrivData.ProbeEvtNum == 0 && IsFlooding) {
+        std::this_thread::yield();
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(1UL, PrivData.ProbeEvtNum.load());  // KeyVerifyPoint
+    ASSERT_TRUE(IsFlooding);                      // KeyVerifyPoint
+    printf("NORMAL latency under URGENT flood: %.1f us\n", PrivData.ProbeLatencyNSs[0] / 1000.0);
+
+    //===CLEANUP===
+    IsFlooding = false;
+    FloodThread.join();
+    IOC_forceProcEVT();
+
+    IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = priorityCbProcEvt, .pCbPrivData = &PrivData};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+}
+
+/**
+ * [@AC-8,US-1]
+ * TC-8:
+ *   @[Name]: verifyPostEvtContention_byMultiProducers_expectNoLossAndReportThroughput
+ *   @[Steps]:
+ *     1) 🔧 SETUP: subEVT(TEST_KEEPALIVE) in ConlesMode
+ *     2) 🎯 BEHAVIOR: for each of 1/4/16 producers, IOC_postEVT in ASyncMayBlock the same total events,
+ *          once concurrently and once serialized by a std::mutex as if postEVT took one lock per AutoLinkID,
+ *          each run ends by IOC_forceProcEVT
+ *     3) ✅ VERIFY: all events callbacked and each producer's order is kept
+ *     4) 🧹 CLEANUP: unsubEVT
+ *   @[Expect]: lossless and ordered, throughput table is printed.
+ */
+#define _TC8_ProducerShift 32
+
+namespace {
+struct ContentionCbPrivData {
+    ULONG_T ProcedEvtNum = 0;
+    ULONG_T OutOfOrderNum = 0;
+    std::vector<ULONG_T> NextExpectedSeqs;
+};
+
+// only called by EvtProcThread, EvtValue carries producer index in high bits and per-producer sequence in low bits.
+IOC_Result_T contentionCbProcEvt(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    auto *pPrivData = static_cast<ContentionCbPrivData *>(pCbPriv);
+    ULONG_T ProducerIdx = pEvtDesc->EvtValue >> _TC8_ProducerShift;
+    ULONG_T Seq = pEvtDesc->EvtValue & ((1UL << _TC8_ProducerShift) - 1);
+
+    if (Seq != pPrivData->NextExpectedSeqs[ProducerIdx]) {
+        pPrivData->OutOfOrderNum++;
+    }
+    pPrivData->NextExpectedSeqs[ProducerIdx] = Seq + 1;
+    pPrivData->ProcedEvtNum++;
+    return IOC_RESULT_SUCCESS;
+}
+}  // namespace
+
+TEST(UT_ConlesEventPerformance, verifyPostEvtContention_byMultiProducers_expectNoLossAndReportThroughput) {
+    //===SETUP===
+    const ULONG_T TotalEvtNum = 64 * 1024;
+    const ULONG_T ProducerNums[] = {1, 4, 16};
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+
+    auto runPost = [&](ULONG_T ProducerNum, bool IsSerialized, ContentionCbPrivData &PrivData) -> double {
+        PrivData.NextExpectedSeqs.assign(ProducerNum, 0);
+        IOC_SubEvtArgs_T SubEvtArgs = {
+            .CbProcEvt_F = contentionCbProcEvt,
+            .pCbPrivData = &PrivData,
+            .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+            .pEvtIDs = SubEvtIDs,
+        };
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+
+        std::mutex SerializingMutex;
+        std::atomic<bool> IsStarted{false};
+        std::vector<std::thread> Producers;
+        for (ULONG_T ProducerIdx = 0; ProducerIdx < ProducerNum; ProducerIdx++) {
+            Producers.emplace_back([&, ProducerIdx]() {
+                IOC_Option_defineASyncMayBlock(OptMayBlock);
+                while (!IsStarted.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (ULONG_T Seq = 0; Seq < TotalEvtNum / ProducerNum; Seq++) {
+                    IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE};
+                    EvtDesc.EvtValue = (ProducerIdx << _TC8_ProducerShift) | Seq;
+                    if (IsSerialized) {
+                        std::lock_guard<std::mutex> Lock(SerializingMutex);
+                        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptMayBlock));
+                    } else {
+                        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&EvtDesc, &OptMayBlock));
+                    }
+                }
+            });
+        }
+
+        auto StartTime = std::chrono::steady_clock::now();
+        IsStarted.store(true, std::memory_order_release);
+        for (auto &Producer : Producers) {
+            Producer.join();
+        }
+        IOC_forceProcEVT();
+        auto EndTime = std::chrono::steady_clock::now();
+
+        IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = contentionCbProcEvt, .pCbPrivData = &PrivData};
+        EXPECT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+        return (double)TotalEvtNum / std::chrono::duration<double>(EndTime - StartTime).count();
+    };
+
+    printf("┌───────────┬──────────────────┬──────────────────┬─────────┐\n");
+    printf("│ Producers │ Serialized(Evt/s)│ Concurrent(Evt/s)│ Speedup │\n");
+    printf("├───────────┼──────────────────┼──────────────────┼─────────┤\n");
+
+    for (ULONG_T ProducerNum : ProducerNums) {
+        //===BEHAVIOR===
+        ContentionCbPrivData SerializedPrivData, ConcurrentPrivData;
+        double SerializedEvtsPerSec = runPost(ProducerNum, true, SerializedPrivData);
+        double ConcurrentEvtsPerSec = runPost(ProducerNum, false, ConcurrentPrivData);
+
+        printf("│ %9lu │ %16.0f │ %16.0f │ %6.2fx │\n", ProducerNum, SerializedEvtsPerSec, ConcurrentEvtsPerSec,
+               ConcurrentEvtsPerSec / SerializedEvtsPerSec);
+
+        //===VERIFY===
+        ASSERT_EQ(TotalEvtNum, SerializedPrivData.ProcedEvtNum);
+        ASSERT_EQ(TotalEvtNum, ConcurrentPrivData.ProcedEvtNum);  // KeyVerifyPoint
+        ASSERT_EQ(0UL, ConcurrentPrivData.OutOfOrderNum);          // KeyVerifyPoint
+    }
+
+    printf("└───────────┴──────────────────┴──────────────────┴─────────┘\n");
+}
+
+/**
+ * TC-9:
+ *   @[Name]: verifyPriorityBurst_byMixedPrioritiesInOnePostEvts_expectSplitByLaneInOrder
+ *   @[Steps]:
+ *     1) 🔧 SETUP: subEVT(TEST_MOVE_STARTED as gate, TEST_MOVE_KEEPING as burst) in ConlesMode,
+ *          post the gate and hold EvtProcThread in its CbProcEvt
+ *     2) 🎯 BEHAVIOR: postEVTs one burst of round robin NORMAL/HIGH/URGENT/out of range priorities,
+ *          with its index in EvtValue, then release the gate
+ *     3) ✅ VERIFY: callbacked all URGENT first, then HIGH, then NORMAL with out of range ones,
+ *          and EvtValues of each lane are ascending
+ *     4) 🧹 CLEANUP: unsubEVT
+ *   @[Expect]: one burst neither drags NORMAL events into URGENT lane nor holds URGENT ones back.
+ */
+#define _TC9_BurstEvtNum 12
+
+namespace {
+struct LanedBurstCbPrivData {
+    std::atomic<bool> IsGateEntered{false};
+    std::atomic<bool> IsGateReleased{false};
+    std::atomic<ULONG_T> BurstEvtNum{0};
+    IOC_EvtDesc_T BurstEvtDescs[_TC9_BurstEvtNum];
+};
+
+IOC_Result_T lanedBurstCbProcEvt(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    LanedBurstCbPrivData *pPrivData = (LanedBurstCbPrivData *)pCbPriv;
+
+    if (pEvtDesc->EvtID == IOC_EVTID_TEST_MOVE_STARTED) {
+        pPrivData->IsGateEntered = true;
+        while (!pPrivData->IsGateReleased) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    } else if (pPrivData->BurstEvtNum < _TC9_BurstEvtNum) {
+        pPrivData->BurstEvtDescs[pPrivData->BurstEvtNum] = *pEvtDesc;
+        pPrivData->BurstEvtNum++;
+    }
+    return IOC_RESULT_SUCCESS;
+}
+}  // namespace
+
+TEST(UT_ConlesEventPerformance, verifyPriorityBurst_byMixedPrioritiesInOnePostEvts_expectSplitByLaneInOrder) {
+    //===SETUP===
+    LanedBurstCbPrivData PrivData;
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_MOVE_STARTED, IOC_EVTID_TEST_MOVE_KEEPING};
+    IOC_SubEvtArgs_T SubEvtArgs = {
+        .CbProcEvt_F = lanedBurstCbProcEvt,
+        .pCbPrivData = &PrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+        .pEvtIDs = SubEvtIDs,
+    };
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_subEVT_inConlesMode(&SubEvtArgs));
+
+    IOC_EvtDesc_T GateEvtDesc = {.EvtID = IOC_EVTID_TEST_MOVE_STARTED, .Priority = IOC_EVT_PRIORITY_URGENT};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVT_inConlesMode(&GateEvtDesc, NULL));
+    while (!PrivData.IsGateEntered) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    //===BEHAVIOR===
+    const IOC_EvtPriority_T RoundRobinPriorities[] = {IOC_EVT_PRIORITY_NORMAL, IOC_EVT_PRIORITY_HIGH,
+                                                      IOC_EVT_PRIORITY_URGENT, (IOC_EvtPriority_T)0x7F};
+    IOC_EvtDesc_T BurstEvtDescs[_TC9_BurstEvtNum] = {};
+    for (ULONG_T i = 0; i < _TC9_BurstEvtNum; i++) {
+        BurstEvtDescs[i].EvtID = IOC_EVTID_TEST_MOVE_KEEPING;
+        BurstEvtDescs[i].EvtValue = i;
+        BurstEvtDescs[i].Priority = RoundRobinPriorities[i % IOC_calcArrayElmtCnt(RoundRobinPriorities)];
+    }
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_postEVTs(IOC_CONLES_MODE_AUTO_LINK_ID, BurstEvtDescs, _TC9_BurstEvtNum, NULL));
+
+    PrivData.IsGateReleased = true;
+    IOC_forceProcEVT();
+
+    //===VERIFY===
+    ASSERT_EQ((ULONG_T)_TC9_BurstEvtNum, PrivData.BurstEvtNum.load());  // KeyVerifyPoint
+
+    IOC_EvtPriority_T LastPriority = IOC_EVT_PRIORITY_URGENT;
+    ULONG_T LastEvtValue = 0;
+    for (ULONG_T i = 0; i < _TC9_BurstEvtNum; i++) {
+        IOC_EvtDesc_pT pEvtDesc = &PrivData.BurstEvtDescs[i];
+        ASSERT_LE(pEvtDesc->Priority, IOC_EVT_PRIORITY_URGENT) << "i=" << i;  // CheckPoint: out of range is NORMAL
+        ASSERT_LE(pEvtDesc->Priority, LastPriority) << "i=" << i;             // KeyVerifyPoint: lane by lane
+
+        if (pEvtDesc->Priority == LastPriority && i > 0) {
+            ASSERT_GT(pEvtDesc->EvtValue, LastEvtValue) << "i=" << i;  // KeyVerifyPoint: posted order in a lane
+        }
+        LastPriority = pEvtDesc->Priority;
+        LastEvtValue = pEvtDesc->EvtValue;
+    }
+    ASSERT_EQ(IOC_EVT_PRIORITY_URGENT, PrivData.BurstEvtDescs[0].Priority);
+    ASSERT_EQ(IOC_EVT_PRIORITY_NORMAL, PrivData.BurstEvtDescs[_TC9_BurstEvtNum - 1].Priority);
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = lanedBurstCbProcEvt, .pCbPrivData = &PrivData};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_unsubEVT_inConlesMode(&UnsubEvtArgs));
+}
+
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -1,5 +1,8 @@
 #include <unistd.h>
 
+#include <atomic>
+#include <vector>
+
 #include "_UT_IOC_Common.h"
 
 /**
@@ -11,6 +14,9 @@
  * Case05_verifyPostEvtNvM_byNxEvtProducerPostEvtAndMxEvtConsumerCbProcEvt
  * Case06_verifyPostEvtNvM_byNxEvtProducerPostEvtAndMxEvtConsumerCbProcEvtInCrossOddEvenEvtID
  * Case07_verifyPostEvtInCbProcEvt_byObjAPostEvt_andObjBInCbProcEvt_postEvtToObjC
+ * Case08_verifyPostEvtsBurst_byOneObjPostEvtsInASyncAndSyncMode_expectInOrderCbProcEvt
+ * Case09_verifyMultiAutoLink_bySlowObjBlockedOnAutoLink1_expectFastObjOnAutoLink0NotStalled
+ * Case10_verifyWorkerPool_bySlowObjBlockedInWorker_expectFastObjOnSameAutoLinkNotStalledAndInOrder
  *
  */
 
@@ -882,3 +888,330 @@ TEST(UT_ConlesEventTypical, Case07_verifyPostEvtInCbProcEvt_byObjAPostEvt_andObj
     Result = IOC_unsubEVT_inConlesMode(&ObjC_UnsubEvtArgs);
     ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
 }
+
+/**
+ * @[Name]: verifyPostEvtsBurst_byOneObjPostEvtsInASyncAndSyncMode_expectInOrderCbProcEvt
+ * @[Purpose]: verify IOC_postEVTs deliver a burst of events same as IOC_postEVT one by one.
+ * @[Steps]:
+ *   1. ObjA call subEVT(TEST_KEEPALIVE) with _Case08_CbProcEvt_checkOrder.
+ *   2. ObjB call postEVTs(TEST_KEEPALIVE) with $_Case08_BurstEvtCnt events per burst in ASyncMode,
+ *        then again in SyncMode, then call forceProcEVT().
+ *   3. ObjB call postEVTs with more events than DepthEvtDescQueue in ASyncMode.
+ * @[Expect]: ObjA's callback see all events with continuous SeqID and EvtValue in order,
+ *    and the too deep burst is rejected with IOC_RESULT_TOO_MANY_QUEUING_EVTDESC.
+ * @[Notes]:
+ */
+typedef struct {
+    uint32_t KeepAliveEvtCnt;
+    ULONG_T LastSeqID;
+    uint32_t OutOfOrderCnt;
+} _Case08_CbPrivData_T;
+
+static IOC_Result_T _Case08_CbProcEvt_checkOrder(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _Case08_CbPrivData_T *pCbPrivData = (_Case08_CbPrivData_T *)pCbPriv;
+
+    if (pCbPrivData->KeepAliveEvtCnt != pEvtDesc->EvtValue ||
+        (pCbPrivData->KeepAliveEvtCnt > 0 && pCbPrivData->LastSeqID + 1 != pEvtDesc->MsgDesc.SeqID)) {
+        pCbPrivData->OutOfOrderCnt++;
+    }
+
+    pCbPrivData->LastSeqID = pEvtDesc->MsgDesc.SeqID;
+    pCbPrivData->KeepAliveEvtCnt++;
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventTypical, Case08_verifyPostEvtsBurst_byOneObjPostEvtsInASyncAndSyncMode_expectInOrderCbProcEvt) {
+    //===SETUP===
+    _Case08_CbPrivData_T ObjA_CbPrivData = {};
+    IOC_EvtID_T ObjA_SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T ObjA_SubEvtArgs = {
+        .CbProcEvt_F = _Case08_CbProcEvt_checkOrder,
+        .pCbPrivData = &ObjA_CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(ObjA_SubEvtIDs),
+        .pEvtIDs = ObjA_SubEvtIDs,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&ObjA_SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_CapabilityDescription_T CapDesc = {.CapID = IOC_CAPID_CONLES_MODE_EVENT};
+    Result = IOC_getCapability(&CapDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+#define _Case08_BurstEvtCnt 16
+#define _Case08_BurstCnt 64
+    //===BEHAVIOR===
+    IOC_EvtDesc_T ObjB_EvtDescs[_Case08_BurstEvtCnt] = {};
+    uint32_t NextEvtValue = 0;
+
+    for (uint32_t BurstIdx = 0; BurstIdx < _Case08_BurstCnt; BurstIdx++) {
+        for (uint32_t i = 0; i < _Case08_BurstEvtCnt; i++) {
+            ObjB_EvtDescs[i].EvtID = IOC_EVTID_TEST_KEEPALIVE;
+            ObjB_EvtDescs[i].EvtValue = NextEvtValue++;
+        }
+
+        IOC_Options_T SyncOption = {.IDs = IOC_OPTID_SYNC_MODE};
+        bool IsSyncMode = (BurstIdx % 2 == 1);
+        Result = IOC_postEVTs_inConlesMode(ObjB_EvtDescs, _Case08_BurstEvtCnt, IsSyncMode ? &SyncOption : NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result) << "BurstIdx=" << BurstIdx;  // CheckPoint
+    }
+
+    IOC_forceProcEVT();
+
+    std::vector<IOC_EvtDesc_T> TooDeepEvtDescs(CapDesc.ConlesModeEvent.DepthEvtDescQueue + 1);
+    for (auto &EvtDesc : TooDeepEvtDescs) {
+        EvtDesc.EvtID = IOC_EVTID_TEST_KEEPALIVE;
+    }
+    IOC_Result_T TooDeepResult = IOC_postEVTs_inConlesMode(TooDeepEvtDescs.data(), TooDeepEvtDescs.size(), NULL);
+
+    //===VERIFY===
+    ASSERT_EQ(_Case08_BurstEvtCnt * _Case08_BurstCnt, ObjA_CbPrivData.KeepAliveEvtCnt);  // KeyVerifyPoint
+    ASSERT_EQ(0, ObjA_CbPrivData.OutOfOrderCnt);                                        // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_TOO_MANY_QUEUING_EVTDESC, TooDeepResult);                       // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_postEVTs_inConlesMode(ObjB_EvtDescs, 0, NULL));
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T ObjA_UnsubEvtArgs = {.CbProcEvt_F = _Case08_CbProcEvt_checkOrder, .pCbPriv = &ObjA_CbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&ObjA_UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+}
+
+/**
+ * @[Name]: verifyMultiAutoLink_bySlowObjBlockedOnAutoLink1_expectFastObjOnAutoLink0NotStalled
+ * @[Purpose]: verify each AutoLinkID has its own EvtDescQueue, EvtSuberList and EvtProcThread,
+ *    so a blocked EvtConsumer on one AutoLinkID never stalls EvtConsumers on another AutoLinkID.
+ * @[Steps]:
+ *   1. getCapability(CONLES_MODE_EVENT) and check AutoLinkNum >= 2.
+ *   2. ObjA subEVT(TEST_SLEEP_999MS) on AUTO_LINK_ID_1, ObjA's CbProcEvt blocks until released.
+ *   3. ObjB subEVT(TEST_KEEPALIVE) on AUTO_LINK_ID_0.
+ *   4. ObjC postEVT(TEST_SLEEP_999MS) to AUTO_LINK_ID_1, and wait ObjA is blocked in CbProcEvt.
+ *   5. ObjC postEVT(TEST_KEEPALIVE) to AUTO_LINK_ID_0 $_Case09_KeepAliveEvtCnt times.
+ *   6. ObjB's CbProcEvt is callbacked $_Case09_KeepAliveEvtCnt times while ObjA is still blocked.
+ *   7. Release ObjA, forceProcEVT and unsubEVT all as CLEANUP.
+ * @[Expect]: Step6 is true, and ObjB does not receive TEST_SLEEP_999MS, ObjA does not receive TEST_KEEPALIVE.
+ * @[Notes]:
+ */
+typedef struct {
+    std::atomic<uint32_t> SleepEvtCnt;
+    std::atomic<uint32_t> KeepAliveEvtCnt;
+    std::atomic<bool> IsBlocked;
+    std::atomic<bool> IsReleased;
+} _Case09_CbPrivData_T;
+
+static IOC_Result_T _Case09_CbProcEvt_blockOrCount(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _Case09_CbPrivData_T *pCbPrivData = (_Case09_CbPrivData_T *)pCbPriv;
+
+    switch (pEvtDesc->EvtID) {
+        case IOC_EVTID_TEST_SLEEP_999MS: {
+            pCbPrivData->SleepEvtCnt++;
+            pCbPrivData->IsBlocked = true;
+            for (int i = 0; i < 5000 && !pCbPrivData->IsReleased; i++) {
+                usleep(1000);
+            }
+            pCbPrivData->IsBlocked = false;
+        } break;
+        case IOC_EVTID_TEST_KEEPALIVE: {
+            pCbPrivData->KeepAliveEvtCnt++;
+        } break;
+        default: {
+            EXPECT_TRUE(false) << "BUG: unexpected EvtID=" << pEvtDesc->EvtID;
+        }
+            return IOC_RESULT_BUG;
+    }
+
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventTypical, Case09_verifyMultiAutoLink_bySlowObjBlockedOnAutoLink1_expectFastObjOnAutoLink0NotStalled) {
+    //===SETUP===
+    IOC_CapabilityDescription_T CapDesc = {.CapID = IOC_CAPID_CONLES_MODE_EVENT};
+    IOC_Result_T Result = IOC_getCapability(&CapDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);              // CheckPoint
+    ASSERT_GE(CapDesc.ConlesModeEvent.AutoLinkNum, 2);  // KeyVerifyPoint
+
+    _Case09_CbPrivData_T ObjA_CbPrivData = {};
+    IOC_EvtID_T ObjA_SubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS};
+    IOC_SubEvtArgs_T ObjA_SubEvtArgs = {
+        .CbProcEvt_F = _Case09_CbProcEvt_blockOrCount,
+        .pCbPrivData = &ObjA_CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(ObjA_SubEvtIDs),
+        .pEvtIDs = ObjA_SubEvtIDs,
+    };
+    Result = IOC_subEVT(IOC_CONLES_MODE_AUTO_LINK_ID_1, &ObjA_SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    _Case09_CbPrivData_T ObjB_CbPrivData = {};
+    IOC_EvtID_T ObjB_SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T ObjB_SubEvtArgs = {
+        .CbProcEvt_F = _Case09_CbProcEvt_blockOrCount,
+        .pCbPrivData = &ObjB_CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(ObjB_SubEvtIDs),
+        .pEvtIDs = ObjB_SubEvtIDs,
+    };
+    Result = IOC_subEVT(IOC_CONLES_MODE_AUTO_LINK_ID_0, &ObjB_SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    IOC_EvtDesc_T ObjC_SleepEvtDesc = {.EvtID = IOC_EVTID_TEST_SLEEP_999MS};
+    Result = IOC_postEVT(IOC_CONLES_MODE_AUTO_LINK_ID_1, &ObjC_SleepEvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    for (int i = 0; i < 1000 && !ObjA_CbPrivData.IsBlocked; i++) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(ObjA_CbPrivData.IsBlocked);  // CheckPoint
+
+#define _Case09_KeepAliveEvtCnt 1024
+    for (uint32_t i = 0; i < _Case09_KeepAliveEvtCnt; i++) {
+        IOC_EvtDesc_T ObjC_KeepAliveEvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE};
+        IOC_Option_defineASyncMayBlock(OptASyncMayBlock);
+        Result = IOC_postEVT(IOC_CONLES_MODE_AUTO_LINK_ID_0, &ObjC_KeepAliveEvtDesc, &OptASyncMayBlock);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    }
+
+    for (int i = 0; i < 1000 && ObjB_CbPrivData.KeepAliveEvtCnt < _Case09_KeepAliveEvtCnt; i++) {
+        usleep(1000);
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(_Case09_KeepAliveEvtCnt, ObjB_CbPrivData.KeepAliveEvtCnt);  // KeyVerifyPoint
+    ASSERT_TRUE(ObjA_CbPrivData.IsBlocked);                               // KeyVerifyPoint
+
+    ObjA_CbPrivData.IsReleased = true;
+    IOC_forceProcEVT();
+
+    ASSERT_EQ(1, ObjA_CbPrivData.SleepEvtCnt);      // KeyVerifyPoint
+    ASSERT_EQ(0, ObjA_CbPrivData.KeepAliveEvtCnt);  // KeyVerifyPoint
+    ASSERT_EQ(0, ObjB_CbPrivData.SleepEvtCnt);      // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T ObjA_UnsubEvtArgs = {.CbProcEvt_F = _Case09_CbProcEvt_blockOrCount, .pCbPriv = &ObjA_CbPrivData};
+    Result = IOC_unsubEVT(IOC_CONLES_MODE_AUTO_LINK_ID_1, &ObjA_UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_UnsubEvtArgs_T ObjB_UnsubEvtArgs = {.CbProcEvt_F = _Case09_CbProcEvt_blockOrCount, .pCbPriv = &ObjB_CbPrivData};
+    Result = IOC_unsubEVT(IOC_CONLES_MODE_AUTO_LINK_ID_0, &ObjB_UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+}
+
+/**
+ * @[Name]: verifyWorkerPool_bySlowObjBlockedInWorker_expectFastObjOnSameAutoLinkNotStalledAndInOrder
+ * @[Purpose]: verify EvtConsumers subEVT with IOC_SUBEVT_FLAG_WORKER_POOL are callbacked by worker threads,
+ *    so a blocked EvtConsumer never stalls other EvtConsumers even on the SAME AutoLinkID,
+ *    while each EvtConsumer still receives its events in posted order.
+ * @[Steps]:
+ *   1. ObjA subEVT(TEST_SLEEP_999MS) with WORKER_POOL on AUTO_LINK_ID_0, ObjA's CbProcEvt blocks until released.
+ *   2. ObjB subEVT(TEST_KEEPALIVE) with WORKER_POOL on AUTO_LINK_ID_0, ObjB's CbProcEvt checks EvtValue in order.
+ *   3. ObjC postEVT(TEST_SLEEP_999MS) and wait ObjA is blocked in CbProcEvt.
+ *   4. ObjC postEVT(TEST_KEEPALIVE) with EvtValue=0..$_Case10_KeepAliveEvtCnt-1.
+ *   5. ObjB's CbProcEvt is callbacked $_Case10_KeepAliveEvtCnt times in order while ObjA is still blocked.
+ *   6. Release ObjA, forceProcEVT and unsubEVT all as CLEANUP.
+ * @[Expect]: Step5 is true, and forceProcEVT returns after ObjA's CbProcEvt returned.
+ * @[Notes]:
+ */
+typedef struct {
+    std::atomic<uint32_t> SleepEvtCnt;
+    std::atomic<uint32_t> KeepAliveEvtCnt;
+    std::atomic<uint32_t> OutOfOrderEvtCnt;
+    std::atomic<bool> IsBlocked;
+    std::atomic<bool> IsReleased;
+} _Case10_CbPrivData_T;
+
+static IOC_Result_T _Case10_CbProcEvt_blockOrCountInOrder(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _Case10_CbPrivData_T *pCbPrivData = (_Case10_CbPrivData_T *)pCbPriv;
+
+    switch (pEvtDesc->EvtID) {
+        case IOC_EVTID_TEST_SLEEP_999MS: {
+            pCbPrivData->IsBlocked = true;
+            for (int i = 0; i < 5000 && !pCbPrivData->IsReleased; i++) {
+                usleep(1000);
+            }
+            pCbPrivData->SleepEvtCnt++;
+            pCbPrivData->IsBlocked = false;
+        } break;
+        case IOC_EVTID_TEST_KEEPALIVE: {
+            if (pEvtDesc->EvtValue != pCbPrivData->KeepAliveEvtCnt) {
+                pCbPrivData->OutOfOrderEvtCnt++;
+            }
+            pCbPrivData->KeepAliveEvtCnt++;
+        } break;
+        default: {
+            EXPECT_TRUE(false) << "BUG: unexpected EvtID=" << pEvtDesc->EvtID;
+        }
+            return IOC_RESULT_BUG;
+    }
+
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ConlesEventTypical, Case10_verifyWorkerPool_bySlowObjBlockedInWorker_expectFastObjOnSameAutoLinkNotStalledAndInOrder) {
+    //===SETUP===
+    _Case10_CbPrivData_T ObjA_CbPrivData = {};
+    IOC_EvtID_T ObjA_SubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS};
+    IOC_SubEvtArgs_T ObjA_SubEvtArgs = {
+        .CbProcEvt_F = _Case10_CbProcEvt_blockOrCountInOrder,
+        .pCbPrivData = &ObjA_CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(ObjA_SubEvtIDs),
+        .pEvtIDs = ObjA_SubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&ObjA_SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    _Case10_CbPrivData_T ObjB_CbPrivData = {};
+    IOC_EvtID_T ObjB_SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T ObjB_SubEvtArgs = {
+        .CbProcEvt_F = _Case10_CbProcEvt_blockOrCountInOrder,
+        .pCbPrivData = &ObjB_CbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(ObjB_SubEvtIDs),
+        .pEvtIDs = ObjB_SubEvtIDs,
+        .Flags = IOC_SUBEVT_FLAG_WORKER_POOL,
+    };
+    Result = IOC_subEVT_inConlesMode(&ObjB_SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    //===BEHAVIOR===
+    IOC_EvtDesc_T ObjC_SleepEvtDesc = {.EvtID = IOC_EVTID_TEST_SLEEP_999MS};
+    Result = IOC_postEVT_inConlesMode(&ObjC_SleepEvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    for (int i = 0; i < 1000 && !ObjA_CbPrivData.IsBlocked; i++) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(ObjA_CbPrivData.IsBlocked);  // CheckPoint
+
+#define _Case10_KeepAliveEvtCnt 1024
+    for (uint32_t i = 0; i < _Case10_KeepAliveEvtCnt; i++) {
+        IOC_EvtDesc_T ObjC_KeepAliveEvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = i};
+        IOC_Option_defineASyncMayBlock(OptASyncMayBlock);
+        Result = IOC_postEVT_inConlesMode(&ObjC_KeepAliveEvtDesc, &OptASyncMayBlock);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    }
+
+    for (int i = 0; i < 1000 && ObjB_CbPrivData.KeepAliveEvtCnt < _Case10_KeepAliveEvtCnt; i++) {
+        usleep(1000);
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(_Case10_KeepAliveEvtCnt, ObjB_CbPrivData.KeepAliveEvtCnt);  // KeyVerifyPoint
+    ASSERT_EQ(0, ObjB_CbPrivData.OutOfOrderEvtCnt);                       // KeyVerifyPoint
+    ASSERT_TRUE(ObjA_CbPrivData.IsBlocked);                               // KeyVerifyPoint
+    ASSERT_EQ(0, ObjA_CbPrivData.SleepEvtCnt);                            // KeyVerifyPoint
+
+    ObjA_CbPrivData.IsReleased = true;
+    IOC_forceProcEVT();
+
+    ASSERT_EQ(1, ObjA_CbPrivData.SleepEvtCnt);      // KeyVerifyPoint
+    ASSERT_EQ(0, ObjA_CbPrivData.KeepAliveEvtCnt);  // KeyVerifyPoint
+    ASSERT_EQ(0, ObjB_CbPrivData.SleepEvtCnt);      // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T ObjA_UnsubEvtArgs = {.CbProcEvt_F = _Case10_CbProcEvt_blockOrCountInOrder,
+                                            .pCbPriv = &ObjA_CbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&ObjA_UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_UnsubEvtArgs_T ObjB_UnsubEvtArgs = {.CbProcEvt_F = _Case10_CbProcEvt_blockOrCountInOrder,
+                                            .pCbPriv = &ObjB_CbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&ObjB_UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+}
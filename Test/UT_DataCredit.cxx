@@ -0,0 +1,381 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * DatCredit is the window of data a DatSender may have in flight to its DatReceiver, in chunks and bytes,
+ *  granted by the DatReceiver by IOC_DatUsageArgs_T::Credit, or fit to its polling buffer if it polls by IOC_recvDAT.
+ * DatSender spends credits locally before each send, and only if they're used up,
+ *  IOC_sendDAT in NonBlock mode returns BUFFER_FULL, and otherwise waits for credits within its timeout,
+ *  which DatReceiver returns as it consumes data, both in FIFO and TCP. So data is NEVER dropped(NODROP),
+ *  nor buffered unboundedly. Only FIFO to a polling DatReceiver doesn't wait without a timeout option,
+ *  as IOC_recvDAT MAY never be called.
+ *
+ * RefDoc:
+ *  1) IOC_SrvTypes.h::IOC_DatUsageArgs_T::Credit
+ *  2) Source/_IOC_DatCredit.h
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender who MUST NOT block,
+ *        I WANT TO get BUFFER_FULL as soon as my DatReceiver's credits are used up,
+ *        SO THAT I can do something else and send again after it consumes data.
+ *  US-2: AS a DatSender who may block,
+ *        I WANT TO wait only until my DatReceiver returns credits,
+ *        SO THAT I send as fast as it consumes, without losing any data, even to a small polling buffer.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with CbRecvDat_F held and Credit.MaxDatNum=2,
+ *         WHEN DatSender sends chunks in NonBlock mode,
+ *         THEN the 3rd chunk gets BUFFER_FULL,
+ *          AND it's sent successfully once CbRecvDat_F is released.
+ * AC-2@US-1: GIVEN DatReceiver's TCP link polling with PollingBufSize=4KB and nobody receiving,
+ *         WHEN DatSender sends 100 bytes chunks in NonBlock mode,
+ *         THEN IOC_sendDAT returns BUFFER_FULL before 4KB is sent,
+ *          AND DatSender sends successfully again after DatReceiver receives all chunks.
+ * AC-1@US-2: GIVEN DatReceiver's FIFO link with CbRecvDat_F held and Credit.MaxDatNum=2,
+ *         WHEN DatSender sends the 3rd chunk in blocking mode,
+ *         THEN IOC_sendDAT waits until CbRecvDat_F is released, and returns SUCCESS,
+ *          AND CbRecvDat_F gets all 3 chunks in order.
+ * AC-2@US-2: GIVEN DatReceiver's FIFO or TCP link polling with PollingBufSize=4KB,
+ *         WHEN DatSender sends 1KB chunks with a timeout while DatReceiver slowly polls them,
+ *         THEN every chunk is sent successfully and received in send order.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyDatCredit_byNonBlockSendToHeldCallback_expectBufferFullThenSuccess
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyDatCredit_byNonBlockSendToTCPPollingWithoutRecv_expectBufferFullThenSuccess
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyDatCredit_byBlockingSendToHeldCallback_expectWaitThenSuccess
+ *
+ * 【@AC-2@US-2】
+ *   TC-2.1:
+ *      @[Name]: verifyDatCredit_byBlockingSendToFifoSlowPolling_expectAllChunksInOrder
+ *   TC-2.2:
+ *      @[Name]: verifyDatCredit_byBlockingSendToTCPSlowPolling_expectAllChunksInOrder
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<bool> IsHeld;
+    std::atomic<int> RecvChunkNum;
+    std::vector<char> FirstBytes;  // First byte of each chunk, only written by the callback
+} _DatCreditRecvPriv_T;
+
+static IOC_Result_T _DatCreditCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    (void)LinkID;
+    _DatCreditRecvPriv_T *pPriv = (_DatCreditRecvPriv_T *)pCbPriv;
+    while (pPriv->IsHeld) {
+        usleep(1000);
+    }
+
+    void *pData = NULL;
+    ULONG_T DataSize = 0;
+    IOC_getDatPayload(pDatDesc, &pData, &DataSize);
+    pPriv->FirstBytes.push_back(((char *)pData)[0]);
+    pPriv->RecvChunkNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _DatCreditSetupLink(IOC_SrvURI_T *pSrvURI, IOC_DatUsageArgs_T *pDatUsageArgs, IOC_SrvID_T *pSrvID,
+                                IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = pDatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _DatCreditSend(IOC_LinkID_T LinkID, const void *pData, ULONG_T DataSize,
+                                   IOC_Options_pT pOption) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)pData;
+    DatDesc.Payload.PtrDataSize = DataSize;
+    DatDesc.Payload.PtrDataLen = DataSize;
+    return IOC_sendDAT(LinkID, &DatDesc, pOption);
+}
+
+static IOC_Result_T _DatCreditRecv(IOC_LinkID_T LinkID, void *pBuf, ULONG_T BufSize, ULONG_T *pRecvSize) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = pBuf;
+    DatDesc.Payload.PtrDataSize = BufSize;
+    IOC_Option_defineTimeout(RecvOption, 3000000);
+    IOC_Result_T Result = IOC_recvDAT(LinkID, &DatDesc, &RecvOption);
+    *pRecvSize = DatDesc.Payload.PtrDataSize;
+    return Result;
+}
+
+TEST(UT_DataCredit, verifyDatCredit_byNonBlockSendToHeldCallback_expectBufferFullThenSuccess) {
+    //===SETUP===
+    _DatCreditRecvPriv_T RecvPriv;
+    RecvPriv.IsHeld = true;
+    RecvPriv.RecvChunkNum = 0;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _DatCreditCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Credit.MaxDatNum = 2;
+
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataCredit_US1_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _DatCreditSetupLink(&SrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    IOC_Option_defineNonBlock(SendOption);
+    char Chunk[64] = {};
+    for (int i = 0; i < 2; i++) {
+        Chunk[0] = (char)i;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _DatCreditSend(SenderLinkID, Chunk, sizeof(Chunk), &SendOption));
+    }
+    Chunk[0] = 2;
+    IOC_Result_T Result = _DatCreditSend(SenderLinkID, Chunk, sizeof(Chunk), &SendOption);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_BUFFER_FULL, Result);  // KeyVerifyPoint: window of 2 chunks is used up
+
+    RecvPriv.IsHeld = false;
+    for (int Retry = 0; Retry < 1000; Retry++) {
+        Result = _DatCreditSend(SenderLinkID, Chunk, sizeof(Chunk), &SendOption);
+        if (Result != IOC_RESULT_BUFFER_FULL) break;
+        usleep(1000);
+    }
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint: credits returned by the callback
+
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));
+    for (int Retry = 0; Retry < 1000 && RecvPriv.RecvChunkNum < 3; Retry++) {
+        usleep(1000);
+    }
+    ASSERT_EQ(3, RecvPriv.RecvChunkNum);
+    ASSERT_EQ(std::vector<char>({0, 1, 2}), RecvPriv.FirstBytes);  // KeyVerifyPoint: NODROP in order
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataCredit, verifyDatCredit_byNonBlockSendToTCPPollingWithoutRecv_expectBufferFullThenSuccess) {
+    //===SETUP===
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.PollingBufSize = 4096;  // polling mode
+
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataCredit_US1_TC2_1",
+        .Port = 19105,
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _DatCreditSetupLink(&SrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const ULONG_T ChunkSize = 100;
+    IOC_Option_defineNonBlock(SendOption);
+    int SentChunkNum = 0;
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    for (; SentChunkNum < 4096 / (int)ChunkSize; SentChunkNum++) {
+        std::vector<char> Chunk(ChunkSize, (char)SentChunkNum);
+        Result = _DatCreditSend(SenderLinkID, Chunk.data(), ChunkSize, &SendOption);
+        if (Result != IOC_RESULT_SUCCESS) break;
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_BUFFER_FULL, Result);  // KeyVerifyPoint: long before the socket buffer is full
+    ASSERT_GT(SentChunkNum, 0);
+
+    for (int i = 0; i < SentChunkNum; i++) {
+        char RecvBuf[ChunkSize] = {};
+        ULONG_T RecvSize = 0;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _DatCreditRecv(ReceiverLinkID, RecvBuf, ChunkSize, &RecvSize));
+        ASSERT_EQ(ChunkSize, RecvSize);
+        ASSERT_EQ((char)i, RecvBuf[0]);  // KeyVerifyPoint: NODROP in order
+    }
+
+    std::vector<char> Chunk(ChunkSize, (char)SentChunkNum);
+    for (int Retry = 0; Retry < 1000; Retry++) {
+        Result = _DatCreditSend(SenderLinkID, Chunk.data(), ChunkSize, &SendOption);
+        if (Result != IOC_RESULT_BUFFER_FULL) break;
+        usleep(1000);
+    }
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint: credits returned over TCP
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataCredit, verifyDatCredit_byBlockingSendToHeldCallback_expectWaitThenSuccess) {
+    //===SETUP===
+    _DatCreditRecvPriv_T RecvPriv;
+    RecvPriv.IsHeld = true;
+    RecvPriv.RecvChunkNum = 0;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _DatCreditCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Credit.MaxDatNum = 2;
+
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataCredit_US2_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _DatCreditSetupLink(&SrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    char Chunk[64] = {};
+    for (int i = 0; i < 2; i++) {
+        Chunk[0] = (char)i;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _DatCreditSend(SenderLinkID, Chunk, sizeof(Chunk), NULL));
+    }
+
+    //===BEHAVIOR===
+    std::atomic<bool> IsSent(false);
+    IOC_Result_T SendResult = IOC_RESULT_BUG;
+    std::thread SenderThread([&] {
+        char ThirdChunk[64] = {2};
+        SendResult = _DatCreditSend(SenderLinkID, ThirdChunk, sizeof(ThirdChunk), NULL);
+        IsSent = true;
+    });
+
+    //===VERIFY===
+    usleep(50000);
+    ASSERT_FALSE(IsSent);  // KeyVerifyPoint: waits for credits
+
+    RecvPriv.IsHeld = false;
+    for (int Retry = 0; Retry < 1000 && !IsSent; Retry++) {
+        usleep(1000);
+    }
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, SendResult);  // KeyVerifyPoint
+
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));
+    for (int Retry = 0; Retry < 1000 && RecvPriv.RecvChunkNum < 3; Retry++) {
+        usleep(1000);
+    }
+    ASSERT_EQ(std::vector<char>({0, 1, 2}), RecvPriv.FirstBytes);  // KeyVerifyPoint: NODROP in order
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+static void _DatCreditVerifySlowPolling(IOC_SrvURI_T *pSrvURI) {
+    //===SETUP===
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.PollingBufSize = 4096;  // polling mode
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _DatCreditSetupLink(pSrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    const ULONG_T ChunkSize = 1024;
+    const int ChunkNum = 200;
+
+    //===BEHAVIOR===
+    std::atomic<int> SentChunkNum(0);
+    IOC_Result_T SendResult = IOC_RESULT_SUCCESS;
+    std::thread SenderThread([&] {
+        IOC_Option_defineTimeout(SendOption, 3000000);  // Without a timeout, FIFO won't wait for IOC_recvDAT
+        for (int i = 0; i < ChunkNum && SendResult == IOC_RESULT_SUCCESS; i++) {
+            std::vector<char> Chunk(ChunkSize, (char)i);
+            SendResult = _DatCreditSend(SenderLinkID, Chunk.data(), ChunkSize, &SendOption);
+            SentChunkNum++;
+        }
+    });
+
+    std::vector<char> RecvBytes;
+    IOC_Result_T RecvResult = IOC_RESULT_SUCCESS;
+    while (RecvBytes.size() < ChunkSize * ChunkNum && RecvResult == IOC_RESULT_SUCCESS) {
+        if (RecvBytes.size() % (16 * ChunkSize) == 0) usleep(5000);  // Slower than DatSender now and then
+
+        char RecvBuf[ChunkSize];
+        ULONG_T RecvSize = 0;
+        RecvResult = _DatCreditRecv(ReceiverLinkID, RecvBuf, sizeof(RecvBuf), &RecvSize);
+        RecvBytes.insert(RecvBytes.end(), RecvBuf, RecvBuf + RecvSize);
+    }
+    SenderThread.join();
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, SendResult);  // KeyVerifyPoint: waits for credits instead of BUFFER_FULL
+    ASSERT_EQ(IOC_RESULT_SUCCESS, RecvResult);
+    ASSERT_EQ(ChunkSize * ChunkNum, RecvBytes.size());  // KeyVerifyPoint: NODROP
+    for (int i = 0; i < ChunkNum; i++) {
+        ASSERT_EQ((char)i, RecvBytes[i * ChunkSize]);  // KeyVerifyPoint: in order
+        ASSERT_EQ((char)i, RecvBytes[i * ChunkSize + ChunkSize - 1]);
+    }
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataCredit, verifyDatCredit_byBlockingSendToFifoSlowPolling_expectAllChunksInOrder) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataCredit_US2_TC2_1",
+    };
+    _DatCreditVerifySlowPolling(&SrvURI);
+}
+
+TEST(UT_DataCredit, verifyDatCredit_byBlockingSendToTCPSlowPolling_expectAllChunksInOrder) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataCredit_US2_TC2_2",
+        .Port = 19106,
+    };
+    _DatCreditVerifySlowPolling(&SrvURI);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -358,7 +358,6 @@ typedef struct {
 // Callback function for receiving data
 static IOC_Result_T __CbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
     __DatReceiverPrivData_T *pPrivData = (__DatReceiverPrivData_T *)pCbPriv;
-    pPrivData->CallbackExecuted = true;
     pPrivData->ReceivedDataCnt++;
 
     ULONG_T DataSize = pDatDesc->Payload.PtrDataLen;
@@ -367,6 +366,7 @@ static IOC_Result_T __CbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc,
     }
 
     pPrivData->TotalReceivedSize += DataSize;
+    pPrivData->CallbackExecuted = true;  // set last, tests wait on it then check what's received
 
     printf("   [TCP DAT Callback] Client[%d] received %lu bytes, total: %lu bytes\n", pPrivData->ClientIndex, DataSize,
            pPrivData->TotalReceivedSize);
@@ -58,6 +58,7 @@
 //======>END OF US-3 TEST CASES====================================================================
 
 #include <cmath>
+#include <condition_variable>
 
 #include "UT_DataEdge.h"
 
@@ -72,11 +73,13 @@
  *      |-> Create DatSender and DatReceiver services
  *      |-> Establish link between sender and receiver
  *      |-> Initialize private data for boundary testing
+ *      |-> Grant a credit window of ONE chunk, and block its callback on a latch
  *   2) Test IOC_sendDAT with zero timeout AS BEHAVIOR
- *      |-> Configure zero timeout option (IOC_TIMEOUT_IMMEDIATE)
- *      |-> Send data with zero timeout, measure timing
+ *      |-> Configure zero timeout option (IOC_TIMEOUT_NONBLOCK)
+ *      |-> Send data with zero timeout, measure timing, which spends the window
  *      |-> Verify immediate return without blocking
- *      |-> Test multiple consecutive zero timeout calls
+ *      |-> Test multiple consecutive zero timeout calls, each BUFFER_FULL while the callback holds the window
+ *      |-> Open the latch, which returns the window
  *   3) Test IOC_recvDAT with zero timeout AS BEHAVIOR
  *      |-> Configure zero timeout option for receiving
  *      |-> Call recvDAT with zero timeout, measure timing
@@ -90,6 +93,26 @@
  * @[Expect]: Zero timeout operations return immediately with proper result codes, no blocking behavior.
  * @[Notes]: Critical for real-time applications - validates AC-1 zero timeout boundary requirements.
  */
+// Receiver callback blocked on a latch, so the chunk it got keeps the DatSender's credit window spent
+typedef struct {
+    __DatEdgePrivData_T EdgePrivData;
+    std::mutex Mutex;
+    std::condition_variable Cond;
+    ULONG_T EnteredCnt;
+    bool IsOpen;
+} __DatEdgeLatchPrivData_T;
+
+static IOC_Result_T __CbRecvDat_EdgeLatch_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    __DatEdgeLatchPrivData_T *pPrivData = (__DatEdgeLatchPrivData_T *)pCbPriv;
+    IOC_Result_T Result = __CbRecvDat_Edge_F(LinkID, pDatDesc, &pPrivData->EdgePrivData);
+
+    std::unique_lock<std::mutex> Lock(pPrivData->Mutex);
+    pPrivData->EnteredCnt++;
+    pPrivData->Cond.notify_all();
+    pPrivData->Cond.wait(Lock, [pPrivData] { return pPrivData->IsOpen; });
+    return Result;
+}
+
 TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     // ┌──────────────────────────────────────────────────────────────────────────────────────┐
     // │                                🔧 SETUP PHASE                                        │
@@ -104,8 +127,8 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     const int CONSISTENCY_TEST_CALLS = 5;
 
     // Initialize test data structures
-    __DatEdgePrivData_T DatReceiverPrivData = {0};
-    DatReceiverPrivData.ClientIndex = 1;
+    __DatEdgeLatchPrivData_T DatReceiverPrivData{};
+    DatReceiverPrivData.EdgePrivData.ClientIndex = 1;
 
     IOC_SrvID_T DatReceiverSrvID = IOC_ID_INVALID;
     IOC_LinkID_T DatSenderLinkID = IOC_ID_INVALID;
@@ -122,9 +145,11 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     };
 
     IOC_DatUsageArgs_T DatReceiverUsageArgs = {
-        .CbRecvDat_F = __CbRecvDat_Edge_F,
+        .CbRecvDat_F = __CbRecvDat_EdgeLatch_F,
         .pCbPrivData = &DatReceiverPrivData,
     };
+    // ONE chunk in flight at most, which the latched callback holds till the latch is opened
+    DatReceiverUsageArgs.Credit.MaxDatNum = 1;
 
     IOC_SrvArgs_T DatReceiverSrvArgs = {
         .SrvURI = DatReceiverSrvURI,
@@ -193,9 +218,16 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     ASSERT_LT(duration.count(), MAX_EXECUTION_TIME_US)
         << "Zero timeout operation should complete within " << MAX_EXECUTION_TIME_US << "μs";
 
-    // FIRST sendDAT with zero timeout should SUCCESS mostly, BUFFER_FULL, or NO_DATA
-    ASSERT_TRUE(Result == IOC_RESULT_SUCCESS || Result == IOC_RESULT_BUFFER_FULL || Result == IOC_RESULT_NO_DATA)
-        << "Zero timeout sendDAT should return SUCCESS, BUFFER_FULL, or NO_DATA, got: " << Result;
+    // FIRST sendDAT with zero timeout spends the whole credit window
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result) << "Zero timeout sendDAT within credits should return SUCCESS";
+
+    {
+        // Its callback holds the window from now on, till the latch is opened
+        std::unique_lock<std::mutex> Lock(DatReceiverPrivData.Mutex);
+        ASSERT_TRUE(DatReceiverPrivData.Cond.wait_for(Lock, std::chrono::seconds(1),
+                                                      [&] { return DatReceiverPrivData.EnteredCnt == 1; }))
+            << "Receiver callback should get the first chunk";
+    }
 
     printf("   ✓ Zero timeout sendDAT behaved correctly\n");
 
@@ -236,6 +268,7 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     }
 
     printf("   📤 Sent %d packets (%d KB) for buffer state setup\n", sentCount, sentCount);
+    ASSERT_EQ(0, sentCount) << "Credit window is spent by the latched callback, NonBlock sendDAT should get BUFFER_FULL";
 
     // Test 3: Zero timeout sendDAT timing guarantee (core TDD requirement)
     printf("🧪 Test 3: Zero timeout sendDAT timing guarantee...\n");
@@ -252,15 +285,8 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
     ASSERT_LT(fullBufferDuration.count(), 10000)
         << "CORE TDD REQUIREMENT: Zero timeout sendDAT must complete within 10ms regardless of buffer state";
 
-    // Zero timeout is NONBLOCK, so it should return BUFFER_FULL instand of TIMEOUT is reasonable
-    ASSERT_TRUE(Result == IOC_RESULT_SUCCESS || Result == IOC_RESULT_BUFFER_FULL)
-        << "Zero timeout sendDAT should return SUCCESS or BUFFER_FULL, got: " << Result;
-
-    if (Result == IOC_RESULT_TIMEOUT) {
-        printf("   ✓ Zero timeout returned TIMEOUT correctly - consistent zero timeout semantics\n");
-    } else {
-        printf("   ❌ Unexpected result for zero timeout: %d\n", Result);
-    }
+    // Zero timeout is NONBLOCK, so it returns BUFFER_FULL instead of TIMEOUT once credits are used up
+    ASSERT_EQ(IOC_RESULT_BUFFER_FULL, Result) << "Zero timeout sendDAT without credits should return BUFFER_FULL";
 
     // Test 3: Multiple consecutive zero timeout calls - consistency verification
     printf("🧪 Test 3: Multiple consecutive zero timeout calls...\n");
@@ -280,9 +306,17 @@ TEST(UT_DataEdge, verifyDatTimeoutEdge_byZeroTimeout_expectImmediateReturn) {
         // Each call must complete quickly and return consistent results
         ASSERT_LT(callDuration.count(), MAX_EXECUTION_TIME_US)
             << "Zero timeout call " << i + 1 << " must complete within timing limit";
+        // DatReceiver's credits bound data in flight, still held by the latched callback
         ASSERT_EQ(IOC_RESULT_BUFFER_FULL, callResult) << "Zero timeout call " << i + 1 << " should return BUFFER_FULL";
     }
 
+    {
+        // Let the callback return, which returns the credit window
+        std::lock_guard<std::mutex> Lock(DatReceiverPrivData.Mutex);
+        DatReceiverPrivData.IsOpen = true;
+        DatReceiverPrivData.Cond.notify_all();
+    }
+
     // Allow some time for buffer to drain before continuing
     printf("   ⏳ Allowing buffer to drain...\n");
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
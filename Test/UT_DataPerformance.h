@@ -117,6 +117,13 @@
  *              AND memory allocation overhead should be minimized
  *              AND batch completion time should scale sub-linearly.
  *
+ *  AC-4: GIVEN a DatReceiver with CbRecvDat_F on a FIFO link,
+ *         WHEN DatSender sends back-to-back in blocking mode,
+ *         THEN callbacks should run on a persistent dispatcher instead of one thread per send
+ *              AND sends/s should be higher than a thread-per-send dispatch
+ *              AND callbacks should keep send order
+ *              AND queue depth should be bounded and reported by IOC_getDatDispatchStats.
+ *
  *---------------------------------------------------------------------------------------------------
  * [@US-2] Low-latency DAT operations verification
  *  AC-1: GIVEN a DAT link optimized for minimal latency,
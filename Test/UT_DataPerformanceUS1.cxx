@@ -56,6 +56,13 @@
  *      @[Brief]: 测试不同负载大小的吞吐量扩展关系，验证效率提升
  *      @[Scaling_Focus]: 测试负载大小对传输效率的影响和扩展性
  *
+ * [@AC-4,US-1] Persistent dispatcher for async data callbacks
+ *  TC-3:
+ *      @[Name]: verifyDispatchRate_byBackToBackSends_expectFasterThanThreadPerSend
+ *      @[Purpose]: 验证常驻分发线程比每次发送创建线程的回调分发更快，且保持顺序、队列有界
+ *      @[Brief]: 先用测试内的每次发送一个线程方式作为基线，再用IOC_sendDAT发送同样数量的数据，比较sends/s
+ *      @[Dispatch_Focus]: sends/s前后对比、回调顺序、IOC_getDatDispatchStats的队列深度
+ *
  * 注意：完整的 US & AC 需求定义请参见 UT_DataPerformance.h
  *************************************************************************************************/
 //======>END OF TEST CASE IMPLEMENTATION===========================================================
@@ -341,5 +348,172 @@ TEST_F(UT_DataPerformanceUS1Fixture, verifyThroughputScaling_byPayloadSize_expec
     // Cleanup handled by TearDown()
 }
 
+typedef struct {
+    std::atomic<ULONG_T> RecvDatNum{0};
+    std::atomic<ULONG_T> LastSeqID{0};
+    std::atomic<bool> IsOutOfOrder{false};
+} __DispatchRatePrivData_T;
+
+static IOC_Result_T __CbRecvDat_checkSeqID(IOC_LinkID_T LinkID, const IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    (void)LinkID;
+    __DispatchRatePrivData_T *pPrivData = (__DispatchRatePrivData_T *)pCbPriv;
+
+    ULONG_T SeqID = 0;
+    memcpy(&SeqID, pDatDesc->Payload.pData, sizeof(SeqID));
+    if (SeqID != pPrivData->LastSeqID.load() + 1) {
+        pPrivData->IsOutOfOrder = true;
+    }
+    pPrivData->LastSeqID = SeqID;
+    pPrivData->RecvDatNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+/**
+ * ╔══════════════════════════════════════════════════════════════════════════════════════════╗
+ * ║                        🧵 DISPATCH RATE VERIFICATION                                    ║
+ * ╠══════════════════════════════════════════════════════════════════════════════════════════╣
+ * ║ @[Name]: verifyDispatchRate_byBackToBackSends_expectFasterThanThreadPerSend             ║
+ * ║ @[Steps]: 🔧 setup receiver with CbRecvDat_F → 🎯 thread-per-send baseline, then        ║
+ * ║          IOC_sendDAT back-to-back → ✅ verify sends/s, order and stats → 🧹 cleanup      ║
+ * ║ @[Expect]: IOC_sendDAT sends/s > thread-per-send sends/s, in order, HighWatermark bound  ║
+ * ║ @[Notes]: Payload is larger than the 16KB batch buffer, so every send is dispatched      ║
+ * ╚══════════════════════════════════════════════════════════════════════════════════════════╝
+ */
+TEST(UT_DataPerformance, verifyDispatchRate_byBackToBackSends_expectFasterThanThreadPerSend) {
+    // ┌──────────────────────────────────────────────────────────────────────────────────────┐
+    // │                                🔧 SETUP PHASE                                        │
+    // └──────────────────────────────────────────────────────────────────────────────────────┘
+    printf("🧪 [TEST] verifyDispatchRate_byBackToBackSends_expectFasterThanThreadPerSend\n");
+
+    const ULONG_T SendNum = 2000;
+    const size_t PayloadSize = 32 * 1024;
+    const auto WaitTimeout = std::chrono::seconds(30);
+
+    __DispatchRatePrivData_T BaselinePrivData;
+    __DispatchRatePrivData_T DispatcherPrivData;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {.CbRecvDat_F = __CbRecvDat_checkSeqID, .pCbPrivData = &DispatcherPrivData};
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_FIFO;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "test/performance/dispatch_rate";
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+    SrvArgs.Flags = IOC_SRVFLAG_AUTO_ACCEPT;
+
+    IOC_Result_T Result = IOC_onlineService(&SrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = SrvArgs.SrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    Result = IOC_connectService(&SenderLinkID, &ConnArgs, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_LinkID_T ReceiverLinkID = IOC_ID_INVALID;
+    uint16_t LinkNum = 0;
+    for (int i = 0; i < 100 && 0 == LinkNum; i++) {
+        IOC_getServiceLinkIDs(SrvID, &ReceiverLinkID, 1, &LinkNum);
+        if (0 == LinkNum) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1, LinkNum) << "AutoAccept should have accepted the DatSender";
+
+    std::vector<char> TestData = CreatePerformanceTestData(PayloadSize, false);
+
+    // ┌──────────────────────────────────────────────────────────────────────────────────────┐
+    // │                               🎯 BEHAVIOR PHASE                                       │
+    // └──────────────────────────────────────────────────────────────────────────────────────┘
+    // BEFORE: one malloc+memcpy and one detached thread per send, as FIFO dispatched callbacks before
+    auto BaselineStart = std::chrono::steady_clock::now();
+    for (ULONG_T SeqID = 1; SeqID <= SendNum; SeqID++) {
+        memcpy(TestData.data(), &SeqID, sizeof(SeqID));
+
+        char *pDataCopy = (char *)malloc(PayloadSize);
+        ASSERT_NE(nullptr, pDataCopy);
+        memcpy(pDataCopy, TestData.data(), PayloadSize);
+
+        std::thread([pDataCopy, PayloadSize, &BaselinePrivData]() {
+            IOC_DatDesc_T DatDesc = {};
+            IOC_initDatDesc(&DatDesc);
+            DatDesc.Payload.pData = pDataCopy;
+            DatDesc.Payload.PtrDataSize = PayloadSize;
+            DatDesc.Payload.PtrDataLen = PayloadSize;
+            __CbRecvDat_checkSeqID(IOC_ID_INVALID, &DatDesc, &BaselinePrivData);
+            free(pDataCopy);
+        }).detach();
+    }
+    while (BaselinePrivData.RecvDatNum.load() < SendNum &&
+           std::chrono::steady_clock::now() - BaselineStart < WaitTimeout) {
+        std::this_thread::yield();
+    }
+    double BaselineSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - BaselineStart).count();
+
+    // AFTER: IOC_sendDAT queues to the receiver's persistent dispatcher
+    auto DispatcherStart = std::chrono::steady_clock::now();
+    for (ULONG_T SeqID = 1; SeqID <= SendNum; SeqID++) {
+        memcpy(TestData.data(), &SeqID, sizeof(SeqID));
+
+        IOC_DatDesc_T DatDesc = {};
+        IOC_initDatDesc(&DatDesc);
+        DatDesc.Payload.pData = TestData.data();
+        DatDesc.Payload.PtrDataSize = PayloadSize;
+        DatDesc.Payload.PtrDataLen = PayloadSize;
+
+        Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result) << "SeqID=" << SeqID;
+    }
+    while (DispatcherPrivData.RecvDatNum.load() < SendNum &&
+           std::chrono::steady_clock::now() - DispatcherStart < WaitTimeout) {
+        std::this_thread::yield();
+    }
+    double DispatcherSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - DispatcherStart).count();
+
+    double BaselineSendsPerSec = SendNum / BaselineSec;
+    double DispatcherSendsPerSec = SendNum / DispatcherSec;
+    printf("📈 [RESULT] Thread-per-send: %.0f sends/s, Persistent dispatcher: %.0f sends/s (x%.2f)\n",
+           BaselineSendsPerSec, DispatcherSendsPerSec, DispatcherSendsPerSec / BaselineSendsPerSec);
+
+    IOC_DatDispatchStats_T DispatchStats = {};
+    for (int i = 0; i < 100; i++) {
+        Result = IOC_getDatDispatchStats(ReceiverLinkID, &DispatchStats);
+        if (Result != IOC_RESULT_SUCCESS || DispatchStats.DispatchedDatNum == SendNum) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    printf("📊 [STATS] Capacity=%lu, HighWatermark=%lu, Blocked=%lu, Overflow=%lu, Dispatched=%lu\n",
+           DispatchStats.Capacity, DispatchStats.HighWatermark, DispatchStats.BlockedDatNum,
+           DispatchStats.OverflowDatNum, DispatchStats.DispatchedDatNum);
+
+    // ┌──────────────────────────────────────────────────────────────────────────────────────┐
+    // │                                ✅ VERIFY PHASE                                        │
+    // └──────────────────────────────────────────────────────────────────────────────────────┘
+    //@KeyVerifyPoint-1: Every send is callbacked exactly once in send order
+    ASSERT_EQ(SendNum, BaselinePrivData.RecvDatNum.load());
+    ASSERT_EQ(SendNum, DispatcherPrivData.RecvDatNum.load());
+    ASSERT_FALSE(DispatcherPrivData.IsOutOfOrder.load());
+
+    //@KeyVerifyPoint-2: Persistent dispatcher beats a thread per send
+    EXPECT_GT(DispatcherSendsPerSec, BaselineSendsPerSec);
+
+    //@KeyVerifyPoint-3: Queue depth is reported and bounded for a DatSender outside any CbRecvDat_F
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_EQ(SendNum, DispatchStats.DispatchedDatNum);
+    ASSERT_EQ(0, DispatchStats.QueuedDatNum);
+    ASSERT_GE(DispatchStats.HighWatermark, 1);
+    ASSERT_LE(DispatchStats.HighWatermark, DispatchStats.Capacity);
+    ASSERT_EQ(0, DispatchStats.OverflowDatNum);
+
+    // ┌──────────────────────────────────────────────────────────────────────────────────────┐
+    // │                               🧹 CLEANUP PHASE                                        │
+    // └──────────────────────────────────────────────────────────────────────────────────────┘
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
 //======END OF UNIT TESTING IMPLEMENTATION=========================================================
 ///////////////////////////////////////////////////////////////////////////////////////////////////
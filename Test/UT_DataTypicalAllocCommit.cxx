@@ -0,0 +1,358 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * AllocCommit here means DatSender loans a buffer by IOC_allocDAT from its link's slab pool,
+ *  fills it in place, then sends it by IOC_commitDAT without IOC copying it.
+ *  FIFO delivers the loaned pData to CbRecvDat_F as is, TCP sends header and payload in one syscall,
+ *  and TCP's DatReceiver receives into slabs of its own link, which CbRecvDat_F may hold as Payload.pDatBuf.
+ *  Released slabs are recycled into their pool, so steady sending and receiving cost no malloc.
+ *
+ * RefDoc:
+ *  1) IOC_DatAPI.h::IOC_allocDAT/IOC_commitDAT
+ *  2) UT_DataTypicalZeroCopy.cxx
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender on a FIFO link,
+ *        I WANT TO fill data directly into a buffer loaned from IOC,
+ *        SO THAT neither I nor IOC copy or malloc for each data chunk.
+ *  US-2: AS a DatSender and DatReceiver on a TCP link,
+ *        I WANT TO send loaned buffers and receive into recycled buffers,
+ *        SO THAT each data chunk costs no malloc on either side.
+ *  US-3: AS a DatSender,
+ *        I WANT TO get clear errors when misusing IOC_allocDAT/IOC_commitDAT,
+ *        SO THAT I never leak or double-send a loaned buffer.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver with CbRecvDat_F on a FIFO link,
+ *         WHEN DatSender IOC_allocDAT, fills and IOC_commitDAT,
+ *         THEN CbRecvDat_F gets the loaned pData with the filled content,
+ *          AND IOC_commitDAT clears Payload.pDatBuf/pData of DatSender's IOC_DatDesc_T.
+ * AC-2@US-1: GIVEN a loaned buffer is delivered and released by every holder,
+ *         WHEN DatSender IOC_allocDAT the same size again,
+ *         THEN it gets the same buffer recycled from the slab pool.
+ * AC-1@US-2: GIVEN DatReceiver with CbRecvDat_F on a TCP link,
+ *         WHEN DatSender commits two loaned buffers one by one,
+ *         THEN CbRecvDat_F gets both with the filled content and a non-NULL Payload.pDatBuf,
+ *          AND the second one is received into the recycled slab of the first one.
+ * AC-1@US-3: GIVEN a FIFO link between DatSender and DatReceiver,
+ *         WHEN IOC_allocDAT on the receiver link, or with zero size, or IOC_commitDAT a not-loaned buffer,
+ *         THEN return INCOMPATIBLE_USAGE, ZERO_DATA, INVALID_PARAM respectively.
+ * AC-2@US-3: GIVEN DatSender loaned a buffer,
+ *         WHEN IOC_commitDAT fails because DatReceiver closed its link,
+ *         THEN DatSender still owns the loan, and may IOC_releaseDatBuf it.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyAllocCommit_byFifoCallback_expectLoanedPtrDelivered
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyAllocCommit_byAllocAgainAfterDelivery_expectSlabRecycled
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyAllocCommit_byTcpCallback_expectIntegrityAndRecycledRecvSlab
+ *
+ * 【@AC-1@US-3】
+ *   TC-1.1:
+ *      @[Name]: verifyAllocCommit_byMisuse_expectErrors
+ * 【@AC-2@US-3】
+ *   TC-2.1:
+ *      @[Name]: verifyAllocCommit_byCommitOnBrokenLink_expectLoanKept
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<uint32_t> RecvDatCnt;
+    void *pRecvData[2];
+    bool HasDatBuf[2];
+    bool IsRecvDataSame[2];
+    char ExpectedFill[2];
+} _AllocCommitPrivData_T;
+
+static IOC_Result_T _AllocCommitCbRecvDat_F(IOC_LinkID_T LinkID, const IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _AllocCommitPrivData_T *pPrivData = (_AllocCommitPrivData_T *)pCbPriv;
+    uint32_t Idx = pPrivData->RecvDatCnt.load();
+    if (Idx < 2) {
+        const char *pData = (const char *)pDatDesc->Payload.pData;
+        bool IsSame = true;
+        for (ULONG_T i = 0; i < pDatDesc->Payload.PtrDataLen; i++) {
+            if (pData[i] != pPrivData->ExpectedFill[Idx]) {
+                IsSame = false;
+                break;
+            }
+        }
+        pPrivData->pRecvData[Idx] = pDatDesc->Payload.pData;
+        pPrivData->HasDatBuf[Idx] = (NULL != pDatDesc->Payload.pDatBuf);
+        pPrivData->IsRecvDataSame[Idx] = IsSame;
+    }
+    pPrivData->RecvDatCnt++;
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _AllocCommitWaitRecvDat(_AllocCommitPrivData_T *pPrivData, uint32_t RecvDatCnt) {
+    for (int i = 0; i < 3000 && pPrivData->RecvDatCnt < RecvDatCnt; i++) {
+        usleep(1000);
+    }
+    usleep(10000);  // the receiver side releases its reference after CbRecvDat_F returns
+}
+
+static void _AllocCommitSetupFifoLink(const char *pPath, _AllocCommitPrivData_T *pPrivData, IOC_SrvID_T *pSrvID,
+                                      IOC_LinkID_T *pSenderLinkID) {
+    static IOC_DatUsageArgs_T DatUsageArgs;
+    DatUsageArgs.CbRecvDat_F = _AllocCommitCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = pPrivData;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_FIFO;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = pPath;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+    SrvArgs.Flags = IOC_SRVFLAG_AUTO_ACCEPT;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = SrvArgs.SrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    Result = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+TEST(UT_DataTypicalAllocCommit, verifyAllocCommit_byFifoCallback_expectLoanedPtrDelivered) {
+    //===SETUP===
+    _AllocCommitPrivData_T PrivData = {};
+    PrivData.ExpectedFill[0] = 'F';
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _AllocCommitSetupFifoLink("UT_DataTypicalAllocCommit_US1_TC1_1", &PrivData, &SrvID, &SenderLinkID);
+
+    //===BEHAVIOR===
+    const ULONG_T DataSize = 100 * 1024;
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    IOC_Result_T Result = IOC_allocDAT(SenderLinkID, DataSize, &DatDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_NE(nullptr, DatDesc.Payload.pData);
+    ASSERT_NE(nullptr, DatDesc.Payload.pDatBuf);
+    ASSERT_EQ(DataSize, DatDesc.Payload.PtrDataSize);
+
+    void *pLoanedData = DatDesc.Payload.pData;
+    memset(pLoanedData, 'F', DataSize);
+
+    Result = IOC_commitDAT(SenderLinkID, &DatDesc, NULL);
+    _AllocCommitWaitRecvDat(&PrivData, 1);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint
+    ASSERT_EQ(nullptr, DatDesc.Payload.pDatBuf);
+    ASSERT_EQ(nullptr, DatDesc.Payload.pData);
+    ASSERT_EQ(1, PrivData.RecvDatCnt.load());
+    ASSERT_EQ(pLoanedData, PrivData.pRecvData[0]);  // KeyVerifyPoint: not copied
+    ASSERT_TRUE(PrivData.HasDatBuf[0]);
+    ASSERT_TRUE(PrivData.IsRecvDataSame[0]);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalAllocCommit, verifyAllocCommit_byAllocAgainAfterDelivery_expectSlabRecycled) {
+    //===SETUP===
+    _AllocCommitPrivData_T PrivData = {};
+    PrivData.ExpectedFill[0] = 'A';
+    PrivData.ExpectedFill[1] = 'B';
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _AllocCommitSetupFifoLink("UT_DataTypicalAllocCommit_US1_TC2_1", &PrivData, &SrvID, &SenderLinkID);
+
+    //===BEHAVIOR===
+    const ULONG_T DataSize = 4000;
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    IOC_Result_T Result = IOC_allocDAT(SenderLinkID, DataSize, &DatDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    void *pFirstLoanedData = DatDesc.Payload.pData;
+    memset(pFirstLoanedData, 'A', DataSize);
+    Result = IOC_commitDAT(SenderLinkID, &DatDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    _AllocCommitWaitRecvDat(&PrivData, 1);
+
+    Result = IOC_allocDAT(SenderLinkID, DataSize - 100, &DatDesc);  // same size class
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    void *pSecondLoanedData = DatDesc.Payload.pData;
+    memset(pSecondLoanedData, 'B', DataSize - 100);
+    Result = IOC_commitDAT(SenderLinkID, &DatDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    _AllocCommitWaitRecvDat(&PrivData, 2);
+
+    //===VERIFY===
+    ASSERT_EQ(pFirstLoanedData, pSecondLoanedData);  // KeyVerifyPoint: recycled, no malloc
+    ASSERT_EQ(2, PrivData.RecvDatCnt.load());
+    ASSERT_EQ(pSecondLoanedData, PrivData.pRecvData[1]);
+    ASSERT_TRUE(PrivData.IsRecvDataSame[0]);
+    ASSERT_TRUE(PrivData.IsRecvDataSame[1]);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalAllocCommit, verifyAllocCommit_byTcpCallback_expectIntegrityAndRecycledRecvSlab) {
+    //===SETUP===
+    _AllocCommitPrivData_T PrivData = {};
+    PrivData.ExpectedFill[0] = 'T';
+    PrivData.ExpectedFill[1] = 'U';
+
+    IOC_DatUsageArgs_T DatUsageArgs = {
+        .CbRecvDat_F = _AllocCommitCbRecvDat_F,
+        .pCbPrivData = &PrivData,
+    };
+
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalAllocCommit_US2_TC1_1",
+        .Port = 19101,
+    };
+
+    IOC_SrvArgs_T SrvArgs = {
+        .SrvURI = SrvURI,
+        .UsageCapabilites = IOC_LinkUsageDatReceiver,
+        .UsageArgs = {.pDat = &DatUsageArgs},
+    };
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_Result_T Result = IOC_onlineService(&SrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {
+        .SrvURI = SrvURI,
+        .Usage = IOC_LinkUsageDatSender,
+    };
+
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    IOC_LinkID_T ReceiverLinkID = IOC_ID_INVALID;
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(&SenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(SrvID, &ReceiverLinkID, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    SenderThread.join();
+
+    //===BEHAVIOR===
+    const ULONG_T DataSize = 60 * 1024;
+    for (int i = 0; i < 2; i++) {
+        IOC_DatDesc_T DatDesc = {};
+        IOC_initDatDesc(&DatDesc);
+        Result = IOC_allocDAT(SenderLinkID, DataSize, &DatDesc);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        memset(DatDesc.Payload.pData, PrivData.ExpectedFill[i], DataSize);
+
+        Result = IOC_commitDAT(SenderLinkID, &DatDesc, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint
+        _AllocCommitWaitRecvDat(&PrivData, i + 1);
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(2, PrivData.RecvDatCnt.load());
+    ASSERT_TRUE(PrivData.IsRecvDataSame[0]);  // KeyVerifyPoint
+    ASSERT_TRUE(PrivData.IsRecvDataSame[1]);  // KeyVerifyPoint
+    ASSERT_TRUE(PrivData.HasDatBuf[0]);
+    ASSERT_TRUE(PrivData.HasDatBuf[1]);
+    ASSERT_EQ(PrivData.pRecvData[0], PrivData.pRecvData[1]);  // KeyVerifyPoint: recycled, no malloc
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalAllocCommit, verifyAllocCommit_byMisuse_expectErrors) {
+    //===SETUP===
+    _AllocCommitPrivData_T PrivData = {};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _AllocCommitSetupFifoLink("UT_DataTypicalAllocCommit_US3_TC1_1", &PrivData, &SrvID, &SenderLinkID);
+
+    IOC_LinkID_T ReceiverLinkID = IOC_ID_INVALID;
+    for (int i = 0; i < 1000 && ReceiverLinkID == IOC_ID_INVALID; i++) {
+        IOC_LinkID_T LinkIDs[1] = {IOC_ID_INVALID};
+        uint16_t LinkNum = 0;
+        IOC_getServiceLinkIDs(SrvID, LinkIDs, 1, &LinkNum);
+        ReceiverLinkID = LinkIDs[0];
+        if (ReceiverLinkID == IOC_ID_INVALID) usleep(1000);
+    }
+    ASSERT_NE(IOC_ID_INVALID, ReceiverLinkID);
+
+    //===BEHAVIOR&VERIFY===
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    ASSERT_EQ(IOC_RESULT_INCOMPATIBLE_USAGE, IOC_allocDAT(ReceiverLinkID, 1024, &DatDesc));  // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_ZERO_DATA, IOC_allocDAT(SenderLinkID, 0, &DatDesc));                // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_allocDAT(SenderLinkID, 1024, NULL));
+    ASSERT_EQ(IOC_RESULT_NOT_EXIST_LINK, IOC_allocDAT(IOC_ID_INVALID, 1024, &DatDesc));
+
+    char NotLoanedData[64] = {};
+    DatDesc.Payload.pData = NotLoanedData;
+    DatDesc.Payload.PtrDataSize = sizeof(NotLoanedData);
+    DatDesc.Payload.PtrDataLen = sizeof(NotLoanedData);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_commitDAT(SenderLinkID, &DatDesc, NULL));  // KeyVerifyPoint
+    ASSERT_EQ(0, PrivData.RecvDatCnt.load());
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalAllocCommit, verifyAllocCommit_byCommitOnBrokenLink_expectLoanKept) {
+    //===SETUP===
+    _AllocCommitPrivData_T PrivData = {};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _AllocCommitSetupFifoLink("UT_DataTypicalAllocCommit_US3_TC2_1", &PrivData, &SrvID, &SenderLinkID);
+
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    IOC_Result_T Result = IOC_allocDAT(SenderLinkID, 1024, &DatDesc);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    IOC_DatBuf_pT pLoanedDatBuf = DatDesc.Payload.pDatBuf;
+
+    //===BEHAVIOR===
+    IOC_offlineService(SrvID);  // closes the accepted DatReceiver link
+    Result = IOC_commitDAT(SenderLinkID, &DatDesc, NULL);
+
+    //===VERIFY===
+    ASSERT_NE(IOC_RESULT_SUCCESS, Result);              // KeyVerifyPoint
+    ASSERT_EQ(pLoanedDatBuf, DatDesc.Payload.pDatBuf);  // KeyVerifyPoint: still owned by DatSender
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_releaseDatBuf(DatDesc.Payload.pDatBuf));
+    ASSERT_EQ(0, PrivData.RecvDatCnt.load());
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
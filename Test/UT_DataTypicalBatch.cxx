@@ -0,0 +1,463 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Batch here means FIFO DatReceiver's dispatcher delivers data chunks queued meanwhile by ONE callback,
+ *  as an array of IOC_DatDesc_T to CbRecvDatBatch_F with each chunk's boundary kept,
+ *  or chunk by chunk to CbRecvDat_F, or joined in one IOC_DatDesc_T if Batch.IsJoinData,
+ *  within IOC_DatUsageArgs_T::Batch's limits.
+ *  If Batch.MaxDelayUS > 0, the dispatcher also waits for more chunks, adapted to the callback cost.
+ *
+ * RefDoc:
+ *  1) IOC_SrvTypes.h::IOC_CbRecvDatBatch_F and IOC_DatUsageArgs_T::Batch
+ *  2) IOC_DatAPI.h::IOC_getDatDispatchStats
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatReceiver of many small data chunks,
+ *        I WANT them delivered in batches with each chunk's boundary kept,
+ *        SO THAT I pay the callback cost once per batch instead of once per chunk.
+ *  US-2: AS a DatReceiver who sets Batch.MaxDelayUS,
+ *        I WANT the dispatcher to wait a bounded time for more chunks, as long as my callback affords it,
+ *        SO THAT even a sender not faster than my callback gets batched, at a bounded latency.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with CbRecvDatBatch_F, whose first callback is held,
+ *         WHEN DatSender sends 100 chunks of different sizes meanwhile,
+ *         THEN CbRecvDatBatch_F gets the 100 chunks in order with their own sizes, in fewer batches.
+ * AC-2@US-1: GIVEN DatReceiver's Batch.MaxDatNum is 8 and Batch.MaxDatBytes is 1024,
+ *         WHEN 100 chunks of 100 bytes and a chunk of 4000 bytes are queued meanwhile,
+ *         THEN no batch has more than 8 chunks or 1024 bytes, except the 4000 bytes chunk alone.
+ * AC-3@US-1: GIVEN DatReceiver's FIFO link with CbRecvDat_F only, whose first callback is held,
+ *         WHEN DatSender sends 100 chunks meanwhile,
+ *         THEN CbRecvDat_F gets each chunk in order by its own callback,
+ *           or gets them joined in order by fewer callbacks if Batch.IsJoinData.
+ * AC-1@US-2: GIVEN DatReceiver's Batch.MaxDelayUS is 20ms with a cheap CbRecvDatBatch_F,
+ *         WHEN DatSender sends 32 chunks one by one, then another one alone,
+ *         THEN they are delivered in fewer batches than chunks, and the last one within a bounded latency.
+ * AC-2@US-2: GIVEN DatReceiver's Batch.MaxDelayUS is 2ms with a CbRecvDatBatch_F costing 5ms per chunk,
+ *         WHEN DatSender sends chunks,
+ *         THEN the dispatcher adapts to wait for ONE chunk, as its callback alone takes more than the delay.
+ * AC-3@US-2: GIVEN DatReceiver's Batch.MaxDelayUS is 10s,
+ *         WHEN DatSender sends 1 chunk then calls IOC_flushDAT,
+ *         THEN the chunk is delivered at once without waiting for 10s.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyDatBatch_byHeldReceiver_expectChunksInOrderWithBoundaries
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyDatBatch_byMaxDatNumAndBytes_expectBatchesWithinLimits
+ *
+ * 【@AC-3@US-1】
+ *   TC-3.1:
+ *      @[Name]: verifyDatBatch_byCbRecvDatOnly_expectEachChunkInOrder
+ *   TC-3.2:
+ *      @[Name]: verifyDatBatch_byCbRecvDatOnly_expectJoinedDataInOrder
+ *
+ * 【@AC-1@US-2】
+ *   TC-4.1:
+ *      @[Name]: verifyDatBatch_byMaxDelayWithCheapCallback_expectBatchesAndBoundedLatency
+ *
+ * 【@AC-2@US-2】
+ *   TC-5.1:
+ *      @[Name]: verifyDatBatch_byMaxDelayWithSlowCallback_expectTargetOfOneChunk
+ *
+ * 【@AC-3@US-2】
+ *   TC-6.1:
+ *      @[Name]: verifyDatBatch_byFlushDuringMaxDelay_expectDeliveredAtOnce
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::mutex Mutex;
+    std::atomic<bool> IsHolding{false};  // first callback waits until it's cleared
+    std::atomic<bool> IsEntered{false};  // first callback is entered
+    useconds_t CostPerDatUS = 0;         // simulated callback cost per chunk
+
+    std::vector<std::string> RecvChunks;
+    std::vector<ULONG_T> BatchDatNums, BatchDatBytes;
+} _BatchRecvPriv_T;
+
+static void _BatchHoldIfNeeded(_BatchRecvPriv_T *pPriv) {
+    pPriv->IsEntered = true;
+    while (pPriv->IsHolding) {
+        usleep(1000);
+    }
+}
+
+static IOC_Result_T _BatchCbRecvDatBatch_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDescs, ULONG_T DatDescNum,
+                                           void *pCbPriv) {
+    _BatchRecvPriv_T *pPriv = (_BatchRecvPriv_T *)pCbPriv;
+    _BatchHoldIfNeeded(pPriv);
+    if (pPriv->CostPerDatUS > 0) {
+        usleep(pPriv->CostPerDatUS * DatDescNum);
+    }
+
+    std::lock_guard<std::mutex> Lock(pPriv->Mutex);
+    ULONG_T BatchBytes = 0;
+    for (ULONG_T i = 0; i < DatDescNum; i++) {
+        void *pData = NULL;
+        ULONG_T DataLen = 0;
+        IOC_getDatPayload(&pDatDescs[i], &pData, &DataLen);
+        pPriv->RecvChunks.push_back(std::string((char *)pData, DataLen));
+        BatchBytes += DataLen;
+    }
+    pPriv->BatchDatNums.push_back(DatDescNum);
+    pPriv->BatchDatBytes.push_back(BatchBytes);
+    return IOC_RESULT_SUCCESS;
+}
+
+static IOC_Result_T _BatchCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _BatchRecvPriv_T *pPriv = (_BatchRecvPriv_T *)pCbPriv;
+    _BatchHoldIfNeeded(pPriv);
+
+    void *pData = NULL;
+    ULONG_T DataLen = 0;
+    IOC_getDatPayload(pDatDesc, &pData, &DataLen);
+
+    std::lock_guard<std::mutex> Lock(pPriv->Mutex);
+    pPriv->RecvChunks.push_back(std::string((char *)pData, DataLen));
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _BatchSetupLink(const char *pPath, IOC_DatUsageArgs_T *pDatUsageArgs, IOC_SrvID_T *pSrvID,
+                            IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_FIFO;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = pPath;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = pDatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = SrvArgs.SrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _BatchSendOne(IOC_LinkID_T LinkID, const std::string &Data) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)Data.data();
+    DatDesc.Payload.PtrDataSize = Data.size();
+    DatDesc.Payload.PtrDataLen = Data.size();
+    return IOC_sendDAT(LinkID, &DatDesc, NULL);
+}
+
+// Send the first chunk and wait its callback entered and held, then send the rest meanwhile and release it
+static void _BatchSendWhileHeld(IOC_LinkID_T LinkID, _BatchRecvPriv_T *pPriv, const std::vector<std::string> &Datas) {
+    pPriv->IsHolding = true;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(LinkID, Datas[0]));
+    for (int Retry = 0; Retry < 200 && !pPriv->IsEntered; Retry++) {
+        usleep(10000);
+    }
+    ASSERT_TRUE(pPriv->IsEntered);
+
+    for (size_t i = 1; i < Datas.size(); i++) {
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(LinkID, Datas[i]));
+    }
+
+    pPriv->IsHolding = false;
+}
+
+// Wait until the received bytes reach TotalBytes or 2s passed
+static void _BatchWaitRecvBytes(_BatchRecvPriv_T *pPriv, size_t TotalBytes) {
+    for (int Retry = 0; Retry < 200; Retry++) {
+        {
+            std::lock_guard<std::mutex> Lock(pPriv->Mutex);
+            size_t RecvBytes = 0;
+            for (auto &Chunk : pPriv->RecvChunks) RecvBytes += Chunk.size();
+            if (RecvBytes >= TotalBytes) return;
+        }
+        usleep(10000);
+    }
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byHeldReceiver_expectChunksInOrderWithBoundaries) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDatBatch_F = _BatchCbRecvDatBatch_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC1_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    std::vector<std::string> SendDatas;
+    size_t TotalBytes = 0;
+    for (int i = 0; i < 100; i++) {
+        SendDatas.push_back("DAT#" + std::to_string(i) + std::string(i % 7, (char)('a' + i % 26)));
+        TotalBytes += SendDatas.back().size();
+    }
+    _BatchSendWhileHeld(SenderLinkID, &RecvPriv, SendDatas);
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes);
+
+    //===VERIFY===
+    IOC_DatDispatchStats_T DispatchStats = {};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_getDatDispatchStats(ReceiverLinkID, &DispatchStats));
+
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(SendDatas, RecvPriv.RecvChunks);                     // KeyVerifyPoint: boundaries kept, in order
+    ASSERT_LT(RecvPriv.BatchDatNums.size(), SendDatas.size());     // KeyVerifyPoint: batched
+    ASSERT_EQ(100, DispatchStats.DispatchedDatNum);
+    ASSERT_EQ(RecvPriv.BatchDatNums.size(), DispatchStats.DispatchedBatchNum);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byMaxDatNumAndBytes_expectBatchesWithinLimits) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDatBatch_F = _BatchCbRecvDatBatch_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Batch.MaxDatNum = 8;
+    DatUsageArgs.Batch.MaxDatBytes = 1024;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC2_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    std::vector<std::string> SendDatas;
+    size_t TotalBytes = 0;
+    for (int i = 0; i < 101; i++) {
+        SendDatas.push_back(std::string((i == 50) ? 4000 : 100, (char)('A' + i % 26)));
+        TotalBytes += SendDatas.back().size();
+    }
+    _BatchSendWhileHeld(SenderLinkID, &RecvPriv, SendDatas);
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes);
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(SendDatas, RecvPriv.RecvChunks);
+    bool HasFullBatch = false;
+    for (size_t i = 0; i < RecvPriv.BatchDatNums.size(); i++) {
+        ASSERT_LE(RecvPriv.BatchDatNums[i], 8);  // KeyVerifyPoint
+        if (RecvPriv.BatchDatBytes[i] > 1024) {
+            ASSERT_EQ(1, RecvPriv.BatchDatNums[i]);  // KeyVerifyPoint: only the 4000 bytes chunk alone
+            ASSERT_EQ(4000, RecvPriv.BatchDatBytes[i]);
+        }
+        HasFullBatch |= (RecvPriv.BatchDatNums[i] == 8);
+    }
+    ASSERT_TRUE(HasFullBatch);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byCbRecvDatOnly_expectEachChunkInOrder) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _BatchCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC3_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    std::vector<std::string> SendDatas;
+    size_t TotalBytes = 0;
+    for (int i = 0; i < 100; i++) {
+        SendDatas.push_back("<" + std::to_string(i) + ">");
+        TotalBytes += SendDatas.back().size();
+    }
+    _BatchSendWhileHeld(SenderLinkID, &RecvPriv, SendDatas);
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes);
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(SendDatas, RecvPriv.RecvChunks);  // KeyVerifyPoint: one callback per chunk, in order
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byCbRecvDatOnly_expectJoinedDataInOrder) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _BatchCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Batch.IsJoinData = true;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC3_2", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    std::vector<std::string> SendDatas;
+    std::string SendStream;
+    for (int i = 0; i < 100; i++) {
+        SendDatas.push_back("<" + std::to_string(i) + ">");
+        SendStream += SendDatas.back();
+    }
+    _BatchSendWhileHeld(SenderLinkID, &RecvPriv, SendDatas);
+    _BatchWaitRecvBytes(&RecvPriv, SendStream.size());
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    std::string RecvStream;
+    for (auto &Chunk : RecvPriv.RecvChunks) RecvStream += Chunk;
+    ASSERT_EQ(SendStream, RecvStream);                          // KeyVerifyPoint: joined in order
+    ASSERT_LT(RecvPriv.RecvChunks.size(), SendDatas.size());  // KeyVerifyPoint: fewer callbacks
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byMaxDelayWithCheapCallback_expectBatchesAndBoundedLatency) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDatBatch_F = _BatchCbRecvDatBatch_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Batch.MaxDelayUS = 20000;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC4_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    size_t TotalBytes = 0;
+    for (int i = 0; i < 32; i++) {
+        std::string Data = "DAT#" + std::to_string(i);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(SenderLinkID, Data));
+        TotalBytes += Data.size();
+    }
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes);
+
+    auto SendTime = std::chrono::steady_clock::now();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(SenderLinkID, "LAST"));
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes + 4);
+    auto LatencyMS =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - SendTime).count();
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(33, RecvPriv.RecvChunks.size());
+    ASSERT_EQ("LAST", RecvPriv.RecvChunks.back());
+    ASSERT_LT(RecvPriv.BatchDatNums.size(), 33);  // KeyVerifyPoint: batched without a held receiver
+    ASSERT_LT(LatencyMS, 1000);                   // KeyVerifyPoint: bounded by MaxDelayUS, with slack for slow CI
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byMaxDelayWithSlowCallback_expectTargetOfOneChunk) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    RecvPriv.CostPerDatUS = 5000;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDatBatch_F = _BatchCbRecvDatBatch_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Batch.MaxDelayUS = 2000;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC5_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    size_t TotalBytes = 0;
+    for (int i = 0; i < 5; i++) {
+        std::string Data = "DAT#" + std::to_string(i);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(SenderLinkID, Data));
+        TotalBytes += Data.size();
+        usleep(10000);
+    }
+    _BatchWaitRecvBytes(&RecvPriv, TotalBytes);
+
+    //===VERIFY===
+    IOC_DatDispatchStats_T DispatchStats = {};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_getDatDispatchStats(ReceiverLinkID, &DispatchStats));
+    ASSERT_EQ(5, DispatchStats.DispatchedDatNum);
+    ASSERT_EQ(1, DispatchStats.TargetBatchDatNum);  // KeyVerifyPoint: adapted to the slow callback
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalBatch, verifyDatBatch_byFlushDuringMaxDelay_expectDeliveredAtOnce) {
+    //===SETUP===
+    _BatchRecvPriv_T RecvPriv;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDatBatch_F = _BatchCbRecvDatBatch_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+    DatUsageArgs.Batch.MaxDelayUS = 10000000;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _BatchSetupLink("UT_DataTypicalBatch_TC6_1", &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    auto SendTime = std::chrono::steady_clock::now();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _BatchSendOne(SenderLinkID, "FLUSHED"));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));
+    _BatchWaitRecvBytes(&RecvPriv, 7);
+    auto LatencyMS =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - SendTime).count();
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(1, RecvPriv.RecvChunks.size());
+    ASSERT_EQ("FLUSHED", RecvPriv.RecvChunks[0]);
+    ASSERT_LT(LatencyMS, 1000);  // KeyVerifyPoint: not waiting for MaxDelayUS
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
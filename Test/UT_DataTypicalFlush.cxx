@@ -0,0 +1,292 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Flush here means IOC_flushDAT of a DatSender as a drain barrier: it returns once every data chunk
+ *  sent before it is delivered to DatReceiver, i.e. returned from CbRecvDat_F or stored in its polling buffer,
+ *  so DatSender pipelines many async IOC_sendDAT and synchronizes once, both in FIFO and TCP.
+ *
+ * RefDoc:
+ *  1) IOC_DatAPI.h::IOC_flushDAT
+ *  2) _IOC_SrvProtoFifo.md::IOC_flushDAT as a drain barrier
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender who sends thousands of chunks asynchronously,
+ *        I WANT TO wait once by IOC_flushDAT until DatReceiver got all of them,
+ *        SO THAT I don't send each chunk synchronously to know when it's delivered.
+ *  US-2: AS a DatSender whose DatReceiver MAY be stuck,
+ *        I WANT TO bound IOC_flushDAT by a timeout,
+ *        SO THAT I'm never stuck with it.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with a slow CbRecvDat_F,
+ *         WHEN DatSender sends 500 chunks then calls IOC_flushDAT without options,
+ *         THEN it returns SUCCESS after CbRecvDat_F got all 500 chunks.
+ * AC-2@US-1: GIVEN DatReceiver's TCP link with a slow CbRecvDat_F,
+ *         WHEN DatSender sends 500 chunks then calls IOC_flushDAT without options,
+ *         THEN it returns SUCCESS after CbRecvDat_F got all 500 chunks.
+ * AC-3@US-1: GIVEN DatReceiver's TCP link in polling mode,
+ *         WHEN DatSender sends 20 chunks then calls IOC_flushDAT,
+ *         THEN NonBlock IOC_recvDAT gets all 20 chunks right after it.
+ * AC-1@US-2: GIVEN DatReceiver's FIFO or TCP link whose CbRecvDat_F is held,
+ *         WHEN DatSender sends a chunk then calls IOC_flushDAT with a 100ms timeout,
+ *         THEN it returns TIMEOUT, and once CbRecvDat_F is released, IOC_flushDAT returns SUCCESS.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyFlushDAT_byFifoSlowCallback_expectAllDeliveredOnReturn
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyFlushDAT_byTCPSlowCallback_expectAllDeliveredOnReturn
+ *
+ * 【@AC-3@US-1】
+ *   TC-3.1:
+ *      @[Name]: verifyFlushDAT_byTCPPolling_expectAllInPollingBufferOnReturn
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyFlushDAT_byFifoHeldCallback_expectTimeoutThenSuccess
+ *   TC-1.2:
+ *      @[Name]: verifyFlushDAT_byTCPHeldCallback_expectTimeoutThenSuccess
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<bool> IsHeld;
+    std::atomic<ULONG_T> RecvByteNum;  // FIFO CbRecvDat_F MAY get chunks sent meanwhile joined, so count bytes
+    useconds_t CostUS;                 // Time each CbRecvDat_F takes
+} _FlushRecvPriv_T;
+
+static IOC_Result_T _FlushCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _FlushRecvPriv_T *pPriv = (_FlushRecvPriv_T *)pCbPriv;
+    while (pPriv->IsHeld) {
+        usleep(1000);
+    }
+    if (pPriv->CostUS) {
+        usleep(pPriv->CostUS);
+    }
+
+    void *pData = NULL;
+    ULONG_T DataSize = 0;
+    IOC_getDatPayload(pDatDesc, &pData, &DataSize);
+    pPriv->RecvByteNum += DataSize;
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _FlushSetupLink(IOC_SrvURI_T *pSrvURI, IOC_DatUsageArgs_T *pDatUsageArgs, IOC_SrvID_T *pSrvID,
+                            IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = pDatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _FlushSend(IOC_LinkID_T LinkID, const void *pData, ULONG_T DataSize,
+                               IOC_Options_pT pOption = NULL) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)pData;
+    DatDesc.Payload.PtrDataSize = DataSize;
+    DatDesc.Payload.PtrDataLen = DataSize;
+    return IOC_sendDAT(LinkID, &DatDesc, pOption);
+}
+
+// Send ChunkNum chunks to a slow CbRecvDat_F, then flush once, all of them MUST be delivered on its return
+static void _FlushVerifySlowCallback(IOC_SrvURI_T *pSrvURI) {
+    //===SETUP===
+    _FlushRecvPriv_T RecvPriv;
+    RecvPriv.IsHeld = false;
+    RecvPriv.RecvByteNum = 0;
+    RecvPriv.CostUS = 200;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _FlushCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _FlushSetupLink(pSrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const int ChunkNum = 500;
+    char Chunk[1024] = {};
+    for (int i = 0; i < ChunkNum; i++) {
+        Chunk[0] = (char)i;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _FlushSend(SenderLinkID, Chunk, sizeof(Chunk)));
+    }
+    IOC_Result_T Result = IOC_flushDAT(SenderLinkID, NULL);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_EQ(ChunkNum * sizeof(Chunk), RecvPriv.RecvByteNum);  // KeyVerifyPoint: delivered on return
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+// Flush a chunk to a held CbRecvDat_F, it MUST time out, then succeed once CbRecvDat_F is released
+static void _FlushVerifyHeldCallback(IOC_SrvURI_T *pSrvURI) {
+    //===SETUP===
+    _FlushRecvPriv_T RecvPriv;
+    RecvPriv.IsHeld = true;
+    RecvPriv.RecvByteNum = 0;
+    RecvPriv.CostUS = 0;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _FlushCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _FlushSetupLink(pSrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    char Chunk[64] = {};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _FlushSend(SenderLinkID, Chunk, sizeof(Chunk)));
+
+    IOC_Option_defineTimeout(FlushOption, 100000);
+    struct timespec Start, End;
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    IOC_Result_T Result = IOC_flushDAT(SenderLinkID, &FlushOption);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    long ElapsedMS = (End.tv_sec - Start.tv_sec) * 1000 + (End.tv_nsec - Start.tv_nsec) / 1000000;
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, Result);  // KeyVerifyPoint
+    ASSERT_GE(ElapsedMS, 90);
+    ASSERT_EQ(0, RecvPriv.RecvByteNum);
+
+    RecvPriv.IsHeld = false;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));  // KeyVerifyPoint
+    ASSERT_EQ(sizeof(Chunk), RecvPriv.RecvByteNum);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalFlush, verifyFlushDAT_byFifoSlowCallback_expectAllDeliveredOnReturn) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalFlush_US1_TC1_1",
+    };
+    _FlushVerifySlowCallback(&SrvURI);
+}
+
+TEST(UT_DataTypicalFlush, verifyFlushDAT_byTCPSlowCallback_expectAllDeliveredOnReturn) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalFlush_US1_TC2_1",
+        .Port = 19107,
+    };
+    _FlushVerifySlowCallback(&SrvURI);
+}
+
+TEST(UT_DataTypicalFlush, verifyFlushDAT_byTCPPolling_expectAllInPollingBufferOnReturn) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalFlush_US1_TC3_1",
+        .Port = 19108,
+    };
+    IOC_DatUsageArgs_T DatUsageArgs = {};  // No CbRecvDat_F means polling mode
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _FlushSetupLink(&SrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const int ChunkNum = 20;
+    const ULONG_T ChunkSize = 100;
+    IOC_Option_defineTimeout(SendOption, 1000000);
+    for (int i = 0; i < ChunkNum; i++) {
+        std::vector<char> Chunk(ChunkSize, (char)i);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _FlushSend(SenderLinkID, Chunk.data(), ChunkSize, &SendOption));
+    }
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));
+
+    //===VERIFY===
+    std::vector<char> RecvBytes;
+    IOC_Option_defineNonBlock(RecvOption);
+    while (RecvBytes.size() < ChunkNum * ChunkSize) {
+        char RecvBuf[ChunkSize * ChunkNum];
+        IOC_DatDesc_T DatDesc = {};
+        IOC_initDatDesc(&DatDesc);
+        DatDesc.Payload.pData = RecvBuf;
+        DatDesc.Payload.PtrDataSize = sizeof(RecvBuf);
+        IOC_Result_T Result = IOC_recvDAT(ReceiverLinkID, &DatDesc, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint: already in polling buffer, never NO_DATA
+        RecvBytes.insert(RecvBytes.end(), RecvBuf, RecvBuf + DatDesc.Payload.PtrDataSize);
+    }
+    ASSERT_EQ(ChunkNum * ChunkSize, RecvBytes.size());
+    for (int i = 0; i < ChunkNum; i++) {
+        ASSERT_EQ((char)i, RecvBytes[i * ChunkSize]);  // KeyVerifyPoint: in order
+    }
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalFlush, verifyFlushDAT_byFifoHeldCallback_expectTimeoutThenSuccess) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalFlush_US2_TC1_1",
+    };
+    _FlushVerifyHeldCallback(&SrvURI);
+}
+
+TEST(UT_DataTypicalFlush, verifyFlushDAT_byTCPHeldCallback_expectTimeoutThenSuccess) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalFlush_US2_TC1_2",
+        .Port = 19109,
+    };
+    _FlushVerifyHeldCallback(&SrvURI);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -0,0 +1,349 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * PollingRing here means the polling buffer of a DatReceiver without CbRecvDat_F, both in FIFO and TCP,
+ *  which is a single-producer/single-consumer ring of data chunks whose capacity is set per link by
+ *  IOC_DatUsageArgs_T::PollingBufSize, and a blocking IOC_recvDAT parks only when the ring is empty.
+ * IOC_recvDAT still reads it as a byte stream, a chunk larger than the caller's buffer is read in parts in order.
+ *
+ * RefDoc:
+ *  1) IOC_SrvTypes.h::IOC_DatUsageArgs_T::PollingBufSize
+ *  2) Source/_IOC_DatRing.h
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatReceiver who polls data by IOC_recvDAT,
+ *        I WANT TO set the capacity of my polling buffer per link,
+ *        SO THAT a slow link buffers more and a tiny link costs less memory.
+ *  US-2: AS a DatReceiver who polls data by IOC_recvDAT,
+ *        I WANT TO get every byte in send order, and be woken as soon as data comes,
+ *        SO THAT polling is as reliable as before while it costs no lock shared with DatSender.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with PollingBufSize=4KB,
+ *         WHEN DatSender sends 100 bytes chunks without anyone receiving,
+ *         THEN IOC_sendDAT returns BUFFER_FULL far before 64KB(default) is sent,
+ *          AND IOC_recvDAT gets all chunks sent successfully in order.
+ * AC-1@US-2: GIVEN DatReceiver's FIFO link with PollingBufSize=4KB,
+ *         WHEN DatSender sends 3000 bytes chunks one by one, each received before next one,
+ *         THEN each chunk is received as is, even if it wraps around the end of the ring.
+ * AC-2@US-2: GIVEN DatReceiver's FIFO link with two 300 bytes chunks polling,
+ *         WHEN DatReceiver calls IOC_recvDAT with a 200 bytes buffer three times,
+ *         THEN it gets 200 bytes each time in send order.
+ * AC-3@US-2: GIVEN DatReceiver blocks in IOC_recvDAT on an empty FIFO link,
+ *         WHEN DatSender sends a chunk 50ms later,
+ *         THEN IOC_recvDAT returns the chunk right after it's sent.
+ * AC-4@US-2: GIVEN DatReceiver's TCP link with PollingBufSize=16KB,
+ *         WHEN DatSender sends 1000 chunks of 1KB while DatReceiver is polling them,
+ *         THEN DatReceiver gets every byte in send order.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyPollingBufSize_bySendWithoutRecv_expectBufferFullEarly
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyPollingRing_bySendRecvWrapAround_expectSameChunk
+ *
+ * 【@AC-2@US-2】
+ *   TC-2.1:
+ *      @[Name]: verifyPollingRing_byRecvSmallerBuffer_expectBytesInOrder
+ *
+ * 【@AC-3@US-2】
+ *   TC-3.1:
+ *      @[Name]: verifyPollingRing_byBlockingRecvBeforeSend_expectWokenBySend
+ *
+ * 【@AC-4@US-2】
+ *   TC-4.1:
+ *      @[Name]: verifyPollingRing_byTCPConcurrentSendRecv_expectAllBytesInOrder
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+static void _PollingRingSetupLink(IOC_SrvURI_T *pSrvURI, ULONG_T PollingBufSize, IOC_SrvID_T *pSrvID,
+                                  IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    static IOC_DatUsageArgs_T DatUsageArgs;
+    DatUsageArgs.CbRecvDat_F = NULL;  // polling mode
+    DatUsageArgs.pCbPrivData = NULL;
+    DatUsageArgs.PollingBufSize = PollingBufSize;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _PollingRingSend(IOC_LinkID_T LinkID, const void *pData, ULONG_T DataSize,
+                                     IOC_Options_pT pOption = NULL) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)pData;
+    DatDesc.Payload.PtrDataSize = DataSize;
+    DatDesc.Payload.PtrDataLen = DataSize;
+    return IOC_sendDAT(LinkID, &DatDesc, pOption);
+}
+
+static IOC_Result_T _PollingRingRecv(IOC_LinkID_T LinkID, void *pBuf, ULONG_T BufSize, ULONG_T *pRecvSize,
+                                     IOC_Options_pT pOption) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = pBuf;
+    DatDesc.Payload.PtrDataSize = BufSize;
+    IOC_Result_T Result = IOC_recvDAT(LinkID, &DatDesc, pOption);
+    *pRecvSize = DatDesc.Payload.PtrDataSize;
+    return Result;
+}
+
+TEST(UT_DataTypicalPollingRing, verifyPollingBufSize_bySendWithoutRecv_expectBufferFullEarly) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalPollingRing_US1_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _PollingRingSetupLink(&SrvURI, 4096, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const ULONG_T ChunkSize = 100;
+    const int MaxChunkNum = 64 * 1024 / ChunkSize;
+    int SentChunkNum = 0;
+    IOC_Result_T Result = IOC_RESULT_SUCCESS;
+    for (; SentChunkNum < MaxChunkNum; SentChunkNum++) {
+        std::vector<char> Chunk(ChunkSize, (char)SentChunkNum);
+        Result = _PollingRingSend(SenderLinkID, Chunk.data(), ChunkSize);
+        if (Result != IOC_RESULT_SUCCESS) break;
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_BUFFER_FULL, Result);  // KeyVerifyPoint
+    ASSERT_GT(SentChunkNum, 0);
+    ASSERT_LT(SentChunkNum, MaxChunkNum / 4);  // KeyVerifyPoint: far less than default 64KB, even of 16KB pages
+
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    for (int i = 0; i < SentChunkNum; i++) {
+        char RecvBuf[ChunkSize] = {};
+        ULONG_T RecvSize = 0;
+        Result = _PollingRingRecv(ReceiverLinkID, RecvBuf, ChunkSize, &RecvSize, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        ASSERT_EQ(ChunkSize, RecvSize);
+        ASSERT_EQ((char)i, RecvBuf[0]);  // KeyVerifyPoint: in order
+        ASSERT_EQ((char)i, RecvBuf[ChunkSize - 1]);
+    }
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalPollingRing, verifyPollingRing_bySendRecvWrapAround_expectSameChunk) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalPollingRing_US2_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _PollingRingSetupLink(&SrvURI, 4096, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR&VERIFY===
+    const ULONG_T ChunkSize = 3000;  // not a divisor of any ring size, so chunks wrap around at different offsets
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    for (int i = 0; i < 100; i++) {
+        std::vector<char> SendChunk(ChunkSize);
+        for (ULONG_T j = 0; j < ChunkSize; j++) SendChunk[j] = (char)(i + j * 3);
+
+        IOC_Result_T Result = _PollingRingSend(SenderLinkID, SendChunk.data(), ChunkSize);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+        std::vector<char> RecvChunk(ChunkSize + 1);
+        ULONG_T RecvSize = 0;
+        Result = _PollingRingRecv(ReceiverLinkID, RecvChunk.data(), RecvChunk.size(), &RecvSize, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        ASSERT_EQ(ChunkSize, RecvSize);                                       // KeyVerifyPoint
+        ASSERT_EQ(0, memcmp(SendChunk.data(), RecvChunk.data(), ChunkSize));  // KeyVerifyPoint
+    }
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalPollingRing, verifyPollingRing_byRecvSmallerBuffer_expectBytesInOrder) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalPollingRing_US2_TC2_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _PollingRingSetupLink(&SrvURI, 0, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::vector<char> ChunkA(300, 'A'), ChunkB(300, 'B');
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _PollingRingSend(SenderLinkID, ChunkA.data(), ChunkA.size()));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _PollingRingSend(SenderLinkID, ChunkB.data(), ChunkB.size()));
+
+    //===BEHAVIOR===
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    std::string RecvBytes;
+    for (int i = 0; i < 3; i++) {
+        char RecvBuf[200] = {};
+        ULONG_T RecvSize = 0;
+        IOC_Result_T Result = _PollingRingRecv(ReceiverLinkID, RecvBuf, sizeof(RecvBuf), &RecvSize, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        ASSERT_EQ(sizeof(RecvBuf), RecvSize);  // KeyVerifyPoint
+        RecvBytes.append(RecvBuf, RecvSize);
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(std::string(300, 'A') + std::string(300, 'B'), RecvBytes);  // KeyVerifyPoint
+
+    ULONG_T RecvSize = 0;
+    char RecvBuf[16];
+    IOC_Option_defineTimeout(ShortOption, 10000);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, _PollingRingRecv(ReceiverLinkID, RecvBuf, sizeof(RecvBuf), &RecvSize, &ShortOption));
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalPollingRing, verifyPollingRing_byBlockingRecvBeforeSend_expectWokenBySend) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalPollingRing_US2_TC3_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _PollingRingSetupLink(&SrvURI, 0, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    char RecvBuf[64] = {};
+    ULONG_T RecvSize = 0;
+    IOC_Result_T RecvResult = IOC_RESULT_BUG;
+    std::chrono::steady_clock::time_point RecvEnd;
+    std::thread ReceiverThread([&] {
+        RecvResult = _PollingRingRecv(ReceiverLinkID, RecvBuf, sizeof(RecvBuf), &RecvSize, NULL);  // block forever
+        RecvEnd = std::chrono::steady_clock::now();
+    });
+
+    usleep(50000);
+    const char SendData[] = "WakeUpReceiver";
+    auto SendBegin = std::chrono::steady_clock::now();
+    IOC_Result_T Result = _PollingRingSend(SenderLinkID, SendData, sizeof(SendData));
+    ReceiverThread.join();
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, RecvResult);  // KeyVerifyPoint
+    ASSERT_EQ(sizeof(SendData), RecvSize);
+    ASSERT_STREQ(SendData, RecvBuf);
+    ASSERT_GE(RecvEnd, SendBegin);  // KeyVerifyPoint: parked until sent
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(RecvEnd - SendBegin).count(), 20);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalPollingRing, verifyPollingRing_byTCPConcurrentSendRecv_expectAllBytesInOrder) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalPollingRing_US2_TC4_1",
+        .Port = 19102,
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _PollingRingSetupLink(&SrvURI, 16 * 1024, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    const ULONG_T ChunkSize = 1024;
+    const int ChunkNum = 1000;
+
+    //===BEHAVIOR===
+    std::vector<char> RecvBytes;
+    std::atomic<ULONG_T> RecvByteNum(0);
+    IOC_Result_T RecvResult = IOC_RESULT_SUCCESS;
+    std::thread ReceiverThread([&] {
+        IOC_Option_defineTimeout(RecvOption, 3000000);
+        while (RecvBytes.size() < ChunkSize * ChunkNum && RecvResult == IOC_RESULT_SUCCESS) {
+            char RecvBuf[1500];
+            ULONG_T RecvSize = 0;
+            RecvResult = _PollingRingRecv(ReceiverLinkID, RecvBuf, sizeof(RecvBuf), &RecvSize, &RecvOption);
+            RecvBytes.insert(RecvBytes.end(), RecvBuf, RecvBuf + RecvSize);
+            RecvByteNum = RecvBytes.size();
+        }
+    });
+
+    // DatReceiver's credits fit the 16KB polling buffer, so a send with timeout waits for them instead of failing
+    IOC_Option_defineTimeout(SendOption, 3000000);
+    for (int i = 0; i < ChunkNum; i++) {
+        std::vector<char> Chunk(ChunkSize, (char)i);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _PollingRingSend(SenderLinkID, Chunk.data(), ChunkSize, &SendOption));
+        // Keep the sender from running far ahead of the receiver
+        for (int Retry = 0; Retry < 3000 && (i + 1) * ChunkSize - RecvByteNum > 8 * 1024; Retry++) {
+            usleep(1000);
+        }
+    }
+    ReceiverThread.join();
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, RecvResult);
+    ASSERT_EQ(ChunkSize * ChunkNum, RecvBytes.size());  // KeyVerifyPoint
+    for (int i = 0; i < ChunkNum; i++) {
+        ASSERT_EQ((char)i, RecvBytes[i * ChunkSize]);  // KeyVerifyPoint: in order
+        ASSERT_EQ((char)i, RecvBytes[i * ChunkSize + ChunkSize - 1]);
+    }
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -0,0 +1,429 @@
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * RecvVec here means IOC_recvDATv/IOC_peekDATv/IOC_consumeDAT of a DatReceiver without CbRecvDat_F,
+ *  which gets many whole data chunks by one call, each into one IOC_DatVec_T with its own length,
+ *  so the chunk boundaries made by DatSender's IOC_sendDAT are kept, unlike the byte stream of IOC_recvDAT.
+ *  IOC_peekDATv points IOC_DatVec_T::pData into IOC's polling buffer instead of copying,
+ *  until IOC_consumeDAT gives the chunks' space back to DatSender.
+ *
+ * RefDoc:
+ *  1) IOC_DatAPI.h::IOC_recvDATv/IOC_peekDATv/IOC_consumeDAT
+ *  2) UT_DataTypicalPollingRing.cxx
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatReceiver who parses messages from polled data,
+ *        I WANT TO receive many whole chunks by one IOC_recvDATv,
+ *        SO THAT I don't need to re-frame the byte stream and pay one call per chunk.
+ *  US-2: AS a DatReceiver who only inspects polled data,
+ *        I WANT TO peek chunks in IOC's buffer and consume them when I'm done,
+ *        SO THAT chunks are never copied on my side.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with 5 chunks of different sizes polling,
+ *         WHEN DatReceiver calls IOC_recvDATv with 8 DatVecs,
+ *         THEN it gets 5 chunks, each in one DatVec with its own length and bytes.
+ * AC-2@US-1: GIVEN DatReceiver's FIFO link with a 100 bytes chunk and a 300 bytes chunk polling,
+ *         WHEN DatReceiver calls IOC_recvDATv with DatVecs of 50 and 200 bytes, then of 200 and 200 bytes,
+ *         THEN it gets BUFFER_TOO_SMALL with DataLen=100 first, then only the 100 bytes chunk,
+ *          AND the 300 bytes chunk is kept for next IOC_recvDATv.
+ * AC-3@US-1: GIVEN DatReceiver's TCP link,
+ *         WHEN DatSender sends 10 chunks of different sizes,
+ *         THEN IOC_recvDATv gets each chunk whole in send order.
+ * AC-1@US-2: GIVEN DatReceiver's FIFO link with 2 chunks polling,
+ *         WHEN DatReceiver calls IOC_peekDATv, then IOC_consumeDAT the first chunk only,
+ *         THEN both chunks are peeked in place, and the next IOC_peekDATv gets the second chunk again,
+ *          AND IOC_consumeDAT without peeking returns INVALID_PARAM.
+ * AC-2@US-2: GIVEN DatReceiver's FIFO link with a chunk peeked by IOC_peekDATv in one thread,
+ *         WHEN another thread calls IOC_consumeDAT,
+ *         THEN it returns INVALID_PARAM and the peek is kept,
+ *          AND the peeking thread still consumes the chunk.
+ * AC-3@US-2: GIVEN DatReceiver's FIFO link with a chunk peeked by IOC_peekDATv,
+ *         WHEN the same thread calls IOC_recvDAT, IOC_recvDATv or IOC_peekDATv before IOC_consumeDAT,
+ *         THEN each returns BUSY at once instead of deadlocking,
+ *          AND after IOC_consumeDAT(0) the chunk is received by IOC_recvDAT.
+ * AC-4@US-2: GIVEN DatReceiver's FIFO link with a chunk peeked by IOC_peekDATv,
+ *         WHEN DatReceiver calls IOC_closeLink without IOC_consumeDAT,
+ *         THEN IOC_closeLink succeeds and drops the peek,
+ *          AND IOC_consumeDAT returns NOT_EXIST_LINK.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyRecvDATv_byManyChunksPolling_expectWholeChunks
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyRecvDATv_byChunkLargerThanDatVec_expectBufferTooSmallAndKept
+ *
+ * 【@AC-3@US-1】
+ *   TC-3.1:
+ *      @[Name]: verifyRecvDATv_byTCPChunks_expectWholeChunksInOrder
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyPeekDATv_byConsumePart_expectRestPeekedAgain
+ *
+ * 【@AC-2@US-2】
+ *   TC-2.1:
+ *      @[Name]: verifyConsumeDAT_byAnotherThreadWhilePeeking_expectInvalidParam
+ *
+ * 【@AC-3@US-2】
+ *   TC-3.1:
+ *      @[Name]: verifyRecvDAT_bySameThreadWhilePeeking_expectBusyThenRecvAfterConsume
+ *
+ * 【@AC-4@US-2】
+ *   TC-4.1:
+ *      @[Name]: verifyCloseLink_byPeekPending_expectPeekDropped
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+static void _RecvVecSetupLink(IOC_SrvURI_T *pSrvURI, IOC_SrvID_T *pSrvID, IOC_LinkID_T *pSenderLinkID,
+                              IOC_LinkID_T *pReceiverLinkID) {
+    static IOC_DatUsageArgs_T DatUsageArgs;
+    DatUsageArgs.CbRecvDat_F = NULL;  // polling mode
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _RecvVecSend(IOC_LinkID_T LinkID, const std::string &Chunk) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)Chunk.data();
+    DatDesc.Payload.PtrDataSize = Chunk.size();
+    DatDesc.Payload.PtrDataLen = Chunk.size();
+    return IOC_sendDAT(LinkID, &DatDesc, NULL);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyRecvDATv_byManyChunksPolling_expectWholeChunks) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US1_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::vector<std::string> SendChunks;
+    for (int i = 0; i < 5; i++) {
+        SendChunks.push_back(std::string(1 + i * 37, (char)('A' + i)));
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, SendChunks.back()));
+    }
+
+    //===BEHAVIOR===
+    char RecvBufs[8][256] = {};
+    IOC_DatVec_T DatVecs[8] = {};
+    for (int i = 0; i < 8; i++) {
+        DatVecs[i].pData = RecvBufs[i];
+        DatVecs[i].DataSize = sizeof(RecvBufs[i]);
+    }
+    ULONG_T RecvDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    IOC_Result_T Result = IOC_recvDATv(ReceiverLinkID, DatVecs, 8, &RecvDatNum, &RecvOption);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_EQ(5, RecvDatNum);  // KeyVerifyPoint: all in one call
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQ(SendChunks[i].size(), DatVecs[i].DataLen);  // KeyVerifyPoint: boundary kept
+        ASSERT_EQ(SendChunks[i], std::string(RecvBufs[i], DatVecs[i].DataLen));
+    }
+
+    IOC_Option_defineTimeout(ShortOption, 10000);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, IOC_recvDATv(ReceiverLinkID, DatVecs, 8, &RecvDatNum, &ShortOption));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_recvDATv(ReceiverLinkID, DatVecs, 0, &RecvDatNum, &ShortOption));
+    ASSERT_EQ(IOC_RESULT_INCOMPATIBLE_USAGE, IOC_recvDATv(SenderLinkID, DatVecs, 8, &RecvDatNum, &ShortOption));
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyRecvDATv_byChunkLargerThanDatVec_expectBufferTooSmallAndKept) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US1_TC2_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::string ChunkA(100, 'A'), ChunkB(300, 'B');
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkA));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkB));
+
+    //===BEHAVIOR&VERIFY===
+    char RecvBufs[2][400] = {};
+    IOC_DatVec_T DatVecs[2] = {{RecvBufs[0], 50, 0}, {RecvBufs[1], 200, 0}};
+    ULONG_T RecvDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    ASSERT_EQ(IOC_RESULT_BUFFER_TOO_SMALL, IOC_recvDATv(ReceiverLinkID, DatVecs, 2, &RecvDatNum, &RecvOption));
+    ASSERT_EQ(0, RecvDatNum);
+    ASSERT_EQ(ChunkA.size(), DatVecs[0].DataLen);  // KeyVerifyPoint: tell the size needed
+
+    DatVecs[0].DataSize = 200;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_recvDATv(ReceiverLinkID, DatVecs, 2, &RecvDatNum, &RecvOption));
+    ASSERT_EQ(1, RecvDatNum);  // KeyVerifyPoint: stop before the chunk larger than DatVecs[1]
+    ASSERT_EQ(ChunkA, std::string(RecvBufs[0], DatVecs[0].DataLen));
+
+    DatVecs[0].DataSize = sizeof(RecvBufs[0]);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_recvDATv(ReceiverLinkID, DatVecs, 2, &RecvDatNum, &RecvOption));
+    ASSERT_EQ(1, RecvDatNum);
+    ASSERT_EQ(ChunkB, std::string(RecvBufs[0], DatVecs[0].DataLen));  // KeyVerifyPoint: kept whole
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyRecvDATv_byTCPChunks_expectWholeChunksInOrder) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US1_TC3_1",
+        .Port = 19103,
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::vector<std::string> SendChunks;
+    for (int i = 0; i < 10; i++) {
+        SendChunks.push_back(std::string(1 + i * 101, (char)('a' + i)));
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, SendChunks.back()));
+    }
+
+    //===BEHAVIOR===
+    std::vector<std::string> RecvChunks;
+    IOC_Option_defineTimeout(RecvOption, 1000000);
+    while (RecvChunks.size() < SendChunks.size()) {
+        char RecvBufs[4][1024] = {};
+        IOC_DatVec_T DatVecs[4] = {};
+        for (int i = 0; i < 4; i++) {
+            DatVecs[i].pData = RecvBufs[i];
+            DatVecs[i].DataSize = sizeof(RecvBufs[i]);
+        }
+        ULONG_T RecvDatNum = 0;
+        IOC_Result_T Result = IOC_recvDATv(ReceiverLinkID, DatVecs, 4, &RecvDatNum, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        for (ULONG_T i = 0; i < RecvDatNum; i++) {
+            RecvChunks.push_back(std::string(RecvBufs[i], DatVecs[i].DataLen));
+        }
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(SendChunks, RecvChunks);  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyPeekDATv_byConsumePart_expectRestPeekedAgain) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US2_TC1_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_consumeDAT(ReceiverLinkID, 0));  // not peeking
+
+    std::string ChunkA = "HeaderOfMessageA", ChunkB(5000, 'B');
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkA));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkB));
+
+    //===BEHAVIOR&VERIFY===
+    IOC_DatVec_T DatVecs[4] = {};
+    ULONG_T PeekDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_peekDATv(ReceiverLinkID, DatVecs, 4, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(2, PeekDatNum);  // KeyVerifyPoint
+    ASSERT_EQ(ChunkA, std::string((char *)DatVecs[0].pData, DatVecs[0].DataLen));
+    ASSERT_EQ(ChunkB, std::string((char *)DatVecs[1].pData, DatVecs[1].DataLen));
+    void *pPeekedB = DatVecs[1].pData;
+
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_consumeDAT(ReceiverLinkID, 3));  // more than peeked, keep peeking
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_consumeDAT(ReceiverLinkID, 1));
+
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_peekDATv(ReceiverLinkID, DatVecs, 4, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(1, PeekDatNum);
+    ASSERT_EQ(pPeekedB, DatVecs[0].pData);  // KeyVerifyPoint: in place, never copied
+    ASSERT_EQ(ChunkB.size(), DatVecs[0].DataLen);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_consumeDAT(ReceiverLinkID, 1));
+
+    IOC_Option_defineTimeout(ShortOption, 10000);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, IOC_peekDATv(ReceiverLinkID, DatVecs, 4, &PeekDatNum, &ShortOption));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_consumeDAT(ReceiverLinkID, 0));  // failed peek holds nothing
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyConsumeDAT_byAnotherThreadWhilePeeking_expectInvalidParam) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US2_TC2_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::string ChunkA = "PeekedByMainThread";
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkA));
+
+    IOC_DatVec_T DatVecs[2] = {};
+    ULONG_T PeekDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_peekDATv(ReceiverLinkID, DatVecs, 2, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(1, PeekDatNum);
+
+    //===BEHAVIOR===
+    IOC_Result_T OtherResult = IOC_RESULT_BUG;
+    std::thread OtherThread([&] { OtherResult = IOC_consumeDAT(ReceiverLinkID, 1); });
+    OtherThread.join();
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, OtherResult);  // KeyVerifyPoint: never ends another thread's peek
+    ASSERT_EQ(ChunkA, std::string((char *)DatVecs[0].pData, DatVecs[0].DataLen));  // still peeked in place
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_consumeDAT(ReceiverLinkID, 1));
+
+    IOC_Option_defineTimeout(ShortOption, 10000);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, IOC_peekDATv(ReceiverLinkID, DatVecs, 2, &PeekDatNum, &ShortOption));
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+TEST(UT_DataTypicalRecvVec, verifyRecvDAT_bySameThreadWhilePeeking_expectBusyThenRecvAfterConsume) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US2_TC3_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::string ChunkA = "PeekedThenReceived";
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkA));
+
+    IOC_DatVec_T DatVecs[2] = {};
+    ULONG_T PeekDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_peekDATv(ReceiverLinkID, DatVecs, 2, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(1, PeekDatNum);
+
+    //===BEHAVIOR&VERIFY===
+    char RecvBuf[64] = {};
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = RecvBuf;
+    DatDesc.Payload.PtrDataSize = sizeof(RecvBuf);
+    ASSERT_EQ(IOC_RESULT_BUSY, IOC_recvDAT(ReceiverLinkID, &DatDesc, &RecvOption));  // KeyVerifyPoint
+
+    IOC_DatVec_T RecvDatVecs[1] = {{.pData = RecvBuf, .DataSize = sizeof(RecvBuf)}};
+    ULONG_T RecvDatNum = 0;
+    ASSERT_EQ(IOC_RESULT_BUSY, IOC_recvDATv(ReceiverLinkID, RecvDatVecs, 1, &RecvDatNum, &RecvOption));
+    IOC_DatVec_T PeekAgainDatVecs[2] = {};
+    ASSERT_EQ(IOC_RESULT_BUSY, IOC_peekDATv(ReceiverLinkID, PeekAgainDatVecs, 2, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(ChunkA, std::string((char *)DatVecs[0].pData, DatVecs[0].DataLen));  // still peeked in place
+
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_consumeDAT(ReceiverLinkID, 0));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_recvDAT(ReceiverLinkID, &DatDesc, &RecvOption));  // KeyVerifyPoint
+    ASSERT_EQ(ChunkA, std::string(RecvBuf, DatDesc.Payload.PtrDataSize));
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalRecvVec, verifyCloseLink_byPeekPending_expectPeekDropped) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalRecvVec_US2_TC4_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _RecvVecSetupLink(&SrvURI, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    std::string ChunkA = "PeekedThenClosed";
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _RecvVecSend(SenderLinkID, ChunkA));
+
+    IOC_DatVec_T DatVecs[2] = {};
+    ULONG_T PeekDatNum = 0;
+    IOC_Option_defineTimeout(RecvOption, 100000);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_peekDATv(ReceiverLinkID, DatVecs, 2, &PeekDatNum, &RecvOption));
+    ASSERT_EQ(1, PeekDatNum);
+
+    //===BEHAVIOR===
+    IOC_Result_T CloseResult = IOC_closeLink(ReceiverLinkID);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, CloseResult);                                 // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_NOT_EXIST_LINK, IOC_consumeDAT(ReceiverLinkID, 1));  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -0,0 +1,360 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Send completion here means a DatSender's IOC_sendDAT with IOC_OPTID_DAT_COMPLETION is completed once
+ *  DatReceiver consumed its data, with the result returned by the receiver's CbRecvDat_F,
+ *  either by a per-send CbDatCompleted_F, or by the link's completion queue polled by IOC_pollDatCompletions,
+ *  so DatSender keeps N sends in flight and recycles each buffer as soon as it's completed, both in FIFO and TCP.
+ *
+ * RefDoc:
+ *  1) IOC_Option.h::IOC_DatCompletion_T
+ *  2) IOC_DatAPI.h::IOC_pollDatCompletions
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender who sends asynchronously,
+ *        I WANT TO get a callback of each send's result from DatReceiver's CbRecvDat_F,
+ *        SO THAT I know when and how each data chunk is processed.
+ *  US-2: AS a DatSender pipeline with N buffers,
+ *        I WANT TO poll completions of many sends at once,
+ *        SO THAT I keep N sends in flight and recycle buffers as soon as they complete.
+ *  US-3: AS a DatSender,
+ *        I WANT TO get clear results polling completions wrongly or too early,
+ *        SO THAT I never wait for completions which will never come.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO or TCP link with CbRecvDat_F,
+ *         WHEN DatSender sends 100 chunks with a CbDatCompleted_F and Tag of each chunk's index, then flushes,
+ *         THEN CbDatCompleted_F got each Tag exactly once, with CbRecvDat_F's result and the chunk's DataSize.
+ * AC-1@US-2: GIVEN DatReceiver's FIFO or TCP link with CbRecvDat_F returning IOC_RESULT_BUFFER_FULL,
+ *         WHEN DatSender keeps 8 sends in flight by IOC_pollDatCompletions, until 200 chunks are sent,
+ *         THEN all 200 are completed once with IOC_RESULT_BUFFER_FULL, and never more than 8 in flight.
+ * AC-1@US-3: GIVEN a DatSender link without sends in flight,
+ *         WHEN IOC_pollDatCompletions NonBlock, or on DatReceiver's link,
+ *         THEN it returns IOC_RESULT_NO_DATA, or IOC_RESULT_INCOMPATIBLE_USAGE.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifySendCompletion_byFifoCallback_expectEachTagOnceWithRecvResult
+ *   TC-1.2:
+ *      @[Name]: verifySendCompletion_byTCPCallback_expectEachTagOnceWithRecvResult
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifySendCompletion_byFifoPollingPipeline_expectAllCompletedWithinInflight
+ *   TC-1.2:
+ *      @[Name]: verifySendCompletion_byTCPPollingPipeline_expectAllCompletedWithinInflight
+ *
+ * 【@AC-1@US-3】
+ *   TC-1.1:
+ *      @[Name]: verifyPollDatCompletions_byNonBlockOrReceiverLink_expectNoDataOrIncompatibleUsage
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+#define _COMPLETION_MAX_TAG_NUM 256
+
+typedef struct {
+    IOC_Result_T RecvResult;  // Returned by CbRecvDat_F
+    std::atomic<ULONG_T> RecvByteNum;
+} _CompletionRecvPriv_T;
+
+typedef struct {
+    std::atomic<ULONG_T> CompletedNum;
+    std::atomic<ULONG_T> TagCompletedNums[_COMPLETION_MAX_TAG_NUM];
+    std::atomic<ULONG_T> BadCompletionNum;  // wrong LinkID, Result or DataSize
+    IOC_LinkID_T SenderLinkID;
+    IOC_Result_T ExpectedResult;
+    ULONG_T ExpectedDataSize;
+} _CompletionSendPriv_T;
+
+static IOC_Result_T _CompletionCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _CompletionRecvPriv_T *pPriv = (_CompletionRecvPriv_T *)pCbPriv;
+    usleep(100);  // Slower than DatSender, so sends are really in flight
+
+    void *pData = NULL;
+    ULONG_T DataSize = 0;
+    IOC_getDatPayload(pDatDesc, &pData, &DataSize);
+    pPriv->RecvByteNum += DataSize;
+    return pPriv->RecvResult;
+}
+
+static void _CompletionCbDatCompleted_F(IOC_LinkID_T LinkID, const IOC_DatCompletion_pT pCompletion,
+                                        void *pCbPrivData) {
+    _CompletionSendPriv_T *pPriv = (_CompletionSendPriv_T *)pCbPrivData;
+    if (LinkID != pPriv->SenderLinkID || pCompletion->Result != pPriv->ExpectedResult ||
+        pCompletion->DataSize != pPriv->ExpectedDataSize || pCompletion->Tag >= _COMPLETION_MAX_TAG_NUM) {
+        pPriv->BadCompletionNum++;
+        return;
+    }
+    pPriv->TagCompletedNums[pCompletion->Tag]++;
+    pPriv->CompletedNum++;
+}
+
+static void _CompletionSetupLink(IOC_SrvURI_T *pSrvURI, IOC_DatUsageArgs_T *pDatUsageArgs, IOC_SrvID_T *pSrvID,
+                                 IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = pDatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static IOC_Result_T _CompletionSend(IOC_LinkID_T LinkID, const void *pData, ULONG_T DataSize,
+                                    IOC_Options_pT pOption) {
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = (void *)pData;
+    DatDesc.Payload.PtrDataSize = DataSize;
+    DatDesc.Payload.PtrDataLen = DataSize;
+    return IOC_sendDAT(LinkID, &DatDesc, pOption);
+}
+
+// Send ChunkNum chunks each with its index as Tag to CbDatCompleted_F, then flush, each Tag MUST be completed once
+static void _CompletionVerifyCallback(IOC_SrvURI_T *pSrvURI) {
+    //===SETUP===
+    _CompletionRecvPriv_T RecvPriv;
+    RecvPriv.RecvResult = IOC_RESULT_SUCCESS;
+    RecvPriv.RecvByteNum = 0;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _CompletionCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _CompletionSetupLink(pSrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    const ULONG_T ChunkNum = 100;
+    char Chunk[512] = {};
+    _CompletionSendPriv_T SendPriv;
+    SendPriv.CompletedNum = 0;
+    SendPriv.BadCompletionNum = 0;
+    for (ULONG_T i = 0; i < _COMPLETION_MAX_TAG_NUM; i++) {
+        SendPriv.TagCompletedNums[i] = 0;
+    }
+    SendPriv.SenderLinkID = SenderLinkID;
+    SendPriv.ExpectedResult = RecvPriv.RecvResult;
+    SendPriv.ExpectedDataSize = sizeof(Chunk);
+
+    //===BEHAVIOR===
+    IOC_Option_defineDatCompletion(SendOption, _CompletionCbDatCompleted_F, &SendPriv);
+    for (ULONG_T i = 0; i < ChunkNum; i++) {
+        SendOption.Payload.DatCompletion.Tag = i;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, _CompletionSend(SenderLinkID, Chunk, sizeof(Chunk), &SendOption));
+    }
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));  // Sends are completed before it returns
+
+    //===VERIFY===
+    ASSERT_EQ(0, SendPriv.BadCompletionNum);  // KeyVerifyPoint: CbRecvDat_F's result and DataSize
+    ASSERT_EQ(ChunkNum, SendPriv.CompletedNum);
+    for (ULONG_T i = 0; i < ChunkNum; i++) {
+        ASSERT_EQ(1, SendPriv.TagCompletedNums[i]) << "Tag=" << i;  // KeyVerifyPoint: each send exactly once
+    }
+    ASSERT_EQ(ChunkNum * sizeof(Chunk), RecvPriv.RecvByteNum);
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+// Keep InflightNum buffers in flight, recycling each by its polled completion, until ChunkNum chunks are sent
+static void _CompletionVerifyPollingPipeline(IOC_SrvURI_T *pSrvURI) {
+    //===SETUP===
+    _CompletionRecvPriv_T RecvPriv;
+    RecvPriv.RecvResult = IOC_RESULT_BUFFER_FULL;
+    RecvPriv.RecvByteNum = 0;
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _CompletionCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _CompletionSetupLink(pSrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    const ULONG_T ChunkNum = 200, InflightNum = 8, ChunkSize = 256;
+    std::vector<std::vector<char>> Bufs(InflightNum, std::vector<char>(ChunkSize));
+    std::vector<ULONG_T> FreeBufIdxs;
+    for (ULONG_T i = 0; i < InflightNum; i++) {
+        FreeBufIdxs.push_back(i);
+    }
+    std::vector<ULONG_T> TagCompletedNums(ChunkNum, 0);
+    std::vector<ULONG_T> BufTags(InflightNum, 0);
+
+    //===BEHAVIOR===
+    IOC_Option_defineDatCompletion(SendOption, NULL, NULL);
+    IOC_Option_defineTimeout(PollOption, 3000000);
+    ULONG_T SentNum = 0, CompletedNum = 0, BadCompletionNum = 0;
+    while (CompletedNum < ChunkNum) {
+        while (SentNum < ChunkNum && !FreeBufIdxs.empty()) {
+            ULONG_T BufIdx = FreeBufIdxs.back();
+            FreeBufIdxs.pop_back();
+            Bufs[BufIdx][0] = (char)SentNum;
+            BufTags[BufIdx] = SentNum;
+            SendOption.Payload.DatCompletion.Tag = BufIdx;  // Tag tells which buffer to recycle
+            ASSERT_EQ(IOC_RESULT_SUCCESS, _CompletionSend(SenderLinkID, Bufs[BufIdx].data(), ChunkSize, &SendOption));
+            SentNum++;
+        }
+
+        IOC_DatCompletion_T Completions[InflightNum];
+        ULONG_T CompletionNum = 0;
+        IOC_Result_T Result =
+            IOC_pollDatCompletions(SenderLinkID, Completions, InflightNum, &CompletionNum, &PollOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        ASSERT_GE(CompletionNum, 1);
+        for (ULONG_T i = 0; i < CompletionNum; i++) {
+            if (Completions[i].Result != RecvPriv.RecvResult || Completions[i].DataSize != ChunkSize ||
+                Completions[i].Tag >= InflightNum) {
+                BadCompletionNum++;
+                continue;
+            }
+            TagCompletedNums[BufTags[Completions[i].Tag]]++;
+            FreeBufIdxs.push_back(Completions[i].Tag);
+        }
+        CompletedNum += CompletionNum;
+        ASSERT_LE(SentNum - CompletedNum, InflightNum);
+    }
+
+    //===VERIFY===
+    ASSERT_EQ(0, BadCompletionNum);  // KeyVerifyPoint: CbRecvDat_F's result reported
+    ASSERT_EQ(ChunkNum, CompletedNum);
+    for (ULONG_T i = 0; i < ChunkNum; i++) {
+        ASSERT_EQ(1, TagCompletedNums[i]) << "Chunk=" << i;  // KeyVerifyPoint: each send exactly once
+    }
+    ASSERT_EQ(ChunkNum * ChunkSize, RecvPriv.RecvByteNum);
+
+    IOC_Option_defineNonBlock(NonBlockOption);
+    IOC_DatCompletion_T Completion;
+    ULONG_T CompletionNum = 0;
+    ASSERT_EQ(IOC_RESULT_NO_DATA, IOC_pollDatCompletions(SenderLinkID, &Completion, 1, &CompletionNum,
+                                                         &NonBlockOption));  // KeyVerifyPoint: nothing more
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalSendCompletion, verifySendCompletion_byFifoCallback_expectEachTagOnceWithRecvResult) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendCompletion_US1_TC1_1",
+    };
+    _CompletionVerifyCallback(&SrvURI);
+}
+
+TEST(UT_DataTypicalSendCompletion, verifySendCompletion_byTCPCallback_expectEachTagOnceWithRecvResult) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendCompletion_US1_TC1_2",
+        .Port = 19110,
+    };
+    _CompletionVerifyCallback(&SrvURI);
+}
+
+TEST(UT_DataTypicalSendCompletion, verifySendCompletion_byFifoPollingPipeline_expectAllCompletedWithinInflight) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendCompletion_US2_TC1_1",
+    };
+    _CompletionVerifyPollingPipeline(&SrvURI);
+}
+
+TEST(UT_DataTypicalSendCompletion, verifySendCompletion_byTCPPollingPipeline_expectAllCompletedWithinInflight) {
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendCompletion_US2_TC1_2",
+        .Port = 19111,
+    };
+    _CompletionVerifyPollingPipeline(&SrvURI);
+}
+
+TEST(UT_DataTypicalSendCompletion, verifyPollDatCompletions_byNonBlockOrReceiverLink_expectNoDataOrIncompatibleUsage) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendCompletion_US3_TC1_1",
+    };
+    _CompletionRecvPriv_T RecvPriv;
+    RecvPriv.RecvResult = IOC_RESULT_SUCCESS;
+    RecvPriv.RecvByteNum = 0;
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _CompletionCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvPriv;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _CompletionSetupLink(&SrvURI, &DatUsageArgs, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR & VERIFY===
+    IOC_Option_defineNonBlock(NonBlockOption);
+    IOC_DatCompletion_T Completion;
+    ULONG_T CompletionNum = 1;
+    ASSERT_EQ(IOC_RESULT_NO_DATA,
+              IOC_pollDatCompletions(SenderLinkID, &Completion, 1, &CompletionNum, &NonBlockOption));  // KeyVerifyPoint
+    ASSERT_EQ(0, CompletionNum);
+
+    // A send without IOC_OPTID_DAT_COMPLETION is never completed
+    char Chunk[64] = {};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, _CompletionSend(SenderLinkID, Chunk, sizeof(Chunk), NULL));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkID, NULL));
+    ASSERT_EQ(IOC_RESULT_NO_DATA,
+              IOC_pollDatCompletions(SenderLinkID, &Completion, 1, &CompletionNum, &NonBlockOption));
+
+    IOC_Option_defineTimeout(TimeoutOption, 10000);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT,
+              IOC_pollDatCompletions(SenderLinkID, &Completion, 1, &CompletionNum, &TimeoutOption));
+
+    ASSERT_EQ(IOC_RESULT_INCOMPATIBLE_USAGE,
+              IOC_pollDatCompletions(ReceiverLinkID, &Completion, 1, &CompletionNum, NULL));  // KeyVerifyPoint
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_pollDatCompletions(SenderLinkID, NULL, 1, &CompletionNum, NULL));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_pollDatCompletions(SenderLinkID, &Completion, 0, &CompletionNum, NULL));
+    ASSERT_EQ(IOC_RESULT_NOT_EXIST_LINK, IOC_pollDatCompletions(IOC_ID_INVALID, &Completion, 1, &CompletionNum, NULL));
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
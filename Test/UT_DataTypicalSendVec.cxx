@@ -0,0 +1,278 @@
+#include <unistd.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * SendVec here means IOC_sendDATv of a DatSender, which sends ONE data chunk made of many segments,
+ *  such as a fixed header and a large body in separate buffers, without DatSender concatenating them.
+ *  DatReceiver gets exactly what IOC_sendDAT of the concatenated buffer would give, both in FIFO and TCP.
+ *
+ * RefDoc:
+ *  1) IOC_DatAPI.h::IOC_sendDATv
+ *  2) UT_DataTypicalRecvVec.cxx
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender who builds messages from a header and a body in separate buffers,
+ *        I WANT TO send them by one IOC_sendDATv,
+ *        SO THAT I don't copy them into a temporary buffer before each send.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver's FIFO link with CbRecvDat_F,
+ *         WHEN DatSender sends 100 messages of a header and a body by IOC_sendDATv,
+ *         THEN CbRecvDat_F gets 100 chunks, each the header followed by the body.
+ * AC-2@US-1: GIVEN DatReceiver's FIFO link in polling mode,
+ *         WHEN DatSender sends 3 segments with an empty one in the middle by IOC_sendDATv,
+ *         THEN IOC_recvDATv gets ONE chunk of the 2 non-empty segments.
+ * AC-3@US-1: GIVEN DatReceiver's TCP link in polling mode,
+ *         WHEN DatSender sends 20 messages of a header and a body by IOC_sendDATv,
+ *         THEN IOC_recvDATv gets 20 chunks, each the header followed by the body.
+ * AC-4@US-1: GIVEN DatSender's FIFO link,
+ *         WHEN DatSender calls IOC_sendDATv with no segment, too many segments, a NULL segment or empty segments,
+ *         THEN it returns INVALID_PARAM or ZERO_DATA, and sends nothing.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifySendDATv_byHeaderBodyToCallback_expectOneChunkEach
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifySendDATv_byEmptyMiddleSegmentToPolling_expectOneChunk
+ *
+ * 【@AC-3@US-1】
+ *   TC-3.1:
+ *      @[Name]: verifySendDATv_byTCPHeaderBody_expectOneChunkEach
+ *
+ * 【@AC-4@US-1】
+ *   TC-4.1:
+ *      @[Name]: verifySendDATv_byInvalidSegments_expectErrorAndNothingSent
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::mutex Mutex;
+    std::vector<std::string> RecvChunks;
+} _SendVecRecvPriv_T;
+
+static IOC_Result_T _SendVecCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _SendVecRecvPriv_T *pPriv = (_SendVecRecvPriv_T *)pCbPriv;
+    void *pData = NULL;
+    ULONG_T DataLen = 0;
+    IOC_getDatPayload(pDatDesc, &pData, &DataLen);
+
+    std::lock_guard<std::mutex> Lock(pPriv->Mutex);
+    pPriv->RecvChunks.push_back(std::string((char *)pData, DataLen));
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _SendVecSetupLink(IOC_SrvURI_T *pSrvURI, _SendVecRecvPriv_T *pRecvPriv, IOC_SrvID_T *pSrvID,
+                              IOC_LinkID_T *pSenderLinkID, IOC_LinkID_T *pReceiverLinkID) {
+    static IOC_DatUsageArgs_T DatUsageArgs;
+    DatUsageArgs.CbRecvDat_F = pRecvPriv ? _SendVecCbRecvDat_F : NULL;  // NULL means polling mode
+    DatUsageArgs.pCbPrivData = pRecvPriv;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI = *pSrvURI;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = *pSrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    std::thread SenderThread([&] {
+        IOC_Result_T ThreadResult = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ThreadResult);
+    });
+    Result = IOC_acceptClient(*pSrvID, pReceiverLinkID, NULL);
+    SenderThread.join();
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+// Receive whole chunks by IOC_recvDATv until ChunkNum chunks are received or it fails
+static void _SendVecRecvChunks(IOC_LinkID_T LinkID, size_t ChunkNum, std::vector<std::string> *pRecvChunks) {
+    IOC_Option_defineTimeout(RecvOption, 1000000);
+    while (pRecvChunks->size() < ChunkNum) {
+        std::vector<char> RecvBufs[4];
+        IOC_DatVec_T DatVecs[4] = {};
+        for (int i = 0; i < 4; i++) {
+            RecvBufs[i].resize(8192);
+            DatVecs[i].pData = RecvBufs[i].data();
+            DatVecs[i].DataSize = RecvBufs[i].size();
+        }
+        ULONG_T RecvDatNum = 0;
+        IOC_Result_T Result = IOC_recvDATv(LinkID, DatVecs, 4, &RecvDatNum, &RecvOption);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+        for (ULONG_T i = 0; i < RecvDatNum; i++) {
+            pRecvChunks->push_back(std::string(RecvBufs[i].data(), DatVecs[i].DataLen));
+        }
+    }
+}
+
+TEST(UT_DataTypicalSendVec, verifySendDATv_byHeaderBodyToCallback_expectOneChunkEach) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendVec_US1_TC1_1",
+    };
+    _SendVecRecvPriv_T RecvPriv;
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _SendVecSetupLink(&SrvURI, &RecvPriv, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const int MsgNum = 100;
+    std::vector<std::string> SendMsgs;
+    for (int i = 0; i < MsgNum; i++) {
+        std::string Header = "HDR#" + std::to_string(i) + ";";
+        std::string Body(1000 + i * 10, (char)('a' + i % 26));
+        SendMsgs.push_back(Header + Body);
+
+        IOC_DatVec_T DatVecs[2] = {{(void *)Header.data(), 0, Header.size()}, {(void *)Body.data(), 0, Body.size()}};
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_sendDATv(SenderLinkID, DatVecs, 2, NULL));
+    }
+
+    for (int Retry = 0; Retry < 200; Retry++) {
+        {
+            std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+            if (RecvPriv.RecvChunks.size() >= (size_t)MsgNum) break;
+        }
+        usleep(10000);
+    }
+
+    //===VERIFY===
+    std::lock_guard<std::mutex> Lock(RecvPriv.Mutex);
+    ASSERT_EQ(SendMsgs, RecvPriv.RecvChunks);  // KeyVerifyPoint: one chunk per IOC_sendDATv, in order
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalSendVec, verifySendDATv_byEmptyMiddleSegmentToPolling_expectOneChunk) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendVec_US1_TC2_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _SendVecSetupLink(&SrvURI, NULL, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    std::string Header = "Header:", Body(3000, 'B');
+    IOC_DatVec_T DatVecs[3] = {
+        {(void *)Header.data(), 0, Header.size()}, {NULL, 0, 0}, {(void *)Body.data(), 0, Body.size()}};
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_sendDATv(SenderLinkID, DatVecs, 3, NULL));
+
+    std::vector<std::string> RecvChunks;
+    _SendVecRecvChunks(ReceiverLinkID, 1, &RecvChunks);
+
+    //===VERIFY===
+    ASSERT_EQ(1, RecvChunks.size());         // KeyVerifyPoint
+    ASSERT_EQ(Header + Body, RecvChunks[0]);  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalSendVec, verifySendDATv_byTCPHeaderBody_expectOneChunkEach) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_TCP,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendVec_US1_TC3_1",
+        .Port = 19104,
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _SendVecSetupLink(&SrvURI, NULL, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR===
+    const int MsgNum = 20;
+    std::vector<std::string> SendMsgs;
+    for (int i = 0; i < MsgNum; i++) {
+        std::string Header = "HDR#" + std::to_string(i) + ";";
+        std::string Body(500 + i * 100, (char)('A' + i));
+        SendMsgs.push_back(Header + Body);
+
+        IOC_DatVec_T DatVecs[2] = {{(void *)Header.data(), 0, Header.size()}, {(void *)Body.data(), 0, Body.size()}};
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_sendDATv(SenderLinkID, DatVecs, 2, NULL));
+    }
+
+    std::vector<std::string> RecvChunks;
+    _SendVecRecvChunks(ReceiverLinkID, MsgNum, &RecvChunks);
+
+    //===VERIFY===
+    ASSERT_EQ(SendMsgs, RecvChunks);  // KeyVerifyPoint: framed by one header each
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalSendVec, verifySendDATv_byInvalidSegments_expectErrorAndNothingSent) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {
+        .pProtocol = IOC_SRV_PROTO_FIFO,
+        .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+        .pPath = "UT_DataTypicalSendVec_US1_TC4_1",
+    };
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID, ReceiverLinkID = IOC_ID_INVALID;
+    _SendVecSetupLink(&SrvURI, NULL, &SrvID, &SenderLinkID, &ReceiverLinkID);
+
+    //===BEHAVIOR&VERIFY===
+    char Data[8] = "Segment";
+    IOC_DatVec_T DatVecs[IOC_DATVEC_MAX_NUM + 1] = {};
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_sendDATv(SenderLinkID, NULL, 1, NULL));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_sendDATv(SenderLinkID, DatVecs, 0, NULL));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_sendDATv(SenderLinkID, DatVecs, IOC_DATVEC_MAX_NUM + 1, NULL));
+    ASSERT_EQ(IOC_RESULT_ZERO_DATA, IOC_sendDATv(SenderLinkID, DatVecs, 2, NULL));
+
+    DatVecs[0] = {Data, 0, sizeof(Data)};
+    DatVecs[1] = {NULL, 0, 1};
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, IOC_sendDATv(SenderLinkID, DatVecs, 2, NULL));
+    ASSERT_EQ(IOC_RESULT_INCOMPATIBLE_USAGE, IOC_sendDATv(ReceiverLinkID, DatVecs, 1, NULL));
+
+    IOC_DatVec_T RecvVec = {Data, sizeof(Data), 0};
+    ULONG_T RecvDatNum = 0;
+    IOC_Option_defineTimeout(ShortOption, 10000);
+    IOC_Result_T Result = IOC_recvDATv(ReceiverLinkID, &RecvVec, 1, &RecvDatNum, &ShortOption);
+    ASSERT_EQ(IOC_RESULT_TIMEOUT, Result);  // KeyVerifyPoint: nothing sent
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_closeLink(ReceiverLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -0,0 +1,348 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * ZeroCopy here means DatSender wraps its own memory into a reference-counted IOC_DatBuf_T by IOC_wrapDatBuf,
+ *  and sets it to IOC_DatDesc_T::Payload.pDatBuf, then IOC_sendDAT holds it instead of copying pData,
+ *  so CbRecvDat_F gets the very same pData, and the release hook is called after the last holder released it,
+ *  which is DatSender after IOC_sendDAT returns, or CbRecvDat_F after it returns, or later if it held one more.
+ * Without Payload.pDatBuf, IOC still copies pData as before.
+ *
+ * RefDoc:
+ *  1) IOC_DatAPI.h::IOC_wrapDatBuf/IOC_holdDatBuf/IOC_releaseDatBuf
+ *  2) Source/_IOC_SrvProtoFifo.md::IOC_sendDAT vs CbRecvDat_F
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a DatSender who sends 1~4MB camera frames to a DatReceiver in the same process,
+ *        I WANT TO hand over each frame to IOC_sendDAT without IOC copying it,
+ *        SO THAT each frame is never copied, and I can recycle it once every DatReceiver is done with it.
+ *  US-2: AS a DatSender who sends data without IOC_DatBuf_T,
+ *        I WANT TO reuse my buffer right after IOC_sendDAT returns,
+ *        SO THAT copy semantics stays the default.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN DatReceiver with CbRecvDat_F on a FIFO link,
+ *         WHEN DatSender sends a 4MB frame with Payload.pDatBuf, and releases it after IOC_sendDAT returns,
+ *         THEN CbRecvDat_F gets the same pData with the same content,
+ *          AND the release hook is called once, after CbRecvDat_F returned.
+ * AC-2@US-1: GIVEN DatReceiver's CbRecvDat_F holds Payload.pDatBuf by IOC_holdDatBuf,
+ *         WHEN DatSender and CbRecvDat_F are both done,
+ *         THEN the release hook is NOT called until DatReceiver releases it by IOC_releaseDatBuf.
+ * AC-3@US-1: GIVEN DatSender wraps a frame into IOC_DatBuf_T,
+ *         WHEN DatSender sends with pData not inside Payload.pDatBuf,
+ *         THEN IOC_sendDAT returns INVALID_PARAM.
+ * AC-4@US-1: GIVEN DatSender wraps frames into IOC_DatBuf_T one by one,
+ *         WHEN each is held once more and released twice without being sent,
+ *         THEN the release hook is called once for each, only after its last release,
+ *          AND each IOC_DatBuf_T itself is freed too, which DiagASAN build checks as no leak.
+ * AC-1@US-2: GIVEN DatReceiver with CbRecvDat_F on a FIFO link,
+ *         WHEN DatSender sends without Payload.pDatBuf and overwrites its buffer right after IOC_sendDAT returns,
+ *         THEN CbRecvDat_F gets a copy with the content at IOC_sendDAT.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyZeroCopy_bySendWrappedDatBuf_expectSamePtrAndReleaseAfterCallback
+ *
+ * 【@AC-2@US-1】
+ *   TC-2.1:
+ *      @[Name]: verifyZeroCopy_byReceiverHoldDatBuf_expectReleaseAfterReceiverRelease
+ *
+ * 【@AC-3@US-1】
+ *   TC-3.1:
+ *      @[Name]: verifyZeroCopy_byPtrOutOfDatBuf_expectInvalidParam
+ *
+ * 【@AC-4@US-1】
+ *   TC-4.1:
+ *      @[Name]: verifyWrapDatBuf_byHoldAndReleaseWithoutSend_expectReleaseOnceAndNoLeak
+ *
+ * 【@AC-1@US-2】
+ *   TC-1.1:
+ *      @[Name]: verifyCopyByDefault_bySendWithoutDatBuf_expectCallbackGetsCopy
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<uint32_t> Seq;  // shared order of CbRecvDat_F and release hook
+
+    std::atomic<uint32_t> RecvDatCnt;
+    std::atomic<uint32_t> CbRecvDatEndSeq;
+    void *pRecvData;
+    ULONG_T RecvDataSize;
+    bool IsRecvDataSame;
+    const char *pExpectedData;
+
+    bool IsHoldDatBuf;
+    IOC_DatBuf_pT pHeldDatBuf;
+
+    std::atomic<uint32_t> ReleaseCnt;
+    std::atomic<uint32_t> ReleaseSeq;
+} _ZeroCopyPrivData_T;
+
+static IOC_Result_T _ZeroCopyCbRecvDat_F(IOC_LinkID_T LinkID, const IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _ZeroCopyPrivData_T *pPrivData = (_ZeroCopyPrivData_T *)pCbPriv;
+
+    pPrivData->pRecvData = pDatDesc->Payload.pData;
+    pPrivData->RecvDataSize = pDatDesc->Payload.PtrDataSize;
+    pPrivData->IsRecvDataSame =
+        (0 == memcmp(pDatDesc->Payload.pData, pPrivData->pExpectedData, pDatDesc->Payload.PtrDataSize));
+
+    if (pPrivData->IsHoldDatBuf && pDatDesc->Payload.pDatBuf) {
+        IOC_holdDatBuf(pDatDesc->Payload.pDatBuf);
+        pPrivData->pHeldDatBuf = pDatDesc->Payload.pDatBuf;
+    }
+
+    usleep(10000);  // let DatSender release its reference while CbRecvDat_F still runs
+
+    pPrivData->CbRecvDatEndSeq = ++pPrivData->Seq;
+    pPrivData->RecvDatCnt++;
+    return IOC_RESULT_SUCCESS;
+}
+
+static void _ZeroCopyCbReleaseDatBuf_F(void *pData, ULONG_T DataSize, void *pCbPriv) {
+    _ZeroCopyPrivData_T *pPrivData = (_ZeroCopyPrivData_T *)pCbPriv;
+    pPrivData->ReleaseSeq = ++pPrivData->Seq;
+    pPrivData->ReleaseCnt++;
+    free(pData);
+}
+
+static void _ZeroCopySetupFifoLink(const char *pPath, _ZeroCopyPrivData_T *pPrivData, IOC_SrvID_T *pSrvID,
+                                   IOC_LinkID_T *pSenderLinkID) {
+    static IOC_DatUsageArgs_T DatUsageArgs;
+    DatUsageArgs.CbRecvDat_F = _ZeroCopyCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = pPrivData;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_FIFO;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = pPath;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+    SrvArgs.Flags = IOC_SRVFLAG_AUTO_ACCEPT;
+
+    IOC_Result_T Result = IOC_onlineService(pSrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    IOC_ConnArgs_T ConnArgs = {};
+    IOC_Helper_initConnArgs(&ConnArgs);
+    ConnArgs.SrvURI = SrvArgs.SrvURI;
+    ConnArgs.Usage = IOC_LinkUsageDatSender;
+
+    Result = IOC_connectService(pSenderLinkID, &ConnArgs, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+}
+
+static void _ZeroCopyWaitRecvDat(_ZeroCopyPrivData_T *pPrivData, uint32_t RecvDatCnt) {
+    for (int i = 0; i < 3000 && pPrivData->RecvDatCnt < RecvDatCnt; i++) {
+        usleep(1000);
+    }
+    usleep(10000);  // the dispatcher releases its reference after CbRecvDat_F returns
+}
+
+TEST(UT_DataTypicalZeroCopy, verifyZeroCopy_bySendWrappedDatBuf_expectSamePtrAndReleaseAfterCallback) {
+    //===SETUP===
+    _ZeroCopyPrivData_T PrivData = {};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _ZeroCopySetupFifoLink("UT_DataTypicalZeroCopy_TC1_1", &PrivData, &SrvID, &SenderLinkID);
+
+    const ULONG_T FrameSize = 4 * 1024 * 1024;
+    char *pFrame = (char *)malloc(FrameSize);
+    ASSERT_NE(nullptr, pFrame);
+    for (ULONG_T i = 0; i < FrameSize; i++) pFrame[i] = (char)(i * 7);
+    PrivData.pExpectedData = pFrame;
+
+    IOC_DatBuf_pT pDatBuf = NULL;
+    IOC_Result_T Result = IOC_wrapDatBuf(pFrame, FrameSize, _ZeroCopyCbReleaseDatBuf_F, &PrivData, &pDatBuf);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    //===BEHAVIOR===
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pDatBuf = pDatBuf;
+    DatDesc.Payload.pData = pFrame;
+    DatDesc.Payload.PtrDataSize = FrameSize;
+    DatDesc.Payload.PtrDataLen = FrameSize;
+
+    Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+    IOC_releaseDatBuf(pDatBuf);  // DatSender is done with the frame
+    _ZeroCopyWaitRecvDat(&PrivData, 1);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);          // KeyVerifyPoint
+    ASSERT_EQ(1, PrivData.RecvDatCnt.load());
+    ASSERT_EQ((void *)pFrame, PrivData.pRecvData);  // KeyVerifyPoint: not copied
+    ASSERT_EQ(FrameSize, PrivData.RecvDataSize);
+    ASSERT_TRUE(PrivData.IsRecvDataSame);
+
+    ASSERT_EQ(1, PrivData.ReleaseCnt.load());                                  // KeyVerifyPoint
+    ASSERT_GT(PrivData.ReleaseSeq.load(), PrivData.CbRecvDatEndSeq.load());  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalZeroCopy, verifyZeroCopy_byReceiverHoldDatBuf_expectReleaseAfterReceiverRelease) {
+    //===SETUP===
+    _ZeroCopyPrivData_T PrivData = {};
+    PrivData.IsHoldDatBuf = true;
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _ZeroCopySetupFifoLink("UT_DataTypicalZeroCopy_TC2_1", &PrivData, &SrvID, &SenderLinkID);
+
+    const ULONG_T FrameSize = 1024 * 1024;
+    char *pFrame = (char *)calloc(1, FrameSize);
+    ASSERT_NE(nullptr, pFrame);
+    PrivData.pExpectedData = pFrame;
+
+    IOC_DatBuf_pT pDatBuf = NULL;
+    IOC_Result_T Result = IOC_wrapDatBuf(pFrame, FrameSize, _ZeroCopyCbReleaseDatBuf_F, &PrivData, &pDatBuf);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    //===BEHAVIOR===
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pDatBuf = pDatBuf;
+    DatDesc.Payload.pData = pFrame;
+    DatDesc.Payload.PtrDataSize = FrameSize;
+    DatDesc.Payload.PtrDataLen = FrameSize;
+
+    Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    IOC_releaseDatBuf(pDatBuf);
+    _ZeroCopyWaitRecvDat(&PrivData, 1);
+
+    //===VERIFY===
+    ASSERT_EQ(1, PrivData.RecvDatCnt.load());
+    ASSERT_EQ(pDatBuf, PrivData.pHeldDatBuf);
+    ASSERT_EQ(0, PrivData.ReleaseCnt.load());  // KeyVerifyPoint: DatReceiver still holds it
+
+    IOC_releaseDatBuf(PrivData.pHeldDatBuf);
+    ASSERT_EQ(1, PrivData.ReleaseCnt.load());  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalZeroCopy, verifyZeroCopy_byPtrOutOfDatBuf_expectInvalidParam) {
+    //===SETUP===
+    _ZeroCopyPrivData_T PrivData = {};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _ZeroCopySetupFifoLink("UT_DataTypicalZeroCopy_TC3_1", &PrivData, &SrvID, &SenderLinkID);
+
+    const ULONG_T FrameSize = 4096;
+    char *pFrame = (char *)calloc(1, FrameSize);
+    ASSERT_NE(nullptr, pFrame);
+
+    IOC_DatBuf_pT pDatBuf = NULL;
+    IOC_Result_T Result = IOC_wrapDatBuf(pFrame, FrameSize, _ZeroCopyCbReleaseDatBuf_F, &PrivData, &pDatBuf);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+    //===BEHAVIOR&VERIFY===
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pDatBuf = pDatBuf;
+    DatDesc.Payload.pData = pFrame + 1024;
+    DatDesc.Payload.PtrDataSize = FrameSize;  // 1024 bytes beyond pFrame's end
+    DatDesc.Payload.PtrDataLen = FrameSize;
+
+    Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, Result);  // KeyVerifyPoint
+
+    char OtherData[16] = {};
+    DatDesc.Payload.pData = OtherData;
+    DatDesc.Payload.PtrDataSize = sizeof(OtherData);
+    DatDesc.Payload.PtrDataLen = sizeof(OtherData);
+
+    Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, Result);  // KeyVerifyPoint
+
+    IOC_releaseDatBuf(pDatBuf);
+    ASSERT_EQ(1, PrivData.ReleaseCnt.load());
+    ASSERT_EQ(0, PrivData.RecvDatCnt.load());
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+
+TEST(UT_DataTypicalZeroCopy, verifyWrapDatBuf_byHoldAndReleaseWithoutSend_expectReleaseOnceAndNoLeak) {
+    //===SETUP===
+    _ZeroCopyPrivData_T PrivData = {};
+    const uint32_t FrameNum = 1000;  // many malloc/free rounds, so a wrapped DatBuf may reuse any freed memory
+
+    for (uint32_t i = 0; i < FrameNum; i++) {
+        char *pFrame = (char *)malloc(4096);
+        ASSERT_NE(nullptr, pFrame);
+
+        IOC_DatBuf_pT pDatBuf = NULL;
+        IOC_Result_T Result = IOC_wrapDatBuf(pFrame, 4096, _ZeroCopyCbReleaseDatBuf_F, &PrivData, &pDatBuf);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+
+        //===BEHAVIOR===
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_holdDatBuf(pDatBuf));
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_releaseDatBuf(pDatBuf));
+
+        //===VERIFY===
+        ASSERT_EQ(i, PrivData.ReleaseCnt.load());  // KeyVerifyPoint: still held once
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_releaseDatBuf(pDatBuf));
+        ASSERT_EQ(i + 1, PrivData.ReleaseCnt.load());  // KeyVerifyPoint
+    }
+}
+
+TEST(UT_DataTypicalZeroCopy, verifyCopyByDefault_bySendWithoutDatBuf_expectCallbackGetsCopy) {
+    //===SETUP===
+    _ZeroCopyPrivData_T PrivData = {};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_LinkID_T SenderLinkID = IOC_ID_INVALID;
+    _ZeroCopySetupFifoLink("UT_DataTypicalZeroCopy_TC4_1", &PrivData, &SrvID, &SenderLinkID);
+
+    const ULONG_T DataSize = 64 * 1024;
+    std::vector<char> SendData(DataSize, 'A');
+    std::vector<char> ExpectedData(DataSize, 'A');
+    PrivData.pExpectedData = ExpectedData.data();
+
+    //===BEHAVIOR===
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = SendData.data();
+    DatDesc.Payload.PtrDataSize = DataSize;
+    DatDesc.Payload.PtrDataLen = DataSize;
+
+    IOC_Result_T Result = IOC_sendDAT(SenderLinkID, &DatDesc, NULL);
+    memset(SendData.data(), 'B', DataSize);  // reuse the buffer right after sending
+    _ZeroCopyWaitRecvDat(&PrivData, 1);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);
+    ASSERT_EQ(1, PrivData.RecvDatCnt.load());
+    ASSERT_NE((void *)SendData.data(), PrivData.pRecvData);  // KeyVerifyPoint: copied
+    ASSERT_TRUE(PrivData.IsRecvDataSame);                    // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(SenderLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
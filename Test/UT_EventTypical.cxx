@@ -65,6 +65,9 @@
  *  AC-2: GIVEN rapid sequential events on a link,
  *         WHEN posted in order,
  *         THEN they are observed in-order per-link.
+ *  AC-3: GIVEN a Conet service (consumer) whose callback posts again to the client producer link,
+ *         WHEN the client posts an event to the link,
+ *         THEN the re-entrant post from the callback is also processed without deadlock.
  */
 //=======>END OF ACCEPTANCE CRITERIA================================================================
 
@@ -108,6 +111,15 @@
  *   3) Service callback records timestamps/order.
  *   4) Assert received sequence matches sent sequence.
  *
+ * [@AC-3,US-2] TC-1: verifyReentrantPost_byPostingFromPeerCallback_expectNoDeadlock
+ * Test: verifyReentrantPost_byPostingFromPeerCallback_expectNoDeadlock
+ * Purpose: Ensure callbacks of the peer are executed without holding the posting link's lock.
+ * Steps:
+ *   1) Service online (EvtConsumer); client connects (EvtProducer).
+ *   2) Service callback posts EvtValue=2 via the same client link when it gets EvtValue=1.
+ *   3) Client posts EvtValue=1.
+ *   4) Assert both events are processed and the nested post returned SUCCESS.
+ *
  * [@AC-3,US-1] TC-1: verifyOfflineLifecycle_byServiceShutdown_expectCleanup
  * Test: verifyOfflineLifecycle_byServiceShutdown_expectCleanup
  * Purpose: Validate links and callbacks are cleaned up when service goes offline.
@@ -473,6 +485,81 @@ TEST(UT_ConetEventTypical, verifyOrderPerLink_bySequentialEvents_expectInOrderOb
     if (SrvID != IOC_ID_INVALID) IOC_offlineService(SrvID);
 }
 
+// Callback context for re-entrant posting
+typedef struct __EvtReentrantPriv {
+    IOC_LinkID_T CliLinkID{IOC_ID_INVALID};
+    std::atomic<int> ReceivedCount{0};
+    std::atomic<IOC_Result_T> NestedPostResult{IOC_RESULT_BUG};
+} __EvtReentrantPriv_T;
+
+static IOC_Result_T __EvtTypical_ReentrantCb(const IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    __EvtReentrantPriv_T *pPrivData = (__EvtReentrantPriv_T *)pCbPriv;
+    if (!pPrivData || !pEvtDesc) return IOC_RESULT_INVALID_PARAM;
+
+    pPrivData->ReceivedCount++;
+    if (1 == IOC_EvtDesc_getEvtValue((IOC_EvtDesc_pT)pEvtDesc)) {
+        IOC_EvtDesc_T NestedEvtDesc = {};
+        NestedEvtDesc.EvtID = IOC_EVTID_TEST_KEEPALIVE;
+        NestedEvtDesc.EvtValue = 2;
+        pPrivData->NestedPostResult = IOC_postEVT(pPrivData->CliLinkID, &NestedEvtDesc, NULL);
+    }
+    return IOC_RESULT_SUCCESS;
+}
+
+// [@AC-3,US-2] TC-1: verifyReentrantPost_byPostingFromPeerCallback_expectNoDeadlock
+TEST(UT_ConetEventTypical, verifyReentrantPost_byPostingFromPeerCallback_expectNoDeadlock) {
+    IOC_Result_T ResultValue = IOC_RESULT_BUG;
+
+    // Service setup (Conet consumer with re-posting callback)
+    __EvtReentrantPriv_T SrvPriv = {};
+    IOC_SrvURI_T SrvURI = {.pProtocol = IOC_SRV_PROTO_FIFO,
+                           .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+                           .pPath = (const char *)"EvtTypical_ReentrantPost"};
+    IOC_SrvArgs_T SrvArgs = {.SrvURI = SrvURI, .Flags = IOC_SRVFLAG_NONE, .UsageCapabilites = IOC_LinkUsageEvtConsumer};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    ResultValue = IOC_onlineService(&SrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ResultValue);
+
+    IOC_ConnArgs_T ConnArgs = {.SrvURI = SrvURI, .Usage = IOC_LinkUsageEvtProducer};
+    IOC_LinkID_T CliLinkID = IOC_ID_INVALID;
+    std::thread CliThread([&] {
+        IOC_Result_T ResultValueInThread = IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ResultValueInThread);
+    });
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID;
+    ResultValue = IOC_acceptClient(SrvID, &SrvLinkID, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ResultValue);
+    if (CliThread.joinable()) CliThread.join();
+    ASSERT_NE(IOC_ID_INVALID, CliLinkID);
+    SrvPriv.CliLinkID = CliLinkID;
+
+    static IOC_EvtID_T SubEvtIDs[1] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T Sub = {
+        .CbProcEvt_F = __EvtTypical_ReentrantCb, .pCbPrivData = &SrvPriv, .EvtNum = 1, .pEvtIDs = &SubEvtIDs[0]};
+    ResultValue = IOC_subEVT(SrvLinkID, &Sub);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ResultValue);
+
+    // Client posts the first event, whose callback posts the second one via the same link
+    IOC_EvtDesc_T EvtDesc = {};
+    EvtDesc.EvtID = IOC_EVTID_TEST_KEEPALIVE;
+    EvtDesc.EvtValue = 1;
+    ResultValue = IOC_postEVT(CliLinkID, &EvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ResultValue);
+
+    for (int i = 0; i < 60 && SrvPriv.ReceivedCount.load() < 2; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(2, SrvPriv.ReceivedCount.load());
+    ASSERT_EQ(IOC_RESULT_SUCCESS, SrvPriv.NestedPostResult.load());
+
+    // Cleanup
+    if (CliLinkID != IOC_ID_INVALID) IOC_closeLink(CliLinkID);
+    if (SrvLinkID != IOC_ID_INVALID) IOC_closeLink(SrvLinkID);
+    if (SrvID != IOC_ID_INVALID) IOC_offlineService(SrvID);
+}
+
 // [@AC-3,US-1] TC-1: verifyOfflineLifecycle_byServiceShutdown_expectCleanup
 TEST(UT_ConetEventTypical, verifyOfflineLifecycle_byServiceShutdown_expectCleanup) {
     IOC_Result_T ResultValue = IOC_RESULT_BUG;
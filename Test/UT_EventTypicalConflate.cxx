@@ -0,0 +1,280 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Conflate here means IOC_OPTID_CONFLATE of ASYNC postEVT, an EvtDesc posted with it replaces the value of
+ *  the pending EvtDesc of the same EvtID which is also posted with it, instead of queuing a new one,
+ *  so a slow EvtConsumer only receives the latest value of each EvtID(such as state or position),
+ *  and the queue depth is bounded by the number of distinct EvtIDs, not by the posting rate.
+ *
+ * RefDoc:
+ *  1) IOC_Option.h::IOC_OPTID_CONFLATE
+ *  2) Source/_IOC_EvtDescQueue.md::Conflating Enqueue
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS an EvtProducer who posts state events much faster than the EvtConsumer,
+ *        I WANT TO post with IOC_OPTID_CONFLATE,
+ *        SO THAT the EvtConsumer only receives the latest value of each EvtID and I'm never blocked by it.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN EvtConsumer in ConlesMode is blocked in CbProcEvt,
+ *         WHEN EvtProducer posts N KEEPALIVE and N MOVE_KEEPING with IOC_OPTID_CONFLATE, N > EvtDescQueue's capacity,
+ *         THEN each postEVT returns SUCCESS without blocking,
+ *          AND EvtConsumer receives KEEPALIVE then MOVE_KEEPING once each with the last posted value.
+ *
+ * AC-2@US-1: GIVEN EvtConsumer in ConetMode(FIFO) polls KEEPALIVE by IOC_pullEVT,
+ *         WHEN EvtProducer posts N KEEPALIVE with IOC_OPTID_CONFLATE before EvtConsumer pulls,
+ *         THEN EvtConsumer pulls KEEPALIVE once with the last posted value, and then NO_EVENT_PENDING.
+ *
+ * AC-3@US-1: GIVEN EvtConsumer in ConetMode(FIFO) whose polling queue is full of KEEPALIVE posted without conflating,
+ *         WHEN EvtProducer posts MOVE_KEEPING with IOC_OPTID_CONFLATE,
+ *         THEN postEVT returns TOO_MANY_QUEUING_EVTDESC instead of SUCCESS,
+ *          AND EvtConsumer only pulls the KEEPALIVEs whose postEVT returned SUCCESS.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1】
+ *   TC-1.1:
+ *      @[Name]: verifyConflate_byBlockedConlesConsumerAndPostManyEvts_expectLatestValueOncePerEvtID
+ *
+ * 【@AC-2】
+ *   TC-2.1:
+ *      @[Name]: verifyConflate_byFifoPollingConsumerAndPostManyEvts_expectLatestValuePulledOnce
+ *
+ * 【@AC-3】
+ *   TC-3.1:
+ *      @[Name]: verifyConflate_byFifoPollingQueueFull_expectTooManyQueuingEvtDesc
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+typedef struct {
+    std::atomic<bool> IsBlocked;
+    std::atomic<bool> IsReleased;
+
+    std::atomic<uint32_t> RecvEvtCnt;  // not include TEST_SLEEP_999MS
+    IOC_EvtID_T RecvEvtIDs[16];
+    ULONG_T RecvEvtValues[16];
+} _ConflateCbPrivData_T;
+
+static IOC_Result_T _ConflateCbProcEvt_blockOrRecord(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _ConflateCbPrivData_T *pCbPrivData = (_ConflateCbPrivData_T *)pCbPriv;
+
+    if (pEvtDesc->EvtID == IOC_EVTID_TEST_SLEEP_999MS) {
+        pCbPrivData->IsBlocked = true;
+        for (int i = 0; i < 5000 && !pCbPrivData->IsReleased; i++) {
+            usleep(1000);
+        }
+        pCbPrivData->IsBlocked = false;
+        return IOC_RESULT_SUCCESS;
+    }
+
+    uint32_t Idx = pCbPrivData->RecvEvtCnt;
+    if (Idx < IOC_calcArrayElmtCnt(pCbPrivData->RecvEvtIDs)) {
+        pCbPrivData->RecvEvtIDs[Idx] = pEvtDesc->EvtID;
+        pCbPrivData->RecvEvtValues[Idx] = pEvtDesc->EvtValue;
+    }
+    pCbPrivData->RecvEvtCnt++;
+    return IOC_RESULT_SUCCESS;
+}
+
+#define _ConflatePostEvtCnt 1000
+
+// [@AC-1,US-1] TC-1.1
+TEST(UT_EventTypicalConflate, verifyConflate_byBlockedConlesConsumerAndPostManyEvts_expectLatestValueOncePerEvtID) {
+    //===SETUP===
+    _ConflateCbPrivData_T *pCbPrivData = new _ConflateCbPrivData_T();
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_SLEEP_999MS, IOC_EVTID_TEST_KEEPALIVE, IOC_EVTID_TEST_MOVE_KEEPING};
+    IOC_SubEvtArgs_T SubEvtArgs = {
+        .CbProcEvt_F = _ConflateCbProcEvt_blockOrRecord,
+        .pCbPrivData = pCbPrivData,
+        .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+        .pEvtIDs = SubEvtIDs,
+    };
+    IOC_Result_T Result = IOC_subEVT_inConlesMode(&SubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_EvtDesc_T SleepEvtDesc = {.EvtID = IOC_EVTID_TEST_SLEEP_999MS};
+    Result = IOC_postEVT_inConlesMode(&SleepEvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    for (int i = 0; i < 1000 && !pCbPrivData->IsBlocked; i++) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(pCbPrivData->IsBlocked);  // CheckPoint
+
+    //===BEHAVIOR===
+    // NonBlock together, so any post which needs a new slot beyond distinct EvtIDs fails here.
+    IOC_Option_defineASyncNonBlock(OptASyncConflate);
+    OptASyncConflate.IDs = (IOC_OptionsID_T)(OptASyncConflate.IDs | IOC_OPTID_CONFLATE);
+
+    for (ULONG_T i = 0; i < _ConflatePostEvtCnt; i++) {
+        IOC_EvtDesc_T KeepAliveEvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = i};
+        Result = IOC_postEVT_inConlesMode(&KeepAliveEvtDesc, &OptASyncConflate);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint
+
+        IOC_EvtDesc_T MoveEvtDesc = {.EvtID = IOC_EVTID_TEST_MOVE_KEEPING, .EvtValue = i};
+        Result = IOC_postEVT_inConlesMode(&MoveEvtDesc, &OptASyncConflate);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // KeyVerifyPoint
+    }
+    ASSERT_TRUE(pCbPrivData->IsBlocked);  // CheckPoint
+
+    pCbPrivData->IsReleased = true;
+    IOC_forceProcEVT();
+
+    //===VERIFY===
+    ASSERT_EQ(2, pCbPrivData->RecvEvtCnt);                                     // KeyVerifyPoint
+    ASSERT_EQ(IOC_EVTID_TEST_KEEPALIVE, pCbPrivData->RecvEvtIDs[0]);           // KeyVerifyPoint
+    ASSERT_EQ(_ConflatePostEvtCnt - 1, pCbPrivData->RecvEvtValues[0]);         // KeyVerifyPoint
+    ASSERT_EQ(IOC_EVTID_TEST_MOVE_KEEPING, pCbPrivData->RecvEvtIDs[1]);        // KeyVerifyPoint
+    ASSERT_EQ(_ConflatePostEvtCnt - 1, pCbPrivData->RecvEvtValues[1]);         // KeyVerifyPoint
+
+    // Conflating is over once the pending one is dequeued, the next post is delivered again.
+    IOC_EvtDesc_T KeepAliveEvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = _ConflatePostEvtCnt};
+    Result = IOC_postEVT_inConlesMode(&KeepAliveEvtDesc, &OptASyncConflate);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    IOC_forceProcEVT();
+    ASSERT_EQ(3, pCbPrivData->RecvEvtCnt);                              // KeyVerifyPoint
+    ASSERT_EQ(_ConflatePostEvtCnt, pCbPrivData->RecvEvtValues[2]);      // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = _ConflateCbProcEvt_blockOrRecord, .pCbPrivData = pCbPrivData};
+    Result = IOC_unsubEVT_inConlesMode(&UnsubEvtArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    delete pCbPrivData;
+}
+
+// [@AC-2,US-1] TC-2.1
+TEST(UT_EventTypicalConflate, verifyConflate_byFifoPollingConsumerAndPostManyEvts_expectLatestValuePulledOnce) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {.pProtocol = IOC_SRV_PROTO_FIFO,
+                           .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+                           .pPath = (const char *)"EvtConflate_FifoPolling"};
+    IOC_SrvArgs_T SrvArgs = {.SrvURI = SrvURI, .Flags = IOC_SRVFLAG_NONE, .UsageCapabilites = IOC_LinkUsageEvtProducer};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_Result_T Result = IOC_onlineService(&SrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_EvtUsageArgs_T EvtUsageArgs = {.CbProcEvt_F = nullptr,  // No callback, only polling
+                                       .pCbPrivData = nullptr,
+                                       .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+                                       .pEvtIDs = SubEvtIDs};
+    IOC_ConnArgs_T ConnArgs = {.SrvURI = SrvURI, .Usage = IOC_LinkUsageEvtConsumer};
+    ConnArgs.UsageArgs.pEvt = &EvtUsageArgs;
+
+    IOC_LinkID_T CliLinkID = IOC_ID_INVALID;
+    std::thread CliThread([&] {
+        IOC_Result_T ResultInThread = IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ResultInThread);  // CheckPoint
+    });
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID;
+    Result = IOC_acceptClient(SrvID, &SrvLinkID, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    CliThread.join();
+
+    //===BEHAVIOR===
+    IOC_Option_defineASyncConflate(OptASyncConflate);
+    for (ULONG_T i = 0; i < _ConflatePostEvtCnt; i++) {
+        IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = i};
+        Result = IOC_postEVT(SrvLinkID, &EvtDesc, &OptASyncConflate);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    }
+
+    //===VERIFY===
+    IOC_EvtDesc_T PulledEvtDesc = {};
+    Result = IOC_pullEVT(CliLinkID, &PulledEvtDesc, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);                                    // KeyVerifyPoint
+    ASSERT_EQ(IOC_EVTID_TEST_KEEPALIVE, PulledEvtDesc.EvtID);                 // KeyVerifyPoint
+    ASSERT_EQ(_ConflatePostEvtCnt - 1, IOC_EvtDesc_getEvtValue(&PulledEvtDesc));  // KeyVerifyPoint
+
+    IOC_Option_defineSyncNonBlock(OptNonBlock);
+    Result = IOC_pullEVT(CliLinkID, &PulledEvtDesc, &OptNonBlock);
+    ASSERT_EQ(IOC_RESULT_NO_EVENT_PENDING, Result);  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(CliLinkID);
+    IOC_closeLink(SrvLinkID);
+    IOC_offlineService(SrvID);
+}
+
+// [@AC-3,US-1] TC-3.1
+TEST(UT_EventTypicalConflate, verifyConflate_byFifoPollingQueueFull_expectTooManyQueuingEvtDesc) {
+    //===SETUP===
+    IOC_SrvURI_T SrvURI = {.pProtocol = IOC_SRV_PROTO_FIFO,
+                           .pHost = IOC_SRV_HOST_LOCAL_PROCESS,
+                           .pPath = (const char *)"EvtConflate_FifoPollingFull"};
+    IOC_SrvArgs_T SrvArgs = {.SrvURI = SrvURI, .Flags = IOC_SRVFLAG_NONE, .UsageCapabilites = IOC_LinkUsageEvtProducer};
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    IOC_Result_T Result = IOC_onlineService(&SrvID, &SrvArgs);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+
+    IOC_EvtID_T SubEvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE, IOC_EVTID_TEST_MOVE_KEEPING};
+    IOC_EvtUsageArgs_T EvtUsageArgs = {.CbProcEvt_F = nullptr,  // No callback, only polling
+                                       .pCbPrivData = nullptr,
+                                       .EvtNum = IOC_calcArrayElmtCnt(SubEvtIDs),
+                                       .pEvtIDs = SubEvtIDs};
+    IOC_ConnArgs_T ConnArgs = {.SrvURI = SrvURI, .Usage = IOC_LinkUsageEvtConsumer};
+    ConnArgs.UsageArgs.pEvt = &EvtUsageArgs;
+
+    IOC_LinkID_T CliLinkID = IOC_ID_INVALID;
+    std::thread CliThread([&] {
+        IOC_Result_T ResultInThread = IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, ResultInThread);  // CheckPoint
+    });
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID;
+    Result = IOC_acceptClient(SrvID, &SrvLinkID, NULL);
+    ASSERT_EQ(IOC_RESULT_SUCCESS, Result);  // CheckPoint
+    CliThread.join();
+
+    // Fill the polling queue by KEEPALIVE without conflating
+    ULONG_T QueuedEvtCnt = 0;
+    for (ULONG_T i = 0; i < 100 * _ConflatePostEvtCnt; i++) {
+        IOC_EvtDesc_T EvtDesc = {.EvtID = IOC_EVTID_TEST_KEEPALIVE, .EvtValue = i};
+        Result = IOC_postEVT(SrvLinkID, &EvtDesc, NULL);
+        if (IOC_RESULT_SUCCESS != Result) break;
+        QueuedEvtCnt++;
+    }
+    ASSERT_EQ(IOC_RESULT_TOO_MANY_QUEUING_EVTDESC, Result);  // CheckPoint
+    ASSERT_GT(QueuedEvtCnt, 0);                              // CheckPoint
+
+    //===BEHAVIOR===
+    IOC_Option_defineASyncConflate(OptASyncConflate);
+    IOC_EvtDesc_T MoveEvtDesc = {.EvtID = IOC_EVTID_TEST_MOVE_KEEPING, .EvtValue = 1};
+    Result = IOC_postEVT(SrvLinkID, &MoveEvtDesc, &OptASyncConflate);
+
+    //===VERIFY===
+    ASSERT_EQ(IOC_RESULT_TOO_MANY_QUEUING_EVTDESC, Result);  // KeyVerifyPoint
+
+    IOC_Option_defineSyncNonBlock(OptNonBlock);
+    IOC_EvtDesc_T PulledEvtDesc = {};
+    for (ULONG_T i = 0; i < QueuedEvtCnt; i++) {
+        Result = IOC_pullEVT(CliLinkID, &PulledEvtDesc, &OptNonBlock);
+        ASSERT_EQ(IOC_RESULT_SUCCESS, Result);                     // KeyVerifyPoint
+        ASSERT_EQ(IOC_EVTID_TEST_KEEPALIVE, PulledEvtDesc.EvtID);  // KeyVerifyPoint
+    }
+    Result = IOC_pullEVT(CliLinkID, &PulledEvtDesc, &OptNonBlock);
+    ASSERT_EQ(IOC_RESULT_NO_EVENT_PENDING, Result);  // KeyVerifyPoint
+
+    //===CLEANUP===
+    IOC_closeLink(CliLinkID);
+    IOC_closeLink(SrvLinkID);
+    IOC_offlineService(SrvID);
+}
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================
@@ -0,0 +1,805 @@
+#include <dirent.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../Source/_IOC_TCPWire.h"
+#include "_UT_IOC_Common.h"
+
+//======BEGIN OF OVERVIEW OF THIS UNIT TESTING FILE================================================
+/**
+ * Benchmark how TCP services scale with many links on loopback, counting the process's threads
+ *  and its CPU time, both while links are idle and while all of them are busy receiving data.
+ *  TCP links are served by a shared reactor of a few threads instead of one receiving thread per link,
+ *  so hundreds of links cost neither hundreds of threads nor their context switches.
+ * Also benchmark how fast a storm of clients connecting at once is accepted,
+ *  by one listener, or by several sharing the port by SO_REUSEPORT, each on its own reactor shard.
+ * And benchmark how many small messages per second a link sends, each in one write at once,
+ *  or coalesced with others into fewer writes.
+ * And benchmark how fast a link receives data of mixed sizes, which is read by large reads into its buffer,
+ *  where smaller data is handled in place, while larger data is received into its own buffer.
+ * And benchmark how fast event and command descriptors are encoded and decoded by their compact wire format,
+ *  and how few bytes they take, then verify commands with payloads of all sizes go over it intact.
+ *
+ * RefDoc:
+ *  1) _IOC_Reactor.h
+ *  2) _IOC_SrvProtoTCP.c
+ *  3) _IOC_TCPWire.h
+ */
+//======END OF OVERVIEW OF THIS UNIT TESTING FILE==================================================
+
+//======BEGIN OF UNIT TESTING DESIGN===============================================================
+/**
+ * @brief 【User Story】
+ *
+ *  US-1: AS a TCP service developer with hundreds of clients,
+ *        I WANT each link to cost no thread of its own,
+ *        SO THAT my service neither runs out of threads nor burns CPU switching between them.
+ *
+ *  US-2: AS a TCP service developer facing many clients connecting at once,
+ *        I WANT to accept them by several listeners in parallel,
+ *        SO THAT connections are neither refused nor queued behind one accepting thread.
+ *
+ *  US-3: AS a TCP EvtProducer or DatSender of many small messages,
+ *        I WANT them written in as few syscalls as possible, within a delay I choose,
+ *        SO THAT my throughput isn't bounded by a syscall per message.
+ *
+ *  US-4: AS a TCP DatReceiver of data both small and large,
+ *        I WANT many small chunks received by one read, and large ones without extra copies,
+ *        SO THAT my throughput is bounded by neither reads per chunk nor copies per byte.
+ *
+ *  US-5: AS a TCP EvtProducer or CmdInitiator,
+ *        I WANT descriptors sent in a compact, versioned format instead of their raw memory,
+ *        SO THAT they take fewer bytes, and a peer of another version or ABI never misreads them.
+ */
+
+/**
+ * @brief 【Acceptance Criteria】
+ *
+ * AC-1@US-1: GIVEN a TCP DatReceiver service with 500 accepted links from 500 DatSender links,
+ *         WHEN all links are idle for 1s, then each link sends 100 chunks of 64B,
+ *         THEN all chunks are received, and the process runs far fewer threads than links all the time,
+ *          AND thread count and CPU time of both phases are reported.
+ *
+ * AC-1@US-2: GIVEN a TCP DatReceiver service with ListenerNum of 1, or 4 by SO_REUSEPORT,
+ *         WHEN 4 threads connect 1000 clients in rounds of 200, each round accepted then closed,
+ *         THEN all clients are connected and accepted by either ListenerNum,
+ *          AND accepted connections per second of both are reported.
+ *
+ * AC-1@US-3: GIVEN a TCP link of an EvtProducer posting ASYNC events, or of a DatSender sending 64B chunks,
+ *         WHEN 100000 messages are sent, written at once, or coalesced by Coalesce.MaxDelayUS of 1ms,
+ *         THEN all of them are received in order by the peer's callback,
+ *          AND messages per second of each are reported.
+ *
+ * AC-1@US-4: GIVEN a TCP link of a DatSender, and its DatReceiver by CbRecvDat_F or by IOC_recvDAT,
+ *         WHEN chunks cycling from 1B to 200KB are sent, written at once, or coalesced by MaxDelayUS of 1ms,
+ *         THEN every byte is received intact in order, each chunk alone by CbRecvDat_F,
+ *          AND MB per second of each are reported.
+ *
+ * AC-1@US-5: GIVEN events and commands of typical and extreme field values,
+ *         WHEN each is encoded and decoded 1000000 times,
+ *         THEN every decoded descriptor equals its original but its pointers, which are NULL,
+ *          AND an event takes a few dozen bytes at most, a typical one far less than sizeof(IOC_EvtDesc_T),
+ *          AND a descriptor of an unknown version, or truncated, is rejected,
+ *          AND encoded sizes and nanoseconds per round trip are reported.
+ *
+ * AC-2@US-5: GIVEN a TCP link of a CmdInitiator and a CmdExecutor echoing IN payload as OUT payload,
+ *         WHEN commands of payloads from 0B to 64KB are executed, both embedded and pointer-based,
+ *         THEN each OUT payload equals its IN payload, with Status and Result of the executor.
+ */
+
+/**
+ * @brief 【Test Cases】
+ *
+ * 【@AC-1@US-1】
+ *   TC-1.1:
+ *      @[Name]: verifyTCPLinkScalability_by500IdleAndBusyLinks_expectFewThreads
+ *
+ * 【@AC-1@US-2】
+ *   TC-2.1:
+ *      @[Name]: verifyTCPConnectStorm_byOneOrFourListeners_expectAllAccepted
+ *
+ * 【@AC-1@US-3】
+ *   TC-3.1:
+ *      @[Name]: verifyTCPSmallMsgThroughput_by64BEvtAndDat_expectAllReceivedInOrder
+ *
+ * 【@AC-1@US-4】
+ *   TC-4.1:
+ *      @[Name]: verifyTCPRecvMixedSizes_byChunksFrom1BTo200KB_expectAllIntactInOrder
+ *
+ * 【@AC-1@US-5】
+ *   TC-5.1:
+ *      @[Name]: verifyTCPWireCodec_byEvtAndCmdRoundTrips_expectCompactAndEqual
+ *
+ * 【@AC-2@US-5】
+ *   TC-5.2:
+ *      @[Name]: verifyTCPWireCmd_byEchoOfPayloadsFrom0BTo64KB_expectIntact
+ */
+//======END OF UNIT TESTING DESIGN=================================================================
+
+//======BEGIN OF UNIT TESTING IMPLEMENTATION=======================================================
+static ULONG_T _PerfTCPGetThreadNum(void) {
+    ULONG_T ThreadNum = 0;
+    DIR *pDir = opendir("/proc/self/task");
+    if (NULL == pDir) return 0;
+    for (struct dirent *pEntry = readdir(pDir); pEntry != NULL; pEntry = readdir(pDir)) {
+        if (pEntry->d_name[0] != '.') ThreadNum++;
+    }
+    closedir(pDir);
+    return ThreadNum;
+}
+
+static double _PerfTCPGetCpuSec(void) {
+    struct timespec Now;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &Now);
+    return Now.tv_sec + Now.tv_nsec / 1e9;
+}
+
+static double _PerfTCPGetWallSec(void) {
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return Now.tv_sec + Now.tv_nsec / 1e9;
+}
+
+static IOC_Result_T _PerfTCPCbRecvDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    std::atomic<ULONG_T> *pRecvByteNum = (std::atomic<ULONG_T> *)pCbPriv;
+    *pRecvByteNum += pDatDesc->Payload.PtrDataLen;
+    return IOC_RESULT_SUCCESS;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPLinkScalability_by500IdleAndBusyLinks_expectFewThreads) {
+    //===SETUP===
+    const ULONG_T LinkNum = 500, ChunkNumPerLink = 100;
+    std::atomic<ULONG_T> RecvByteNum{0};
+    ULONG_T BaseThreadNum = _PerfTCPGetThreadNum();
+
+    IOC_DatUsageArgs_T DatUsageArgs = {};
+    DatUsageArgs.CbRecvDat_F = _PerfTCPCbRecvDat_F;
+    DatUsageArgs.pCbPrivData = &RecvByteNum;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_TCP;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "UT_ServicePerformanceTCP_US1_TC1_1";
+    SrvArgs.SrvURI.Port = 19112;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.UsageArgs.pDat = &DatUsageArgs;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_onlineService(&SrvID, &SrvArgs));
+
+    std::vector<IOC_LinkID_T> SenderLinkIDs(LinkNum, IOC_ID_INVALID), ReceiverLinkIDs(LinkNum, IOC_ID_INVALID);
+    std::atomic<ULONG_T> ConnectedNum{0};
+    std::thread ConnectThread([&] {
+        IOC_ConnArgs_T ConnArgs = {};
+        IOC_Helper_initConnArgs(&ConnArgs);
+        ConnArgs.SrvURI = SrvArgs.SrvURI;
+        ConnArgs.Usage = IOC_LinkUsageDatSender;
+        for (ULONG_T i = 0; i < LinkNum; i++) {
+            if (IOC_connectService(&SenderLinkIDs[i], &ConnArgs, NULL) != IOC_RESULT_SUCCESS) break;
+            ConnectedNum++;
+        }
+    });
+    for (ULONG_T i = 0; i < LinkNum; i++) {
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_acceptClient(SrvID, &ReceiverLinkIDs[i], NULL)) << "i=" << i;
+    }
+    ConnectThread.join();
+    ASSERT_EQ(LinkNum, ConnectedNum.load());
+
+    //===BEHAVIOR===
+    // Idle: all links are connected, but nothing is sent
+    double IdleCpuSec = _PerfTCPGetCpuSec();
+    sleep(1);
+    IdleCpuSec = _PerfTCPGetCpuSec() - IdleCpuSec;
+    ULONG_T IdleThreadNum = _PerfTCPGetThreadNum() - BaseThreadNum;
+
+    // Busy: every link sends, round robin, while sampling the most threads ever running
+    std::atomic<bool> IsBusy{true};
+    std::atomic<ULONG_T> BusyThreadNum{0};
+    std::thread SampleThread([&] {
+        while (IsBusy) {
+            ULONG_T ThreadNum = _PerfTCPGetThreadNum() - BaseThreadNum - 1;  // Not this sampling thread
+            if (ThreadNum > BusyThreadNum) BusyThreadNum = ThreadNum;
+            usleep(10000);
+        }
+    });
+
+    char Chunk[64] = {};
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = Chunk;
+    DatDesc.Payload.PtrDataSize = sizeof(Chunk);
+    DatDesc.Payload.PtrDataLen = sizeof(Chunk);
+
+    double BusyWallSec = _PerfTCPGetWallSec(), BusyCpuSec = _PerfTCPGetCpuSec();
+    for (ULONG_T Round = 0; Round < ChunkNumPerLink; Round++) {
+        for (ULONG_T i = 0; i < LinkNum; i++) {
+            ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_sendDAT(SenderLinkIDs[i], &DatDesc, NULL));
+        }
+    }
+    for (ULONG_T i = 0; i < LinkNum; i++) {
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_flushDAT(SenderLinkIDs[i], NULL));
+    }
+    BusyWallSec = _PerfTCPGetWallSec() - BusyWallSec;
+    BusyCpuSec = _PerfTCPGetCpuSec() - BusyCpuSec;
+    IsBusy = false;
+    SampleThread.join();
+
+    ULONG_T ChunkNum = LinkNum * ChunkNumPerLink;
+    printf("📊 [TCP LINK SCALABILITY] %lu links\n", LinkNum);
+    printf("├─ Idle 1s: %lu threads, CPU %.1f ms\n", IdleThreadNum, IdleCpuSec * 1000);
+    printf("└─ Busy %lu x %zuB: %lu threads at most, CPU %.1f ms, wall %.1f ms, %.0f msgs/s\n", ChunkNum,
+           sizeof(Chunk), BusyThreadNum.load(), BusyCpuSec * 1000, BusyWallSec * 1000, ChunkNum / BusyWallSec);
+
+    //===VERIFY===
+    ASSERT_EQ(ChunkNum * sizeof(Chunk), RecvByteNum.load());
+    ASSERT_LT(IdleThreadNum, LinkNum / 8);  // KeyVerifyPoint: far fewer threads than links
+    ASSERT_LT(BusyThreadNum.load(), LinkNum / 8);
+
+    //===CLEANUP===
+    for (ULONG_T i = 0; i < LinkNum; i++) {
+        IOC_closeLink(SenderLinkIDs[i]);
+        IOC_closeLink(ReceiverLinkIDs[i]);
+    }
+    IOC_offlineService(SrvID);
+}
+
+// Connect RoundNum rounds of LinkNumPerRound clients by ConnThreadNum threads, accept and close each round,
+//  then return accepted connections per second, or 0 if any client failed to connect or be accepted.
+static double _PerfTCPRunConnectStorm(ULONG_T ListenerNum, uint16_t Port) {
+    const ULONG_T ConnThreadNum = 4, LinkNumPerRound = 200, RoundNum = 5;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_TCP;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "UT_ServicePerformanceTCP_US2_TC2_1";
+    SrvArgs.SrvURI.Port = Port;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatReceiver;
+    SrvArgs.ListenerNum = ListenerNum;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    if (IOC_onlineService(&SrvID, &SrvArgs) != IOC_RESULT_SUCCESS) return 0;
+
+    IOC_Option_defineTimeout(AcceptOption, 5000000);
+    std::vector<IOC_LinkID_T> SenderLinkIDs(LinkNumPerRound), ReceiverLinkIDs(LinkNumPerRound);
+    ULONG_T AcceptedNum = 0;
+    std::atomic<ULONG_T> ConnectedNum{0};
+
+    double WallSec = _PerfTCPGetWallSec();
+    for (ULONG_T Round = 0; Round < RoundNum; Round++) {
+        std::fill(SenderLinkIDs.begin(), SenderLinkIDs.end(), IOC_ID_INVALID);
+        std::fill(ReceiverLinkIDs.begin(), ReceiverLinkIDs.end(), IOC_ID_INVALID);
+
+        std::vector<std::thread> ConnThreads;
+        for (ULONG_T t = 0; t < ConnThreadNum; t++) {
+            ConnThreads.emplace_back([&, t] {
+                IOC_ConnArgs_T ConnArgs = {};
+                IOC_Helper_initConnArgs(&ConnArgs);
+                ConnArgs.SrvURI = SrvArgs.SrvURI;
+                ConnArgs.Usage = IOC_LinkUsageDatSender;
+                for (ULONG_T i = t; i < LinkNumPerRound; i += ConnThreadNum) {
+                    if (IOC_connectService(&SenderLinkIDs[i], &ConnArgs, NULL) == IOC_RESULT_SUCCESS) ConnectedNum++;
+                }
+            });
+        }
+        for (ULONG_T i = 0; i < LinkNumPerRound; i++) {
+            if (IOC_acceptClient(SrvID, &ReceiverLinkIDs[i], &AcceptOption) == IOC_RESULT_SUCCESS) AcceptedNum++;
+        }
+        for (auto &ConnThread : ConnThreads) ConnThread.join();
+
+        for (ULONG_T i = 0; i < LinkNumPerRound; i++) {
+            if (SenderLinkIDs[i] != IOC_ID_INVALID) IOC_closeLink(SenderLinkIDs[i]);
+            if (ReceiverLinkIDs[i] != IOC_ID_INVALID) IOC_closeLink(ReceiverLinkIDs[i]);
+        }
+    }
+    WallSec = _PerfTCPGetWallSec() - WallSec;
+    IOC_offlineService(SrvID);
+
+    ULONG_T LinkNum = LinkNumPerRound * RoundNum;
+    printf("├─ ListenerNum=%lu: %lu/%lu connected, %lu/%lu accepted, wall %.1f ms, %.0f conns/s\n", ListenerNum,
+           ConnectedNum.load(), LinkNum, AcceptedNum, LinkNum, WallSec * 1000, AcceptedNum / WallSec);
+    return (ConnectedNum == LinkNum && AcceptedNum == LinkNum) ? AcceptedNum / WallSec : 0;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPConnectStorm_byOneOrFourListeners_expectAllAccepted) {
+    //===SETUP===
+    printf("📊 [TCP CONNECT STORM] %u CPU core(s)\n", std::thread::hardware_concurrency());
+
+    //===BEHAVIOR===
+    double OneListenerConnPerSec = _PerfTCPRunConnectStorm(1, 19113);
+    double FourListenersConnPerSec = _PerfTCPRunConnectStorm(4, 19113);
+
+    //===VERIFY===
+    ASSERT_GT(OneListenerConnPerSec, 0);  // KeyVerifyPoint: every client is accepted by either ListenerNum
+    ASSERT_GT(FourListenersConnPerSec, 0);
+    printf("└─ 4 listeners vs 1: x%.2f\n", FourListenersConnPerSec / OneListenerConnPerSec);
+
+    //===CLEANUP===
+}
+
+typedef struct {
+    std::atomic<ULONG_T> RecvNum{0};
+    std::atomic<bool> IsInOrder{true};
+} _PerfTCPSmallMsgPriv_T;
+
+static IOC_Result_T _PerfTCPCbProcEvt_F(IOC_EvtDesc_pT pEvtDesc, void *pCbPriv) {
+    _PerfTCPSmallMsgPriv_T *pPriv = (_PerfTCPSmallMsgPriv_T *)pCbPriv;
+    if (pEvtDesc->EvtValue != pPriv->RecvNum) pPriv->IsInOrder = false;
+    pPriv->RecvNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+static IOC_Result_T _PerfTCPCbRecvSmallDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _PerfTCPSmallMsgPriv_T *pPriv = (_PerfTCPSmallMsgPriv_T *)pCbPriv;
+    if (*(ULONG_T *)pDatDesc->Payload.pData != pPriv->RecvNum) pPriv->IsInOrder = false;
+    pPriv->RecvNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+// Send MsgNum ASYNC events or 64B chunks from a service's link to its client, with Coalesce.MaxDelayUS,
+//  then return messages received in order per second, or 0 if any is lost or out of order.
+static double _PerfTCPRunSmallMsgs(bool IsEvt, ULONG_T MaxDelayUS, uint16_t Port) {
+    const ULONG_T MsgNum = 100000;
+    _PerfTCPSmallMsgPriv_T Priv;
+
+    IOC_EvtUsageArgs_T EvtUsageArgs = {};
+    IOC_DatUsageArgs_T SenderDatUsageArgs = {}, ReceiverDatUsageArgs = {};
+    EvtUsageArgs.Coalesce.MaxDelayUS = MaxDelayUS;
+    SenderDatUsageArgs.Coalesce.MaxDelayUS = MaxDelayUS;
+    ReceiverDatUsageArgs.CbRecvDat_F = _PerfTCPCbRecvSmallDat_F;
+    ReceiverDatUsageArgs.pCbPrivData = &Priv;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_TCP;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "UT_ServicePerformanceTCP_US3_TC3_1";
+    SrvArgs.SrvURI.Port = Port;
+    SrvArgs.UsageCapabilites = IsEvt ? IOC_LinkUsageEvtProducer : IOC_LinkUsageDatSender;
+    if (IsEvt) {
+        SrvArgs.UsageArgs.pEvt = &EvtUsageArgs;
+    } else {
+        SrvArgs.UsageArgs.pDat = &SenderDatUsageArgs;
+    }
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    if (IOC_onlineService(&SrvID, &SrvArgs) != IOC_RESULT_SUCCESS) return 0;
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID, CliLinkID = IOC_ID_INVALID;
+    std::thread ConnThread([&] {
+        IOC_ConnArgs_T ConnArgs = {};
+        IOC_Helper_initConnArgs(&ConnArgs);
+        ConnArgs.SrvURI = SrvArgs.SrvURI;
+        ConnArgs.Usage = IsEvt ? IOC_LinkUsageEvtConsumer : IOC_LinkUsageDatReceiver;
+        ConnArgs.UsageArgs.pDat = IsEvt ? NULL : &ReceiverDatUsageArgs;
+        IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+    });
+    IOC_acceptClient(SrvID, &SrvLinkID, NULL);
+    ConnThread.join();
+
+    IOC_EvtID_T EvtIDs[] = {IOC_EVTID_TEST_KEEPALIVE};
+    IOC_SubEvtArgs_T SubEvtArgs = {};
+    SubEvtArgs.CbProcEvt_F = _PerfTCPCbProcEvt_F;
+    SubEvtArgs.pCbPrivData = &Priv;
+    SubEvtArgs.EvtNum = IOC_calcArrayElmtCnt(EvtIDs);
+    SubEvtArgs.pEvtIDs = EvtIDs;
+    if (IsEvt && CliLinkID != IOC_ID_INVALID) {
+        IOC_subEVT(CliLinkID, &SubEvtArgs);
+        usleep(100000);  // Till the producer gets the subscription
+    }
+
+    IOC_EvtDesc_T EvtDesc = {};
+    EvtDesc.EvtID = IOC_EVTID_TEST_KEEPALIVE;
+    char Chunk[64] = {};
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = Chunk;
+    DatDesc.Payload.PtrDataSize = sizeof(Chunk);
+    DatDesc.Payload.PtrDataLen = sizeof(Chunk);
+
+    double WallSec = _PerfTCPGetWallSec();
+    ULONG_T SentNum = 0;
+    for (; SentNum < MsgNum; SentNum++) {
+        IOC_Result_T Result;
+        if (IsEvt) {
+            EvtDesc.EvtValue = SentNum;
+            Result = IOC_postEVT(SrvLinkID, &EvtDesc, NULL);
+        } else {
+            *(ULONG_T *)Chunk = SentNum;
+            Result = IOC_sendDAT(SrvLinkID, &DatDesc, NULL);
+        }
+        if (Result != IOC_RESULT_SUCCESS) break;
+    }
+    if (!IsEvt) IOC_flushDAT(SrvLinkID, NULL);
+    for (int i = 0; i < 10000 && Priv.RecvNum < SentNum; i++) usleep(1000);
+    WallSec = _PerfTCPGetWallSec() - WallSec;
+
+    printf("├─ %s, MaxDelayUS=%lu: %lu/%lu received%s, wall %.1f ms, %.0f msgs/s\n", IsEvt ? "EVT" : "DAT",
+           MaxDelayUS, Priv.RecvNum.load(), MsgNum, Priv.IsInOrder ? "" : " OUT OF ORDER", WallSec * 1000,
+           Priv.RecvNum / WallSec);
+
+    if (IsEvt && CliLinkID != IOC_ID_INVALID) {
+        IOC_UnsubEvtArgs_T UnsubEvtArgs = {.CbProcEvt_F = _PerfTCPCbProcEvt_F, .pCbPrivData = &Priv};
+        IOC_unsubEVT(CliLinkID, &UnsubEvtArgs);
+    }
+    if (SrvLinkID != IOC_ID_INVALID) IOC_closeLink(SrvLinkID);
+    if (CliLinkID != IOC_ID_INVALID) IOC_closeLink(CliLinkID);
+    IOC_offlineService(SrvID);
+    return (Priv.RecvNum == MsgNum && Priv.IsInOrder) ? MsgNum / WallSec : 0;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPSmallMsgThroughput_by64BEvtAndDat_expectAllReceivedInOrder) {
+    //===SETUP===
+    printf("📊 [TCP SMALL MSG THROUGHPUT] %zuB events, 64B data\n", sizeof(IOC_EvtDesc_T));
+
+    //===BEHAVIOR===
+    double EvtMsgPerSec = _PerfTCPRunSmallMsgs(true, 0, 19114);
+    double CoalescedEvtMsgPerSec = _PerfTCPRunSmallMsgs(true, 1000, 19114);
+    double DatMsgPerSec = _PerfTCPRunSmallMsgs(false, 0, 19114);
+    double CoalescedDatMsgPerSec = _PerfTCPRunSmallMsgs(false, 1000, 19114);
+
+    //===VERIFY===
+    ASSERT_GT(EvtMsgPerSec, 0);  // KeyVerifyPoint: every message is received in order, coalesced or not
+    ASSERT_GT(CoalescedEvtMsgPerSec, 0);
+    ASSERT_GT(DatMsgPerSec, 0);
+    ASSERT_GT(CoalescedDatMsgPerSec, 0);
+    printf("└─ Coalesced vs at once: EVT x%.2f, DAT x%.2f\n", CoalescedEvtMsgPerSec / EvtMsgPerSec,
+           CoalescedDatMsgPerSec / DatMsgPerSec);
+
+    //===CLEANUP===
+}
+
+// Chunk sizes cycled by _PerfTCPRunMixedDat, around TCP's in-place limit of 16KB and read buffer of 64KB
+static const ULONG_T _PerfTCPMixedSizes[] = {1, 7, 64, 1000, 4096, 16384, 16385, 65536, 200000};
+#define _PERF_TCP_MIXED_SIZE_NUM IOC_calcArrayElmtCnt(_PerfTCPMixedSizes)
+
+typedef struct {
+    std::atomic<ULONG_T> RecvNum{0};     // Chunks received by CbRecvDat_F
+    std::atomic<ULONG_T> RecvBytes{0};   // Bytes received by either way
+    std::atomic<bool> IsIntact{true};
+    ULONG_T StreamChunkIdx = 0, StreamOffset = 0;  // Where IOC_recvDAT is in the stream of chunks
+} _PerfTCPMixedDatPriv_T;
+
+// Byte at Offset of the ChunkIdx-th chunk
+static inline uint8_t _PerfTCPMixedByte(ULONG_T ChunkIdx, ULONG_T Offset) {
+    return (uint8_t)(ChunkIdx * 131 + Offset);
+}
+
+static IOC_Result_T _PerfTCPCbRecvMixedDat_F(IOC_LinkID_T LinkID, IOC_DatDesc_pT pDatDesc, void *pCbPriv) {
+    _PerfTCPMixedDatPriv_T *pPriv = (_PerfTCPMixedDatPriv_T *)pCbPriv;
+    ULONG_T ChunkIdx = pPriv->RecvNum;
+    const uint8_t *pData = (const uint8_t *)pDatDesc->Payload.pData;
+    bool IsIntact = (pDatDesc->Payload.PtrDataLen == _PerfTCPMixedSizes[ChunkIdx % _PERF_TCP_MIXED_SIZE_NUM]);
+    for (ULONG_T i = 0; IsIntact && i < pDatDesc->Payload.PtrDataLen; i++) {
+        IsIntact = (pData[i] == _PerfTCPMixedByte(ChunkIdx, i));
+    }
+    if (!IsIntact) pPriv->IsIntact = false;
+    pPriv->RecvBytes += pDatDesc->Payload.PtrDataLen;
+    pPriv->RecvNum++;
+    return IOC_RESULT_SUCCESS;
+}
+
+// Check Size bytes received by IOC_recvDAT continue the stream of chunks
+static void _PerfTCPCheckMixedStream(_PerfTCPMixedDatPriv_T *pPriv, const uint8_t *pData, ULONG_T Size) {
+    for (ULONG_T i = 0; i < Size; i++) {
+        if (pData[i] != _PerfTCPMixedByte(pPriv->StreamChunkIdx, pPriv->StreamOffset)) pPriv->IsIntact = false;
+        if (++pPriv->StreamOffset == _PerfTCPMixedSizes[pPriv->StreamChunkIdx % _PERF_TCP_MIXED_SIZE_NUM]) {
+            pPriv->StreamChunkIdx++;
+            pPriv->StreamOffset = 0;
+        }
+    }
+    pPriv->RecvBytes += Size;
+}
+
+// Send RoundNum rounds of _PerfTCPMixedSizes chunks from a service's DatSender link with Coalesce.MaxDelayUS
+//  to its client DatReceiver by CbRecvDat_F or IOC_recvDAT, then return MB received intact per second, or 0.
+static double _PerfTCPRunMixedDat(bool IsPolling, ULONG_T MaxDelayUS, uint16_t Port) {
+    const ULONG_T RoundNum = 200;
+    _PerfTCPMixedDatPriv_T Priv;
+
+    ULONG_T ChunkNum = RoundNum * _PERF_TCP_MIXED_SIZE_NUM, TotalBytes = 0;
+    for (ULONG_T i = 0; i < _PERF_TCP_MIXED_SIZE_NUM; i++) TotalBytes += RoundNum * _PerfTCPMixedSizes[i];
+
+    IOC_DatUsageArgs_T SenderDatUsageArgs = {}, ReceiverDatUsageArgs = {};
+    SenderDatUsageArgs.Coalesce.MaxDelayUS = MaxDelayUS;
+    ReceiverDatUsageArgs.CbRecvDat_F = IsPolling ? NULL : _PerfTCPCbRecvMixedDat_F;
+    ReceiverDatUsageArgs.pCbPrivData = &Priv;
+    ReceiverDatUsageArgs.PollingBufSize = 1024 * 1024;  // Fits several of the largest chunks
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_TCP;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "UT_ServicePerformanceTCP_US4_TC4_1";
+    SrvArgs.SrvURI.Port = Port;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageDatSender;
+    SrvArgs.UsageArgs.pDat = &SenderDatUsageArgs;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    if (IOC_onlineService(&SrvID, &SrvArgs) != IOC_RESULT_SUCCESS) return 0;
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID, CliLinkID = IOC_ID_INVALID;
+    std::thread ConnThread([&] {
+        IOC_ConnArgs_T ConnArgs = {};
+        IOC_Helper_initConnArgs(&ConnArgs);
+        ConnArgs.SrvURI = SrvArgs.SrvURI;
+        ConnArgs.Usage = IOC_LinkUsageDatReceiver;
+        ConnArgs.UsageArgs.pDat = &ReceiverDatUsageArgs;
+        IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+    });
+    IOC_acceptClient(SrvID, &SrvLinkID, NULL);
+    ConnThread.join();
+
+    std::thread PollThread;
+    if (IsPolling && CliLinkID != IOC_ID_INVALID) {
+        PollThread = std::thread([&] {
+            std::vector<uint8_t> RecvBuf(256 * 1024);
+            while (Priv.RecvBytes < TotalBytes) {
+                IOC_DatDesc_T RecvDesc = {};
+                IOC_initDatDesc(&RecvDesc);
+                RecvDesc.Payload.pData = RecvBuf.data();
+                RecvDesc.Payload.PtrDataSize = RecvBuf.size();
+                IOC_Option_defineSyncTimeout(TimeoutOpts, 1000000);
+                if (IOC_recvDAT(CliLinkID, &RecvDesc, &TimeoutOpts) != IOC_RESULT_SUCCESS) break;
+                _PerfTCPCheckMixedStream(&Priv, RecvBuf.data(), RecvDesc.Payload.PtrDataLen);
+            }
+        });
+    }
+
+    std::vector<uint8_t> Chunk(_PerfTCPMixedSizes[_PERF_TCP_MIXED_SIZE_NUM - 1]);
+    IOC_DatDesc_T DatDesc = {};
+    IOC_initDatDesc(&DatDesc);
+    DatDesc.Payload.pData = Chunk.data();
+    IOC_Option_defineTimeout(SendOpts, IOC_TIMEOUT_INFINITE);  // Wait for credits of IOC_recvDAT too
+
+    double WallSec = _PerfTCPGetWallSec();
+    for (ULONG_T ChunkIdx = 0; ChunkIdx < ChunkNum; ChunkIdx++) {
+        ULONG_T ChunkSize = _PerfTCPMixedSizes[ChunkIdx % _PERF_TCP_MIXED_SIZE_NUM];
+        for (ULONG_T i = 0; i < ChunkSize; i++) Chunk[i] = _PerfTCPMixedByte(ChunkIdx, i);
+        DatDesc.Payload.PtrDataSize = ChunkSize;
+        DatDesc.Payload.PtrDataLen = ChunkSize;
+        if (IOC_sendDAT(SrvLinkID, &DatDesc, &SendOpts) != IOC_RESULT_SUCCESS) break;
+    }
+    IOC_flushDAT(SrvLinkID, NULL);
+    for (int i = 0; i < 10000 && Priv.RecvBytes < TotalBytes; i++) usleep(1000);
+    WallSec = _PerfTCPGetWallSec() - WallSec;
+    if (PollThread.joinable()) PollThread.join();
+
+    printf("├─ %s, MaxDelayUS=%lu: %lu/%lu bytes received%s, wall %.1f ms, %.1f MB/s\n",
+           IsPolling ? "IOC_recvDAT" : "CbRecvDat_F", MaxDelayUS, Priv.RecvBytes.load(), TotalBytes,
+           Priv.IsIntact ? "" : " NOT INTACT", WallSec * 1000, Priv.RecvBytes / WallSec / 1e6);
+
+    if (SrvLinkID != IOC_ID_INVALID) IOC_closeLink(SrvLinkID);
+    if (CliLinkID != IOC_ID_INVALID) IOC_closeLink(CliLinkID);
+    IOC_offlineService(SrvID);
+    bool IsAllRecvd = (Priv.RecvBytes == TotalBytes) && (IsPolling || Priv.RecvNum == ChunkNum);
+    return (IsAllRecvd && Priv.IsIntact) ? TotalBytes / WallSec / 1e6 : 0;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPRecvMixedSizes_byChunksFrom1BTo200KB_expectAllIntactInOrder) {
+    //===SETUP===
+    printf("📊 [TCP MIXED SIZE RECEIVING] chunks cycling 1B..200KB\n");
+
+    //===BEHAVIOR===
+    double CbMBPerSec = _PerfTCPRunMixedDat(false, 0, 19115);
+    double CoalescedCbMBPerSec = _PerfTCPRunMixedDat(false, 1000, 19115);
+    double PollMBPerSec = _PerfTCPRunMixedDat(true, 0, 19115);
+    double CoalescedPollMBPerSec = _PerfTCPRunMixedDat(true, 1000, 19115);
+
+    //===VERIFY===
+    ASSERT_GT(CbMBPerSec, 0);  // KeyVerifyPoint: every chunk is received intact in order, in place or not
+    ASSERT_GT(CoalescedCbMBPerSec, 0);
+    ASSERT_GT(PollMBPerSec, 0);  // KeyVerifyPoint: so is the stream received by IOC_recvDAT
+    ASSERT_GT(CoalescedPollMBPerSec, 0);
+
+    //===CLEANUP===
+}
+
+static bool _PerfTCPIsEvtEqual(const IOC_EvtDesc_T *pA, const IOC_EvtDesc_T *pB) {
+    return pA->MsgDesc.SeqID == pB->MsgDesc.SeqID && pA->MsgDesc.TimeStamp.tv_sec == pB->MsgDesc.TimeStamp.tv_sec &&
+           pA->MsgDesc.TimeStamp.tv_nsec == pB->MsgDesc.TimeStamp.tv_nsec && pA->EvtID == pB->EvtID &&
+           pA->EvtValue == pB->EvtValue && pA->Priority == pB->Priority;
+}
+
+static bool _PerfTCPIsCmdPayloadEqual(const IOC_CmdPayload_T *pA, const IOC_CmdPayload_T *pB) {
+    return pA->EmdDataSize == pB->EmdDataSize && 0 == memcmp(pA->EmdData, pB->EmdData, pA->EmdDataSize) &&
+           NULL == pB->pData && 0 == pB->PtrDataSize && 0 == pB->PtrDataLen;
+}
+
+static bool _PerfTCPIsCmdEqual(const IOC_CmdDesc_T *pA, const IOC_CmdDesc_T *pB) {
+    return pA->MsgDesc.SeqID == pB->MsgDesc.SeqID && pA->MsgDesc.TimeStamp.tv_sec == pB->MsgDesc.TimeStamp.tv_sec &&
+           pA->MsgDesc.TimeStamp.tv_nsec == pB->MsgDesc.TimeStamp.tv_nsec && pA->CmdID == pB->CmdID &&
+           pA->Status == pB->Status && pA->Result == pB->Result && pA->TimeoutMs == pB->TimeoutMs &&
+           _PerfTCPIsCmdPayloadEqual(&pA->InPayload, &pB->InPayload) &&
+           _PerfTCPIsCmdPayloadEqual(&pA->OutPayload, &pB->OutPayload) && NULL == pB->pExecContext;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPWireCodec_byEvtAndCmdRoundTrips_expectCompactAndEqual) {
+    //===SETUP===
+    const ULONG_T RoundNum = 1000000;
+    struct timespec Now;
+    clock_gettime(CLOCK_REALTIME, &Now);
+
+    IOC_EvtDesc_T TypicalEvt = {};
+    TypicalEvt.MsgDesc.SeqID = 12345;
+    TypicalEvt.MsgDesc.TimeStamp = Now;
+    TypicalEvt.EvtID = IOC_EVTID_TEST_KEEPALIVE;
+    TypicalEvt.EvtValue = 42;
+    TypicalEvt.Priority = IOC_EVT_PRIORITY_NORMAL;
+
+    IOC_EvtDesc_T ExtremeEvt = {};
+    ExtremeEvt.MsgDesc.SeqID = ULONG_MAX;
+    ExtremeEvt.MsgDesc.TimeStamp.tv_sec = -1;
+    ExtremeEvt.MsgDesc.TimeStamp.tv_nsec = 999999999;
+    ExtremeEvt.EvtID = UINT64_MAX;
+    ExtremeEvt.EvtValue = ULONG_MAX;
+    ExtremeEvt.Priority = IOC_EVT_PRIORITY_HIGH;
+
+    IOC_CMDDESC_DECLARE_VAR(TypicalCmd);
+    TypicalCmd.MsgDesc.SeqID = 12345;
+    TypicalCmd.MsgDesc.TimeStamp = Now;
+    TypicalCmd.CmdID = IOC_CMDID_TEST_ECHO;
+    TypicalCmd.Status = IOC_CMD_STATUS_PENDING;
+    TypicalCmd.TimeoutMs = 5000;
+    IOC_CmdDesc_setInPayload(&TypicalCmd, (void *)"Hello", 5);
+
+    uint8_t FullEmdData[sizeof(TypicalCmd.OutPayload.EmdData)];
+    for (ULONG_T i = 0; i < sizeof(FullEmdData); i++) FullEmdData[i] = (uint8_t)(i * 7 + 1);
+    IOC_CMDDESC_DECLARE_VAR(ExtremeCmd);
+    ExtremeCmd.MsgDesc.SeqID = ULONG_MAX;
+    ExtremeCmd.MsgDesc.TimeStamp.tv_sec = -1;
+    ExtremeCmd.CmdID = UINT64_MAX;
+    ExtremeCmd.Status = IOC_CMD_STATUS_FAILED;
+    ExtremeCmd.Result = IOC_RESULT_LINK_BROKEN;
+    ExtremeCmd.TimeoutMs = ULONG_MAX;
+    IOC_CmdDesc_setInPayload(&ExtremeCmd, FullEmdData, sizeof(FullEmdData));
+    IOC_CmdDesc_setOutPayload(&ExtremeCmd, FullEmdData, sizeof(FullEmdData));
+
+    //===BEHAVIOR===
+    uint8_t EvtWire[_IOC_TCP_WIRE_EVT_MAX_SIZE], CmdWire[_IOC_TCP_WIRE_CMD_MAX_SIZE];
+    IOC_EvtDesc_T DecodedEvt;
+    IOC_CmdDesc_T DecodedCmd;
+    ULONG_T DescSize = 0;
+    bool IsAllEqual = true;
+
+    double EvtWallSec = _PerfTCPGetWallSec();
+    for (ULONG_T Round = 0; Round < RoundNum; Round++) {
+        TypicalEvt.EvtValue = Round;  // Not optimized away, and of varints from 1 to 3 bytes
+        ULONG_T WireSize = _IOC_TCPWire_encodeEvt(&TypicalEvt, EvtWire);
+        if (_IOC_TCPWire_decodeEvt(EvtWire, WireSize, &DecodedEvt) != IOC_RESULT_SUCCESS ||
+            !_PerfTCPIsEvtEqual(&TypicalEvt, &DecodedEvt)) {
+            IsAllEqual = false;
+        }
+    }
+    EvtWallSec = _PerfTCPGetWallSec() - EvtWallSec;
+
+    double CmdWallSec = _PerfTCPGetWallSec();
+    for (ULONG_T Round = 0; Round < RoundNum; Round++) {
+        TypicalCmd.MsgDesc.SeqID = Round;
+        ULONG_T WireSize = _IOC_TCPWire_encodeCmd(&TypicalCmd, CmdWire);
+        if (_IOC_TCPWire_decodeCmd(CmdWire, WireSize, &DecodedCmd, &DescSize) != IOC_RESULT_SUCCESS ||
+            !_PerfTCPIsCmdEqual(&TypicalCmd, &DecodedCmd)) {
+            IsAllEqual = false;
+        }
+    }
+    CmdWallSec = _PerfTCPGetWallSec() - CmdWallSec;
+
+    TypicalEvt.EvtValue = 42;
+    TypicalCmd.MsgDesc.SeqID = 12345;
+    ULONG_T TypicalEvtSize = _IOC_TCPWire_encodeEvt(&TypicalEvt, EvtWire);
+    ULONG_T TypicalCmdSize = _IOC_TCPWire_encodeCmd(&TypicalCmd, CmdWire);
+    ULONG_T ExtremeEvtSize = _IOC_TCPWire_encodeEvt(&ExtremeEvt, EvtWire);
+    IOC_Result_T ExtremeEvtResult = _IOC_TCPWire_decodeEvt(EvtWire, ExtremeEvtSize, &DecodedEvt);
+    ULONG_T ExtremeCmdSize = _IOC_TCPWire_encodeCmd(&ExtremeCmd, CmdWire);
+    IOC_Result_T ExtremeCmdResult = _IOC_TCPWire_decodeCmd(CmdWire, ExtremeCmdSize, &DecodedCmd, &DescSize);
+
+    printf("📊 [TCP WIRE CODEC] %lu round trips each\n", RoundNum);
+    printf("├─ EVT: %zuB raw, %luB typical, %luB extreme, %.1f ns/round trip\n", sizeof(IOC_EvtDesc_T),
+           TypicalEvtSize, ExtremeEvtSize, EvtWallSec * 1e9 / RoundNum);
+    printf("└─ CMD: %zuB raw, %luB typical, %luB extreme, %.1f ns/round trip\n", sizeof(IOC_CmdDesc_T),
+           TypicalCmdSize, ExtremeCmdSize, CmdWallSec * 1e9 / RoundNum);
+
+    //===VERIFY===
+    ASSERT_TRUE(IsAllEqual);  // KeyVerifyPoint: every round trip decodes what was encoded
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ExtremeEvtResult);
+    ASSERT_TRUE(_PerfTCPIsEvtEqual(&ExtremeEvt, &DecodedEvt));
+    ASSERT_EQ(IOC_RESULT_SUCCESS, ExtremeCmdResult);
+    ASSERT_TRUE(_PerfTCPIsCmdEqual(&ExtremeCmd, &DecodedCmd));
+    ASSERT_EQ(ExtremeCmdSize, DescSize);
+
+    ASSERT_LE(TypicalEvtSize, 24UL);  // KeyVerifyPoint: a typical event takes a fraction of its raw size
+    ASSERT_LE(ExtremeEvtSize, (ULONG_T)_IOC_TCP_WIRE_EVT_MAX_SIZE);
+    ASSERT_LT(TypicalCmdSize, sizeof(IOC_CmdDesc_T) / 4);
+
+    // KeyVerifyPoint: an unknown version, or a truncated descriptor, is never misread
+    EvtWire[0] = _IOC_TCP_WIRE_VERSION + 1;
+    ASSERT_EQ(IOC_RESULT_NOT_SUPPORT, _IOC_TCPWire_decodeEvt(EvtWire, ExtremeEvtSize, &DecodedEvt));
+    ASSERT_EQ(IOC_RESULT_INVALID_PARAM, _IOC_TCPWire_decodeEvt(EvtWire, 0, &DecodedEvt));
+    for (ULONG_T Size = 1; Size < ExtremeCmdSize; Size++) {
+        ASSERT_EQ(IOC_RESULT_INVALID_PARAM, _IOC_TCPWire_decodeCmd(CmdWire, Size, &DecodedCmd, &DescSize))
+            << "Size=" << Size;
+    }
+
+    //===CLEANUP===
+}
+
+static IOC_Result_T _PerfTCPCbExecEchoCmd_F(IOC_LinkID_T LinkID, IOC_CmdDesc_pT pCmdDesc, void *pCbPriv) {
+    IOC_CmdDesc_setOutPayload(pCmdDesc, IOC_CmdDesc_getInData(pCmdDesc), IOC_CmdDesc_getInDataLen(pCmdDesc));
+    return (pCmdDesc->CmdID == IOC_CMDID_TEST_ECHO) ? IOC_RESULT_SUCCESS : IOC_RESULT_NOT_SUPPORT;
+}
+
+TEST(UT_ServicePerformanceTCP, verifyTCPWireCmd_byEchoOfPayloadsFrom0BTo64KB_expectIntact) {
+    //===SETUP===
+    const ULONG_T PayloadSizes[] = {0, 1, 64, 65, 1000, 16384, 65536};
+
+    IOC_CmdID_T CmdIDs[] = {IOC_CMDID_TEST_ECHO, IOC_CMDID_TEST_PING};
+    IOC_CmdUsageArgs_T CmdUsageArgs = {};
+    CmdUsageArgs.CbExecCmd_F = _PerfTCPCbExecEchoCmd_F;
+    CmdUsageArgs.CmdNum = IOC_calcArrayElmtCnt(CmdIDs);
+    CmdUsageArgs.pCmdIDs = CmdIDs;
+
+    IOC_SrvArgs_T SrvArgs = {};
+    IOC_Helper_initSrvArgs(&SrvArgs);
+    SrvArgs.SrvURI.pProtocol = IOC_SRV_PROTO_TCP;
+    SrvArgs.SrvURI.pHost = IOC_SRV_HOST_LOCAL_PROCESS;
+    SrvArgs.SrvURI.pPath = "UT_ServicePerformanceTCP_US5_TC5_2";
+    SrvArgs.SrvURI.Port = 19116;
+    SrvArgs.UsageCapabilites = IOC_LinkUsageCmdExecutor;
+    SrvArgs.UsageArgs.pCmd = &CmdUsageArgs;
+
+    IOC_SrvID_T SrvID = IOC_ID_INVALID;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_onlineService(&SrvID, &SrvArgs));
+
+    IOC_LinkID_T SrvLinkID = IOC_ID_INVALID, CliLinkID = IOC_ID_INVALID;
+    std::thread ConnThread([&] {
+        IOC_ConnArgs_T ConnArgs = {};
+        IOC_Helper_initConnArgs(&ConnArgs);
+        ConnArgs.SrvURI = SrvArgs.SrvURI;
+        ConnArgs.Usage = IOC_LinkUsageCmdInitiator;
+        IOC_connectService(&CliLinkID, &ConnArgs, NULL);
+    });
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_acceptClient(SrvID, &SrvLinkID, NULL));
+    ConnThread.join();
+    ASSERT_NE(IOC_ID_INVALID, CliLinkID);
+
+    //===BEHAVIOR & VERIFY===
+    for (ULONG_T PayloadSize : PayloadSizes) {
+        std::vector<uint8_t> InData(PayloadSize + 1);
+        for (ULONG_T i = 0; i < PayloadSize; i++) InData[i] = (uint8_t)(i * 31 + PayloadSize);
+
+        IOC_CMDDESC_DECLARE_VAR(CmdDesc);
+        CmdDesc.CmdID = IOC_CMDID_TEST_ECHO;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_CmdDesc_setInPayload(&CmdDesc, InData.data(), PayloadSize));
+        ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_execCMD(CliLinkID, &CmdDesc, NULL)) << "PayloadSize=" << PayloadSize;
+
+        // KeyVerifyPoint: OUT payload echoes IN payload intact, embedded or pointer-based
+        ASSERT_EQ(IOC_CMD_STATUS_SUCCESS, CmdDesc.Status) << "PayloadSize=" << PayloadSize;
+        ASSERT_EQ(IOC_RESULT_SUCCESS, CmdDesc.Result);
+        ASSERT_EQ(PayloadSize, IOC_CmdDesc_getOutDataLen(&CmdDesc));
+        if (PayloadSize > 0) {
+            ASSERT_EQ(0, memcmp(InData.data(), IOC_CmdDesc_getOutData(&CmdDesc), PayloadSize))
+                << "PayloadSize=" << PayloadSize;
+        }
+        IOC_CmdDesc_cleanup(&CmdDesc);
+    }
+
+    // KeyVerifyPoint: so is a failure of the executor
+    IOC_CMDDESC_DECLARE_VAR(PingDesc);
+    PingDesc.CmdID = IOC_CMDID_TEST_PING;
+    ASSERT_EQ(IOC_RESULT_SUCCESS, IOC_execCMD(CliLinkID, &PingDesc, NULL));
+    ASSERT_EQ(IOC_CMD_STATUS_FAILED, PingDesc.Status);
+    ASSERT_EQ(IOC_RESULT_NOT_SUPPORT, PingDesc.Result);
+
+    //===CLEANUP===
+    IOC_closeLink(CliLinkID);
+    IOC_closeLink(SrvLinkID);
+    IOC_offlineService(SrvID);
+}
+
+//======END OF UNIT TESTING IMPLEMENTATION=========================================================